@@ -0,0 +1,67 @@
+####################################################################################################
+#                                                                                                  #
+#                                                          _|        _|                            #
+#                    _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|                        #
+#                  _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|                      #
+#                  _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|                      #
+#                    _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|                        #
+#                                                                                                  #
+#                           CxxABB - C++ Application Building Blocks                               # 
+#                                                                                                  #
+#                  Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>                      #
+#                                                                                                  #
+####################################################################################################
+
+# @version $Revision$
+# @author  $Author$
+# @date    $Date$
+# @id      $Id$
+
+## Makefile for BenchSuite - microbenchmarks
+## All sources in BENCH.SOURCE are linked with the BenchSuite runner into $(BIN.PATH)/Bench$(TARGET.NAME)
+## Run as "make runbench BENCH.ARGS='--json=out.json'", build with COMPILE.TYPE=R for meaningful numbers
+
+BCH.DIR = bench
+
+BENCHSUITE.DIR = $(SRC.PATH)/BenchSuite
+BENCHSUITE.HEADERS = $(BENCHSUITE.DIR)/include/Bench/*.h
+BENCHSUITE.SRC = $(BENCHSUITE.DIR)/src/*.cpp $(BENCHSUITE.HEADERS)
+
+BENCHSUITE.INCLUDES = -I$(BENCHSUITE.DIR)/include
+
+BENCH.SOURCES := $(addprefix $(BCH.DIR)/, $(BENCH.SOURCE))
+BENCH.OBJ := $(addprefix $(OBJ.DIR)/, $(BENCH.SOURCES))
+BENCH.OBJECTS := $(addsuffix .o, $(basename $(BENCH.OBJ)))
+BENCH.TARGET := $(BIN.PATH)/Bench$(TARGET.NAME)
+BENCH.LIBS := $(addsuffix $(TARGET.ARCH.SUFFIX), $(BENCH.LIBS))
+BENCH.LINKPATH += -L$(LIB.PATH)
+
+.PHONY: bench runbench bench_clean
+
+bench: $(TARGET) $(BENCH.TARGET)
+
+runbench: bench
+	@$(ECHO) "[INFO] Running benchmarks..."
+	@$(BENCH.TARGET) $(BENCH.ARGS)
+
+$(BENCH.TARGET): $(BENCH.OBJECTS) $(OBJ.DIR)/$(BCH.DIR)/bench_main.a $(TARGET)
+	$(CXX) $(CXXFLAGS) $(BENCH.LINKPATH) $(BENCH.OBJECTS) $(OBJ.DIR)/$(BCH.DIR)/bench_main.a -o $@ $(BENCH.LIBS) -lpthread
+
+$(OBJ.DIR)/$(BCH.DIR)/%.o: $(BCH.DIR)/%.cpp $(BENCHSUITE.HEADERS)
+	$(TESTDIR) $(dir $@) || $(MKDIR) $(dir $@)
+	$(CXX) $(CXXFLAGS) $(BENCHSUITE.INCLUDES) -o $@ -c $<
+
+$(OBJ.DIR)/$(BCH.DIR)/Bench.o : $(BENCHSUITE.SRC)
+	$(TESTDIR) $(dir $@) || $(MKDIR) $(dir $@)
+	$(CXX) $(CXXFLAGS) $(BENCHSUITE.INCLUDES) -c $(BENCHSUITE.DIR)/src/Bench.cpp -o $@
+
+$(OBJ.DIR)/$(BCH.DIR)/BenchMain.o : $(BENCHSUITE.SRC)
+	$(TESTDIR) $(dir $@) || $(MKDIR) $(dir $@)
+	$(CXX) $(CXXFLAGS) $(BENCHSUITE.INCLUDES) -c $(BENCHSUITE.DIR)/src/BenchMain.cpp -o $@
+
+$(OBJ.DIR)/$(BCH.DIR)/bench_main.a : $(OBJ.DIR)/$(BCH.DIR)/Bench.o $(OBJ.DIR)/$(BCH.DIR)/BenchMain.o
+	$(AR) $(ARFLAGS) $@ $^
+
+bench_clean:
+	-@$(RM) -f $(BENCH.TARGET) $(BENCH.OBJECTS) $(OBJ.DIR)/$(BCH.DIR)/Bench.o \
+	$(OBJ.DIR)/$(BCH.DIR)/BenchMain.o $(OBJ.DIR)/$(BCH.DIR)/bench_main.a
@@ -162,6 +162,8 @@ endif
 -include $(BLD.PATH)/TestSuite.mk
 #endif
 
+-include $(BLD.PATH)/BenchSuite.mk
+
 #Don't create dependencies when we're cleaning, for instance
 ifeq (0, $(words $(findstring $(MAKECMDGOALS), $(NODEPS))))
 
@@ -187,7 +189,7 @@ $(OBJ.DIR)/$(SRC.DIR)/%.o: $(SRC.DIR)/%.cpp
 #.cpp:
 #	$(CXX) $(CXXFLAGS) $< -o $@ $(LINKPATH) $(LIBS)
 
-clean: test_clean
+clean: test_clean bench_clean
 	-@$(RM) -f $(OBJECTS) $(DEPFILES) $(TEST.DEPFILES) $(TARGET)
 	
 
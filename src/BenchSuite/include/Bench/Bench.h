@@ -0,0 +1,412 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Bench.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : BenchSuite
+ * Module      : Benchmark
+ * Comment     : Microbenchmark registration, timing state and runner
+ *
+ */
+
+#ifndef CXXABB_BENCH_BENCH_H_
+#define CXXABB_BENCH_BENCH_H_
+
+#include <CxxAbb/Types.h>
+
+#include <string>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Bench
+{
+
+/** @brief Force the compiler to materialise _value, so the work producing it is not optimised away */
+template<class T>
+inline void DoNotOptimize(const T & _value)
+{
+	__asm__ __volatile__("" : : "r"(&_value) : "memory");
+}
+
+/** @brief Force pending writes to memory to be considered visible */
+inline void ClobberMemory()
+{
+	__asm__ __volatile__("" : : : "memory");
+}
+
+/** @brief Per run context handed to Benchmark::Run()
+ *
+ * The body must execute its operation Iterations() times. The clock is running
+ * while Run() executes, use PauseTiming()/ResumeTiming() around per run setup
+ * that should not be measured.
+ *
+ * Threaded benchmarks get one State per thread, each thread runs Iterations()
+ * operations. Their time is the wall time from the first thread starting to the
+ * last one finishing, PauseTiming() is not subtracted from it.
+ */
+class State
+{
+public:
+	enum
+	{
+		LatencySampleMask = 63,      /// LatencyProbe times one in 64 iterations
+		MaxLatencySamples = 1 << 16  /// per State and run
+	};
+
+	State(UInt64 _uiIterations, long _lArg, int _iThreads = 1, int _iThreadIndex = 0);
+
+	UInt64 Iterations() const
+	{
+		return ui_Iterations;
+	}
+
+	/** @brief Argument the benchmark was registered with, 0 if none */
+	long Arg() const
+	{
+		return l_Arg;
+	}
+
+	/** @brief Number of threads running this benchmark concurrently */
+	int Threads() const
+	{
+		return i_Threads;
+	}
+
+	/** @brief Index of the calling thread in [0, Threads()) */
+	int ThreadIndex() const
+	{
+		return i_ThreadIndex;
+	}
+
+	void PauseTiming();
+	void ResumeTiming();
+
+	/** @brief Items (or bytes) handled by the whole run, reported as a rate */
+	void SetItemsProcessed(UInt64 _uiItems)
+	{
+		ui_Items = _uiItems;
+	}
+
+	void SetBytesProcessed(UInt64 _uiBytes)
+	{
+		ui_Bytes = _uiBytes;
+	}
+
+	/** @brief Record the latency of one operation, see LatencyProbe */
+	void AddLatency(UInt64 _uiNs)
+	{
+		if (lst_Latencies.size() < static_cast<std::size_t>(MaxLatencySamples))
+			lst_Latencies.push_back(_uiNs);
+	}
+
+	/** @brief Used by the Runner */
+	void StartTiming();
+	void StopTiming();
+
+	UInt64 ElapsedNs() const
+	{
+		return ui_ElapsedNs;
+	}
+
+	/** @brief Clock at StartTiming() and StopTiming() */
+	UInt64 BeginNs() const
+	{
+		return ui_Begin;
+	}
+
+	UInt64 EndNs() const
+	{
+		return ui_End;
+	}
+
+	UInt64 ItemsProcessed() const
+	{
+		return ui_Items;
+	}
+
+	UInt64 BytesProcessed() const
+	{
+		return ui_Bytes;
+	}
+
+	const std::vector<UInt64> & Latencies() const
+	{
+		return lst_Latencies;
+	}
+
+	/** @brief Monotonic clock in nanoseconds */
+	static UInt64 Now();
+
+private:
+	UInt64 ui_Iterations;
+	long l_Arg;
+	int i_Threads;
+	int i_ThreadIndex;
+	UInt64 ui_Start;
+	UInt64 ui_Begin;
+	UInt64 ui_End;
+	UInt64 ui_ElapsedNs;
+	UInt64 ui_Items;
+	UInt64 ui_Bytes;
+	bool b_Running;
+	std::vector<UInt64> lst_Latencies;
+};
+
+/** @brief Times the enclosing scope for iteration _uiIteration if it is sampled
+ *
+ * Sampling keeps the clock reads off most iterations, the recorded latencies
+ * are reported as p50/p99/p99.9 next to the throughput.
+ * @code
+ * for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+ * {
+ *     CxxAbb::Bench::LatencyProbe probe(state, i);
+ *     ...
+ * }
+ * @endcode
+ */
+class LatencyProbe
+{
+public:
+	LatencyProbe(State & _state, UInt64 _uiIteration)
+		: m_State(_state),
+		  ui_Start((_uiIteration & State::LatencySampleMask) == 0 ? State::Now() : 0)
+	{
+	}
+
+	~LatencyProbe()
+	{
+		if (ui_Start)
+			m_State.AddLatency(State::Now() - ui_Start);
+	}
+
+private:
+	LatencyProbe(const LatencyProbe &);
+	LatencyProbe & operator = (const LatencyProbe &);
+
+	State & m_State;
+	UInt64 ui_Start;
+};
+
+/** @brief Base of all benchmarks, instances register themselves on construction
+ *
+ * Use the CXXABB_BENCH* macros rather than deriving directly. A threaded
+ * benchmark (CXXABB_BENCH_THREADED) is run once per thread count of the sweep,
+ * state shared by its threads lives in a fixture class derived from Benchmark,
+ * created in Setup() and released in TearDown().
+ */
+class Benchmark
+{
+public:
+	Benchmark(const char * _zSuite, const char * _zName);
+	Benchmark(const char * _zSuite, const char * _zName, long _lArg);
+	virtual ~Benchmark();
+
+	virtual void Run(State & _state) = 0;
+
+	/** @brief Called on the runner thread before and after every run, _state is thread 0's */
+	virtual void Setup(State & _state);
+	virtual void TearDown(State & _state);
+
+	const std::string & Suite() const
+	{
+		return s_Suite;
+	}
+
+	/** @brief Full name, "Suite.Name" or "Suite.Name/Arg" */
+	const std::string & Name() const
+	{
+		return s_Name;
+	}
+
+	long Arg() const
+	{
+		return l_Arg;
+	}
+
+	bool IsThreaded() const
+	{
+		return b_Threaded;
+	}
+
+	/** @brief All registered benchmarks in registration order */
+	static std::vector<Benchmark *> & Registry();
+
+protected:
+	/** @brief Run this benchmark over the thread count sweep */
+	void SetThreaded()
+	{
+		b_Threaded = true;
+	}
+
+private:
+	void Register();
+
+	std::string s_Suite;
+	std::string s_Name;
+	long l_Arg;
+	bool b_Threaded;
+};
+
+/** @brief Result of one benchmark, all times in nanoseconds per iteration
+ *
+ * For threaded runs the time of a sample is the wall time of all threads, rates
+ * are totals over all threads.
+ */
+struct Result
+{
+	Result();
+
+	std::string s_Name;              /// Benchmark::Name(), "/threads:N" appended when threaded
+	std::string s_Suite;
+	long l_Arg;
+	int i_Threads;
+	UInt64 ui_Iterations;            /// iterations per sample and thread
+	std::vector<double> lst_Samples;
+	double d_Median;
+	double d_P99;
+	double d_Mean;
+	double d_Min;
+	double d_Max;
+	double d_StdDev;
+	double d_ItemsPerSec;            /// 0 when not reported
+	double d_BytesPerSec;            /// 0 when not reported
+	UInt64 ui_LatencySamples;        /// LatencyProbe samples, latencies are 0 without
+	double d_LatencyP50;
+	double d_LatencyP99;
+	double d_LatencyP999;
+	std::string s_Error;             /// set when the benchmark threw
+};
+
+/** @brief Runner configuration, see Runner::Usage() for the command line */
+struct Options
+{
+	Options();
+
+	std::string s_Filter;            /// substring match on the full name, empty runs all
+	double d_MinTimeMs;              /// minimum duration of one sample
+	double d_WarmupMs;               /// discarded runs before sampling
+	int i_Samples;
+	int i_Cpu;                       /// pin to this cpu, -1 leaves affinity alone
+	std::vector<int> lst_Threads;    /// thread counts of threaded benchmarks
+	std::string s_Json;              /// write results as JSON to this file
+	std::string s_Csv;               /// write results as CSV to this file
+	std::string s_Compare;           /// baseline JSON to compare against
+	std::string s_Against;           /// compare s_Compare to this JSON instead of running
+	double d_Threshold;              /// median slow down in percent flagged as regression
+	bool b_List;
+};
+
+/** @brief Drives the registered benchmarks
+ *
+ * Each benchmark is first run with growing iteration counts until one run lasts
+ * at least MinTime, then run for Warmup, then sampled Samples times at that
+ * iteration count. Statistics are over the per iteration time of the samples.
+ */
+class Runner
+{
+public:
+	/** @brief Entry point used by the default main(), returns the exit status */
+	static int Main(int _iArgc, char ** _pArgv);
+
+	/** @brief Returns false on unknown options */
+	static bool Parse(int _iArgc, char ** _pArgv, Options & _options);
+	static void Usage(const char * _zProgram);
+
+	static Result Measure(Benchmark & _bench, const Options & _options, int _iThreads = 1);
+
+	/** @brief Default sweep, powers of two from 1 to twice the online processors */
+	static std::vector<int> DefaultThreads();
+
+	/** @brief Pin the calling thread to _iCpu, returns false on failure */
+	static bool PinCpu(int _iCpu);
+
+	static void PrintHeader();
+	static void Print(const Result & _result);
+	static bool WriteJson(const std::string & _sPath, const Options & _options,
+			const std::vector<Result> & _results);
+	static bool WriteCsv(const std::string & _sPath, const std::vector<Result> & _results);
+
+	/** @brief Read results written by WriteJson(), returns false if the file cannot be read */
+	static bool ReadJson(const std::string & _sPath, std::vector<Result> & _results);
+
+	/** @brief Print the change of each benchmark present in both, returns the regression count */
+	static int Compare(const std::vector<Result> & _baseline, const std::vector<Result> & _current,
+			double _dThreshold);
+};
+
+}  /* namespace Bench */
+
+}  /* namespace CxxAbb */
+
+#define CXXABB_BENCH_CONCAT_(A, B) A##B
+#define CXXABB_BENCH_CONCAT(A, B) CXXABB_BENCH_CONCAT_(A, B)
+#define CXXABB_BENCH_CLASS(SUITE, NAME) SUITE##_##NAME##_Bench
+
+/** @brief Define and register a benchmark, followed by the body of Run(state)
+ *
+ * @code
+ * CXXABB_BENCH(Buffer, Append)
+ * {
+ *     for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+ *         ...
+ * }
+ * @endcode
+ */
+#define CXXABB_BENCH(SUITE, NAME) \
+	class CXXABB_BENCH_CLASS(SUITE, NAME) : public CxxAbb::Bench::Benchmark \
+	{ \
+	public: \
+		CXXABB_BENCH_CLASS(SUITE, NAME)() : CxxAbb::Bench::Benchmark(#SUITE, #NAME) {} \
+		void Run(CxxAbb::Bench::State & state); \
+	}; \
+	static CXXABB_BENCH_CLASS(SUITE, NAME) s_##SUITE##_##NAME##_Instance; \
+	void CXXABB_BENCH_CLASS(SUITE, NAME)::Run(CxxAbb::Bench::State & state)
+
+/** @brief Define a benchmark run by every thread count of the sweep
+ *
+ * FIXTURE derives from CxxAbb::Bench::Benchmark, has a (const char *, const char *)
+ * constructor and keeps the state shared by the threads.
+ */
+#define CXXABB_BENCH_THREADED(FIXTURE, NAME) \
+	class CXXABB_BENCH_CLASS(FIXTURE, NAME) : public FIXTURE \
+	{ \
+	public: \
+		CXXABB_BENCH_CLASS(FIXTURE, NAME)() : FIXTURE(#FIXTURE, #NAME) { SetThreaded(); } \
+		void Run(CxxAbb::Bench::State & state); \
+	}; \
+	static CXXABB_BENCH_CLASS(FIXTURE, NAME) s_##FIXTURE##_##NAME##_Instance; \
+	void CXXABB_BENCH_CLASS(FIXTURE, NAME)::Run(CxxAbb::Bench::State & state)
+
+/** @brief Define a parameterised benchmark, register it with CXXABB_BENCH_ARG() */
+#define CXXABB_BENCH_P(SUITE, NAME) \
+	class CXXABB_BENCH_CLASS(SUITE, NAME) : public CxxAbb::Bench::Benchmark \
+	{ \
+	public: \
+		explicit CXXABB_BENCH_CLASS(SUITE, NAME)(long _lArg) : CxxAbb::Bench::Benchmark(#SUITE, #NAME, _lArg) {} \
+		void Run(CxxAbb::Bench::State & state); \
+	}; \
+	void CXXABB_BENCH_CLASS(SUITE, NAME)::Run(CxxAbb::Bench::State & state)
+
+/** @brief Register an instance of a CXXABB_BENCH_P() benchmark for state.Arg() == ARG */
+#define CXXABB_BENCH_ARG(SUITE, NAME, ARG) \
+	static CXXABB_BENCH_CLASS(SUITE, NAME) CXXABB_BENCH_CONCAT(s_##SUITE##_##NAME##_Instance, __LINE__)(ARG)
+
+#endif /* CXXABB_BENCH_BENCH_H_ */
@@ -0,0 +1,840 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Bench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : BenchSuite
+ * Module      : Benchmark
+ * Comment     : Microbenchmark runner: auto-scaling, statistics, reporting
+ *
+ */
+
+#include <Bench/Bench.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace CxxAbb
+{
+
+namespace Bench
+{
+
+namespace
+{
+
+/// Hard limit on the iterations of one sample
+const UInt64 MaxIterations = static_cast<UInt64>(1000000000);
+
+double Percentile(const std::vector<double> & _sorted, double _dPercent)
+{
+	// nearest rank
+	std::size_t tRank = static_cast<std::size_t>(std::ceil(_dPercent / 100.0 * _sorted.size()));
+	if (tRank == 0)
+		tRank = 1;
+	return _sorted[tRank - 1];
+}
+
+struct Worker
+{
+	Benchmark * p_Bench;
+	State * p_State;
+	pthread_barrier_t * p_Barrier;
+	int i_Cpu;                       /// -1 to leave affinity alone
+	std::string s_Error;
+};
+
+void * WorkerMain(void * _pArg)
+{
+	Worker * pWorker = static_cast<Worker *>(_pArg);
+	if (pWorker->i_Cpu >= 0)
+		Runner::PinCpu(pWorker->i_Cpu);
+	::pthread_barrier_wait(pWorker->p_Barrier);
+	try
+	{
+		pWorker->p_State->StartTiming();
+		pWorker->p_Bench->Run(*pWorker->p_State);
+		pWorker->p_State->StopTiming();
+	}
+	catch (std::exception & e)
+	{
+		pWorker->s_Error = e.what();
+	}
+	catch (...)
+	{
+		pWorker->s_Error = "unknown exception";
+	}
+	return 0;
+}
+
+/// Totals of one run over all threads
+struct Sample
+{
+	UInt64 ui_ElapsedNs;
+	UInt64 ui_Items;
+	UInt64 ui_Bytes;
+};
+
+/** One run of _iThreads x _uiIterations, latencies are appended to _latencies if given.
+ * Threads after the first are pinned to the cpus following _iCpu.
+ */
+Sample RunOnce(Benchmark & _bench, UInt64 _uiIterations, int _iThreads, int _iCpu,
+		std::vector<UInt64> * _latencies)
+{
+	std::vector<State> lst_States;
+	for (int t = 0; t < _iThreads; ++t)
+		lst_States.push_back(State(_uiIterations, _bench.Arg(), _iThreads, t));
+
+	_bench.Setup(lst_States[0]);
+	std::string sError;
+	if (_iThreads == 1)
+	{
+		try
+		{
+			lst_States[0].StartTiming();
+			_bench.Run(lst_States[0]);
+			lst_States[0].StopTiming();
+		}
+		catch (...)
+		{
+			_bench.TearDown(lst_States[0]);
+			throw;
+		}
+	}
+	else
+	{
+		long lCpus = ::sysconf(_SC_NPROCESSORS_ONLN);
+		pthread_barrier_t barrier;
+		::pthread_barrier_init(&barrier, 0, static_cast<unsigned int>(_iThreads));
+
+		std::vector<Worker> lst_Workers(_iThreads);
+		std::vector<pthread_t> lst_Handles(_iThreads);
+		int iStarted = 0;
+		for (; iStarted < _iThreads; ++iStarted)
+		{
+			Worker & worker = lst_Workers[iStarted];
+			worker.p_Bench = &_bench;
+			worker.p_State = &lst_States[iStarted];
+			worker.p_Barrier = &barrier;
+			worker.i_Cpu = (_iCpu >= 0 && lCpus > 0) ? static_cast<int>((_iCpu + iStarted) % lCpus) : -1;
+			if (::pthread_create(&lst_Handles[iStarted], 0, WorkerMain, &worker) != 0)
+				break;
+		}
+		if (iStarted < _iThreads)
+		{
+			// the barrier can never open, nothing sensible is left to do
+			std::fprintf(stderr, "[ERROR] Cannot start benchmark thread %d\n", iStarted);
+			std::abort();
+		}
+		for (int t = 0; t < _iThreads; ++t)
+		{
+			::pthread_join(lst_Handles[t], 0);
+			if (sError.empty())
+				sError = lst_Workers[t].s_Error;
+		}
+		::pthread_barrier_destroy(&barrier);
+	}
+	_bench.TearDown(lst_States[0]);
+	if (!sError.empty())
+		throw std::runtime_error(sError);
+
+	Sample sample = { lst_States[0].ElapsedNs(), 0, 0 };
+	UInt64 uiBegin = lst_States[0].BeginNs();
+	UInt64 uiEnd = lst_States[0].EndNs();
+	for (int t = 0; t < _iThreads; ++t)
+	{
+		const State & state = lst_States[t];
+		uiBegin = std::min(uiBegin, state.BeginNs());
+		uiEnd = std::max(uiEnd, state.EndNs());
+		sample.ui_Items += state.ItemsProcessed();
+		sample.ui_Bytes += state.BytesProcessed();
+		if (_latencies)
+			_latencies->insert(_latencies->end(), state.Latencies().begin(), state.Latencies().end());
+	}
+	if (_iThreads > 1)
+		sample.ui_ElapsedNs = uiEnd - uiBegin;
+	return sample;
+}
+
+std::string JsonEscape(const std::string & _sValue)
+{
+	std::string sOut;
+	for (std::size_t i = 0; i < _sValue.size(); ++i)
+	{
+		char c = _sValue[i];
+		if (c == '"' || c == '\\')
+		{
+			sOut += '\\';
+			sOut += c;
+		}
+		else if (static_cast<unsigned char>(c) < 0x20)
+		{
+			char zBuf[8];
+			std::sprintf(zBuf, "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c)));
+			sOut += zBuf;
+		}
+		else
+			sOut += c;
+	}
+	return sOut;
+}
+
+}
+
+State::State(UInt64 _uiIterations, long _lArg, int _iThreads, int _iThreadIndex)
+	: ui_Iterations(_uiIterations),
+	  l_Arg(_lArg),
+	  i_Threads(_iThreads),
+	  i_ThreadIndex(_iThreadIndex),
+	  ui_Start(0),
+	  ui_Begin(0),
+	  ui_End(0),
+	  ui_ElapsedNs(0),
+	  ui_Items(0),
+	  ui_Bytes(0),
+	  b_Running(false)
+{
+}
+
+void State::StartTiming()
+{
+	ui_ElapsedNs = 0;
+	lst_Latencies.clear();
+	b_Running = true;
+	ui_Start = Now();
+	ui_Begin = ui_Start;
+}
+
+void State::StopTiming()
+{
+	PauseTiming();
+	ui_End = Now();
+}
+
+void State::PauseTiming()
+{
+	if (b_Running)
+	{
+		ui_ElapsedNs += Now() - ui_Start;
+		b_Running = false;
+	}
+}
+
+void State::ResumeTiming()
+{
+	if (!b_Running)
+	{
+		b_Running = true;
+		ui_Start = Now();
+	}
+}
+
+UInt64 State::Now()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<UInt64>(ts.tv_sec) * static_cast<UInt64>(1000000000) + static_cast<UInt64>(ts.tv_nsec);
+}
+
+Benchmark::Benchmark(const char * _zSuite, const char * _zName)
+	: s_Suite(_zSuite),
+	  s_Name(std::string(_zSuite) + "." + _zName),
+	  l_Arg(0),
+	  b_Threaded(false)
+{
+	Register();
+}
+
+Benchmark::Benchmark(const char * _zSuite, const char * _zName, long _lArg)
+	: s_Suite(_zSuite),
+	  s_Name(std::string(_zSuite) + "." + _zName),
+	  l_Arg(_lArg),
+	  b_Threaded(false)
+{
+	char zArg[32];
+	std::sprintf(zArg, "/%ld", _lArg);
+	s_Name += zArg;
+	Register();
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+void Benchmark::Setup(State &)
+{
+}
+
+void Benchmark::TearDown(State &)
+{
+}
+
+std::vector<Benchmark *> & Benchmark::Registry()
+{
+	// function local, benchmarks register from static initialisers of other units
+	static std::vector<Benchmark *> lst_Benchmarks;
+	return lst_Benchmarks;
+}
+
+void Benchmark::Register()
+{
+	Registry().push_back(this);
+}
+
+Options::Options()
+	: d_MinTimeMs(10.0),
+	  d_WarmupMs(100.0),
+	  i_Samples(20),
+	  i_Cpu(-1),
+	  d_Threshold(5.0),
+	  b_List(false)
+{
+}
+
+Result::Result()
+	: l_Arg(0),
+	  i_Threads(1),
+	  ui_Iterations(0),
+	  d_Median(0),
+	  d_P99(0),
+	  d_Mean(0),
+	  d_Min(0),
+	  d_Max(0),
+	  d_StdDev(0),
+	  d_ItemsPerSec(0),
+	  d_BytesPerSec(0),
+	  ui_LatencySamples(0),
+	  d_LatencyP50(0),
+	  d_LatencyP99(0),
+	  d_LatencyP999(0)
+{
+}
+
+Result Runner::Measure(Benchmark & _bench, const Options & _options, int _iThreads)
+{
+	Result result;
+	result.s_Name = _bench.Name();
+	result.s_Suite = _bench.Suite();
+	result.l_Arg = _bench.Arg();
+	result.i_Threads = _iThreads;
+	if (_bench.IsThreaded())
+	{
+		char zThreads[32];
+		std::sprintf(zThreads, "/threads:%d", _iThreads);
+		result.s_Name += zThreads;
+	}
+
+	double dItemsPerIter = 0;
+	double dBytesPerIter = 0;
+	std::vector<UInt64> lst_Latencies;
+	try
+	{
+		const double dMinNs = _options.d_MinTimeMs * 1e6;
+
+		// grow the iteration count until one run is long enough to time reliably
+		UInt64 uiIterations = 1;
+		for (;;)
+		{
+			UInt64 uiElapsed = RunOnce(_bench, uiIterations, _iThreads, _options.i_Cpu, 0).ui_ElapsedNs;
+			if (uiElapsed >= dMinNs || uiIterations >= MaxIterations)
+				break;
+
+			double dScale = (uiElapsed > 0) ? 1.4 * dMinNs / uiElapsed : 10.0;
+			if (dScale > 10.0)
+				dScale = 10.0;
+			if (dScale < 2.0)
+				dScale = 2.0;
+			uiIterations = std::min(MaxIterations, static_cast<UInt64>(uiIterations * dScale) + 1);
+		}
+		result.ui_Iterations = uiIterations;
+
+		// warm caches, branch predictors and the cpu clock
+		UInt64 uiWarmStart = State::Now();
+		while (State::Now() - uiWarmStart < _options.d_WarmupMs * 1e6)
+			RunOnce(_bench, uiIterations, _iThreads, _options.i_Cpu, 0);
+
+		for (int i = 0; i < _options.i_Samples; ++i)
+		{
+			Sample sample = RunOnce(_bench, uiIterations, _iThreads, _options.i_Cpu, &lst_Latencies);
+			result.lst_Samples.push_back(static_cast<double>(sample.ui_ElapsedNs) / uiIterations);
+			dItemsPerIter = static_cast<double>(sample.ui_Items) / uiIterations;
+			dBytesPerIter = static_cast<double>(sample.ui_Bytes) / uiIterations;
+		}
+	}
+	catch (std::exception & e)
+	{
+		result.s_Error = e.what();
+		return result;
+	}
+
+	std::vector<double> lst_Sorted(result.lst_Samples);
+	std::sort(lst_Sorted.begin(), lst_Sorted.end());
+	std::size_t tCount = lst_Sorted.size();
+	if (tCount == 0)
+		return result;
+
+	double dSum = 0;
+	for (std::size_t i = 0; i < tCount; ++i)
+		dSum += lst_Sorted[i];
+	result.d_Mean = dSum / tCount;
+
+	double dVar = 0;
+	for (std::size_t i = 0; i < tCount; ++i)
+		dVar += (lst_Sorted[i] - result.d_Mean) * (lst_Sorted[i] - result.d_Mean);
+	result.d_StdDev = (tCount > 1) ? std::sqrt(dVar / (tCount - 1)) : 0;
+
+	result.d_Min = lst_Sorted.front();
+	result.d_Max = lst_Sorted.back();
+	result.d_Median = (tCount % 2) ? lst_Sorted[tCount / 2]
+			: (lst_Sorted[tCount / 2 - 1] + lst_Sorted[tCount / 2]) / 2;
+	result.d_P99 = Percentile(lst_Sorted, 99.0);
+	if (result.d_Median > 0)
+	{
+		result.d_ItemsPerSec = dItemsPerIter * 1e9 / result.d_Median;
+		result.d_BytesPerSec = dBytesPerIter * 1e9 / result.d_Median;
+	}
+
+	if (!lst_Latencies.empty())
+	{
+		std::vector<double> lst_Ns(lst_Latencies.begin(), lst_Latencies.end());
+		std::sort(lst_Ns.begin(), lst_Ns.end());
+		result.ui_LatencySamples = lst_Ns.size();
+		result.d_LatencyP50 = Percentile(lst_Ns, 50.0);
+		result.d_LatencyP99 = Percentile(lst_Ns, 99.0);
+		result.d_LatencyP999 = Percentile(lst_Ns, 99.9);
+	}
+
+	return result;
+}
+
+bool Runner::PinCpu(int _iCpu)
+{
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(_iCpu, &set);
+	return ::sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+std::vector<int> Runner::DefaultThreads()
+{
+	long lCpus = ::sysconf(_SC_NPROCESSORS_ONLN);
+	int iMax = 2 * static_cast<int>(lCpus > 0 ? lCpus : 1);
+
+	std::vector<int> lst_Threads;
+	for (int t = 1; t < iMax; t *= 2)
+		lst_Threads.push_back(t);
+	lst_Threads.push_back(iMax);
+	return lst_Threads;
+}
+
+void Runner::Usage(const char * _zProgram)
+{
+	std::fprintf(stderr,
+			"usage: %s [options]\n"
+			"  --filter=TEXT     run benchmarks whose name contains TEXT\n"
+			"  --min_time=MS     minimum duration of one sample (default 10)\n"
+			"  --warmup=MS       warm-up duration before sampling (default 100)\n"
+			"  --samples=N       number of samples (default 20)\n"
+			"  --cpu=N           pin the benchmark thread to cpu N, threads of threaded\n"
+			"                    benchmarks to the following cpus\n"
+			"  --threads=N,M,..  thread counts of threaded benchmarks\n"
+			"                    (default 1, 2, 4 .. 2 x online cpus)\n"
+			"  --json=FILE       also write results as JSON to FILE\n"
+			"  --csv=FILE        also write results as CSV to FILE\n"
+			"  --compare=FILE    compare the results with a JSON baseline\n"
+			"  --against=FILE    with --compare, compare two JSON files without running\n"
+			"  --threshold=PCT   median slow down reported as regression (default 5)\n"
+			"  --list            list benchmarks and exit\n", _zProgram);
+}
+
+bool Runner::Parse(int _iArgc, char ** _pArgv, Options & _options)
+{
+	for (int i = 1; i < _iArgc; ++i)
+	{
+		const char * zArg = _pArgv[i];
+		const char * zValue = std::strchr(zArg, '=');
+		std::string sKey(zArg, zValue ? zValue - zArg : std::strlen(zArg));
+		zValue = zValue ? zValue + 1 : "";
+
+		if (sKey == "--filter")
+			_options.s_Filter = zValue;
+		else if (sKey == "--min_time")
+			_options.d_MinTimeMs = std::atof(zValue);
+		else if (sKey == "--warmup")
+			_options.d_WarmupMs = std::atof(zValue);
+		else if (sKey == "--samples")
+			_options.i_Samples = std::max(1, std::atoi(zValue));
+		else if (sKey == "--cpu")
+			_options.i_Cpu = std::atoi(zValue);
+		else if (sKey == "--threads")
+		{
+			_options.lst_Threads.clear();
+			for (const char * z = zValue; *z; )
+			{
+				char * zEnd = 0;
+				long lThreads = std::strtol(z, &zEnd, 10);
+				if (zEnd == z || lThreads < 1)
+					return false;
+				_options.lst_Threads.push_back(static_cast<int>(lThreads));
+				z = (*zEnd == ',') ? zEnd + 1 : zEnd;
+				if (*zEnd && *zEnd != ',')
+					return false;
+			}
+		}
+		else if (sKey == "--json")
+			_options.s_Json = zValue;
+		else if (sKey == "--csv")
+			_options.s_Csv = zValue;
+		else if (sKey == "--compare")
+			_options.s_Compare = zValue;
+		else if (sKey == "--against")
+			_options.s_Against = zValue;
+		else if (sKey == "--threshold")
+			_options.d_Threshold = std::atof(zValue);
+		else if (sKey == "--list")
+			_options.b_List = true;
+		else
+			return false;
+	}
+	if (!_options.s_Against.empty() && _options.s_Compare.empty())
+		return false;
+	if (_options.lst_Threads.empty())
+		_options.lst_Threads = DefaultThreads();
+	return true;
+}
+
+void Runner::PrintHeader()
+{
+	std::printf("%-40s %12s %12s %12s %10s %12s %14s %12s\n",
+			"benchmark", "median ns", "p99 ns", "mean ns", "stddev %", "iterations", "rate/s", "op p99 ns");
+}
+
+void Runner::Print(const Result & _result)
+{
+	if (!_result.s_Error.empty())
+	{
+		std::printf("%-40s ERROR: %s\n", _result.s_Name.c_str(), _result.s_Error.c_str());
+		return;
+	}
+
+	char zRate[32] = "";
+	if (_result.d_ItemsPerSec > 0)
+		std::sprintf(zRate, "%.4g", _result.d_ItemsPerSec);
+	else if (_result.d_BytesPerSec > 0)
+		std::sprintf(zRate, "%.4gB", _result.d_BytesPerSec);
+
+	char zLatency[32] = "";
+	if (_result.ui_LatencySamples > 0)
+		std::sprintf(zLatency, "%.0f", _result.d_LatencyP99);
+
+	std::printf("%-40s %12.2f %12.2f %12.2f %10.2f %12lu %14s %12s\n", _result.s_Name.c_str(),
+			_result.d_Median, _result.d_P99, _result.d_Mean,
+			_result.d_Mean > 0 ? 100.0 * _result.d_StdDev / _result.d_Mean : 0.0,
+			static_cast<unsigned long>(_result.ui_Iterations), zRate, zLatency);
+	std::fflush(stdout);
+}
+
+bool Runner::WriteJson(const std::string & _sPath, const Options & _options,
+		const std::vector<Result> & _results)
+{
+	std::ofstream out(_sPath.c_str());
+	if (!out)
+		return false;
+
+	char zHost[256] = "";
+	::gethostname(zHost, sizeof(zHost) - 1);
+	char zDate[64] = "";
+	std::time_t tNow = std::time(0);
+	std::strftime(zDate, sizeof(zDate), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&tNow));
+
+	out.precision(12);
+	out << "{\n  \"context\": {\n"
+		<< "    \"date\": \"" << zDate << "\",\n"
+		<< "    \"host\": \"" << JsonEscape(zHost) << "\",\n"
+		<< "    \"cpus\": " << ::sysconf(_SC_NPROCESSORS_ONLN) << ",\n"
+		<< "    \"pinned_cpu\": " << _options.i_Cpu << ",\n"
+#ifdef __OPTIMIZE__
+		<< "    \"optimized\": true,\n"
+#else
+		<< "    \"optimized\": false,\n"
+#endif
+		<< "    \"min_time_ms\": " << _options.d_MinTimeMs << ",\n"
+		<< "    \"warmup_ms\": " << _options.d_WarmupMs << ",\n"
+		<< "    \"samples\": " << _options.i_Samples << "\n"
+		<< "  },\n  \"benchmarks\": [";
+
+	// one benchmark per line, ReadJson() depends on it
+	for (std::size_t i = 0; i < _results.size(); ++i)
+	{
+		const Result & r = _results[i];
+		out << (i ? ",\n" : "\n")
+			<< "    {\"name\": \"" << JsonEscape(r.s_Name) << "\", \"suite\": \"" << JsonEscape(r.s_Suite)
+			<< "\", \"arg\": " << r.l_Arg << ", \"threads\": " << r.i_Threads;
+		if (!r.s_Error.empty())
+		{
+			out << ", \"error\": \"" << JsonEscape(r.s_Error) << "\"}";
+			continue;
+		}
+		out << ", \"iterations\": " << r.ui_Iterations
+			<< ", \"median_ns\": " << r.d_Median
+			<< ", \"p99_ns\": " << r.d_P99
+			<< ", \"mean_ns\": " << r.d_Mean
+			<< ", \"min_ns\": " << r.d_Min
+			<< ", \"max_ns\": " << r.d_Max
+			<< ", \"stddev_ns\": " << r.d_StdDev
+			<< ", \"items_per_second\": " << r.d_ItemsPerSec
+			<< ", \"bytes_per_second\": " << r.d_BytesPerSec
+			<< ", \"latency_samples\": " << r.ui_LatencySamples
+			<< ", \"latency_p50_ns\": " << r.d_LatencyP50
+			<< ", \"latency_p99_ns\": " << r.d_LatencyP99
+			<< ", \"latency_p999_ns\": " << r.d_LatencyP999
+			<< ", \"samples_ns\": [";
+		for (std::size_t s = 0; s < r.lst_Samples.size(); ++s)
+			out << (s ? ", " : "") << r.lst_Samples[s];
+		out << "]}";
+	}
+	out << "\n  ]\n}\n";
+	return !out.fail();
+}
+
+bool Runner::WriteCsv(const std::string & _sPath, const std::vector<Result> & _results)
+{
+	std::ofstream out(_sPath.c_str());
+	if (!out)
+		return false;
+
+	out.precision(12);
+	out << "name,suite,arg,threads,iterations,median_ns,p99_ns,mean_ns,min_ns,max_ns,stddev_ns,"
+		"items_per_second,bytes_per_second,latency_p50_ns,latency_p99_ns,latency_p999_ns,error\n";
+	for (std::size_t i = 0; i < _results.size(); ++i)
+	{
+		const Result & r = _results[i];
+		out << r.s_Name << ',' << r.s_Suite << ',' << r.l_Arg << ',' << r.i_Threads << ','
+			<< r.ui_Iterations << ',' << r.d_Median << ',' << r.d_P99 << ',' << r.d_Mean << ','
+			<< r.d_Min << ',' << r.d_Max << ',' << r.d_StdDev << ','
+			<< r.d_ItemsPerSec << ',' << r.d_BytesPerSec << ','
+			<< r.d_LatencyP50 << ',' << r.d_LatencyP99 << ',' << r.d_LatencyP999 << ',';
+		if (!r.s_Error.empty())
+		{
+			std::string sError(r.s_Error);
+			std::replace(sError.begin(), sError.end(), '"', '\'');
+			out << '"' << sError << '"';
+		}
+		out << '\n';
+	}
+	return !out.fail();
+}
+
+namespace
+{
+
+bool JsonString(const std::string & _sLine, const char * _zKey, std::string & _sValue)
+{
+	std::string sKey = std::string("\"") + _zKey + "\": \"";
+	std::string::size_type tPos = _sLine.find(sKey);
+	if (tPos == std::string::npos)
+		return false;
+
+	_sValue.clear();
+	for (tPos += sKey.size(); tPos < _sLine.size() && _sLine[tPos] != '"'; ++tPos)
+	{
+		if (_sLine[tPos] == '\\' && tPos + 1 < _sLine.size())
+			++tPos;
+		_sValue += _sLine[tPos];
+	}
+	return true;
+}
+
+double JsonNumber(const std::string & _sLine, const char * _zKey)
+{
+	std::string sKey = std::string("\"") + _zKey + "\": ";
+	std::string::size_type tPos = _sLine.find(sKey);
+	if (tPos == std::string::npos)
+		return 0;
+	return std::strtod(_sLine.c_str() + tPos + sKey.size(), 0);
+}
+
+}
+
+bool Runner::ReadJson(const std::string & _sPath, std::vector<Result> & _results)
+{
+	std::ifstream in(_sPath.c_str());
+	if (!in)
+		return false;
+
+	std::string sLine;
+	while (std::getline(in, sLine))
+	{
+		Result r;
+		if (!JsonString(sLine, "name", r.s_Name))
+			continue;
+		JsonString(sLine, "suite", r.s_Suite);
+		JsonString(sLine, "error", r.s_Error);
+		r.l_Arg = static_cast<long>(JsonNumber(sLine, "arg"));
+		r.i_Threads = static_cast<int>(JsonNumber(sLine, "threads"));
+		r.ui_Iterations = static_cast<UInt64>(JsonNumber(sLine, "iterations"));
+		r.d_Median = JsonNumber(sLine, "median_ns");
+		r.d_P99 = JsonNumber(sLine, "p99_ns");
+		r.d_Mean = JsonNumber(sLine, "mean_ns");
+		r.d_Min = JsonNumber(sLine, "min_ns");
+		r.d_Max = JsonNumber(sLine, "max_ns");
+		r.d_StdDev = JsonNumber(sLine, "stddev_ns");
+		r.d_ItemsPerSec = JsonNumber(sLine, "items_per_second");
+		r.d_BytesPerSec = JsonNumber(sLine, "bytes_per_second");
+		r.ui_LatencySamples = static_cast<UInt64>(JsonNumber(sLine, "latency_samples"));
+		r.d_LatencyP50 = JsonNumber(sLine, "latency_p50_ns");
+		r.d_LatencyP99 = JsonNumber(sLine, "latency_p99_ns");
+		r.d_LatencyP999 = JsonNumber(sLine, "latency_p999_ns");
+		_results.push_back(r);
+	}
+	return true;
+}
+
+int Runner::Compare(const std::vector<Result> & _baseline, const std::vector<Result> & _current,
+		double _dThreshold)
+{
+	std::printf("\n%-40s %12s %12s %9s %12s %12s %9s\n",
+			"benchmark", "base ns", "new ns", "change %", "base op p99", "new op p99", "change %");
+
+	int iRegressions = 0;
+	for (std::size_t i = 0; i < _current.size(); ++i)
+	{
+		const Result & now = _current[i];
+		const Result * pBase = 0;
+		for (std::size_t b = 0; b < _baseline.size() && !pBase; ++b)
+		{
+			if (_baseline[b].s_Name == now.s_Name)
+				pBase = &_baseline[b];
+		}
+		if (!pBase || !pBase->s_Error.empty() || !now.s_Error.empty() || pBase->d_Median <= 0)
+			continue;
+
+		double dChange = 100.0 * (now.d_Median - pBase->d_Median) / pBase->d_Median;
+		bool bRegression = dChange > _dThreshold;
+		if (bRegression)
+			++iRegressions;
+
+		char zLatency[64] = "";
+		if (pBase->d_LatencyP99 > 0 && now.d_LatencyP99 > 0)
+			std::sprintf(zLatency, "%12.0f %12.0f %+9.1f", pBase->d_LatencyP99, now.d_LatencyP99,
+					100.0 * (now.d_LatencyP99 - pBase->d_LatencyP99) / pBase->d_LatencyP99);
+
+		std::printf("%-40s %12.2f %12.2f %+9.1f %s%s\n", now.s_Name.c_str(), pBase->d_Median,
+				now.d_Median, dChange, zLatency, bRegression ? "  REGRESSION" : "");
+	}
+	std::printf("%d regression(s) above %.1f%%\n", iRegressions, _dThreshold);
+	return iRegressions;
+}
+
+int Runner::Main(int _iArgc, char ** _pArgv)
+{
+	Options options;
+	if (!Parse(_iArgc, _pArgv, options))
+	{
+		Usage(_pArgv[0]);
+		return 1;
+	}
+
+	std::vector<Result> lst_Baseline;
+	if (!options.s_Compare.empty() && !ReadJson(options.s_Compare, lst_Baseline))
+	{
+		std::fprintf(stderr, "[ERROR] Cannot read %s\n", options.s_Compare.c_str());
+		return 1;
+	}
+	if (!options.s_Against.empty())
+	{
+		std::vector<Result> lst_Other;
+		if (!ReadJson(options.s_Against, lst_Other))
+		{
+			std::fprintf(stderr, "[ERROR] Cannot read %s\n", options.s_Against.c_str());
+			return 1;
+		}
+		return Compare(lst_Baseline, lst_Other, options.d_Threshold) ? 1 : 0;
+	}
+
+	std::vector<Benchmark *> & lst_All = Benchmark::Registry();
+	std::vector<Benchmark *> lst_Selected;
+	for (std::size_t i = 0; i < lst_All.size(); ++i)
+	{
+		if (options.s_Filter.empty() || lst_All[i]->Name().find(options.s_Filter) != std::string::npos)
+			lst_Selected.push_back(lst_All[i]);
+	}
+
+	if (options.b_List)
+	{
+		for (std::size_t i = 0; i < lst_Selected.size(); ++i)
+			std::printf("%s%s\n", lst_Selected[i]->Name().c_str(), lst_Selected[i]->IsThreaded() ? " (threaded)" : "");
+		return 0;
+	}
+
+#ifndef __OPTIMIZE__
+	std::fprintf(stderr, "[WARN] Benchmarks built without optimisation, use 'make bench COMPILE.TYPE=R'\n");
+#endif
+	if (options.i_Cpu >= 0 && !PinCpu(options.i_Cpu))
+	{
+		std::fprintf(stderr, "[ERROR] Cannot pin to cpu %d\n", options.i_Cpu);
+		return 1;
+	}
+
+	PrintHeader();
+	int iStatus = 0;
+	std::vector<Result> lst_Results;
+	for (std::size_t i = 0; i < lst_Selected.size(); ++i)
+	{
+		std::vector<int> lst_Threads(1, 1);
+		if (lst_Selected[i]->IsThreaded())
+			lst_Threads = options.lst_Threads;
+
+		for (std::size_t t = 0; t < lst_Threads.size(); ++t)
+		{
+			lst_Results.push_back(Measure(*lst_Selected[i], options, lst_Threads[t]));
+			Print(lst_Results.back());
+			if (!lst_Results.back().s_Error.empty())
+				iStatus = 1;
+		}
+	}
+
+	if (!options.s_Json.empty() && !WriteJson(options.s_Json, options, lst_Results))
+	{
+		std::fprintf(stderr, "[ERROR] Cannot write %s\n", options.s_Json.c_str());
+		return 1;
+	}
+	if (!options.s_Csv.empty() && !WriteCsv(options.s_Csv, lst_Results))
+	{
+		std::fprintf(stderr, "[ERROR] Cannot write %s\n", options.s_Csv.c_str());
+		return 1;
+	}
+	if (!lst_Baseline.empty() && Compare(lst_Baseline, lst_Results, options.d_Threshold) > 0)
+		iStatus = 1;
+	return iStatus;
+}
+
+}  /* namespace Bench */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,33 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BenchMain.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : BenchSuite
+ * Module      : Benchmark
+ * Comment     : Default main() for benchmark programs
+ *
+ */
+
+#include <Bench/Bench.h>
+
+int main(int argc, char ** argv)
+{
+	return CxxAbb::Bench::Runner::Main(argc, argv);
+}
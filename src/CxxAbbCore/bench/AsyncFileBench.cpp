@@ -0,0 +1,186 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * AsyncFileBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Sys
+ * Comment     : AsyncFile queue depth benchmarks against blocking pread
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Sys/AsyncFile.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+const char * BenchFile = "/tmp/CxxAbbAsyncFileBench.bin";
+const std::size_t FileSize = 64 * 1024 * 1024;
+const std::size_t BlockSize = 4096;
+const std::size_t MaxDepth = 32;
+
+/// Written once per process. Reads are O_DIRECT where the file system allows it,
+/// so they reach the device and queue depth matters, not the page cache
+void CreateBenchFile()
+{
+	static bool s_bCreated = false;
+	if (s_bCreated)
+		return;
+
+	std::vector<char> lstChunk(1024 * 1024, 'r');
+	std::FILE * pFile = std::fopen(BenchFile, "wb");
+	for (std::size_t i = 0; i < FileSize / lstChunk.size(); ++i)
+		std::fwrite(&lstChunk[0], 1, lstChunk.size(), pFile);
+	std::fclose(pFile);
+	s_bCreated = true;
+}
+
+/// Block aligned read buffers, as O_DIRECT needs
+class Blocks
+{
+public:
+	Blocks()
+		: p_Memory(CxxAbb::NullPtr)
+	{
+		if (::posix_memalign(&p_Memory, BlockSize, BlockSize * MaxDepth) != 0)
+			p_Memory = CxxAbb::NullPtr;
+		for (std::size_t i = 0; i < MaxDepth; ++i)
+			lst_Buffers.push_back(new CxxAbb::Buffer<char>(static_cast<char*>(p_Memory) + i * BlockSize, BlockSize));
+	}
+
+	~Blocks()
+	{
+		for (std::size_t i = 0; i < lst_Buffers.size(); ++i)
+			delete lst_Buffers[i];
+		std::free(p_Memory);
+	}
+
+	CxxAbb::Buffer<char> & operator [](std::size_t _tIndex)
+	{
+		return *lst_Buffers[_tIndex];
+	}
+
+private:
+	void * p_Memory;
+	std::vector<CxxAbb::Buffer<char>*> lst_Buffers;
+};
+
+/// Random block offset, LCG so every variant reads the same sequence
+std::size_t NextOffset(CxxAbb::UInt64 & _uiSeed)
+{
+	_uiSeed = _uiSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return static_cast<std::size_t>((_uiSeed >> 33) % (FileSize / BlockSize)) * BlockSize;
+}
+
+void Count(long _lResult, void * _pData)
+{
+	if (_lResult > 0)
+		CxxAbb::Sys::AtomicFetchAdd(static_cast<CxxAbb::UInt64*>(_pData), static_cast<CxxAbb::UInt64>(_lResult));
+}
+
+/// _state.Arg() reads kept in flight on _eBackend: a batch is submitted and drained per round
+void ReadAtDepth(CxxAbb::Bench::State & _state, CxxAbb::Sys::AsyncFile::Backend _eBackend)
+{
+	_state.PauseTiming();
+	CreateBenchFile();
+	std::size_t tDepth = static_cast<std::size_t>(_state.Arg());
+	CxxAbb::Sys::AsyncFile file;
+	try
+	{
+		file.Open(BenchFile, CxxAbb::Sys::AsyncFile::ReadOnly, CxxAbb::Sys::AsyncFile::Direct, _eBackend,
+				static_cast<unsigned int>(tDepth));
+	}
+	catch(CxxAbb::OpenFileException &)
+	{
+		file.Open(BenchFile, CxxAbb::Sys::AsyncFile::ReadOnly, 0, _eBackend, static_cast<unsigned int>(tDepth));
+	}
+	Blocks blocks;
+	CxxAbb::Sys::AsyncFile::Batch batch;
+	CxxAbb::UInt64 uiSeed = 1;
+	CxxAbb::UInt64 uiBytes = 0;
+	_state.ResumeTiming();
+
+	CxxAbb::UInt64 i = 0;
+	while (i < _state.Iterations())
+	{
+		for (std::size_t j = 0; j < tDepth; ++j)
+			batch.Read(NextOffset(uiSeed), blocks[j], &Count, &uiBytes);
+		file.Submit(batch);
+		file.Drain();
+		i += tDepth;
+	}
+	CxxAbb::Bench::DoNotOptimize(uiBytes);
+	_state.SetItemsProcessed(i);
+	_state.SetBytesProcessed(uiBytes);
+}
+
+}
+
+/// One blocking pread at a time, the queue depth 1 baseline
+CXXABB_BENCH(AsyncFile, SyncPread)
+{
+	state.PauseTiming();
+	CreateBenchFile();
+	int iFd = ::open(BenchFile, O_RDONLY | O_DIRECT);
+	if (iFd < 0)
+		iFd = ::open(BenchFile, O_RDONLY);
+	Blocks blocks;
+	CxxAbb::UInt64 uiSeed = 1;
+	CxxAbb::UInt64 uiBytes = 0;
+	state.ResumeTiming();
+
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		ssize_t tRead = ::pread(iFd, blocks[0].begin(), BlockSize, static_cast<off_t>(NextOffset(uiSeed)));
+		if (tRead > 0)
+			uiBytes += static_cast<CxxAbb::UInt64>(tRead);
+	}
+	::close(iFd);
+	CxxAbb::Bench::DoNotOptimize(uiBytes);
+	state.SetItemsProcessed(state.Iterations());
+	state.SetBytesProcessed(uiBytes);
+}
+
+/// 4 KB random reads through io_uring, state.Arg() in flight
+CXXABB_BENCH_P(AsyncFile, UringRead)
+{
+	if (!CxxAbb::Sys::AsyncFile::UringSupported())
+		return;
+	ReadAtDepth(state, CxxAbb::Sys::AsyncFile::BackendUring);
+}
+CXXABB_BENCH_ARG(AsyncFile, UringRead, 1);
+CXXABB_BENCH_ARG(AsyncFile, UringRead, 8);
+CXXABB_BENCH_ARG(AsyncFile, UringRead, 32);
+
+/// The same reads on the fallback worker pool
+CXXABB_BENCH_P(AsyncFile, PoolRead)
+{
+	ReadAtDepth(state, CxxAbb::Sys::AsyncFile::BackendThreadPool);
+}
+CXXABB_BENCH_ARG(AsyncFile, PoolRead, 1);
+CXXABB_BENCH_ARG(AsyncFile, PoolRead, 8);
+CXXABB_BENCH_ARG(AsyncFile, PoolRead, 32);
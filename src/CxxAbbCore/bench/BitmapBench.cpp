@@ -0,0 +1,150 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BitmapBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Bitmap bulk operation throughput
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Bitmap.h>
+
+namespace
+{
+
+/// 128 KB per bitmap, fits in L2
+const std::size_t Bits = 1024 * 1024;
+
+/// Every _tStep-th bit set
+CxxAbb::Bitmap Filled(std::size_t _tStep)
+{
+	CxxAbb::Bitmap bitmap(Bits);
+	for (std::size_t i = 0; i < Bits; i += _tStep)
+		bitmap.Set(i);
+	return bitmap;
+}
+
+struct Sum
+{
+	explicit Sum(CxxAbb::UInt64 & _uiSum)
+		: p_Sum(&_uiSum)
+	{}
+
+	void operator()(std::size_t _tBit) const
+	{
+		*p_Sum += _tBit;
+	}
+
+	CxxAbb::UInt64 * p_Sum;
+};
+
+}
+
+/// Kernel state.Arg() for Count(), nothing measured if the CPU lacks it
+CXXABB_BENCH_P(Bitmap, Count)
+{
+	if (!CxxAbb::Bitmap::SetKernel(static_cast<CxxAbb::Bitmap::Kernel>(state.Arg())))
+		return;
+
+	CxxAbb::Bitmap bitmap = Filled(3);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		std::size_t tCount = bitmap.Count();
+		CxxAbb::Bench::DoNotOptimize(tCount);
+	}
+	state.SetBytesProcessed(state.Iterations() * Bits / 8);
+	CxxAbb::Bitmap::SetKernel(CxxAbb::Bitmap::KernelAuto);
+}
+CXXABB_BENCH_ARG(Bitmap, Count, CxxAbb::Bitmap::KernelScalar);
+CXXABB_BENCH_ARG(Bitmap, Count, CxxAbb::Bitmap::KernelPopcnt);
+CXXABB_BENCH_ARG(Bitmap, Count, CxxAbb::Bitmap::KernelAvx2);
+
+/// Intersection size of two bitmaps, bytes of both inputs counted
+CXXABB_BENCH_P(Bitmap, CountAnd)
+{
+	if (!CxxAbb::Bitmap::SetKernel(static_cast<CxxAbb::Bitmap::Kernel>(state.Arg())))
+		return;
+
+	CxxAbb::Bitmap lhs = Filled(3);
+	CxxAbb::Bitmap rhs = Filled(5);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		std::size_t tCount = lhs.CountAnd(rhs);
+		CxxAbb::Bench::DoNotOptimize(tCount);
+	}
+	state.SetBytesProcessed(state.Iterations() * 2 * Bits / 8);
+	CxxAbb::Bitmap::SetKernel(CxxAbb::Bitmap::KernelAuto);
+}
+CXXABB_BENCH_ARG(Bitmap, CountAnd, CxxAbb::Bitmap::KernelScalar);
+CXXABB_BENCH_ARG(Bitmap, CountAnd, CxxAbb::Bitmap::KernelPopcnt);
+CXXABB_BENCH_ARG(Bitmap, CountAnd, CxxAbb::Bitmap::KernelAvx2);
+
+/// In place AND, alternating operands so the result does not settle to a fixed point
+CXXABB_BENCH_P(Bitmap, And)
+{
+	if (!CxxAbb::Bitmap::SetKernel(static_cast<CxxAbb::Bitmap::Kernel>(state.Arg())))
+		return;
+
+	CxxAbb::Bitmap lhs = Filled(3);
+	CxxAbb::Bitmap rhs = Filled(5);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		lhs.And(rhs);
+		CxxAbb::Bench::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.Iterations() * 2 * Bits / 8);
+	CxxAbb::Bitmap::SetKernel(CxxAbb::Bitmap::KernelAuto);
+}
+CXXABB_BENCH_ARG(Bitmap, And, CxxAbb::Bitmap::KernelScalar);
+CXXABB_BENCH_ARG(Bitmap, And, CxxAbb::Bitmap::KernelAvx2);
+
+/// Visit the set bits, 1 in state.Arg() set
+CXXABB_BENCH_P(Bitmap, ForEach)
+{
+	CxxAbb::Bitmap bitmap = Filled(static_cast<std::size_t>(state.Arg()));
+	CxxAbb::UInt64 uiSum = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		bitmap.ForEach(Sum(uiSum));
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+	state.SetItemsProcessed(state.Iterations() * bitmap.Count());
+}
+CXXABB_BENCH_ARG(Bitmap, ForEach, 2);
+CXXABB_BENCH_ARG(Bitmap, ForEach, 64);
+CXXABB_BENCH_ARG(Bitmap, ForEach, 4096);
+
+/// The same walk with Test() on every bit
+CXXABB_BENCH_P(Bitmap, TestEach)
+{
+	CxxAbb::Bitmap bitmap = Filled(static_cast<std::size_t>(state.Arg()));
+	CxxAbb::UInt64 uiSum = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		for (std::size_t j = 0; j < Bits; ++j)
+		{
+			if (bitmap.Test(j))
+				uiSum += j;
+		}
+	}
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+	state.SetItemsProcessed(state.Iterations() * bitmap.Count());
+}
+CXXABB_BENCH_ARG(Bitmap, TestEach, 64);
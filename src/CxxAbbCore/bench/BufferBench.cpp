@@ -0,0 +1,145 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BufferBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Memory
+ * Comment     : Buffer append/remove throughput
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/BinaryReader.h>
+#include <CxxAbb/BinaryWriter.h>
+#include <CxxAbb/SwapByteOrder.h>
+
+#include <cstring>
+
+namespace
+{
+
+/// Buffer keeps growing until this, then it is cleared
+const std::size_t Limit = 64 * 1024;
+
+/// Header of the encoded message: id, flags, timestamp, name
+const std::string MessageName = "orders.eu-west.settlement";
+
+}
+
+/// Append state.Arg() bytes per iteration, capacity grows only during the first pass
+CXXABB_BENCH_P(Buffer, Append)
+{
+	const std::size_t tChunk = static_cast<std::size_t>(state.Arg());
+	char zChunk[1024];
+	std::memset(zChunk, 'x', sizeof(zChunk));
+
+	CxxAbb::Buffer<char> buffer(Limit);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		if (buffer.size() + tChunk > Limit)
+			buffer.clear();
+		buffer.append(zChunk, tChunk);
+		CxxAbb::Bench::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.Iterations() * tChunk);
+}
+CXXABB_BENCH_ARG(Buffer, Append, 16);
+CXXABB_BENCH_ARG(Buffer, Append, 256);
+CXXABB_BENCH_ARG(Buffer, Append, 1024);
+
+/// Consume state.Arg() bytes from the front of a full buffer, refill when drained
+CXXABB_BENCH_P(Buffer, Remove)
+{
+	const std::size_t tChunk = static_cast<std::size_t>(state.Arg());
+	const std::size_t tFill = 4 * 1024;
+	char zFill[tFill];
+	std::memset(zFill, 'x', sizeof(zFill));
+
+	CxxAbb::Buffer<char> buffer(tFill);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		if (buffer.size() < tChunk)
+			buffer.assign(zFill, tFill);
+		buffer.remove(tChunk);
+		CxxAbb::Bench::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.Iterations() * tChunk);
+}
+CXXABB_BENCH_ARG(Buffer, Remove, 16);
+CXXABB_BENCH_ARG(Buffer, Remove, 256);
+
+/// A message encoded the hand written way into a fresh buffer: memcpy of swapped fields, append per field
+CXXABB_BENCH(Binary, EncodeByHand)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Buffer<char> buffer(16);
+		CxxAbb::UInt32 uiId = CxxAbb::ByteOrder::HostToNetwork(static_cast<CxxAbb::UInt32>(i));
+		CxxAbb::UInt16 uiFlags = CxxAbb::ByteOrder::HostToNetwork(static_cast<CxxAbb::UInt16>(3));
+		CxxAbb::UInt64 uiTime = CxxAbb::ByteOrder::HostToNetwork(i * 1000);
+		CxxAbb::UInt32 uiLength = CxxAbb::ByteOrder::HostToNetwork(static_cast<CxxAbb::UInt32>(MessageName.size()));
+		buffer.append(reinterpret_cast<const char *>(&uiId), sizeof(uiId));
+		buffer.append(reinterpret_cast<const char *>(&uiFlags), sizeof(uiFlags));
+		buffer.append(reinterpret_cast<const char *>(&uiTime), sizeof(uiTime));
+		buffer.append(reinterpret_cast<const char *>(&uiLength), sizeof(uiLength));
+		buffer.append(MessageName.data(), MessageName.size());
+		CxxAbb::Bench::DoNotOptimize(buffer.begin());
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+/// Same message through BinaryWriter with one Reserve()
+CXXABB_BENCH(Binary, EncodeWriter)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Buffer<char> buffer(16);
+		CxxAbb::BinaryWriter writer(buffer);
+		writer.Reserve(4 + 2 + 8 + CxxAbb::BinaryWriter::SizeOfString(MessageName));
+		writer.WriteUInt32(static_cast<CxxAbb::UInt32>(i));
+		writer.WriteUInt16(3);
+		writer.WriteUInt64(i * 1000);
+		writer.WriteString(MessageName);
+		CxxAbb::Bench::DoNotOptimize(buffer.begin());
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+/// Decode it again, the name as a view
+CXXABB_BENCH(Binary, Decode)
+{
+	CxxAbb::Buffer<char> buffer(64);
+	CxxAbb::BinaryWriter writer(buffer);
+	writer.WriteUInt32(1);
+	writer.WriteUInt16(3);
+	writer.WriteUInt64(1000);
+	writer.WriteString(MessageName);
+
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::BinaryReader reader(buffer);
+		CxxAbb::UInt64 uiSum = reader.ReadUInt32() + reader.ReadUInt16() + reader.ReadUInt64();
+		CxxAbb::ByteView name = reader.ReadStringView();
+		CxxAbb::Bench::DoNotOptimize(uiSum);
+		CxxAbb::Bench::DoNotOptimize(name.p_Data);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
@@ -0,0 +1,124 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * DateTimeBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : DateTime
+ * Comment     : DateTime/LocalDateTime conversion cost
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/DateTime.h>
+#include <CxxAbb/LocalDateTime.h>
+#include <CxxAbb/Timestamp.h>
+
+namespace
+{
+
+/// 2017-02-08 00:00:00 UTC
+const std::time_t EpochSecs = 1486512000;
+
+}
+
+CXXABB_BENCH(DateTime, FromTimestamp)
+{
+	CxxAbb::Timestamp timestamp;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::DateTime dt(timestamp);
+		CxxAbb::Bench::DoNotOptimize(dt);
+	}
+}
+
+CXXABB_BENCH(DateTime, FromEpoch)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::DateTime dt(static_cast<std::time_t>(EpochSecs + i));
+		CxxAbb::Bench::DoNotOptimize(dt);
+	}
+}
+
+CXXABB_BENCH(DateTime, ToTimestamp)
+{
+	CxxAbb::DateTime dt(EpochSecs);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Timestamp timestamp = dt.TimestampValue();
+		CxxAbb::Bench::DoNotOptimize(timestamp);
+	}
+}
+
+CXXABB_BENCH(DateTime, JulianDay)
+{
+	CxxAbb::DateTime dt(EpochSecs);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		CxxAbb::Bench::DoNotOptimize(dt.JulianDayNumber());
+}
+
+CXXABB_BENCH(DateTime, AddDays)
+{
+	CxxAbb::DateTime dt(EpochSecs);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		dt.AddDays(1);
+		CxxAbb::Bench::DoNotOptimize(dt);
+	}
+}
+
+CXXABB_BENCH(LocalDateTime, FromDateTime)
+{
+	CxxAbb::DateTime dt(EpochSecs);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::LocalDateTime ldt(dt);
+		CxxAbb::Bench::DoNotOptimize(ldt);
+	}
+}
+
+CXXABB_BENCH(LocalDateTime, FromEpoch)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::LocalDateTime ldt(static_cast<std::time_t>(EpochSecs + i));
+		CxxAbb::Bench::DoNotOptimize(ldt);
+	}
+}
+
+CXXABB_BENCH(LocalDateTime, ToUtc)
+{
+	CxxAbb::LocalDateTime ldt(EpochSecs);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::DateTime dt = ldt.UtcDateTime();
+		CxxAbb::Bench::DoNotOptimize(dt);
+	}
+}
+
+CXXABB_BENCH(LocalDateTime, Copy)
+{
+	CxxAbb::LocalDateTime ldtSource(EpochSecs);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::LocalDateTime ldt(ldtSource);
+		CxxAbb::Bench::DoNotOptimize(ldt);
+	}
+}
@@ -0,0 +1,246 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * FlatHashMapBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : FlatHashMap against std::tr1::unordered_map
+ *
+ */
+
+
+#include <Bench/Bench.h>
+#include <CxxAbb/FlatHashMap.h>
+
+#include <map>
+#include <tr1/unordered_map>
+#include <vector>
+
+namespace
+{
+
+typedef CxxAbb::FlatHashMap<CxxAbb::UInt64, CxxAbb::UInt64> FlatMap;
+typedef std::tr1::unordered_map<CxxAbb::UInt64, CxxAbb::UInt64> StdMap;
+
+/// Random keys, built once per size and kept for all samples
+const std::vector<CxxAbb::UInt64> & Keys(long _lCount)
+{
+	static std::map<long, std::vector<CxxAbb::UInt64> > s_mapKeys;
+	std::vector<CxxAbb::UInt64> & lstKeys = s_mapKeys[_lCount];
+	if (lstKeys.empty())
+	{
+		CxxAbb::UInt64 uiState = 0x9E3779B97F4A7C15ULL ^ static_cast<CxxAbb::UInt64>(_lCount);
+		lstKeys.resize(static_cast<std::size_t>(_lCount));
+		for (std::size_t i = 0; i < lstKeys.size(); ++i)
+		{
+			uiState = uiState * 6364136223846793005ULL + 1442695040888963407ULL;
+			lstKeys[i] = uiState >> 1 << 1; // even, key + 1 is a guaranteed miss
+		}
+	}
+	return lstKeys;
+}
+
+/// Stride through the keys, visiting them in another order than they were
+/// inserted: std nodes would otherwise be read sequentially in memory
+inline std::size_t Stride(std::size_t _tCount)
+{
+	return 7919 % _tCount; // prime, coprime with the powers of ten used
+}
+
+template <typename M>
+M & Filled(long _lCount)
+{
+	static std::map<long, M *> s_mapMaps;
+	M *& pMap = s_mapMaps[_lCount];
+	if (!pMap)
+	{
+		const std::vector<CxxAbb::UInt64> & lstKeys = Keys(_lCount);
+		pMap = new M();
+		for (std::size_t i = 0; i < lstKeys.size(); ++i)
+			(*pMap)[lstKeys[i]] = i;
+	}
+	return *pMap;
+}
+
+template <typename M>
+void Insert(CxxAbb::Bench::State & state)
+{
+	state.PauseTiming();
+	const std::vector<CxxAbb::UInt64> & lstKeys = Keys(state.Arg());
+	state.ResumeTiming();
+	M map;
+	std::size_t j = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		if (j == lstKeys.size())
+		{
+			state.PauseTiming();
+			M().swap(map);
+			j = 0;
+			state.ResumeTiming();
+		}
+		map.insert(std::make_pair(lstKeys[j], i));
+		++j;
+	}
+	CxxAbb::Bench::DoNotOptimize(map);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+template <typename M>
+void Find(CxxAbb::Bench::State & state, CxxAbb::UInt64 _uiOffset)
+{
+	state.PauseTiming();
+	const std::vector<CxxAbb::UInt64> & lstKeys = Keys(state.Arg());
+	const M & map = Filled<M>(state.Arg());
+	state.ResumeTiming();
+	const std::size_t tStride = Stride(lstKeys.size());
+	std::size_t j = 0, tFound = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		tFound += map.find(lstKeys[j] + _uiOffset) != map.end();
+		j += tStride;
+		if (j >= lstKeys.size())
+			j -= lstKeys.size();
+	}
+	CxxAbb::Bench::DoNotOptimize(tFound);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+template <typename M>
+void EraseInsert(CxxAbb::Bench::State & state)
+{
+	state.PauseTiming();
+	const std::vector<CxxAbb::UInt64> & lstKeys = Keys(state.Arg());
+	M & map = Filled<M>(state.Arg());
+	state.ResumeTiming();
+	const std::size_t tStride = Stride(lstKeys.size());
+	std::size_t j = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		map.erase(lstKeys[j]);
+		map.insert(std::make_pair(lstKeys[j], i));
+		j += tStride;
+		if (j >= lstKeys.size())
+			j -= lstKeys.size();
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+/// Both maps behind the same lower case interface for the templates above
+struct Flat: public FlatMap
+{
+	typedef FlatMap::ConstIterator const_iterator;
+
+	void insert(const FlatMap::ValueType & _value)
+	{
+		Insert(_value);
+	}
+
+	template <typename Q>
+	FlatMap::ConstIterator find(const Q & _key) const
+	{
+		return Find(_key);
+	}
+
+	std::size_t erase(CxxAbb::UInt64 _uiKey)
+	{
+		return Erase(_uiKey);
+	}
+
+	void swap(Flat & _rhs)
+	{
+		Swap(_rhs);
+	}
+};
+
+}
+
+CXXABB_BENCH_P(HashMap, FlatInsert) { Insert<Flat>(state); }
+CXXABB_BENCH_P(HashMap, StdInsert) { Insert<StdMap>(state); }
+CXXABB_BENCH_P(HashMap, FlatFind) { Find<Flat>(state, 0); }
+CXXABB_BENCH_P(HashMap, StdFind) { Find<StdMap>(state, 0); }
+CXXABB_BENCH_P(HashMap, FlatFindMiss) { Find<Flat>(state, 1); }
+CXXABB_BENCH_P(HashMap, StdFindMiss) { Find<StdMap>(state, 1); }
+CXXABB_BENCH_P(HashMap, FlatEraseInsert) { EraseInsert<Flat>(state); }
+CXXABB_BENCH_P(HashMap, StdEraseInsert) { EraseInsert<StdMap>(state); }
+
+/// 1e3 fits L1, 1e5 L2/L3, 1e7 only memory
+CXXABB_BENCH_ARG(HashMap, FlatInsert, 1000);
+CXXABB_BENCH_ARG(HashMap, FlatInsert, 100000);
+CXXABB_BENCH_ARG(HashMap, FlatInsert, 10000000);
+CXXABB_BENCH_ARG(HashMap, StdInsert, 1000);
+CXXABB_BENCH_ARG(HashMap, StdInsert, 100000);
+CXXABB_BENCH_ARG(HashMap, StdInsert, 10000000);
+CXXABB_BENCH_ARG(HashMap, FlatFind, 1000);
+CXXABB_BENCH_ARG(HashMap, FlatFind, 100000);
+CXXABB_BENCH_ARG(HashMap, FlatFind, 10000000);
+CXXABB_BENCH_ARG(HashMap, StdFind, 1000);
+CXXABB_BENCH_ARG(HashMap, StdFind, 100000);
+CXXABB_BENCH_ARG(HashMap, StdFind, 10000000);
+CXXABB_BENCH_ARG(HashMap, FlatFindMiss, 1000);
+CXXABB_BENCH_ARG(HashMap, FlatFindMiss, 100000);
+CXXABB_BENCH_ARG(HashMap, FlatFindMiss, 10000000);
+CXXABB_BENCH_ARG(HashMap, StdFindMiss, 1000);
+CXXABB_BENCH_ARG(HashMap, StdFindMiss, 100000);
+CXXABB_BENCH_ARG(HashMap, StdFindMiss, 10000000);
+CXXABB_BENCH_ARG(HashMap, FlatEraseInsert, 1000);
+CXXABB_BENCH_ARG(HashMap, FlatEraseInsert, 100000);
+CXXABB_BENCH_ARG(HashMap, FlatEraseInsert, 10000000);
+CXXABB_BENCH_ARG(HashMap, StdEraseInsert, 1000);
+CXXABB_BENCH_ARG(HashMap, StdEraseInsert, 100000);
+CXXABB_BENCH_ARG(HashMap, StdEraseInsert, 10000000);
+
+/// Short lived 8 element maps, the table from a MemoryPool or the heap
+CXXABB_BENCH(HashMap, SmallPooled)
+{
+	CxxAbb::MemoryPool pool(FlatMap::StorageSize(16), 0, 1);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		FlatMap map(&pool);
+		for (CxxAbb::UInt64 j = 0; j < 8; ++j)
+			map[i + j] = j;
+		CxxAbb::Bench::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(HashMap, SmallHeap)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		FlatMap map;
+		for (CxxAbb::UInt64 j = 0; j < 8; ++j)
+			map[i + j] = j;
+		CxxAbb::Bench::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(HashMap, SmallStd)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		StdMap map;
+		for (CxxAbb::UInt64 j = 0; j < 8; ++j)
+			map[i + j] = j;
+		CxxAbb::Bench::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
@@ -0,0 +1,89 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LoggerBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Logging
+ * Comment     : Asynchronous logger benchmarks
+ *
+ */
+
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Log/Logger.h>
+#include <CxxAbb/Log/Sink.h>
+
+using CxxAbb::UInt64;
+
+namespace
+{
+
+/// Discards the lines, the runs measure enqueue and formatting but not the disk
+class NullSink: public CxxAbb::Log::Sink
+{
+public:
+	void Write(const struct iovec *, int)
+	{}
+};
+
+/// Every thread logs into its own ring, the writer formats behind them
+class Logging: public CxxAbb::Bench::Benchmark
+{
+public:
+	Logging(const char * _zSuite, const char * _zName)
+		: CxxAbb::Bench::Benchmark(_zSuite, _zName)
+	{
+	}
+
+	void Setup(CxxAbb::Bench::State &)
+	{
+		CxxAbb::Log::LoggerOptions options;
+		options.e_Overflow = CxxAbb::Log::OverflowBlock;
+		options.l_FlushMilliSeconds = 1;
+		CxxAbb::Log::Logger::Start(new NullSink, options);
+	}
+
+	void TearDown(CxxAbb::Bench::State &)
+	{
+		CxxAbb::Log::Logger::Stop();
+	}
+};
+
+}
+
+CXXABB_BENCH_THREADED(Logging, Disabled)
+{
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+		CxxAbb::Log::Debug("filtered {}", i);
+}
+
+CXXABB_BENCH_THREADED(Logging, Integers)
+{
+	state.SetItemsProcessed(state.Iterations());
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+		CxxAbb::Log::Info("record {} of thread {}", i, state.ThreadIndex());
+}
+
+CXXABB_BENCH_THREADED(Logging, String)
+{
+	state.SetItemsProcessed(state.Iterations());
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+		CxxAbb::Log::Info("request {} from {} took {} ms", i, "client.example.org", 1.25);
+}
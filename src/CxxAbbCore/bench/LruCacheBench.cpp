@@ -0,0 +1,177 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LruCacheBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : LruCache against a mutex guarded std::map + std::list cache
+ *
+ */
+
+
+
+#include <Bench/Bench.h>
+#include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/Timestamp.h>
+#include <CxxAbb/Sys/LruCache.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+
+#include <list>
+#include <map>
+
+using CxxAbb::UInt64;
+
+namespace
+{
+
+typedef CxxAbb::Sys::LruCache<UInt64, UInt64>::ValuePtr ValuePtr;
+
+/// The hand rolled expiring cache: std::map index, std::list recency, one mutex
+class MapCache
+{
+public:
+	explicit MapCache(std::size_t _tCapacity, CxxAbb::Timestamp::TimeDiff _tTimeToLive)
+		: t_Capacity(_tCapacity),
+		  t_TimeToLive(_tTimeToLive)
+	{}
+
+	bool Find(UInt64 _uiKey, ValuePtr & _value)
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::FastMutex> lock(m_Mutex);
+		EntryMap::iterator it = m_Entries.find(_uiKey);
+		if (it == m_Entries.end())
+			return false;
+		if (it->second.m_Inserted.IsElapsed(t_TimeToLive))
+		{
+			lst_Recency.erase(it->second.it_Recency);
+			m_Entries.erase(it);
+			return false;
+		}
+		lst_Recency.splice(lst_Recency.begin(), lst_Recency, it->second.it_Recency);
+		_value = it->second.m_Value;
+		return true;
+	}
+
+	void Insert(UInt64 _uiKey, const ValuePtr & _value)
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::FastMutex> lock(m_Mutex);
+		EntryMap::iterator it = m_Entries.find(_uiKey);
+		if (it != m_Entries.end())
+		{
+			lst_Recency.erase(it->second.it_Recency);
+			m_Entries.erase(it);
+		}
+		lst_Recency.push_front(_uiKey);
+		Entry & entry = m_Entries[_uiKey];
+		entry.m_Value = _value;
+		entry.it_Recency = lst_Recency.begin();
+		if (m_Entries.size() > t_Capacity)
+		{
+			m_Entries.erase(lst_Recency.back());
+			lst_Recency.pop_back();
+		}
+	}
+
+private:
+	struct Entry
+	{
+		ValuePtr m_Value;
+		CxxAbb::Timestamp m_Inserted;
+		std::list<UInt64>::iterator it_Recency;
+	};
+
+	typedef std::map<UInt64, Entry> EntryMap;
+
+	CxxAbb::Sys::FastMutex m_Mutex;
+	EntryMap m_Entries;
+	std::list<UInt64> lst_Recency;
+	std::size_t t_Capacity;
+	CxxAbb::Timestamp::TimeDiff t_TimeToLive;
+};
+
+/** Both caches hold Capacity entries with a 60 s time to live and see keys
+ * drawn from 5/4 of the capacity, a miss inserts. Kept filled across runs.
+ */
+class Caches: public CxxAbb::Bench::Benchmark
+{
+public:
+	enum
+	{
+		Capacity = 1 << 16,
+		KeySpace = Capacity + Capacity / 4
+	};
+
+	Caches(const char * _zSuite, const char * _zName)
+		: CxxAbb::Bench::Benchmark(_zSuite, _zName)
+	{
+	}
+
+protected:
+	static MapCache & Map()
+	{
+		static MapCache s_Cache(Capacity, 60 * CxxAbb::Timestamp::Resolution());
+		return s_Cache;
+	}
+
+	static CxxAbb::Sys::LruCache<UInt64, UInt64> & Lru()
+	{
+		static CxxAbb::Sys::LruCache<UInt64, UInt64> s_Cache(Capacity, 60 * CxxAbb::Timestamp::Resolution());
+		return s_Cache;
+	}
+
+	/// Per thread LCG
+	static UInt64 NextKey(UInt64 & _uiSeed)
+	{
+		_uiSeed = _uiSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+		return (_uiSeed >> 32) % KeySpace;
+	}
+
+	template <typename C>
+	static void FindOrInsert(C & _cache, CxxAbb::Bench::State & state)
+	{
+		UInt64 uiSeed = static_cast<UInt64>(state.ThreadIndex()) + 1;
+		ValuePtr value(new UInt64(0));
+		UInt64 uiSum = 0;
+		for (UInt64 i = 0; i < state.Iterations(); ++i)
+		{
+			CxxAbb::Bench::LatencyProbe probe(state, i);
+			UInt64 uiKey = NextKey(uiSeed);
+			if (_cache.Find(uiKey, value))
+				uiSum += *value;
+			else
+				_cache.Insert(uiKey, ValuePtr(new UInt64(uiKey)));
+		}
+		CxxAbb::Bench::DoNotOptimize(uiSum);
+		state.SetItemsProcessed(state.Iterations());
+	}
+};
+
+}
+
+CXXABB_BENCH_THREADED(Caches, MapCache)
+{
+	FindOrInsert(Map(), state);
+}
+
+CXXABB_BENCH_THREADED(Caches, LruCache)
+{
+	FindOrInsert(Lru(), state);
+}
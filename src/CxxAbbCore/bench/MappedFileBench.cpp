@@ -0,0 +1,111 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * MappedFileBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Scanning a file through MappedFile against read()
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/MappedFile.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+const char * ScanFile = "/tmp/CxxAbbMappedFileBench.bin";
+const std::size_t FileSize = 64 * 1024 * 1024;
+const std::size_t ChunkSize = 1024 * 1024;
+
+/// Written once per process, in the page cache for every sample after the first
+void CreateScanFile()
+{
+	static bool s_bCreated = false;
+	if (s_bCreated)
+		return;
+
+	std::vector<CxxAbb::UInt64> lstChunk(ChunkSize / sizeof(CxxAbb::UInt64));
+	for (std::size_t i = 0; i < lstChunk.size(); ++i)
+		lstChunk[i] = i * 0x9E3779B97F4A7C15ULL;
+	std::FILE * pFile = std::fopen(ScanFile, "wb");
+	for (std::size_t i = 0; i < FileSize / ChunkSize; ++i)
+		std::fwrite(&lstChunk[0], 1, ChunkSize, pFile);
+	std::fclose(pFile);
+	s_bCreated = true;
+}
+
+CxxAbb::UInt64 Sum(const char * _pData, std::size_t _tSize)
+{
+	CxxAbb::UInt64 uiSum = 0;
+	for (std::size_t i = 0; i + sizeof(CxxAbb::UInt64) <= _tSize; i += sizeof(CxxAbb::UInt64))
+	{
+		CxxAbb::UInt64 uiWord;
+		std::memcpy(&uiWord, _pData + i, sizeof(uiWord));
+		uiSum += uiWord;
+	}
+	return uiSum;
+}
+
+}
+
+/// read() into a 1 MB buffer and sum it, the copy out of the page cache is the difference
+CXXABB_BENCH(MappedFile, ScanRead)
+{
+	state.PauseTiming();
+	CreateScanFile();
+	std::vector<char> lstBuffer(ChunkSize);
+	state.ResumeTiming();
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		int iFd = ::open(ScanFile, O_RDONLY);
+		CxxAbb::UInt64 uiSum = 0;
+		ssize_t tRead;
+		while ((tRead = ::read(iFd, &lstBuffer[0], ChunkSize)) > 0)
+			uiSum += Sum(&lstBuffer[0], static_cast<std::size_t>(tRead));
+		::close(iFd);
+		CxxAbb::Bench::DoNotOptimize(uiSum);
+	}
+	state.SetBytesProcessed(state.Iterations() * FileSize);
+}
+
+/// Map, sum the view in place, unmap
+CXXABB_BENCH(MappedFile, ScanMapped)
+{
+	state.PauseTiming();
+	CreateScanFile();
+	state.ResumeTiming();
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::MappedFile file(ScanFile, CxxAbb::MappedFile::ReadOnly, CxxAbb::MappedFile::Shared,
+				CxxAbb::MappedFile::Populate);
+		file.Advise(CxxAbb::MappedFile::AdviceSequential);
+		CxxAbb::BufferView<char> view = file.View(0, file.Size());
+		CxxAbb::UInt64 uiSum = Sum(view.begin(), view.size());
+		CxxAbb::Bench::DoNotOptimize(uiSum);
+	}
+	state.SetBytesProcessed(state.Iterations() * FileSize);
+}
@@ -0,0 +1,108 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * MemoryPoolBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Memory
+ * Comment     : MemoryPool Get/Release against the global allocator
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/MemoryPool.h>
+
+#include <vector>
+
+CXXABB_BENCH_P(MemoryPool, GetRelease)
+{
+	CxxAbb::MemoryPool pool(static_cast<std::size_t>(state.Arg()), 0, 16);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		void * pBlock = pool.Get();
+		CxxAbb::Bench::DoNotOptimize(pBlock);
+		pool.Release(pBlock);
+	}
+}
+CXXABB_BENCH_ARG(MemoryPool, GetRelease, 64);
+CXXABB_BENCH_ARG(MemoryPool, GetRelease, 4096);
+
+/// Hold 64 blocks at a time, exercises the free list rather than one hot block
+CXXABB_BENCH_P(MemoryPool, GetReleaseBatch)
+{
+	const std::size_t tBatch = 64;
+	CxxAbb::MemoryPool pool(static_cast<std::size_t>(state.Arg()), 0, tBatch);
+	std::vector<void *> lst_Blocks(tBatch);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		for (std::size_t b = 0; b < tBatch; ++b)
+			lst_Blocks[b] = pool.Get();
+		for (std::size_t b = 0; b < tBatch; ++b)
+			pool.Release(lst_Blocks[b]);
+	}
+	state.SetItemsProcessed(state.Iterations() * tBatch);
+}
+CXXABB_BENCH_ARG(MemoryPool, GetReleaseBatch, 64);
+
+/// Reference: the same pattern through operator new/delete
+CXXABB_BENCH_P(MemoryPool, NewDelete)
+{
+	const std::size_t tSize = static_cast<std::size_t>(state.Arg());
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		char * pBlock = new char[tSize];
+		CxxAbb::Bench::DoNotOptimize(pBlock);
+		delete [] pBlock;
+	}
+}
+CXXABB_BENCH_ARG(MemoryPool, NewDelete, 64);
+CXXABB_BENCH_ARG(MemoryPool, NewDelete, 4096);
+
+/// Failure path of an exhausted pool: OutOfMemoryException unwind
+CXXABB_BENCH(MemoryPool, ExhaustedThrow)
+{
+	CxxAbb::MemoryPool pool(64, 1, 1);
+	void * pHeld = pool.Get();
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		try
+		{
+			CxxAbb::Bench::DoNotOptimize(pool.Get());
+		}
+		catch (CxxAbb::OutOfMemoryException &)
+		{
+			CxxAbb::Bench::ClobberMemory();
+		}
+	}
+	pool.Release(pHeld);
+}
+
+/// Failure path of an exhausted pool: Result error code
+CXXABB_BENCH(MemoryPool, ExhaustedTryGet)
+{
+	CxxAbb::MemoryPool pool(64, 1, 1);
+	void * pHeld = pool.Get();
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Result<void*> block = pool.TryGet();
+		CxxAbb::Bench::DoNotOptimize(block);
+	}
+	pool.Release(pHeld);
+}
@@ -0,0 +1,135 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * NumberFormatBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : NumberFormat against iostreams and stdio
+ *
+ */
+
+
+#include <Bench/Bench.h>
+#include <CxxAbb/NumberFormat.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+
+/// Mixed magnitudes so the digit count varies per iteration
+const double Doubles[] = { 0.1, 3.14159, 2.5e-7, 123456.789, 1e21, 0.30000000000000004, 42.0, 6.02214076e23 };
+const CxxAbb::UInt64 Integers[] = { 7, 1234, 99999, 1234567, 4294967296ULL, 18446744073709551615ULL, 12, 98765 };
+
+}
+
+CXXABB_BENCH(NumberFormat, UInt64)
+{
+	char aText[CxxAbb::NumberFormat::MaxUInt64Chars];
+	std::size_t tLength = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		tLength += CxxAbb::NumberFormat::FormatUInt64(aText, Integers[i & 7]);
+	CxxAbb::Bench::DoNotOptimize(tLength);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(NumberFormat, UInt64Sprintf)
+{
+	char aText[32];
+	std::size_t tLength = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		tLength += static_cast<std::size_t>(std::sprintf(aText, "%llu", static_cast<unsigned long long>(Integers[i & 7])));
+	CxxAbb::Bench::DoNotOptimize(tLength);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(NumberFormat, UInt64Stream)
+{
+	std::size_t tLength = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		std::ostringstream ss;
+		ss << Integers[i & 7];
+		tLength += ss.str().size();
+	}
+	CxxAbb::Bench::DoNotOptimize(tLength);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(NumberFormat, Double)
+{
+	char aText[CxxAbb::NumberFormat::MaxDoubleChars];
+	std::size_t tLength = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		tLength += CxxAbb::NumberFormat::FormatDouble(aText, Doubles[i & 7]);
+	CxxAbb::Bench::DoNotOptimize(tLength);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+/// %.17g round-trips too, but is not shortest
+CXXABB_BENCH(NumberFormat, DoubleSprintf)
+{
+	char aText[32];
+	std::size_t tLength = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		tLength += static_cast<std::size_t>(std::sprintf(aText, "%.17g", Doubles[i & 7]));
+	CxxAbb::Bench::DoNotOptimize(tLength);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(NumberFormat, DoubleStream)
+{
+	std::size_t tLength = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		std::ostringstream ss;
+		ss.precision(17);
+		ss << Doubles[i & 7];
+		tLength += ss.str().size();
+	}
+	CxxAbb::Bench::DoNotOptimize(tLength);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(NumberFormat, ParseDouble)
+{
+	const char * aTexts[] = { "0.1", "3.14159", "2.5e-7", "123456.789", "1e+21", "0.30000000000000004", "42", "6.02214076e+23" };
+	std::size_t aLengths[8];
+	for (int i = 0; i < 8; ++i)
+		aLengths[i] = std::strlen(aTexts[i]);
+	double dSum = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		dSum += CxxAbb::NumberFormat::ParseDouble(aTexts[i & 7], aLengths[i & 7]).Value();
+	CxxAbb::Bench::DoNotOptimize(dSum);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(NumberFormat, ParseDoubleStrtod)
+{
+	const char * aTexts[] = { "0.1", "3.14159", "2.5e-7", "123456.789", "1e+21", "0.30000000000000004", "42", "6.02214076e+23" };
+	double dSum = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		dSum += std::strtod(aTexts[i & 7], NULL);
+	CxxAbb::Bench::DoNotOptimize(dSum);
+	state.SetItemsProcessed(state.Iterations());
+}
@@ -0,0 +1,173 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ParallelBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Parallel algorithms over worker count, argument 0 is the serial reference
+ *
+ */
+
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Sys/Parallel.h>
+#include <CxxAbb/Sys/ThreadPool.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/SmartPtr.h>
+
+#include <algorithm>
+#include <functional>
+
+
+namespace
+{
+
+using CxxAbb::UInt32;
+using CxxAbb::UInt64;
+
+const std::size_t Elements = 1 << 20;
+
+class Transform
+{
+public:
+	void operator()(UInt32 * _pBegin, UInt32 * _pEnd) const
+	{
+		for (; _pBegin != _pEnd; ++_pBegin)
+			*_pBegin = *_pBegin * 2654435761U + 0x9E3779B9U;
+	}
+};
+
+class Checksum: public std::binary_function<const UInt32 *, const UInt32 *, UInt64>
+{
+public:
+	UInt64 operator()(const UInt32 * _pBegin, const UInt32 * _pEnd) const
+	{
+		UInt64 uiSum = 0;
+		for (; _pBegin != _pEnd; ++_pBegin)
+			uiSum += *_pBegin ^ (uiSum >> 7);
+		return uiSum;
+	}
+};
+
+/// Deterministic xorshift fill, so every run sorts the same input
+void Fill(CxxAbb::Buffer<UInt32> & _buffer)
+{
+	UInt32 uiState = 2463534242U;
+	for (std::size_t i = 0; i < _buffer.size(); ++i)
+	{
+		uiState ^= uiState << 13;
+		uiState ^= uiState >> 17;
+		uiState ^= uiState << 5;
+		_buffer[i] = uiState;
+	}
+}
+
+/// Untimed setup shared by the kernels: filled input and a pool of state.Arg() workers
+class Fixture
+{
+public:
+	explicit Fixture(CxxAbb::Bench::State & _state)
+		: m_Buffer(Elements)
+	{
+		_state.PauseTiming();
+		m_Buffer.size(Elements);
+		Fill(m_Buffer);
+		if (_state.Arg() > 0)
+			ptr_Pool.reset(new CxxAbb::Sys::ThreadPool(static_cast<unsigned int>(_state.Arg()), "Bench"));
+		_state.ResumeTiming();
+	}
+
+	CxxAbb::Buffer<UInt32> & Data()
+	{
+		return m_Buffer;
+	}
+
+	/// NullPtr for the serial reference
+	CxxAbb::Sys::ThreadPool * Pool()
+	{
+		return ptr_Pool.get();
+	}
+
+private:
+	CxxAbb::Buffer<UInt32> m_Buffer;
+	CxxAbb::ScopedPtr<CxxAbb::Sys::ThreadPool> ptr_Pool;
+};
+
+}
+
+CXXABB_BENCH_P(Parallel, For)
+{
+	Fixture fixture(state);
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		if (fixture.Pool())
+			CxxAbb::Sys::ParallelFor(fixture.Data(), Transform(), 0, *fixture.Pool());
+		else
+			Transform()(fixture.Data().begin(), fixture.Data().end());
+		CxxAbb::Bench::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.Iterations() * Elements);
+}
+CXXABB_BENCH_ARG(Parallel, For, 0);
+CXXABB_BENCH_ARG(Parallel, For, 1);
+CXXABB_BENCH_ARG(Parallel, For, 2);
+CXXABB_BENCH_ARG(Parallel, For, 4);
+
+CXXABB_BENCH_P(Parallel, Reduce)
+{
+	Fixture fixture(state);
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		UInt64 uiSum;
+		if (fixture.Pool())
+			uiSum = CxxAbb::Sys::ParallelReduce(fixture.Data(), UInt64(0), Checksum(),
+					std::plus<UInt64>(), 0, *fixture.Pool());
+		else
+			uiSum = Checksum()(fixture.Data().begin(), fixture.Data().end());
+		CxxAbb::Bench::DoNotOptimize(uiSum);
+	}
+	state.SetItemsProcessed(state.Iterations() * Elements);
+}
+CXXABB_BENCH_ARG(Parallel, Reduce, 0);
+CXXABB_BENCH_ARG(Parallel, Reduce, 1);
+CXXABB_BENCH_ARG(Parallel, Reduce, 2);
+CXXABB_BENCH_ARG(Parallel, Reduce, 4);
+
+CXXABB_BENCH_P(Parallel, Sort)
+{
+	Fixture fixture(state);
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		state.PauseTiming();
+		Fill(fixture.Data());
+		state.ResumeTiming();
+		if (fixture.Pool())
+			CxxAbb::Sys::ParallelSort(fixture.Data().begin(), fixture.Data().end(),
+					std::less<UInt32>(), 0, *fixture.Pool());
+		else
+			std::sort(fixture.Data().begin(), fixture.Data().end());
+		CxxAbb::Bench::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.Iterations() * Elements);
+}
+CXXABB_BENCH_ARG(Parallel, Sort, 0);
+CXXABB_BENCH_ARG(Parallel, Sort, 1);
+CXXABB_BENCH_ARG(Parallel, Sort, 2);
+CXXABB_BENCH_ARG(Parallel, Sort, 4);
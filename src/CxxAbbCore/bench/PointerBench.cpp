@@ -0,0 +1,163 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * PointerBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Memory
+ * Comment     : Copy and reset cost of the smart pointer family
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/RefCountedObj.h>
+
+namespace
+{
+
+class Object: public CxxAbb::RefCounted
+{
+public:
+	Object() : i_Value(0) {}
+
+	int i_Value;
+};
+
+class AtomicObject: public CxxAbb::AtomicRefCounted
+{
+public:
+	AtomicObject() : i_Value(0) {}
+
+	int i_Value;
+};
+
+class IntrusiveObject: public CxxAbb::IntrusiveRefCounted<IntrusiveObject, CxxAbb::PlainRefCount>
+{
+public:
+	IntrusiveObject() : i_Value(0) {}
+
+	int i_Value;
+};
+
+class IntrusiveAtomicObject: public CxxAbb::IntrusiveRefCounted<IntrusiveAtomicObject, CxxAbb::AtomicRefCount>
+{
+public:
+	IntrusiveAtomicObject() : i_Value(0) {}
+
+	int i_Value;
+};
+
+}
+
+CXXABB_BENCH(SmartPtr, Copy)
+{
+	CxxAbb::SmartPtr<int> ptrSource(new int(1));
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::SmartPtr<int> ptrCopy(ptrSource);
+		CxxAbb::Bench::DoNotOptimize(ptrCopy);
+	}
+}
+
+CXXABB_BENCH(SmartPtr, Create)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::SmartPtr<int> ptr(new int(1));
+		CxxAbb::Bench::DoNotOptimize(ptr);
+	}
+}
+
+CXXABB_BENCH(SharedPtr, Copy)
+{
+	CxxAbb::SharedPtr<int> ptrSource(new int(1));
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::SharedPtr<int> ptrCopy(ptrSource);
+		CxxAbb::Bench::DoNotOptimize(ptrCopy);
+	}
+}
+
+CXXABB_BENCH(SharedPtr, Create)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::SharedPtr<int> ptr(new int(1));
+		CxxAbb::Bench::DoNotOptimize(ptr);
+	}
+}
+
+CXXABB_BENCH(AutoPtr, Copy)
+{
+	CxxAbb::AutoPtr<Object> ptrSource(new Object);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::AutoPtr<Object> ptrCopy(ptrSource);
+		CxxAbb::Bench::DoNotOptimize(ptrCopy);
+	}
+}
+
+CXXABB_BENCH(AutoPtr, CopyAtomic)
+{
+	CxxAbb::AutoPtr<AtomicObject> ptrSource(new AtomicObject);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::AutoPtr<AtomicObject> ptrCopy(ptrSource);
+		CxxAbb::Bench::DoNotOptimize(ptrCopy);
+	}
+}
+
+CXXABB_BENCH(AutoPtr, Create)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::AutoPtr<Object> ptr(new Object);
+		CxxAbb::Bench::DoNotOptimize(ptr);
+	}
+}
+
+CXXABB_BENCH(IntrusivePtr, Copy)
+{
+	CxxAbb::IntrusivePtr<IntrusiveObject> ptrSource(new IntrusiveObject);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::IntrusivePtr<IntrusiveObject> ptrCopy(ptrSource);
+		CxxAbb::Bench::DoNotOptimize(ptrCopy);
+	}
+}
+
+CXXABB_BENCH(IntrusivePtr, CopyAtomic)
+{
+	CxxAbb::IntrusivePtr<IntrusiveAtomicObject> ptrSource(new IntrusiveAtomicObject);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::IntrusivePtr<IntrusiveAtomicObject> ptrCopy(ptrSource);
+		CxxAbb::Bench::DoNotOptimize(ptrCopy);
+	}
+}
+
+CXXABB_BENCH(IntrusivePtr, Create)
+{
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::IntrusivePtr<IntrusiveObject> ptr(new IntrusiveObject);
+		CxxAbb::Bench::DoNotOptimize(ptr);
+	}
+}
@@ -0,0 +1,421 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ScalingBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Throughput and tail latency of Sys primitives over thread count
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/MemoryPool.h>
+#include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/Sys/ConcurrentHashMap.h>
+#include <CxxAbb/Sys/Environment.h>
+#include <CxxAbb/Sys/Atomicity.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Sys/StripedCounter.h>
+#include <CxxAbb/Sys/WaitCondition.h>
+
+#include <deque>
+#include <map>
+
+using CxxAbb::UInt64;
+
+namespace
+{
+
+/// All threads hammer one lock, counter or pool
+class Contention: public CxxAbb::Bench::Benchmark
+{
+public:
+	Contention(const char * _zSuite, const char * _zName)
+		: CxxAbb::Bench::Benchmark(_zSuite, _zName),
+		  ui_Shared(0)
+	{
+	}
+
+	void Setup(CxxAbb::Bench::State &)
+	{
+		ui_Shared = 0;
+		ptr_Pool.reset(new CxxAbb::MemoryPool(64));
+	}
+
+	void TearDown(CxxAbb::Bench::State &)
+	{
+		ptr_Pool.reset();
+	}
+
+protected:
+	CxxAbb::Sys::Mutex m_Mutex;
+	CxxAbb::Sys::FastMutex m_FastMutex;
+	CxxAbb::Sys::AtomicCounter m_Counter;
+	CxxAbb::Sys::StripedCounter m_StripedCounter;
+	CxxAbb::ScopedPtr<CxxAbb::MemoryPool> ptr_Pool;
+	UInt64 ui_Shared;
+};
+
+/** Threads 2k and 2k+1 bounce a pair of events, the measured round trip is
+ * one Set() and one wake up each way. A thread without partner signals itself.
+ */
+class PingPong: public CxxAbb::Bench::Benchmark
+{
+public:
+	PingPong(const char * _zSuite, const char * _zName)
+		: CxxAbb::Bench::Benchmark(_zSuite, _zName)
+	{
+	}
+
+	void Setup(CxxAbb::Bench::State & _state)
+	{
+		std::size_t tPairs = static_cast<std::size_t>(_state.Threads() + 1) / 2;
+		ptr_Ping.reset(new CxxAbb::Sys::SigEvent[tPairs]);
+		ptr_Pong.reset(new CxxAbb::Sys::SigEvent[tPairs]);
+	}
+
+	void TearDown(CxxAbb::Bench::State &)
+	{
+		ptr_Ping.reset();
+		ptr_Pong.reset();
+	}
+
+protected:
+	CxxAbb::ScopedArrayPtr<CxxAbb::Sys::SigEvent> ptr_Ping;
+	CxxAbb::ScopedArrayPtr<CxxAbb::Sys::SigEvent> ptr_Pong;
+};
+
+/** Bounded queue guarded by a Mutex with WaitCondition for not empty / not full.
+ * Even threads produce, odd threads consume, the last thread of an odd count does both.
+ */
+class ProducerConsumer: public CxxAbb::Bench::Benchmark
+{
+public:
+	enum
+	{
+		Capacity = 256
+	};
+
+	ProducerConsumer(const char * _zSuite, const char * _zName)
+		: CxxAbb::Bench::Benchmark(_zSuite, _zName)
+	{
+	}
+
+	void Setup(CxxAbb::Bench::State &)
+	{
+		m_Queue.clear();
+	}
+
+protected:
+	void Push(UInt64 _uiValue)
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::Mutex> lock(m_Mutex);
+		while (m_Queue.size() >= static_cast<std::size_t>(Capacity))
+			m_NotFull.Wait(m_Mutex);
+		m_Queue.push_back(_uiValue);
+		m_NotEmpty.Signal();
+	}
+
+	UInt64 Pop()
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::Mutex> lock(m_Mutex);
+		while (m_Queue.empty())
+			m_NotEmpty.Wait(m_Mutex);
+		UInt64 uiValue = m_Queue.front();
+		m_Queue.pop_front();
+		m_NotFull.Signal();
+		return uiValue;
+	}
+
+	CxxAbb::Sys::Mutex m_Mutex;
+	CxxAbb::Sys::WaitCondition m_NotEmpty;
+	CxxAbb::Sys::WaitCondition m_NotFull;
+	std::deque<UInt64> m_Queue;
+};
+
+
+/** Read mostly lookup table shared by all threads: a std::map behind one
+ * FastMutex against the sharded ConcurrentHashMap. Both are filled once with
+ * Keys entries and kept across runs, writers only replace existing values.
+ */
+class SharedTable: public CxxAbb::Bench::Benchmark
+{
+public:
+	enum
+	{
+		Keys = 1 << 16
+	};
+
+	typedef CxxAbb::Sys::ConcurrentHashMap<UInt64, UInt64>::ValuePtr ValuePtr;
+
+	SharedTable(const char * _zSuite, const char * _zName)
+		: CxxAbb::Bench::Benchmark(_zSuite, _zName)
+	{
+	}
+
+	void Setup(CxxAbb::Bench::State &)
+	{
+		if (!m_Map.empty())
+			return;
+		for (UInt64 i = 0; i < Keys; ++i)
+		{
+			ValuePtr value(new UInt64(i));
+			m_Map.insert(std::make_pair(i, value));
+			m_Concurrent.InsertOrAssign(i, value);
+		}
+	}
+
+protected:
+	/// Per thread LCG, top bits give the key
+	static UInt64 NextKey(UInt64 & _uiSeed)
+	{
+		_uiSeed = _uiSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+		return (_uiSeed >> 32) & (Keys - 1);
+	}
+
+	bool MapFind(UInt64 _uiKey, ValuePtr & _value)
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::FastMutex> lock(m_Mutex);
+		std::map<UInt64, ValuePtr>::const_iterator it = m_Map.find(_uiKey);
+		if (it == m_Map.end())
+			return false;
+		_value = it->second;
+		return true;
+	}
+
+	void MapAssign(UInt64 _uiKey, const ValuePtr & _value)
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::FastMutex> lock(m_Mutex);
+		m_Map.find(_uiKey)->second = _value;
+	}
+
+	CxxAbb::Sys::FastMutex m_Mutex;
+	std::map<UInt64, ValuePtr> m_Map;
+	CxxAbb::Sys::ConcurrentHashMap<UInt64, UInt64> m_Concurrent;
+};
+
+}
+
+CXXABB_BENCH_THREADED(Contention, Mutex)
+{
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::Mutex> lock(m_Mutex);
+		++ui_Shared;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(Contention, FastMutex)
+{
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::FastMutex> lock(m_FastMutex);
+		++ui_Shared;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(Contention, AtomicCounter)
+{
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		++m_Counter;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(Contention, StripedCounter)
+{
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		++m_StripedCounter;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(Contention, MemoryPool)
+{
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		void * pBlock = ptr_Pool->Get();
+		CxxAbb::Bench::DoNotOptimize(pBlock);
+		ptr_Pool->Release(pBlock);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(Contention, EnvironmentGet)
+{
+	const std::string sKey("PATH");
+	const std::string sDefault;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		std::string sValue = CxxAbb::Sys::Environment::Get(sKey, sDefault);
+		CxxAbb::Bench::DoNotOptimize(sValue);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(Contention, EnvironmentSnapshot)
+{
+	const std::string sKey("PATH");
+	const std::string sDefault;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		CxxAbb::Sys::EnvironmentSnapshot::Ptr ptrSnapshot = CxxAbb::Sys::Environment::Snapshot();
+		const std::string & sValue = ptrSnapshot->Get(sKey, sDefault);
+		CxxAbb::Bench::DoNotOptimize(sValue);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(PingPong, SigEvent)
+{
+	int iPair = state.ThreadIndex() / 2;
+	CxxAbb::Sys::SigEvent & ping = ptr_Ping.get()[iPair];
+	CxxAbb::Sys::SigEvent & pong = ptr_Pong.get()[iPair];
+
+	if (state.ThreadIndex() % 2 == 1)
+	{
+		for (UInt64 i = 0; i < state.Iterations(); ++i)
+		{
+			ping.Wait();
+			pong.Set();
+		}
+	}
+	else if (state.ThreadIndex() + 1 < state.Threads())
+	{
+		for (UInt64 i = 0; i < state.Iterations(); ++i)
+		{
+			CxxAbb::Bench::LatencyProbe probe(state, i);
+			ping.Set();
+			pong.Wait();
+		}
+		state.SetItemsProcessed(state.Iterations());
+	}
+	else
+	{
+		for (UInt64 i = 0; i < state.Iterations(); ++i)
+		{
+			CxxAbb::Bench::LatencyProbe probe(state, i);
+			ping.Set();
+			ping.Wait();
+		}
+		state.SetItemsProcessed(state.Iterations());
+	}
+}
+
+CXXABB_BENCH_THREADED(ProducerConsumer, WaitCondition)
+{
+	bool bProducer = state.ThreadIndex() % 2 == 0;
+	bool bBoth = bProducer && state.ThreadIndex() + 1 == state.Threads() && state.Threads() % 2 == 1;
+
+	UInt64 uiSum = 0;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		if (bProducer)
+			Push(i);
+		if (!bProducer || bBoth)
+			uiSum += Pop();
+	}
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+
+	// count each transferred item once, at the consumer
+	if (!bProducer || bBoth)
+		state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(SharedTable, MapRead)
+{
+	UInt64 uiSeed = static_cast<UInt64>(state.ThreadIndex()) + 1;
+	ValuePtr value(new UInt64(0));
+	UInt64 uiSum = 0;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		if (MapFind(NextKey(uiSeed), value))
+			uiSum += *value;
+	}
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(SharedTable, ConcurrentRead)
+{
+	UInt64 uiSeed = static_cast<UInt64>(state.ThreadIndex()) + 1;
+	ValuePtr value(new UInt64(0));
+	UInt64 uiSum = 0;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		if (m_Concurrent.Find(NextKey(uiSeed), value))
+			uiSum += *value;
+	}
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+// every tenth operation replaces a value
+CXXABB_BENCH_THREADED(SharedTable, MapMixed)
+{
+	UInt64 uiSeed = static_cast<UInt64>(state.ThreadIndex()) + 1;
+	ValuePtr value(new UInt64(0));
+	UInt64 uiSum = 0;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		UInt64 uiKey = NextKey(uiSeed);
+		if (i % 10 == 0)
+			MapAssign(uiKey, ValuePtr(new UInt64(uiKey)));
+		else if (MapFind(uiKey, value))
+			uiSum += *value;
+	}
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH_THREADED(SharedTable, ConcurrentMixed)
+{
+	UInt64 uiSeed = static_cast<UInt64>(state.ThreadIndex()) + 1;
+	ValuePtr value(new UInt64(0));
+	UInt64 uiSum = 0;
+	for (UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::LatencyProbe probe(state, i);
+		UInt64 uiKey = NextKey(uiSeed);
+		if (i % 10 == 0)
+			m_Concurrent.InsertOrAssign(uiKey, new UInt64(uiKey));
+		else if (m_Concurrent.Find(uiKey, value))
+			uiSum += *value;
+	}
+	CxxAbb::Bench::DoNotOptimize(uiSum);
+	state.SetItemsProcessed(state.Iterations());
+}
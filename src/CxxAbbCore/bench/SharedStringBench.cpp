@@ -0,0 +1,113 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SharedStringBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : SharedString and InternedString against std::string
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/InternedString.h>
+#include <CxxAbb/SharedString.h>
+
+#include <string>
+
+namespace
+{
+
+/// Past the inline limit of both std::string and SharedString, like a message or a path
+const char * const LongText = "connection to upstream service refused";
+
+}
+
+CXXABB_BENCH(String, CopyStdLong)
+{
+	const std::string sValue(LongText);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		std::string sCopy(sValue);
+		CxxAbb::Bench::DoNotOptimize(sCopy);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(String, CopySharedLong)
+{
+	const CxxAbb::SharedString value(LongText);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::SharedString copy(value);
+		CxxAbb::Bench::DoNotOptimize(copy);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(String, CopySharedShort)
+{
+	const CxxAbb::SharedString value("Pool-3");
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::SharedString copy(value);
+		CxxAbb::Bench::DoNotOptimize(copy);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(String, EqualStdLong)
+{
+	const std::string sLhs(LongText);
+	const std::string sRhs(LongText);
+	std::size_t tEqual = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::DoNotOptimize(sLhs);
+		tEqual += sLhs == sRhs;
+	}
+	CxxAbb::Bench::DoNotOptimize(tEqual);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+CXXABB_BENCH(String, EqualInterned)
+{
+	const CxxAbb::InternedString lhs(LongText);
+	const CxxAbb::InternedString rhs((std::string(LongText)));
+	std::size_t tEqual = 0;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Bench::DoNotOptimize(lhs);
+		tEqual += lhs == rhs;
+	}
+	CxxAbb::Bench::DoNotOptimize(tEqual);
+	state.SetItemsProcessed(state.Iterations());
+}
+
+/// Lookup of an already interned string: hash, shard read lock, probe
+CXXABB_BENCH(String, Intern)
+{
+	CxxAbb::InternedString first(LongText);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::InternedString again(LongText);
+		CxxAbb::Bench::DoNotOptimize(again);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
@@ -0,0 +1,93 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SwapByteOrderBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Bulk byte order conversion throughput
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/SwapByteOrder.h>
+
+#include <vector>
+
+namespace
+{
+
+/// Converted in place every iteration, fits in L2
+const std::size_t Bytes = 64 * 1024;
+
+/// One pass per iteration with kernel state.Arg(), nothing measured if the CPU lacks it
+template <typename T>
+void SwabKernel(CxxAbb::Bench::State & _state)
+{
+	if (!CxxAbb::ByteOrder::SetKernel(static_cast<CxxAbb::ByteOrder::Kernel>(_state.Arg())))
+		return;
+
+	std::vector<T> lstData(Bytes / sizeof(T), T(0x1234));
+	for (CxxAbb::UInt64 i = 0; i < _state.Iterations(); ++i)
+	{
+		CxxAbb::SwabArray(&lstData[0], lstData.size());
+		CxxAbb::Bench::ClobberMemory();
+	}
+	_state.SetBytesProcessed(_state.Iterations() * Bytes);
+	CxxAbb::ByteOrder::SetKernel(CxxAbb::ByteOrder::KernelAuto);
+}
+
+}
+
+/// Element by element with the scalar Swab(), the loop callers wrote before SwabArray()
+CXXABB_BENCH(ByteSwap, Loop32)
+{
+	std::vector<CxxAbb::UInt32> lstData(Bytes / sizeof(CxxAbb::UInt32), 0x1234);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		for (std::size_t j = 0; j < lstData.size(); ++j)
+			lstData[j] = CxxAbb::ByteOrder::NetworkToHost(lstData[j]);
+		CxxAbb::Bench::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.Iterations() * Bytes);
+}
+
+CXXABB_BENCH_P(ByteSwap, Swab16)
+{
+	SwabKernel<CxxAbb::UInt16>(state);
+}
+CXXABB_BENCH_ARG(ByteSwap, Swab16, CxxAbb::ByteOrder::KernelScalar);
+CXXABB_BENCH_ARG(ByteSwap, Swab16, CxxAbb::ByteOrder::KernelSsse3);
+CXXABB_BENCH_ARG(ByteSwap, Swab16, CxxAbb::ByteOrder::KernelAvx2);
+
+CXXABB_BENCH_P(ByteSwap, Swab32)
+{
+	SwabKernel<CxxAbb::UInt32>(state);
+}
+CXXABB_BENCH_ARG(ByteSwap, Swab32, CxxAbb::ByteOrder::KernelScalar);
+CXXABB_BENCH_ARG(ByteSwap, Swab32, CxxAbb::ByteOrder::KernelSsse3);
+CXXABB_BENCH_ARG(ByteSwap, Swab32, CxxAbb::ByteOrder::KernelAvx2);
+
+CXXABB_BENCH_P(ByteSwap, Swab64)
+{
+	SwabKernel<CxxAbb::UInt64>(state);
+}
+CXXABB_BENCH_ARG(ByteSwap, Swab64, CxxAbb::ByteOrder::KernelScalar);
+CXXABB_BENCH_ARG(ByteSwap, Swab64, CxxAbb::ByteOrder::KernelSsse3);
+CXXABB_BENCH_ARG(ByteSwap, Swab64, CxxAbb::ByteOrder::KernelAvx2);
@@ -0,0 +1,138 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SyncBench.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Uncontended cost of the synchronisation primitives
+ *
+ */
+
+#include <Bench/Bench.h>
+#include <CxxAbb/Sys/Atomicity.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/SigEvent.h>
+
+CXXABB_BENCH(Mutex, LockUnlock)
+{
+	CxxAbb::Sys::Mutex mutex;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		mutex.Lock();
+		mutex.Unlock();
+	}
+}
+
+CXXABB_BENCH(Mutex, ScopedLock)
+{
+	CxxAbb::Sys::Mutex mutex;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		CxxAbb::Sys::ScopedLock<CxxAbb::Sys::Mutex> lock(mutex);
+		CxxAbb::Bench::ClobberMemory();
+	}
+}
+
+CXXABB_BENCH(Mutex, TryLock)
+{
+	CxxAbb::Sys::Mutex mutex;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		if (mutex.TryLock())
+			mutex.Unlock();
+	}
+}
+
+CXXABB_BENCH(FastMutex, LockUnlock)
+{
+	CxxAbb::Sys::FastMutex mutex;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		mutex.Lock();
+		mutex.Unlock();
+	}
+}
+
+CXXABB_BENCH(FastMutex, Recursive)
+{
+	CxxAbb::Sys::FastMutex mutex;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		mutex.Lock();
+		mutex.Lock();
+		mutex.Unlock();
+		mutex.Unlock();
+	}
+}
+
+/// Profiled lock with profiling disabled, the price of naming a lock
+CXXABB_BENCH(FastMutex, Named)
+{
+	CxxAbb::Sys::FastMutex mutex("Bench.FastMutex");
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		mutex.Lock();
+		mutex.Unlock();
+	}
+}
+
+CXXABB_BENCH(SigEvent, SetWait)
+{
+	CxxAbb::Sys::SigEvent event;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		event.Set();
+		event.Wait();
+	}
+}
+
+CXXABB_BENCH(SigEvent, TryWaitTimeout0)
+{
+	CxxAbb::Sys::SigEvent event;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		CxxAbb::Bench::DoNotOptimize(event.TryWait(0));
+}
+
+CXXABB_BENCH(AtomicCounter, Increment)
+{
+	CxxAbb::Sys::AtomicCounter counter;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		++counter;
+	CxxAbb::Bench::DoNotOptimize(counter.Value());
+}
+
+CXXABB_BENCH(AtomicCounter, IncrementDecrement)
+{
+	CxxAbb::Sys::AtomicCounter counter;
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+	{
+		++counter;
+		--counter;
+	}
+	CxxAbb::Bench::DoNotOptimize(counter.Value());
+}
+
+CXXABB_BENCH(AtomicCounter, Read)
+{
+	CxxAbb::Sys::AtomicCounter counter(1U);
+	for (CxxAbb::UInt64 i = 0; i < state.Iterations(); ++i)
+		CxxAbb::Bench::DoNotOptimize(counter.Value());
+}
@@ -0,0 +1,245 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BinaryReader.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Endian aware binary decoder over Buffer
+ *
+ */
+
+#ifndef CXXABB_CORE_BINARYREADER_H_
+#define CXXABB_CORE_BINARYREADER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/SwapByteOrder.h>
+
+#include <cstring>
+#include <string>
+
+namespace CxxAbb
+{
+
+/** @brief Bytes inside someone else's storage, valid while that storage is
+ */
+struct CXXABB_API ByteView
+{
+	ByteView()
+		: p_Data(NullPtr),
+		  t_Size(0)
+	{}
+
+	ByteView(const char * _pData, std::size_t _tSize)
+		: p_Data(_pData),
+		  t_Size(_tSize)
+	{}
+
+	bool Empty() const
+	{
+		return t_Size == 0;
+	}
+
+	std::string ToString() const
+	{
+		return std::string(p_Data, t_Size);
+	}
+
+	bool operator ==(const std::string & _sOther) const
+	{
+		return t_Size == _sOther.size() && std::memcmp(p_Data, _sOther.data(), t_Size) == 0;
+	}
+
+	bool operator !=(const std::string & _sOther) const
+	{
+		return !(*this == _sOther);
+	}
+
+	const char * p_Data;
+	std::size_t t_Size;
+};
+
+/** @brief Reads values written by BinaryWriter from a byte range
+ *
+ * The reader does not copy the input: ReadBlobView() / ReadStringView() /
+ * ReadView() return views into it, so the buffer must outlive them. Every read is
+ * bounds checked; reading past the end throws RangeException, a malformed varint
+ * DataFormatException, and in both cases the position is left unchanged.
+ */
+class CXXABB_API BinaryReader
+{
+public:
+	BinaryReader(const char * _pData, std::size_t _tSize, ByteOrder::Order _eOrder = ByteOrder::OrderNetwork);
+
+	/** @brief Reads the used part of _buffer */
+	explicit BinaryReader(const Buffer<char> & _buffer, ByteOrder::Order _eOrder = ByteOrder::OrderNetwork);
+
+	~BinaryReader() {}
+
+	Int8 ReadInt8()
+	{
+		return static_cast<Int8>(Get<UInt8>());
+	}
+
+	UInt8 ReadUInt8()
+	{
+		return Get<UInt8>();
+	}
+
+	bool ReadBool()
+	{
+		return Get<UInt8>() != 0;
+	}
+
+	Int16 ReadInt16()
+	{
+		return static_cast<Int16>(Get<UInt16>());
+	}
+
+	UInt16 ReadUInt16()
+	{
+		return Get<UInt16>();
+	}
+
+	Int32 ReadInt32()
+	{
+		return static_cast<Int32>(Get<UInt32>());
+	}
+
+	UInt32 ReadUInt32()
+	{
+		return Get<UInt32>();
+	}
+
+	Int64 ReadInt64()
+	{
+		return static_cast<Int64>(Get<UInt64>());
+	}
+
+	UInt64 ReadUInt64()
+	{
+		return Get<UInt64>();
+	}
+
+	float ReadFloat();
+
+	double ReadDouble();
+
+	/** @brief LEB128, DataFormatException if it does not fit 32 bits */
+	UInt32 ReadVarUInt32();
+
+	/** @brief LEB128, DataFormatException past 10 bytes or 64 bits */
+	UInt64 ReadVarUInt64();
+
+	Int32 ReadVarInt32();
+
+	Int64 ReadVarInt64()
+	{
+		return UnZigZag(ReadVarUInt64());
+	}
+
+	/** @brief Copy _tSize raw bytes to _pData */
+	void ReadBytes(void * _pData, std::size_t _tSize)
+	{
+		std::memcpy(_pData, ReadView(_tSize).p_Data, _tSize);
+	}
+
+	/** @brief Next _tSize raw bytes, not copied */
+	ByteView ReadView(std::size_t _tSize)
+	{
+		Require(_tSize);
+		ByteView view(p_Data + t_Position, _tSize);
+		t_Position += _tSize;
+		return view;
+	}
+
+	/** @brief Varint length prefixed bytes, not copied */
+	ByteView ReadBlobView();
+
+	ByteView ReadStringView()
+	{
+		return ReadBlobView();
+	}
+
+	std::string ReadString()
+	{
+		return ReadBlobView().ToString();
+	}
+
+	void Skip(std::size_t _tSize)
+	{
+		Require(_tSize);
+		t_Position += _tSize;
+	}
+
+	std::size_t Position() const
+	{
+		return t_Position;
+	}
+
+	std::size_t Remaining() const
+	{
+		return t_Size - t_Position;
+	}
+
+	bool AtEnd() const
+	{
+		return t_Position == t_Size;
+	}
+
+	ByteOrder::Order Order() const
+	{
+		return e_Order;
+	}
+
+	static Int64 UnZigZag(UInt64 _uiValue)
+	{
+		return static_cast<Int64>(_uiValue >> 1) ^ -static_cast<Int64>(_uiValue & 1);
+	}
+
+private:
+	void Require(std::size_t _tSize) const
+	{
+		if (_tSize > t_Size - t_Position)
+			Underflow(_tSize);
+	}
+
+	void Underflow(std::size_t _tSize) const;
+
+	template <typename T>
+	T Get()
+	{
+		Require(sizeof(T));
+		T value;
+		std::memcpy(&value, p_Data + t_Position, sizeof(T));
+		t_Position += sizeof(T);
+		return b_Swap ? Swab(value) : value;
+	}
+
+	const char * p_Data;
+	std::size_t t_Size;
+	std::size_t t_Position;
+	ByteOrder::Order e_Order;
+	bool b_Swap;
+};
+
+} /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_BINARYREADER_H_ */
@@ -0,0 +1,210 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BinaryWriter.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Endian aware binary encoder over Buffer
+ *
+ */
+
+#ifndef CXXABB_CORE_BINARYWRITER_H_
+#define CXXABB_CORE_BINARYWRITER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/SwapByteOrder.h>
+
+#include <cstring>
+#include <string>
+
+namespace CxxAbb
+{
+
+/** @brief Appends binary encoded values to a Buffer<char>
+ *
+ * Fixed width integers and floating point values are written in the byte order
+ * given at construction, varints as LEB128 (signed ones zigzag encoded first),
+ * strings and blobs as a varint length followed by the bytes.
+ *
+ * Encoding a message of known size: Reserve(SizeOf...() + ...) once, then write,
+ * nothing reallocates. Without Reserve() the buffer grows geometrically instead of
+ * by the exact amount like Buffer::append(). The buffer never grows past its
+ * max() (a FixedLenBuffer or external array not at all); writing beyond it throws
+ * OutOfMemoryException and leaves the buffer as it was before that write.
+ *
+ * @code
+ *   CxxAbb::Buffer<char> buffer(64);
+ *   CxxAbb::BinaryWriter writer(buffer);
+ *   writer.Reserve(4 + CxxAbb::BinaryWriter::SizeOfString(sName));
+ *   writer.WriteUInt32(uiId);
+ *   writer.WriteString(sName);
+ * @endcode
+ */
+class CXXABB_API BinaryWriter : private NonCopyable
+{
+public:
+	explicit BinaryWriter(Buffer<char> & _buffer, ByteOrder::Order _eOrder = ByteOrder::OrderNetwork);
+
+	~BinaryWriter() {}
+
+	/** @brief Make room for _tBytes more bytes with at most one reallocation */
+	void Reserve(std::size_t _tBytes)
+	{
+		if (_tBytes > m_Buffer.capacity() - m_Buffer.size())
+			Grow(_tBytes, false);
+	}
+
+	void WriteInt8(Int8 _iValue)
+	{
+		Put(static_cast<UInt8>(_iValue));
+	}
+
+	void WriteUInt8(UInt8 _uiValue)
+	{
+		Put(_uiValue);
+	}
+
+	void WriteBool(bool _bValue)
+	{
+		Put(static_cast<UInt8>(_bValue ? 1 : 0));
+	}
+
+	void WriteInt16(Int16 _iValue)
+	{
+		Put(static_cast<UInt16>(_iValue));
+	}
+
+	void WriteUInt16(UInt16 _uiValue)
+	{
+		Put(_uiValue);
+	}
+
+	void WriteInt32(Int32 _iValue)
+	{
+		Put(static_cast<UInt32>(_iValue));
+	}
+
+	void WriteUInt32(UInt32 _uiValue)
+	{
+		Put(_uiValue);
+	}
+
+	void WriteInt64(Int64 _iValue)
+	{
+		Put(static_cast<UInt64>(_iValue));
+	}
+
+	void WriteUInt64(UInt64 _uiValue)
+	{
+		Put(_uiValue);
+	}
+
+	void WriteFloat(float _fValue);
+
+	void WriteDouble(double _dValue);
+
+	/** @brief LEB128, 1 byte per started 7 bits */
+	void WriteVarUInt32(UInt32 _uiValue)
+	{
+		WriteVarUInt64(_uiValue);
+	}
+
+	void WriteVarUInt64(UInt64 _uiValue);
+
+	/** @brief Zigzag then LEB128, small magnitudes of either sign stay short */
+	void WriteVarInt32(Int32 _iValue)
+	{
+		WriteVarUInt64(ZigZag(_iValue));
+	}
+
+	void WriteVarInt64(Int64 _iValue)
+	{
+		WriteVarUInt64(ZigZag(_iValue));
+	}
+
+	/** @brief _tSize raw bytes, no length prefix */
+	void WriteBytes(const void * _pData, std::size_t _tSize);
+
+	/** @brief Varint length and the bytes, read back with BinaryReader::ReadBlob() */
+	void WriteBlob(const void * _pData, std::size_t _tSize);
+
+	void WriteString(const std::string & _sValue)
+	{
+		WriteBlob(_sValue.data(), _sValue.size());
+	}
+
+	/** @brief Bytes in the buffer, the offset the next write goes to */
+	std::size_t Position() const
+	{
+		return m_Buffer.size();
+	}
+
+	ByteOrder::Order Order() const
+	{
+		return e_Order;
+	}
+
+	static std::size_t SizeOfVarUInt(UInt64 _uiValue);
+
+	static std::size_t SizeOfVarInt(Int64 _iValue)
+	{
+		return SizeOfVarUInt(ZigZag(_iValue));
+	}
+
+	static std::size_t SizeOfBlob(std::size_t _tSize)
+	{
+		return SizeOfVarUInt(_tSize) + _tSize;
+	}
+
+	static std::size_t SizeOfString(const std::string & _sValue)
+	{
+		return SizeOfBlob(_sValue.size());
+	}
+
+	static UInt64 ZigZag(Int64 _iValue)
+	{
+		return (static_cast<UInt64>(_iValue) << 1) ^ static_cast<UInt64>(_iValue >> 63);
+	}
+
+private:
+	/** @brief Room for _tBytes more, doubling the capacity if _bGeometric */
+	void Grow(std::size_t _tBytes, bool _bGeometric = true);
+
+	template <typename T>
+	void Put(T _value)
+	{
+		if (sizeof(T) > m_Buffer.capacity() - m_Buffer.size())
+			Grow(sizeof(T));
+		if (b_Swap)
+			_value = Swab(_value);
+		std::memcpy(m_Buffer.begin() + m_Buffer.size(), &_value, sizeof(T));
+		m_Buffer.size(m_Buffer.size() + sizeof(T));
+	}
+
+	Buffer<char> & m_Buffer;
+	ByteOrder::Order e_Order;
+	bool b_Swap;
+};
+
+} /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_BINARYWRITER_H_ */
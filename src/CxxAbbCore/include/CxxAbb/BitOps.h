@@ -107,6 +107,87 @@ namespace CxxAbb
 /* turn on right-most 0-bit in x */
 #define BITOP_TURNON_0(x)    ((x) |= ((x)+1))
 
+/// Typed bit operations on unsigned integers, compiled to single instructions
+/// (popcnt, lzcnt / bsr, tzcnt / bsf, rol) where the target has them and folded
+/// at compile time for constant arguments.
+
+/// Width of the unsigned integer types accepted below, signed types do not compile
+template <typename T> struct UnsignedBits;
+template <> struct UnsignedBits<unsigned char> { enum { Value = 8 }; };
+template <> struct UnsignedBits<unsigned short> { enum { Value = 16 }; };
+template <> struct UnsignedBits<unsigned int> { enum { Value = 32 }; };
+template <> struct UnsignedBits<unsigned long> { enum { Value = sizeof(unsigned long) * 8 }; };
+template <> struct UnsignedBits<unsigned long long> { enum { Value = 64 }; };
+
+/** @brief Number of set bits */
+template <typename T>
+inline unsigned int Popcount(T _value)
+{
+	return UnsignedBits<T>::Value <= 32 ?
+		static_cast<unsigned int>(__builtin_popcount(static_cast<unsigned int>(_value))) :
+		static_cast<unsigned int>(__builtin_popcountll(static_cast<unsigned long long>(_value)));
+}
+
+/** @brief Zero bits above the highest set bit, the full width for 0 */
+template <typename T>
+inline unsigned int CountLeadingZeros(T _value)
+{
+	if (!_value)
+		return UnsignedBits<T>::Value;
+	return UnsignedBits<T>::Value <= 32 ?
+		static_cast<unsigned int>(__builtin_clz(static_cast<unsigned int>(_value))) - (32 - UnsignedBits<T>::Value) :
+		static_cast<unsigned int>(__builtin_clzll(static_cast<unsigned long long>(_value))) - (64 - UnsignedBits<T>::Value);
+}
+
+/** @brief Zero bits below the lowest set bit, the full width for 0 */
+template <typename T>
+inline unsigned int CountTrailingZeros(T _value)
+{
+	if (!_value)
+		return UnsignedBits<T>::Value;
+	return UnsignedBits<T>::Value <= 32 ?
+		static_cast<unsigned int>(__builtin_ctz(static_cast<unsigned int>(_value))) :
+		static_cast<unsigned int>(__builtin_ctzll(static_cast<unsigned long long>(_value)));
+}
+
+/** @brief Rotate by _uiShift modulo the width */
+template <typename T>
+inline T RotateLeft(T _value, unsigned int _uiShift)
+{
+	_uiShift &= UnsignedBits<T>::Value - 1;
+	return _uiShift ? static_cast<T>((_value << _uiShift) | (_value >> (UnsignedBits<T>::Value - _uiShift))) : _value;
+}
+
+template <typename T>
+inline T RotateRight(T _value, unsigned int _uiShift)
+{
+	_uiShift &= UnsignedBits<T>::Value - 1;
+	return _uiShift ? static_cast<T>((_value >> _uiShift) | (_value << (UnsignedBits<T>::Value - _uiShift))) : _value;
+}
+
+template <typename T>
+inline bool IsPow2(T _value)
+{
+	return _value && !(_value & (_value - 1));
+}
+
+/** @brief Smallest power of two >= _value, 1 for 0, 0 if it does not fit T */
+template <typename T>
+inline T NextPow2(T _value)
+{
+	if (_value <= 1)
+		return 1;
+	unsigned int uiShift = UnsignedBits<T>::Value - CountLeadingZeros(static_cast<T>(_value - 1));
+	return uiShift < UnsignedBits<T>::Value ? static_cast<T>(static_cast<T>(1) << uiShift) : 0;
+}
+
+/** @brief Index of the highest set bit, _value must not be 0 */
+template <typename T>
+inline unsigned int Log2Floor(T _value)
+{
+	return UnsignedBits<T>::Value - 1 - CountLeadingZeros(_value);
+}
+
 inline void Int8ToBinary(CxxAbb::Int8 _num, std::ostream & _os)
 {
 	char str[9] = {0};
@@ -0,0 +1,253 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Bitmap.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Dynamically sized bitmap with bulk word operations
+ *
+ */
+
+#ifndef CXXABB_CORE_BITMAP_H_
+#define CXXABB_CORE_BITMAP_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/BitOps.h>
+#include <CxxAbb/Debug.h>
+
+namespace CxxAbb
+{
+
+/** @brief Dynamically sized array of bits stored in 64 bit words
+ *
+ * Bulk operations (And, Or, AndNot, Xor, Count, CountAnd) run on the fastest
+ * kernel the CPU has: AVX2, scalar with popcnt, or plain scalar, see SetKernel().
+ * Bitmaps of different sizes can be combined, the result keeps the size of the
+ * left hand side and bits missing on the right count as 0.
+ *
+ * Set bits are visited with FindFirst() / FindNext() or ForEach(), both skip whole
+ * zero words; free slot tracking uses FindFirstZero() / FindNextZero().
+ *
+ * @code
+ *   CxxAbb::Bitmap matches(lstRows.size());
+ *   matches.Or(byColour).And(bySize);
+ *   matches.ForEach(Emit(lstRows));
+ * @endcode
+ */
+class CXXABB_API Bitmap
+{
+public:
+	typedef UInt64 Word;
+
+	enum
+	{
+		WordBits = 64
+	};
+
+	/// Bulk kernels, Auto picks the best one the CPU supports
+	enum Kernel
+	{
+		KernelAuto = 0,
+		KernelScalar,
+		KernelPopcnt,
+		KernelAvx2
+	};
+
+	/// Returned by the Find functions when there is no such bit
+	static const std::size_t npos = static_cast<std::size_t>(-1);
+
+	Bitmap();
+
+	explicit Bitmap(std::size_t _tBits, bool _bValue = false);
+
+	Bitmap(const Bitmap & _other);
+
+	~Bitmap();
+
+	Bitmap & operator =(const Bitmap & _other);
+
+	void Swap(Bitmap & _other);
+
+	std::size_t Size() const
+	{
+		return t_Bits;
+	}
+
+	/** @brief Grow or shrink to _tBits, new bits set to _bValue */
+	void Resize(std::size_t _tBits, bool _bValue = false);
+
+	bool Test(std::size_t _tBit) const
+	{
+		ASSERT(_tBit < t_Bits);
+		return (p_Words[_tBit / WordBits] >> (_tBit % WordBits)) & 1;
+	}
+
+	bool operator [](std::size_t _tBit) const
+	{
+		return Test(_tBit);
+	}
+
+	void Set(std::size_t _tBit)
+	{
+		ASSERT(_tBit < t_Bits);
+		p_Words[_tBit / WordBits] |= Word(1) << (_tBit % WordBits);
+	}
+
+	void Reset(std::size_t _tBit)
+	{
+		ASSERT(_tBit < t_Bits);
+		p_Words[_tBit / WordBits] &= ~(Word(1) << (_tBit % WordBits));
+	}
+
+	void Flip(std::size_t _tBit)
+	{
+		ASSERT(_tBit < t_Bits);
+		p_Words[_tBit / WordBits] ^= Word(1) << (_tBit % WordBits);
+	}
+
+	void Assign(std::size_t _tBit, bool _bValue)
+	{
+		if (_bValue)
+			Set(_tBit);
+		else
+			Reset(_tBit);
+	}
+
+	void SetAll();
+
+	void ResetAll();
+
+	/** @brief Set bits [_tBegin, _tEnd) */
+	void SetRange(std::size_t _tBegin, std::size_t _tEnd);
+
+	/** @brief Number of set bits */
+	std::size_t Count() const;
+
+	bool Any() const;
+
+	bool None() const
+	{
+		return !Any();
+	}
+
+	std::size_t FindFirst() const
+	{
+		return FindNext(0);
+	}
+
+	/** @brief First set bit at or after _tBit, npos if none */
+	std::size_t FindNext(std::size_t _tBit) const;
+
+	std::size_t FindFirstZero() const
+	{
+		return FindNextZero(0);
+	}
+
+	/** @brief First clear bit at or after _tBit, npos if none */
+	std::size_t FindNextZero(std::size_t _tBit) const;
+
+	/** @brief Call _func(index) for every set bit in increasing order */
+	template <typename Func>
+	void ForEach(Func _func) const
+	{
+		for (std::size_t i = 0; i < t_WordCount; ++i)
+		{
+			for (Word uiWord = p_Words[i]; uiWord; uiWord &= uiWord - 1)
+				_func(i * WordBits + CountTrailingZeros(uiWord));
+		}
+	}
+
+	Bitmap & And(const Bitmap & _other);
+
+	Bitmap & Or(const Bitmap & _other);
+
+	/** @brief Clear the bits set in _other */
+	Bitmap & AndNot(const Bitmap & _other);
+
+	Bitmap & Xor(const Bitmap & _other);
+
+	Bitmap & operator &=(const Bitmap & _other)
+	{
+		return And(_other);
+	}
+
+	Bitmap & operator |=(const Bitmap & _other)
+	{
+		return Or(_other);
+	}
+
+	Bitmap & operator ^=(const Bitmap & _other)
+	{
+		return Xor(_other);
+	}
+
+	/** @brief Count() of the intersection without building it */
+	std::size_t CountAnd(const Bitmap & _other) const;
+
+	bool operator ==(const Bitmap & _other) const;
+
+	bool operator !=(const Bitmap & _other) const
+	{
+		return !(*this == _other);
+	}
+
+	/** @brief Word storage, cache line aligned, bits past Size() are always 0 */
+	const Word * Words() const
+	{
+		return p_Words;
+	}
+
+	std::size_t WordCount() const
+	{
+		return t_WordCount;
+	}
+
+	/// Use _eKernel for the bulk operations, false (and no change) if this CPU lacks it
+	static bool SetKernel(Kernel _eKernel);
+
+	/// Kernel the bulk operations currently run, never KernelAuto
+	static Kernel ActiveKernel();
+
+	static bool KernelSupported(Kernel _eKernel);
+
+	static const char * KernelName(Kernel _eKernel);
+
+private:
+	static std::size_t WordsFor(std::size_t _tBits)
+	{
+		return (_tBits + WordBits - 1) / WordBits;
+	}
+
+	/** @brief Clear the bits of the last word past Size() */
+	void TrimTail();
+
+	Word * p_Words;
+	std::size_t t_WordCount;
+	std::size_t t_Bits;
+};
+
+inline void swap(Bitmap & _lhs, Bitmap & _rhs)
+{
+	_lhs.Swap(_rhs);
+}
+
+} /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_BITMAP_H_ */
@@ -32,6 +32,8 @@
 #include <CxxAbb/Exception.h>
 #include <CxxAbb/Debug.h>
 
+#include <limits>
+
 namespace CxxAbb
 {
 
@@ -55,7 +57,7 @@ public:
 		p_Data(new T[_capacity]),
 		b_Alloced(true)
 	{
-		std::memset(p_Data,0,i_Capacity);
+		std::memset(p_Data,0,i_Capacity * sizeof(T));
 	}
 
 	/** @brief Creates the Buffer as a wrapper for external data array.
@@ -142,7 +144,7 @@ public:
 		{
 			T* ptr = new T[_newCapacity];
 			if (_preserveContent)
-				std::memcpy(ptr, p_Data, i_Capacity);
+				std::memcpy(ptr, p_Data, i_Capacity * sizeof(T));
 
 			delete [] p_Data;
 			p_Data  = ptr;
@@ -160,7 +162,7 @@ public:
 		{
 			resize(_sz, false);
 		}
-		std::memcpy(p_Data, _buf, _sz);
+		std::memcpy(p_Data, _buf, _sz * sizeof(T));
 		i_Used = _sz;
 	}
 
@@ -172,7 +174,7 @@ public:
 		if (0 == _sz) return;
 		std::size_t oldSize = i_Used;
 		resize(i_Used + _sz, true);
-		std::memcpy(p_Data + oldSize, _buf, _sz);
+		std::memcpy(p_Data + oldSize, _buf, _sz * sizeof(T));
 		i_Used += _sz;
 	}
 
@@ -206,6 +208,14 @@ public:
 		return i_Capacity;
 	}
 
+	/** @brief Largest capacity resize() can reach, capacity() for external arrays.
+	 *
+	 */
+	virtual std::size_t max() const
+	{
+		return b_Alloced ? std::numeric_limits<std::size_t>::max() / sizeof(T) : i_Capacity;
+	}
+
 	/** @brief Compare operator.
 	 *
 	 */
@@ -215,7 +225,7 @@ public:
 		{
 			if (i_Used == _other.i_Used)
 			{
-				if (std::memcmp(p_Data, _other.p_Data, i_Used) == 0)
+				if (std::memcmp(p_Data, _other.p_Data, i_Used * sizeof(T)) == 0)
 				{
 					return true;
 				}
@@ -329,7 +339,7 @@ public:
 		if(_length > 0 && _length <= i_Used)
 		{
 			i_Used -= _length;
-			std::memmove(p_Data, p_Data + _length, i_Used);
+			std::memmove(p_Data, p_Data + _length, i_Used * sizeof(T));
 		}
 	}
 
@@ -412,7 +422,7 @@ public:
 		if (0 == _sz) return;
 		if (_sz > this->i_Capacity)
 			_sz = this->i_Capacity;
-		std::memcpy(this->p_Data, _buf, _sz);
+		std::memcpy(this->p_Data, _buf, _sz * sizeof(T));
 		this->i_Used = _sz;
 	}
 
@@ -425,10 +435,15 @@ public:
 		std::size_t iFree = this->i_Capacity - this->i_Used;
 		if(_sz > iFree)
 			_sz = iFree;
-		std::memcpy(this->p_Data + this->i_Used, _buf, _sz);
+		std::memcpy(this->p_Data + this->i_Used, _buf, _sz * sizeof(T));
 		this->i_Used += _sz;
 	}
 
+	virtual std::size_t max() const
+	{
+		return this->i_Capacity;
+	}
+
 private:
 };
 
@@ -511,7 +526,7 @@ public:
 		{
 			T* ptr = new T[_newCapacity];
 			if (_preserveContent)
-				std::memcpy(ptr, this->p_Data, this->i_Capacity);
+				std::memcpy(ptr, this->p_Data, this->i_Capacity * sizeof(T));
 
 			delete [] this->p_Data;
 			this->p_Data  = ptr;
@@ -531,7 +546,7 @@ public:
 		if (0 == _sz) return;
 		if (_sz > this->i_Capacity)
 			resize(_sz, false);
-		std::memcpy(this->p_Data, _buf, _sz);
+		std::memcpy(this->p_Data, _buf, _sz * sizeof(T));
 		this->i_Used = _sz;
 	}
 
@@ -546,11 +561,11 @@ public:
 		if(_sz > iFree)
 			resize(_sz + this->i_Used);
 
-		std::memcpy(this->p_Data + this->i_Used, _buf, _sz);
+		std::memcpy(this->p_Data + this->i_Used, _buf, _sz * sizeof(T));
 		this->i_Used += _sz;
 	}
 
-	std::size_t max() const
+	virtual std::size_t max() const
 	{
 		return i_MaxSize;
 	}
@@ -564,6 +579,58 @@ private:
 	std::size_t i_MaxSize;
 };
 
+/** @brief Non owning view of an array: a pointer and a length
+ *
+ * Copying a view copies the pointer, every copy refers to the same memory, so
+ * views can be passed and stored by value. The memory must outlive the views.
+ * To hand the memory to an API taking a Buffer wrap it explicitly with
+ * Buffer(view.begin(), view.size()), and do not copy that Buffer.
+ */
+template <typename T>
+class CXXABB_API BufferView
+{
+public:
+	BufferView()
+		: p_Data(0),
+		  t_Size(0)
+	{}
+
+	BufferView(T* _pData, std::size_t _tSize)
+		: p_Data(_pData),
+		  t_Size(_tSize)
+	{}
+
+	T* begin() const
+	{
+		return p_Data;
+	}
+
+	T* end() const
+	{
+		return p_Data + t_Size;
+	}
+
+	std::size_t size() const
+	{
+		return t_Size;
+	}
+
+	bool empty() const
+	{
+		return t_Size == 0;
+	}
+
+	T& operator [] (std::size_t _index) const
+	{
+		ASSERT (_index < t_Size);
+		return p_Data[_index];
+	}
+
+private:
+	T* p_Data;
+	std::size_t t_Size;
+};
+
 typedef Buffer<char> CharBuffer;
 typedef Buffer<CxxAbb::Byte> ByteBuffer;
 typedef FixedLenBuffer<CxxAbb::Byte> FixedLenByteBuffer;
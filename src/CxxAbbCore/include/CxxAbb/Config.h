@@ -45,4 +45,10 @@
 //#define CXXABB_DEF_ATOMICITY_WINDOWS
 //#define CXXABB_DEF_ATOMICITY_PTHREAD
 
+/// Compile out lock contention profiling of named Mutex / FastMutex (see Sys/LockProfiler.h)
+//#define CXXABB_NO_LOCK_PROFILING
+
+/// Compile out CXXABB_TRACE_* event tracing macros (see Trace/Tracer.h)
+//#define CXXABB_NO_TRACING
+
 #endif /* CXXABB_CORE_CONFIG_H_ */
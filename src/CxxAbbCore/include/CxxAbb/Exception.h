@@ -29,6 +29,7 @@
 #define CXXABB_CORE_EXCEPTION_H_
 
 #include "CxxAbb/Core.h"
+#include "CxxAbb/SharedString.h"
 #include <exception>
 #include <stdexcept>
 
@@ -82,7 +83,8 @@ public:
 		return p_Nested;
 	}
 
-	const std::string& Message() const
+	/** @brief Shared, copying an exception does not copy its message */
+	const SharedString& Message() const
 	{
 		return s_Msg;
 	}
@@ -100,15 +102,36 @@ protected:
 	Exception(int _iCode = 0);
 	/// Standard constructor.
 
+	/** @brief Tag of the constructors that leave the what() text to a subclass */
+	struct DeferWhat {};
+
+	Exception(int _iCode, DeferWhat);
+
+	Exception(const std::string& _sMsg, int _iCode, DeferWhat);
+
+	Exception(const std::string& _sMsg, const Exception& _mNested, int _iCode, DeferWhat);
+
 	void Message(const std::string& _sMsg)
 	{
 		s_Msg = _sMsg;
+		BuildWhat();
 	}
 
 	void ExtendedMessage(const std::string& _sArg);
 
+	/** @brief Builds the "Name: Message" text what() returns
+	 *
+	 * Only the public constructors call it, they construct their base with a
+	 * DeferWhat constructor, so the text is built once, with the Name() of the most
+	 * derived class. what() never writes and concurrent calls on a shared exception
+	 * are safe. Subclasses written without CXXABB_IMPLEMENT_EXCEPTION do the same,
+	 * what() returns the bare message until BuildWhat() is called.
+	 */
+	void BuildWhat();
+
 private:
-	std::string s_Msg;
+	SharedString s_Msg;
+	SharedString s_What;   /// "Name: Message", see BuildWhat()
 	Exception* p_Nested;
 	int i_Code;
 };
@@ -129,19 +152,38 @@ private:
 		const char* ClassName() const throw();										\
 		CxxAbb::Exception* Clone() const;												\
 		void Rethrow() const;														\
+	protected:																		\
+		CLS(int _iCode, CxxAbb::Exception::DeferWhat);									\
+		CLS(const std::string& s_Msg, int _iCode, CxxAbb::Exception::DeferWhat);			\
+		CLS(const std::string& s_Msg, const CxxAbb::Exception& _mExc, int _iCode, CxxAbb::Exception::DeferWhat);	\
 	};
 
 #define CXXABB_DEFINE_EXCEPTION_BASE(API, CLS, BASE) \
 	CXXABB_DEFINE_EXCEPTION(API, CLS, BASE, 0)
 
 #define CXXABB_IMPLEMENT_EXCEPTION(CLS, BASE, NAME)													\
-	CLS::CLS(int _iCode): BASE(_iCode)																	\
+	CLS::CLS(int _iCode): BASE(_iCode, CxxAbb::Exception::DeferWhat())									\
+	{																								\
+		BuildWhat();																				\
+	}																								\
+	CLS::CLS(const std::string& _sMsg, int _iCode): BASE(_sMsg, _iCode, CxxAbb::Exception::DeferWhat())		\
+	{																								\
+		BuildWhat();																				\
+	}																								\
+	CLS::CLS(const std::string& _sMsg, const CxxAbb::Exception& _mExc, int _iCode)						\
+		: BASE(_sMsg, _mExc, _iCode, CxxAbb::Exception::DeferWhat())									\
+	{																								\
+		BuildWhat();																				\
+	}																								\
+	CLS::CLS(int _iCode, CxxAbb::Exception::DeferWhat _defer): BASE(_iCode, _defer)						\
 	{																								\
 	}																								\
-	CLS::CLS(const std::string& _sMsg, int _iCode): BASE(_sMsg, _iCode)										\
+	CLS::CLS(const std::string& _sMsg, int _iCode, CxxAbb::Exception::DeferWhat _defer)					\
+		: BASE(_sMsg, _iCode, _defer)																\
 	{																								\
 	}																								\
-	CLS::CLS(const std::string& _sMsg, const CxxAbb::Exception& _mExc, int _iCode): BASE(_sMsg, _mExc, _iCode)	\
+	CLS::CLS(const std::string& _sMsg, const CxxAbb::Exception& _mExc, int _iCode, CxxAbb::Exception::DeferWhat _defer)	\
+		: BASE(_sMsg, _mExc, _iCode, _defer)														\
 	{																								\
 	}																								\
 	CLS::CLS(const CLS& _mExc): BASE(_mExc)																\
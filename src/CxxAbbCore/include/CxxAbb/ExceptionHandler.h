@@ -60,6 +60,7 @@ public:
 /** @brief Thread Exception Handler
  *  Thread function thrown exceptions are handle by this class and its registerd handlers
  *  Custom handlers can be registered with Set() function
+ *  Handler state is a Dp::Singleton created on first use and destroyed at exit.
  */
 class CXXABB_API ThreadErrorHandler
 {
@@ -82,10 +83,6 @@ public:
 	static ExceptionHandler * Set(ExceptionHandler * _new);
 
 	static ExceptionHandler * Get();
-
-private:
-	static ExceptionHandler * p_CurrentHandler;
-	static CxxAbb::Sys::FastMutex m_Mutex;
 };
 
 }  /* namespace CxxAbb */
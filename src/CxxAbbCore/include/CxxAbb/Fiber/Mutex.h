@@ -0,0 +1,73 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Mutex.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber aware mutex
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_MUTEX_H_
+#define CXXABB_CORE_FIBER_MUTEX_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Fiber/Waiter.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+/** @brief Mutex which parks the calling fiber instead of blocking its carrier thread
+ *
+ * Uncontended Lock() / Unlock() are a single atomic operation each.
+ * Waiters are served in FIFO order, ownership is handed over directly.
+ * Usable from plain threads too. Unlike Sys::FastMutex it is not recursive.
+ */
+class CXXABB_API FastMutex : public CxxAbb::NonCopyable
+{
+public:
+	typedef CxxAbb::Sys::ScopedLock<FastMutex> ScopedLock;
+
+	FastMutex();
+	~FastMutex();
+
+	void Lock();
+	bool TryLock();
+	bool TryLock(long _lMiliSeconds);
+	void Unlock();
+
+private:
+	CxxAbb::Sys::SpinLock m_Spin;
+	CxxAbb::Sys::Atomic<int> i_Locked;
+	WaitQueue m_Waiters;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_MUTEX_H_ */
@@ -0,0 +1,173 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Scheduler.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : M:N scheduler running fibers on carrier threads
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_SCHEDULER_H_
+#define CXXABB_CORE_FIBER_SCHEDULER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Timestamp.h>
+#include <CxxAbb/Sys/Executor.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Fiber/StackPool.h>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+class FiberData;
+class Carrier;
+class Waiter;
+
+/** @brief Runs Runnables as fibers (user space threads) on N carrier threads
+ *
+ * Each fiber has its own small pooled stack and is switched in user space,
+ * so a blocked fiber costs only its touched stack pages, not an OS thread.
+ * Fibers block through the fiber aware FastMutex, SigEvent and WaitCondition
+ * of this namespace, which park the fiber and let the carrier run others.
+ * Blocking OS calls (Sys::Mutex, sleep, read) block the carrier with all its fibers.
+ *
+ * Fibers may migrate between carriers whenever they block or yield.
+ * Do not block or yield inside a catch handler and do not keep addresses of thread local data across a block.
+ *
+ * @code
+ * CxxAbb::Fiber::Scheduler scheduler(4);
+ * scheduler.Start();
+ * scheduler.Execute(new Session(socket)); // owned and deleted by scheduler
+ * ...
+ * scheduler.WaitIdle();
+ * scheduler.Stop();
+ * @endcode
+ */
+class CXXABB_API Scheduler : public CxxAbb::Sys::Executor, private CxxAbb::NonCopyable
+{
+public:
+	typedef std::multimap<CxxAbb::Timestamp::TimeVal, Waiter*> TimerMap;
+
+	/** @brief Create scheduler, carriers are not started yet
+	 *  @param _uiCarriers number of carrier threads
+	 *  @param _tStackSize usable stack size of each fiber
+	 */
+	explicit Scheduler(unsigned int _uiCarriers = 1, std::size_t _tStackSize = StackPool::DefaultStackSize);
+
+	/** @brief Stop carriers. See Stop()
+	 */
+	virtual ~Scheduler();
+
+	/** @brief Start carrier threads
+	 */
+	void Start();
+
+	/** @brief Stop carrier threads after their current fiber block or finish
+	 *  Remaining fibers are discarded, their tasks deleted without unwinding the fiber stack.
+	 *  Call WaitIdle() first for an orderly shutdown.
+	 */
+	void Stop();
+
+	/** @brief Run task on a new fiber. Scheduler takes ownership and deletes the task after Run()
+	 *  Can be called from any thread or fiber, also before Start()
+	 */
+	void Execute(CxxAbb::Runnable * _pTask);
+
+	/** @brief Block until all fibers finished
+	 */
+	void WaitIdle();
+
+	/** @brief Block at most x milliseconds until all fibers finished
+	 */
+	bool TryWaitIdle(long _lMilliSeconds);
+
+	/** @brief Number of live (not finished) fibers
+	 */
+	std::size_t FiberCount() const;
+
+	unsigned int CarrierCount() const
+	{
+		return static_cast<unsigned int>(lst_Carriers.size());
+	}
+
+	/** @brief Check if caller runs on a fiber
+	 */
+	static bool InFiber();
+
+	/** @brief Let other fibers run. Yields the thread if not called on a fiber
+	 */
+	static void Yield();
+
+	/** @brief Suspend current fiber at least x milliseconds. Sleeps the thread if not called on a fiber
+	 */
+	static void Sleep(long _lMilliSeconds);
+
+private:
+	friend class Carrier;
+	friend class Waiter;
+
+	/// Upper bound of a carrier idle wait, timers are checked at least this often
+	static const long MaxIdleWait = 100;
+
+	static FiberData * CurrentFiber();
+	static void Park();
+	static void FiberEntry(void * _pArg);
+
+	void Resume(FiberData * _pFiber);
+	void Enqueue(FiberData * _pFiber);
+	FiberData * Next(Carrier & _carrier);
+	void Destroy(FiberData * _pFiber);
+	void ArmTimer(Waiter & _waiter, long _lMilliSeconds);
+	void DisarmTimer(Waiter & _waiter);
+	void Unlink(FiberData * _pFiber);
+
+	StackPool m_Stacks;
+	std::vector<Carrier*> lst_Carriers;
+	std::vector<Carrier*> lst_Idle;
+	std::deque<FiberData*> lst_Ready;
+	TimerMap lst_Timers;
+	FiberData * p_Fibers;
+	std::size_t t_FiberCount;
+	bool b_Started;
+	bool b_Stopping;
+	/// ready queue, idle carriers, timers and start / stop state: a carrier checks
+	/// them and parks itself as idle in one step, so a wake up is never lost
+	mutable CxxAbb::Sys::FastMutex mtx_Queue;
+	/// live fiber list and count, touched once at the start and end of a fiber
+	mutable CxxAbb::Sys::FastMutex mtx_Fibers;
+	CxxAbb::Sys::SigEvent m_Idle;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_SCHEDULER_H_ */
@@ -0,0 +1,82 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SigEvent.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber aware event
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_SIGEVENT_H_
+#define CXXABB_CORE_FIBER_SIGEVENT_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Fiber/Waiter.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+/** @brief Event which parks waiting fibers instead of blocking their carrier thread
+ *  Same semantic as Sys::SigEvent, usable from plain threads too
+ */
+class CXXABB_API SigEvent : public CxxAbb::NonCopyable
+{
+public:
+	SigEvent(bool _autoreset = true);
+	~SigEvent();
+
+	/** @brief Set this event has happened
+	 *  Auto reset event releases one waiter, or stays set until the next wait
+	 */
+	void Set();
+
+	/** @brief Wait for this event to happen
+	 */
+	void Wait();
+
+	/** @brief Wait for this event at most x milliseconds
+	 */
+	bool TryWait(long _lMiliSeconds);
+
+	/** @brief Reset event - i.e. event has not happened
+	 */
+	void Reset();
+
+private:
+	/// Consume the event if set, caller holds the lock
+	bool Consume();
+
+	CxxAbb::Sys::SpinLock m_Spin;
+	WaitQueue m_Waiters;
+	bool b_AutoReset;
+	bool b_EventHappened;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_SIGEVENT_H_ */
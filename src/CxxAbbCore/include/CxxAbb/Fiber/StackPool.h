@@ -0,0 +1,100 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * StackPool.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Pool of guard paged fiber stacks
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_STACKPOOL_H_
+#define CXXABB_CORE_FIBER_STACKPOOL_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+/** @brief Pool of fixed size stacks for fibers
+ *
+ * Each stack is an anonymous mapping with a PROT_NONE guard page below it,
+ * so an overflow faults instead of silently corrupting the neighbour.
+ * Memory is reserved lazily (MAP_NORESERVE), an idle fiber costs only the pages it touched.
+ * Released stacks are cached up to a limit and reused without a system call.
+ */
+class CXXABB_API StackPool : private CxxAbb::NonCopyable
+{
+public:
+	/// Usable stack range is [p_Base, p_Base + t_Size), grows downwards
+	struct Stack
+	{
+		void * p_Base;
+		std::size_t t_Size;
+	};
+
+	static const std::size_t DefaultStackSize = 64 * 1024;
+
+	/** @brief Create pool
+	 *  @param _tStackSize usable stack size, rounded up to page size
+	 *  @param _tMaxCached max released stacks kept for reuse
+	 */
+	explicit StackPool(std::size_t _tStackSize = DefaultStackSize, std::size_t _tMaxCached = 1024);
+
+	/** @brief Unmap cached stacks. Stacks still in use are not tracked
+	 */
+	~StackPool();
+
+	/** @brief Get a stack. Throws OutOfMemoryException if mapping fails
+	 */
+	Stack Allocate();
+
+	/** @brief Return a stack got from Allocate()
+	 */
+	void Release(const Stack & _stack);
+
+	std::size_t StackSize() const
+	{
+		return t_StackSize;
+	}
+
+	std::size_t CachedCount() const;
+
+private:
+	void Unmap(void * _pMap);
+
+	std::size_t t_StackSize;
+	std::size_t t_PageSize;
+	std::size_t t_MaxCached;
+	std::vector<void*> lst_Free;
+	mutable CxxAbb::Sys::FastMutex mtx_Free;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_STACKPOOL_H_ */
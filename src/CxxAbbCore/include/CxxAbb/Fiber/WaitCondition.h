@@ -0,0 +1,110 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * WaitCondition.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber aware condition variable
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_WAITCONDITION_H_
+#define CXXABB_CORE_FIBER_WAITCONDITION_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Sys/ScopedUnlock.h>
+#include <CxxAbb/Fiber/Waiter.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+/** @brief Condition which parks waiting fibers instead of blocking their carrier thread
+ *  Same semantic as Sys::WaitCondition, usually used with Fiber::FastMutex
+ */
+class CXXABB_API WaitCondition : public CxxAbb::NonCopyable
+{
+public:
+	WaitCondition()
+	{}
+
+	~WaitCondition()
+	{}
+
+	/** @brief Release _mtxCall, wait on this condition to be signaled and re-acquire _mtxCall
+	 * First to call will be first to signaled (FIFO)
+	 */
+	template <class Mutex>
+	void Wait(Mutex & _mtxCall)
+	{
+		Waiter waiter;
+		CxxAbb::Sys::ScopedUnlock<Mutex> lckCall(_mtxCall, false);
+		{
+			CxxAbb::Sys::SpinLock::ScopedLock lckQueue(m_Spin);
+			m_Waiters.PushBack(waiter);
+		}
+		lckCall.Unlock();
+		waiter.Block();
+	}
+
+	/** @brief Same as Wait(), but wait at most x milliseconds
+	 *  @return false on timeout, _mtxCall is re-acquired in both cases
+	 */
+	template <class Mutex>
+	bool TryWait(Mutex & _mtxCall, long _lMilliseconds)
+	{
+		Waiter waiter;
+		CxxAbb::Sys::ScopedUnlock<Mutex> lckCall(_mtxCall, false);
+		{
+			CxxAbb::Sys::SpinLock::ScopedLock lckQueue(m_Spin);
+			m_Waiters.PushBack(waiter);
+		}
+		lckCall.Unlock();
+
+		if (waiter.Block(_lMilliseconds))
+			return true;
+
+		CxxAbb::Sys::SpinLock::ScopedLock lckQueue(m_Spin);
+		m_Waiters.Remove(waiter);
+		return false;
+	}
+
+	/** @brief Signal next waiter in queue
+	 */
+	void Signal();
+
+	/** @brief Signal all waiters
+	 */
+	void SignalAll();
+
+private:
+	CxxAbb::Sys::SpinLock m_Spin;
+	WaitQueue m_Waiters;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_WAITCONDITION_H_ */
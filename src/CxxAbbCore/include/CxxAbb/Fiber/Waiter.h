@@ -0,0 +1,140 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Waiter.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Wait queue building block of fiber synchronization objects
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_WAITER_H_
+#define CXXABB_CORE_FIBER_WAITER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Fiber/Scheduler.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+/** @brief One blocked fiber or thread, lives on the stack of the blocked party
+ *
+ * Waiter binds to the current fiber, or to the current thread when created outside a fiber,
+ * so fiber synchronization objects can also be used by plain threads.
+ * Wake-up sources (notification, timeout) race through Claim(), only the winner calls Wake().
+ */
+class CXXABB_API Waiter : private CxxAbb::NonCopyable
+{
+public:
+	enum Status
+	{
+		Waiting = 0,
+		Notified,
+		TimedOut
+	};
+
+	Waiter();
+	~Waiter();
+
+	/** @brief Try to become the one who wakes this waiter
+	 */
+	bool Claim(Status _eStatus)
+	{
+		int iExpected = Waiting;
+		return i_Status.CompareExchange(iExpected, _eStatus, CxxAbb::Sys::MemoryOrderAcqRel);
+	}
+
+	/** @brief Resume blocked party, only after a successful Claim(). Waiter may be gone on return
+	 */
+	void Wake();
+
+	/** @brief Block until woken
+	 */
+	void Block();
+
+	/** @brief Block until woken or x milliseconds passed
+	 *  @return true if notified, false on timeout (caller unlinks the waiter from its queue)
+	 */
+	bool Block(long _lMilliSeconds);
+
+private:
+	friend class WaitQueue;
+	friend class Scheduler;
+
+	Waiter * p_Prev;
+	Waiter * p_Next;
+	bool b_Linked;
+	FiberData * p_Fiber;
+	CxxAbb::Sys::SigEvent * p_Event;
+	CxxAbb::Sys::Atomic<int> i_Status;
+	bool b_TimerArmed;
+	Scheduler::TimerMap::iterator t_TimerPos;
+};
+
+/** @brief FIFO of waiters, guarded by the owner's lock
+ */
+class CXXABB_API WaitQueue : private CxxAbb::NonCopyable
+{
+public:
+	WaitQueue()
+		: p_Head(NullPtr), p_Tail(NullPtr)
+	{}
+
+	bool Empty() const
+	{
+		return p_Head == NullPtr;
+	}
+
+	void PushBack(Waiter & _waiter);
+
+	/** @brief Unlink waiter, no effect if already unlinked
+	 */
+	void Remove(Waiter & _waiter);
+
+	/** @brief Unlink waiters from front until one is claimed as notified
+	 *  @return claimed waiter to be woken by caller, NULL if none
+	 */
+	Waiter * ClaimFront();
+
+	/** @brief Unlink and claim all waiters
+	 *  @return claimed waiters chained by WakeAll() order, NULL if none
+	 */
+	Waiter * ClaimAll();
+
+	/** @brief Wake a chain returned by ClaimAll()
+	 */
+	static void WakeAll(Waiter * _pChain);
+
+private:
+	Waiter * p_Head;
+	Waiter * p_Tail;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_WAITER_H_ */
@@ -0,0 +1,658 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * FlatHashMap.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Open addressing hash map
+ *
+ */
+
+
+#ifndef CXXABB_CORE_FLATHASHMAP_H_
+#define CXXABB_CORE_FLATHASHMAP_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/BitOps.h>
+#include <CxxAbb/Hash.h>
+#include <CxxAbb/MemoryPool.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__)
+#define CXXABB_FLATHASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace CxxAbb
+{
+namespace Dp
+{
+
+/** @brief 16 control bytes of a FlatHashMap, matched at once
+ *
+ * A control byte is the low 7 bits of the hash for a full slot, CtrlEmpty or
+ * CtrlDeleted (both with the high bit set) otherwise. The Match functions return
+ * one bit per byte, bit i for _pCtrl[i].
+ */
+class FlatHashGroup
+{
+public:
+	enum
+	{
+		Width = 16,
+		CtrlEmpty = -128,
+		CtrlDeleted = -2
+	};
+
+	explicit FlatHashGroup(const Int8 * _pCtrl)
+#ifdef CXXABB_FLATHASH_SSE2
+		: m_Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_pCtrl)))
+#else
+		: p_Ctrl(_pCtrl)
+#endif
+	{}
+
+	UInt32 Match(Int8 _iH2) const
+	{
+#ifdef CXXABB_FLATHASH_SSE2
+		return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(_iH2), m_Ctrl)));
+#else
+		UInt32 uiMask = 0;
+		for (int i = 0; i < Width; ++i)
+			uiMask |= static_cast<UInt32>(p_Ctrl[i] == _iH2) << i;
+		return uiMask;
+#endif
+	}
+
+	UInt32 MatchEmpty() const
+	{
+		return Match(static_cast<Int8>(CtrlEmpty));
+	}
+
+	UInt32 MatchEmptyOrDeleted() const
+	{
+#ifdef CXXABB_FLATHASH_SSE2
+		return static_cast<UInt32>(_mm_movemask_epi8(m_Ctrl));
+#else
+		UInt32 uiMask = 0;
+		for (int i = 0; i < Width; ++i)
+			uiMask |= static_cast<UInt32>(p_Ctrl[i] < 0) << i;
+		return uiMask;
+#endif
+	}
+
+private:
+#ifdef CXXABB_FLATHASH_SSE2
+	__m128i m_Ctrl;
+#else
+	const Int8 * p_Ctrl;
+#endif
+};
+
+}  /* namespace Dp */
+
+/** @brief Open addressing hash map with SwissTable style control bytes
+ *
+ * Elements live in one flat array next to an array of control bytes, one per
+ * slot holding 7 bits of the hash. A lookup compares 16 control bytes with one
+ * SSE2 instruction and touches a slot only on a 7 bit match, so most misses
+ * never read a key. The table is a power of two, at most 7/8 full.
+ *
+ * Find(), Contains() and Erase() take any type the hasher and E accept
+ * together with K, e.g. a const char * for std::string keys.
+ *
+ * Storage that fits _pPool->BlockSize() comes from the pool, bigger tables from
+ * the heap: StorageSize() tells the block size for a given Capacity(). The pool
+ * must outlive the map.
+ *
+ * Inserting or erasing invalidates iterators and element pointers on rehash,
+ * erasing leaves others valid. Copying K and V should not throw, a throwing
+ * copy during rehash leaves the map unchanged.
+ *
+ * @code
+ * CxxAbb::FlatHashMap<std::string, int> ages;
+ * ages["alice"] = 31;
+ * CxxAbb::FlatHashMap<std::string, int>::Iterator it = ages.Find("alice");
+ * @endcode
+ */
+template <typename K, typename V, typename H = Hash<K>, typename E = EqualTo<K> >
+class FlatHashMap
+{
+	typedef Dp::FlatHashGroup Group;
+
+public:
+	typedef K KeyType;
+	typedef V MappedType;
+	typedef std::pair<const K, V> ValueType;
+
+	template <typename T>
+	class IteratorT
+	{
+	public:
+		IteratorT()
+			: p_Ctrl(NullPtr),
+			  p_End(NullPtr),
+			  p_Slot(NullPtr)
+		{}
+
+		/// Iterator to ConstIterator
+		template <typename U>
+		IteratorT(const IteratorT<U> & _rhs)
+			: p_Ctrl(_rhs.p_Ctrl),
+			  p_End(_rhs.p_End),
+			  p_Slot(_rhs.p_Slot)
+		{}
+
+		T & operator *() const
+		{
+			return *p_Slot;
+		}
+
+		T * operator ->() const
+		{
+			return p_Slot;
+		}
+
+		IteratorT & operator ++()
+		{
+			++p_Ctrl;
+			++p_Slot;
+			SkipFree();
+			return *this;
+		}
+
+		IteratorT operator ++(int)
+		{
+			IteratorT it = *this;
+			++*this;
+			return it;
+		}
+
+		bool operator ==(const IteratorT & _rhs) const
+		{
+			return p_Ctrl == _rhs.p_Ctrl;
+		}
+
+		bool operator !=(const IteratorT & _rhs) const
+		{
+			return p_Ctrl != _rhs.p_Ctrl;
+		}
+
+	private:
+		friend class FlatHashMap;
+		template <typename U> friend class IteratorT;
+
+		IteratorT(const Int8 * _pCtrl, const Int8 * _pEnd, T * _pSlot)
+			: p_Ctrl(_pCtrl),
+			  p_End(_pEnd),
+			  p_Slot(_pSlot)
+		{}
+
+		void SkipFree()
+		{
+			while (p_Ctrl != p_End && *p_Ctrl < 0)
+			{
+				++p_Ctrl;
+				++p_Slot;
+			}
+		}
+
+		const Int8 * p_Ctrl;
+		const Int8 * p_End;
+		T * p_Slot;
+	};
+
+	typedef IteratorT<ValueType> Iterator;
+	typedef IteratorT<const ValueType> ConstIterator;
+
+	explicit FlatHashMap(MemoryPool * _pPool = NullPtr, const H & _hash = H(), const E & _equal = E())
+		: p_Ctrl(NullPtr),
+		  p_Slots(NullPtr),
+		  t_Capacity(0),
+		  t_Size(0),
+		  t_GrowthLeft(0),
+		  p_Pool(_pPool),
+		  m_Hash(_hash),
+		  m_Equal(_equal)
+	{}
+
+	FlatHashMap(const FlatHashMap & _rhs)
+		: p_Ctrl(NullPtr),
+		  p_Slots(NullPtr),
+		  t_Capacity(0),
+		  t_Size(0),
+		  t_GrowthLeft(0),
+		  p_Pool(_rhs.p_Pool),
+		  m_Hash(_rhs.m_Hash),
+		  m_Equal(_rhs.m_Equal)
+	{
+		Reserve(_rhs.t_Size);
+		try
+		{
+			for (ConstIterator it = _rhs.begin(); it != _rhs.end(); ++it)
+			{
+				UInt64 uiHash = m_Hash(it->first);
+				std::size_t tIndex = FindFirstNonFull(uiHash);
+				new (p_Slots + tIndex) ValueType(*it);
+				Commit(tIndex, uiHash);
+			}
+		}
+		catch (...)
+		{
+			Destroy();
+			throw;
+		}
+	}
+
+	~FlatHashMap()
+	{
+		Destroy();
+	}
+
+	FlatHashMap & operator =(const FlatHashMap & _rhs)
+	{
+		if (this != &_rhs)
+		{
+			FlatHashMap copy(_rhs);
+			Swap(copy);
+		}
+		return *this;
+	}
+
+	void Swap(FlatHashMap & _rhs)
+	{
+		std::swap(p_Ctrl, _rhs.p_Ctrl);
+		std::swap(p_Slots, _rhs.p_Slots);
+		std::swap(t_Capacity, _rhs.t_Capacity);
+		std::swap(t_Size, _rhs.t_Size);
+		std::swap(t_GrowthLeft, _rhs.t_GrowthLeft);
+		std::swap(p_Pool, _rhs.p_Pool);
+		std::swap(m_Hash, _rhs.m_Hash);
+		std::swap(m_Equal, _rhs.m_Equal);
+	}
+
+	std::size_t Size() const
+	{
+		return t_Size;
+	}
+
+	bool Empty() const
+	{
+		return t_Size == 0;
+	}
+
+	/// Slots in the table, Size() may grow to 7/8 of it (less erased slots) without a rehash
+	std::size_t Capacity() const
+	{
+		return t_Capacity;
+	}
+
+	/** @brief Inserts (_key, _value) unless _key is present, false and the present element then */
+	std::pair<Iterator, bool> Insert(const K & _key, const V & _value)
+	{
+		UInt64 uiHash = m_Hash(_key);
+		std::size_t tIndex = FindIndex(_key, uiHash);
+		if (tIndex != NoIndex)
+			return std::make_pair(IteratorAt(tIndex), false);
+		tIndex = PrepareInsert(uiHash);
+		new (p_Slots + tIndex) ValueType(_key, _value);
+		Commit(tIndex, uiHash);
+		return std::make_pair(IteratorAt(tIndex), true);
+	}
+
+	std::pair<Iterator, bool> Insert(const ValueType & _value)
+	{
+		return Insert(_value.first, _value.second);
+	}
+
+	/** @brief Inserts or overwrites, true if inserted */
+	std::pair<Iterator, bool> InsertOrAssign(const K & _key, const V & _value)
+	{
+		std::pair<Iterator, bool> res = Insert(_key, _value);
+		if (!res.second)
+			res.first->second = _value;
+		return res;
+	}
+
+	/// Inserts V() if _key is missing
+	V & operator [](const K & _key)
+	{
+		return Insert(_key, V()).first->second;
+	}
+
+	template <typename Q>
+	Iterator Find(const Q & _key)
+	{
+		std::size_t tIndex = FindIndex(_key, m_Hash(_key));
+		return tIndex == NoIndex ? end() : IteratorAt(tIndex);
+	}
+
+	template <typename Q>
+	ConstIterator Find(const Q & _key) const
+	{
+		std::size_t tIndex = FindIndex(_key, m_Hash(_key));
+		return tIndex == NoIndex ? end() : ConstIterator(p_Ctrl + tIndex, p_Ctrl + t_Capacity, p_Slots + tIndex);
+	}
+
+	template <typename Q>
+	bool Contains(const Q & _key) const
+	{
+		return FindIndex(_key, m_Hash(_key)) != NoIndex;
+	}
+
+	/// Number of elements erased, 0 or 1
+	template <typename Q>
+	std::size_t Erase(const Q & _key)
+	{
+		std::size_t tIndex = FindIndex(_key, m_Hash(_key));
+		if (tIndex == NoIndex)
+			return 0;
+		EraseAt(tIndex);
+		return 1;
+	}
+
+	void Erase(Iterator _it)
+	{
+		EraseAt(static_cast<std::size_t>(_it.p_Ctrl - p_Ctrl));
+	}
+
+	/// Destroys all elements, keeps the table
+	void Clear()
+	{
+		if (!t_Capacity)
+			return;
+		DestroyElements();
+		std::memset(p_Ctrl, Group::CtrlEmpty, t_Capacity + Group::Width);
+		t_Size = 0;
+		t_GrowthLeft = MaxLoad(t_Capacity);
+	}
+
+	/// Room for _tCount elements without a rehash
+	void Reserve(std::size_t _tCount)
+	{
+		std::size_t tCapacity = CapacityFor(_tCount);
+		if (tCapacity > t_Capacity)
+			Resize(tCapacity);
+	}
+
+	/** @brief Rebuilds the table for max(_tCount, Size()) elements
+	 *
+	 * Drops erased slots and can shrink, Rehash(0) on an empty map frees the table.
+	 */
+	void Rehash(std::size_t _tCount)
+	{
+		if (_tCount < t_Size)
+			_tCount = t_Size;
+		if (_tCount == 0)
+		{
+			Destroy();
+			return;
+		}
+		Resize(CapacityFor(_tCount));
+	}
+
+	Iterator begin()
+	{
+		Iterator it(p_Ctrl, p_Ctrl + t_Capacity, p_Slots);
+		it.SkipFree();
+		return it;
+	}
+
+	Iterator end()
+	{
+		return Iterator(p_Ctrl + t_Capacity, p_Ctrl + t_Capacity, p_Slots + t_Capacity);
+	}
+
+	ConstIterator begin() const
+	{
+		ConstIterator it(p_Ctrl, p_Ctrl + t_Capacity, p_Slots);
+		it.SkipFree();
+		return it;
+	}
+
+	ConstIterator end() const
+	{
+		return ConstIterator(p_Ctrl + t_Capacity, p_Ctrl + t_Capacity, p_Slots + t_Capacity);
+	}
+
+	/// Bytes of one allocation for a table of _tCapacity slots, for sizing a MemoryPool
+	static std::size_t StorageSize(std::size_t _tCapacity)
+	{
+		return SlotOffset(_tCapacity) + _tCapacity * sizeof(ValueType);
+	}
+
+	/// Capacity() after Reserve(_tCount) on an empty map
+	static std::size_t CapacityFor(std::size_t _tCount)
+	{
+		if (!_tCount)
+			return 0;
+		std::size_t tCapacity = Group::Width;
+		while (MaxLoad(tCapacity) < _tCount)
+			tCapacity <<= 1;
+		return tCapacity;
+	}
+
+private:
+	static const std::size_t NoIndex = ~static_cast<std::size_t>(0);
+
+	static std::size_t MaxLoad(std::size_t _tCapacity)
+	{
+		return _tCapacity - _tCapacity / 8;
+	}
+
+	static std::size_t SlotOffset(std::size_t _tCapacity)
+	{
+		const std::size_t tAlign = __alignof__(ValueType);
+		return (_tCapacity + Group::Width + tAlign - 1) / tAlign * tAlign;
+	}
+
+	static Int8 H2(UInt64 _uiHash)
+	{
+		return static_cast<Int8>(_uiHash & 0x7F);
+	}
+
+	Iterator IteratorAt(std::size_t _tIndex)
+	{
+		return Iterator(p_Ctrl + _tIndex, p_Ctrl + t_Capacity, p_Slots + _tIndex);
+	}
+
+	/// The first 15 control bytes are mirrored past the end for group loads near it
+	void SetCtrl(std::size_t _tIndex, Int8 _iCtrl)
+	{
+		p_Ctrl[_tIndex] = _iCtrl;
+		if (_tIndex < Group::Width - 1)
+			p_Ctrl[t_Capacity + _tIndex] = _iCtrl;
+	}
+
+	/// Triangular probing over groups, visits every group of a power of two table once
+	template <typename Q>
+	std::size_t FindIndex(const Q & _key, UInt64 _uiHash) const
+	{
+		if (!t_Capacity)
+			return NoIndex;
+		const std::size_t tMask = t_Capacity - 1;
+		const Int8 iH2 = H2(_uiHash);
+		std::size_t tPos = static_cast<std::size_t>(_uiHash >> 7) & tMask;
+		for (std::size_t tStep = Group::Width; ; tStep += Group::Width)
+		{
+			Group group(p_Ctrl + tPos);
+			for (UInt32 uiMatch = group.Match(iH2); uiMatch; uiMatch &= uiMatch - 1)
+			{
+				std::size_t tIndex = (tPos + CountTrailingZeros(uiMatch)) & tMask;
+				if (m_Equal(p_Slots[tIndex].first, _key))
+					return tIndex;
+			}
+			if (group.MatchEmpty())
+				return NoIndex;
+			tPos = (tPos + tStep) & tMask;
+		}
+	}
+
+	std::size_t FindFirstNonFull(UInt64 _uiHash) const
+	{
+		const std::size_t tMask = t_Capacity - 1;
+		std::size_t tPos = static_cast<std::size_t>(_uiHash >> 7) & tMask;
+		for (std::size_t tStep = Group::Width; ; tStep += Group::Width)
+		{
+			UInt32 uiFree = Group(p_Ctrl + tPos).MatchEmptyOrDeleted();
+			if (uiFree)
+				return (tPos + CountTrailingZeros(uiFree)) & tMask;
+			tPos = (tPos + tStep) & tMask;
+		}
+	}
+
+	/// Slot for a new element, grows first if it would take the last empty slot allowed
+	std::size_t PrepareInsert(UInt64 _uiHash)
+	{
+		if (t_Capacity)
+		{
+			std::size_t tIndex = FindFirstNonFull(_uiHash);
+			if (t_GrowthLeft || p_Ctrl[tIndex] == Group::CtrlDeleted)
+				return tIndex;
+		}
+		// mostly erased slots: rebuild at the same size, else double
+		if (t_Capacity > Group::Width && t_Size <= MaxLoad(t_Capacity) / 2)
+			Resize(t_Capacity);
+		else
+			Resize(t_Capacity ? t_Capacity * 2 : static_cast<std::size_t>(Group::Width));
+		return FindFirstNonFull(_uiHash);
+	}
+
+	void Commit(std::size_t _tIndex, UInt64 _uiHash)
+	{
+		t_GrowthLeft -= p_Ctrl[_tIndex] == Group::CtrlEmpty;
+		SetCtrl(_tIndex, H2(_uiHash));
+		++t_Size;
+	}
+
+	/// A slot becomes empty again if no probe can have passed it: some group
+	/// around it always had an empty slot
+	void EraseAt(std::size_t _tIndex)
+	{
+		p_Slots[_tIndex].~ValueType();
+		--t_Size;
+		const std::size_t tBefore = (_tIndex - Group::Width) & (t_Capacity - 1);
+		const UInt32 uiEmptyAfter = Group(p_Ctrl + _tIndex).MatchEmpty();
+		const UInt32 uiEmptyBefore = Group(p_Ctrl + tBefore).MatchEmpty();
+		const bool bWasNeverFull = uiEmptyBefore && uiEmptyAfter &&
+			CountTrailingZeros(uiEmptyAfter) + CountLeadingZeros(static_cast<UInt16>(uiEmptyBefore)) < static_cast<unsigned int>(Group::Width);
+		SetCtrl(_tIndex, static_cast<Int8>(bWasNeverFull ? Group::CtrlEmpty : Group::CtrlDeleted));
+		t_GrowthLeft += bWasNeverFull;
+	}
+
+	void Resize(std::size_t _tCapacity)
+	{
+		Int8 * pOldCtrl = p_Ctrl;
+		ValueType * pOldSlots = p_Slots;
+		const std::size_t tOldCapacity = t_Capacity;
+		const std::size_t tOldGrowthLeft = t_GrowthLeft;
+
+		Allocate(_tCapacity);
+		t_GrowthLeft = MaxLoad(_tCapacity) - t_Size;
+		std::size_t i = 0;
+		try
+		{
+			for (; i < tOldCapacity; ++i)
+			{
+				if (pOldCtrl[i] < 0)
+					continue;
+				UInt64 uiHash = m_Hash(pOldSlots[i].first);
+				std::size_t tIndex = FindFirstNonFull(uiHash);
+				new (p_Slots + tIndex) ValueType(pOldSlots[i]);
+				SetCtrl(tIndex, H2(uiHash));
+			}
+		}
+		catch (...)
+		{
+			DestroyElements();
+			Deallocate(p_Ctrl, t_Capacity);
+			p_Ctrl = pOldCtrl;
+			p_Slots = pOldSlots;
+			t_Capacity = tOldCapacity;
+			t_GrowthLeft = tOldGrowthLeft;
+			throw;
+		}
+
+		for (i = 0; i < tOldCapacity; ++i)
+		{
+			if (pOldCtrl[i] >= 0)
+				pOldSlots[i].~ValueType();
+		}
+		if (tOldCapacity)
+			Deallocate(pOldCtrl, tOldCapacity);
+	}
+
+	void Allocate(std::size_t _tCapacity)
+	{
+		std::size_t tBytes = StorageSize(_tCapacity);
+		void * pStorage = (p_Pool && tBytes <= p_Pool->BlockSize()) ? p_Pool->Get() : ::operator new(tBytes);
+		p_Ctrl = static_cast<Int8 *>(pStorage);
+		p_Slots = reinterpret_cast<ValueType *>(static_cast<char *>(pStorage) + SlotOffset(_tCapacity));
+		t_Capacity = _tCapacity;
+		std::memset(p_Ctrl, Group::CtrlEmpty, _tCapacity + Group::Width);
+	}
+
+	void Deallocate(Int8 * _pCtrl, std::size_t _tCapacity)
+	{
+		if (p_Pool && StorageSize(_tCapacity) <= p_Pool->BlockSize())
+			p_Pool->Release(_pCtrl);
+		else
+			::operator delete(_pCtrl);
+	}
+
+	void DestroyElements()
+	{
+		for (std::size_t i = 0; i < t_Capacity; ++i)
+		{
+			if (p_Ctrl[i] >= 0)
+				p_Slots[i].~ValueType();
+		}
+	}
+
+	void Destroy()
+	{
+		if (!t_Capacity)
+			return;
+		DestroyElements();
+		Deallocate(p_Ctrl, t_Capacity);
+		p_Ctrl = NullPtr;
+		p_Slots = NullPtr;
+		t_Capacity = 0;
+		t_Size = 0;
+		t_GrowthLeft = 0;
+	}
+
+	Int8 * p_Ctrl;
+	ValueType * p_Slots;
+	std::size_t t_Capacity;
+	std::size_t t_Size;
+	std::size_t t_GrowthLeft;   /// inserts into empty slots before the next rehash
+	MemoryPool * p_Pool;
+	H m_Hash;
+	E m_Equal;
+};
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FLATHASHMAP_H_ */
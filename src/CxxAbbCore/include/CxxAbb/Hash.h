@@ -0,0 +1,160 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Hash.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Hash functors for the hash containers
+ *
+ */
+
+
+#ifndef CXXABB_CORE_HASH_H_
+#define CXXABB_CORE_HASH_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/SharedString.h>
+
+#include <cstring>
+#include <string>
+
+namespace CxxAbb
+{
+
+/** @brief Finalizer of MurmurHash3, a bijection that spreads every input bit over the result */
+inline UInt64 HashMix(UInt64 _uiValue)
+{
+	_uiValue ^= _uiValue >> 33;
+	_uiValue *= 0xFF51AFD7ED558CCDULL;
+	_uiValue ^= _uiValue >> 33;
+	_uiValue *= 0xC4CEB9FE1A85EC53ULL;
+	_uiValue ^= _uiValue >> 33;
+	return _uiValue;
+}
+
+/** @brief Hash of an integer key: both halves of a 64x64 bit product folded
+ *
+ * One multiplication, cheaper than HashMix() on the lookup path of a hash table
+ * and mixed well enough for it. HashMix() where there is no 128 bit product.
+ */
+inline UInt64 HashFold(UInt64 _uiValue)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef unsigned __int128 UInt128;
+	UInt128 uiProduct = static_cast<UInt128>(_uiValue) * 0x9E3779B97F4A7C15ULL;
+	return static_cast<UInt64>(uiProduct) ^ static_cast<UInt64>(uiProduct >> 64);
+#else
+	return HashMix(_uiValue);
+#endif
+}
+
+/** @brief Hash of a byte range, 8 bytes per step */
+CXXABB_API UInt64 HashBytes(const void * _pData, std::size_t _tSize, UInt64 _uiSeed = 0);
+
+/** @brief Default hasher of FlatHashMap, all bits of the result are well mixed
+ *
+ * Specialize for own key types. A hasher may overload operator() for other
+ * types that compare equal to the key (Hash<std::string> takes const char *),
+ * containers then find a key from those without building a K.
+ */
+template <typename T>
+struct Hash;
+
+#define CXXABB_HASH_INTEGER(T) \
+	template <> \
+	struct Hash<T> \
+	{ \
+		UInt64 operator ()(T _value) const \
+		{ \
+			return HashFold(static_cast<UInt64>(_value)); \
+		} \
+	}
+
+CXXABB_HASH_INTEGER(bool);
+CXXABB_HASH_INTEGER(char);
+CXXABB_HASH_INTEGER(signed char);
+CXXABB_HASH_INTEGER(unsigned char);
+CXXABB_HASH_INTEGER(short);
+CXXABB_HASH_INTEGER(unsigned short);
+CXXABB_HASH_INTEGER(int);
+CXXABB_HASH_INTEGER(unsigned int);
+CXXABB_HASH_INTEGER(long);
+CXXABB_HASH_INTEGER(unsigned long);
+CXXABB_HASH_INTEGER(long long);
+CXXABB_HASH_INTEGER(unsigned long long);
+
+#undef CXXABB_HASH_INTEGER
+
+template <typename T>
+struct Hash<T *>
+{
+	UInt64 operator ()(const T * _pValue) const
+	{
+		return HashFold(reinterpret_cast<UPtrT>(_pValue));
+	}
+};
+
+template <>
+struct Hash<std::string>
+{
+	UInt64 operator ()(const std::string & _sValue) const
+	{
+		return HashBytes(_sValue.data(), _sValue.size());
+	}
+
+	UInt64 operator ()(const char * _zValue) const
+	{
+		return HashBytes(_zValue, std::strlen(_zValue));
+	}
+};
+
+template <>
+struct Hash<SharedString>
+{
+	UInt64 operator ()(const SharedString & _value) const
+	{
+		return HashBytes(_value.data(), _value.size());
+	}
+
+	UInt64 operator ()(const std::string & _sValue) const
+	{
+		return HashBytes(_sValue.data(), _sValue.size());
+	}
+
+	UInt64 operator ()(const char * _zValue) const
+	{
+		return HashBytes(_zValue, std::strlen(_zValue));
+	}
+};
+
+/** @brief Default key comparison, takes anything K has an operator == with */
+template <typename T>
+struct EqualTo
+{
+	template <typename U>
+	bool operator ()(const T & _lhs, const U & _rhs) const
+	{
+		return _lhs == _rhs;
+	}
+};
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_HASH_H_ */
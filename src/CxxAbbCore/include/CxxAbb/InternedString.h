@@ -0,0 +1,153 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * InternedString.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Process wide table of unique strings
+ *
+ */
+
+
+#ifndef CXXABB_CORE_INTERNEDSTRING_H_
+#define CXXABB_CORE_INTERNEDSTRING_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Hash.h>
+#include <CxxAbb/SharedString.h>
+
+#include <iosfwd>
+#include <string>
+
+namespace CxxAbb
+{
+
+namespace Dp
+{
+
+struct InternEntry
+{
+	SharedString m_Value;
+	UInt64 ui_Hash;
+};
+
+}  /* namespace Dp */
+
+/** @brief Handle of a string in the process wide intern table
+ *
+ * Equal strings are interned to the same entry, so comparing and hashing two
+ * handles is comparing and hashing one pointer, and a handle is a pointer copy.
+ * Entries are never freed: intern names, keys and identifiers drawn from a
+ * bounded set, not arbitrary input.
+ *
+ * Interning looks the string up under a shard read lock and only takes the
+ * shard's write lock the first time a string is seen; intern once and keep the
+ * handle on hot paths.
+ *
+ * @code
+ * static const CxxAbb::InternedString s_Get("GET");
+ * if (CxxAbb::InternedString(zMethod) == s_Get)
+ *     ...
+ * @endcode
+ */
+class CXXABB_API InternedString
+{
+public:
+	/** @brief The empty string, without touching the table */
+	InternedString();
+
+	explicit InternedString(const char * _zValue);
+
+	InternedString(const char * _pData, std::size_t _tSize);
+
+	explicit InternedString(const std::string & _sValue);
+
+	explicit InternedString(const SharedString & _value);
+
+	const SharedString & Value() const
+	{
+		return p_Entry->m_Value;
+	}
+
+	const char * c_str() const
+	{
+		return p_Entry->m_Value.c_str();
+	}
+
+	std::size_t size() const
+	{
+		return p_Entry->m_Value.size();
+	}
+
+	bool empty() const
+	{
+		return p_Entry->m_Value.empty();
+	}
+
+	std::string str() const
+	{
+		return p_Entry->m_Value.str();
+	}
+
+	/** @brief HashBytes() of the characters, computed once when interned */
+	UInt64 HashValue() const
+	{
+		return p_Entry->ui_Hash;
+	}
+
+	bool operator == (const InternedString & _rhs) const
+	{
+		return p_Entry == _rhs.p_Entry;
+	}
+
+	bool operator != (const InternedString & _rhs) const
+	{
+		return p_Entry != _rhs.p_Entry;
+	}
+
+	/** @brief Order of the entries in memory, stable for the process but not alphabetical */
+	bool operator < (const InternedString & _rhs) const
+	{
+		return p_Entry < _rhs.p_Entry;
+	}
+
+	/** @brief Number of strings interned so far */
+	static std::size_t TableSize();
+
+private:
+	void Intern(const char * _pData, std::size_t _tSize);
+
+	const Dp::InternEntry * p_Entry;
+};
+
+CXXABB_API std::ostream & operator << (std::ostream & _os, const InternedString & _value);
+
+template <>
+struct Hash<InternedString>
+{
+	UInt64 operator ()(const InternedString & _value) const
+	{
+		return _value.HashValue();
+	}
+};
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_INTERNEDSTRING_H_ */
@@ -0,0 +1,280 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Logger.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Logging
+ * Comment     : Asynchronous logger with per thread lock free rings
+ *
+ */
+
+#ifndef CXXABB_LOG_LOGGER_H_
+#define CXXABB_LOG_LOGGER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#include <cstring>
+#include <string>
+
+namespace CxxAbb
+{
+
+namespace Log
+{
+
+enum Level
+{
+	LevelTrace,
+	LevelDebug,
+	LevelInfo,
+	LevelWarning,
+	LevelError,
+	LevelFatal
+};
+
+/** @brief What a thread does when its ring is full */
+enum OverflowPolicy
+{
+	OverflowDrop,      /// discard the record and count it, never blocks
+	OverflowBlock      /// wait for the writer to make room
+};
+
+/** @brief One format argument, captured by value (strings are copied into the record) */
+class CXXABB_API Arg
+{
+public:
+	enum Type
+	{
+		TypeInt,
+		TypeUInt,
+		TypeDouble,
+		TypeBool,
+		TypeChar,
+		TypeString,
+		TypePointer
+	};
+
+	Arg(bool _bValue) : e_Type(TypeBool) { u_Value.ui = _bValue ? 1 : 0; }
+	Arg(char _cValue) : e_Type(TypeChar) { u_Value.ui = static_cast<unsigned char>(_cValue); }
+	Arg(short _iValue) : e_Type(TypeInt) { u_Value.i = _iValue; }
+	Arg(unsigned short _uiValue) : e_Type(TypeUInt) { u_Value.ui = _uiValue; }
+	Arg(int _iValue) : e_Type(TypeInt) { u_Value.i = _iValue; }
+	Arg(unsigned int _uiValue) : e_Type(TypeUInt) { u_Value.ui = _uiValue; }
+	Arg(long _lValue) : e_Type(TypeInt) { u_Value.i = _lValue; }
+	Arg(unsigned long _ulValue) : e_Type(TypeUInt) { u_Value.ui = _ulValue; }
+#if defined(CXXABB_64_BIT_ENABLED)
+	Arg(long long _llValue) : e_Type(TypeInt) { u_Value.i = _llValue; }
+	Arg(unsigned long long _ullValue) : e_Type(TypeUInt) { u_Value.ui = _ullValue; }
+#endif
+	Arg(float _fValue) : e_Type(TypeDouble) { u_Value.d = _fValue; }
+	Arg(double _dValue) : e_Type(TypeDouble) { u_Value.d = _dValue; }
+	Arg(const void * _pValue) : e_Type(TypePointer) { u_Value.p = _pValue; }
+
+	Arg(const char * _zValue)
+		: e_Type(TypeString),
+		  z_String(_zValue ? _zValue : "(null)"),
+		  t_Length(std::strlen(z_String))
+	{}
+
+	Arg(const std::string & _sValue)
+		: e_Type(TypeString),
+		  z_String(_sValue.data()),
+		  t_Length(_sValue.size())
+	{}
+
+	Type e_Type;
+	union
+	{
+		Int64 i;
+		UInt64 ui;
+		double d;
+		const void * p;
+	} u_Value;
+	const char * z_String;
+	std::size_t t_Length;
+};
+
+/** @brief Logger configuration, see Logger::Start() */
+struct CXXABB_API LoggerOptions
+{
+	LoggerOptions()
+		: e_Level(LevelInfo),
+		  e_Overflow(OverflowDrop),
+		  t_RingRecords(4096),
+		  l_FlushMilliSeconds(100)
+	{}
+
+	Level e_Level;                 /// records below this level are not enqueued
+	OverflowPolicy e_Overflow;
+	std::size_t t_RingRecords;     /// per thread ring capacity, rounded up to a power of two
+	long l_FlushMilliSeconds;      /// writer period
+};
+
+/** @brief Process wide asynchronous logger
+ *
+ * Logging a record copies the level, a Timestamp, the format string pointer and
+ * the arguments into a lock free ring of the calling thread (single producer,
+ * the writer thread is the single consumer). No formatting or I/O happens on the
+ * calling thread. A background writer Sys::Thread formats the records and hands
+ * them in batches to the Sink, which writes them with writev().
+ *
+ * Format strings must outlive the logger (string literals), only the pointer is
+ * stored. Each "{}" is replaced by the next argument, at most MaxArgs arguments,
+ * string arguments are copied and truncated to fit in the record.
+ *
+ * @code
+ * CxxAbb::Log::Logger::Start(new CxxAbb::Log::RotatingFileSink("app.log", 16 << 20, 5));
+ * CxxAbb::Log::Info("listening on {}:{}", sHost, iPort);
+ * CxxAbb::Log::Logger::Stop();
+ * @endcode
+ *
+ * Output lines look like
+ * "2026-10-19 09:16:27.123456 INFO  [4711] listening on localhost:8080".
+ */
+class CXXABB_API Logger
+{
+public:
+	enum
+	{
+		MaxArgs = 6
+	};
+
+	/** @brief Start the writer, takes ownership of _pSink, throws IllegalStateException if started */
+	static void Start(Sink * _pSink, const LoggerOptions & _options = LoggerOptions());
+
+	/** @brief Stop the writer, write remaining records and destroy the sink */
+	static void Stop();
+
+	/** @brief Block until everything logged before the call has been written */
+	static void Flush();
+
+	/** @brief Best effort drain for a crashing process, async signal safe
+	 *
+	 * Registered with SignalToException::AddCrashHandler() by Start(). It takes no
+	 * lock and formats nothing: it wakes the writer and waits a short time for it
+	 * to write and flush the pending records. If the writer itself crashed, the
+	 * lines it had already formatted are written with write(2) to the sink's
+	 * Descriptor().
+	 */
+	static void CrashFlush(int _iSigNum);
+
+	static bool IsEnabled(Level _eLevel)
+	{
+		return static_cast<int>(_eLevel) >= Sys::AtomicLoad(&i_Level, Sys::MemoryOrderRelaxed);
+	}
+
+	/** @brief Change the threshold at run time */
+	static void SetLevel(Level _eLevel);
+
+	static const char * LevelName(Level _eLevel);
+
+	/** @brief Enqueue one record, use the Log::Info() etc. wrappers */
+	static void Write(Level _eLevel, const char * _zFormat, const Arg * _pArgs, int _iArgs);
+
+	/** @brief Records lost to full rings since Start() */
+	static UInt64 Dropped();
+
+	/** @brief Records written to the sink since Start() */
+	static UInt64 Written();
+
+private:
+	/// LevelFatal + 1 while stopped, so IsEnabled() is false for every level
+	static volatile int i_Level;
+};
+
+#define CXXABB_LOG_LEVEL_FUNCTIONS(NAME, LEVEL) \
+	inline void NAME(const char * _zFormat) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+			Logger::Write(LEVEL, _zFormat, NullPtr, 0); \
+	} \
+	template <class A1> \
+	inline void NAME(const char * _zFormat, const A1 & _a1) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+		{ \
+			const Arg args[] = { Arg(_a1) }; \
+			Logger::Write(LEVEL, _zFormat, args, 1); \
+		} \
+	} \
+	template <class A1, class A2> \
+	inline void NAME(const char * _zFormat, const A1 & _a1, const A2 & _a2) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+		{ \
+			const Arg args[] = { Arg(_a1), Arg(_a2) }; \
+			Logger::Write(LEVEL, _zFormat, args, 2); \
+		} \
+	} \
+	template <class A1, class A2, class A3> \
+	inline void NAME(const char * _zFormat, const A1 & _a1, const A2 & _a2, const A3 & _a3) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+		{ \
+			const Arg args[] = { Arg(_a1), Arg(_a2), Arg(_a3) }; \
+			Logger::Write(LEVEL, _zFormat, args, 3); \
+		} \
+	} \
+	template <class A1, class A2, class A3, class A4> \
+	inline void NAME(const char * _zFormat, const A1 & _a1, const A2 & _a2, const A3 & _a3, \
+			const A4 & _a4) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+		{ \
+			const Arg args[] = { Arg(_a1), Arg(_a2), Arg(_a3), Arg(_a4) }; \
+			Logger::Write(LEVEL, _zFormat, args, 4); \
+		} \
+	} \
+	template <class A1, class A2, class A3, class A4, class A5> \
+	inline void NAME(const char * _zFormat, const A1 & _a1, const A2 & _a2, const A3 & _a3, \
+			const A4 & _a4, const A5 & _a5) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+		{ \
+			const Arg args[] = { Arg(_a1), Arg(_a2), Arg(_a3), Arg(_a4), Arg(_a5) }; \
+			Logger::Write(LEVEL, _zFormat, args, 5); \
+		} \
+	} \
+	template <class A1, class A2, class A3, class A4, class A5, class A6> \
+	inline void NAME(const char * _zFormat, const A1 & _a1, const A2 & _a2, const A3 & _a3, \
+			const A4 & _a4, const A5 & _a5, const A6 & _a6) \
+	{ \
+		if (Logger::IsEnabled(LEVEL)) \
+		{ \
+			const Arg args[] = { Arg(_a1), Arg(_a2), Arg(_a3), Arg(_a4), Arg(_a5), Arg(_a6) }; \
+			Logger::Write(LEVEL, _zFormat, args, 6); \
+		} \
+	}
+
+CXXABB_LOG_LEVEL_FUNCTIONS(Trace, LevelTrace)
+CXXABB_LOG_LEVEL_FUNCTIONS(Debug, LevelDebug)
+CXXABB_LOG_LEVEL_FUNCTIONS(Info, LevelInfo)
+CXXABB_LOG_LEVEL_FUNCTIONS(Warning, LevelWarning)
+CXXABB_LOG_LEVEL_FUNCTIONS(Error, LevelError)
+CXXABB_LOG_LEVEL_FUNCTIONS(Fatal, LevelFatal)
+
+#undef CXXABB_LOG_LEVEL_FUNCTIONS
+
+}  /* namespace Log */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_LOG_LOGGER_H_ */
@@ -0,0 +1,139 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Sink.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Logging
+ * Comment     : Log output destinations: file and rotating file
+ *
+ */
+
+#ifndef CXXABB_LOG_SINK_H_
+#define CXXABB_LOG_SINK_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+
+#include <string>
+#include <sys/uio.h>
+
+namespace CxxAbb
+{
+
+namespace Log
+{
+
+/** @brief Destination of formatted log lines
+ *
+ * Only the logger's writer thread calls a sink, so implementations need no
+ * locking. Each iovec holds exactly one line.
+ */
+class CXXABB_API Sink : private NonCopyable
+{
+public:
+	virtual ~Sink();
+
+	/** @brief Write _iCount lines, must not throw */
+	virtual void Write(const struct iovec * _pLines, int _iCount) = 0;
+
+	/** @brief Push buffered data to the device, default does nothing */
+	virtual void Flush();
+
+	/** @brief Descriptor Logger::CrashFlush() may write(2) formatted lines to, default -1 for none */
+	virtual int Descriptor() const;
+};
+
+/** @brief Appends to a file descriptor with writev() */
+class CXXABB_API FileSink : public Sink
+{
+public:
+	/** @brief Open _sPath for appending (created if missing), throws OpenFileException */
+	explicit FileSink(const std::string & _sPath, bool _bTruncate = false);
+
+	/** @brief Write to an already open descriptor (e.g. STDERR_FILENO), not closed on destruction */
+	explicit FileSink(int _iFd);
+
+	~FileSink();
+
+	void Write(const struct iovec * _pLines, int _iCount);
+	void Flush();
+	int Descriptor() const;
+
+	/** @brief Bytes written since opened */
+	UInt64 Size() const
+	{
+		return ui_Size;
+	}
+
+	/** @brief Failed writes, the lines of a failed write are lost */
+	UInt64 Errors() const
+	{
+		return ui_Errors;
+	}
+
+protected:
+	/** @brief writev() everything, retrying partial writes */
+	void WriteAll(const struct iovec * _pLines, int _iCount);
+
+	void Open(bool _bTruncate);
+	void Close();
+
+	std::string s_Path;
+	int i_Fd;
+	bool b_Owned;
+	UInt64 ui_Size;
+	UInt64 ui_Errors;
+};
+
+/** @brief File sink that starts a new file when the current one would exceed a size
+ *
+ * The active file is always _sPath, older files are _sPath.1 (newest) to
+ * _sPath.N, the oldest is removed. Files are rotated on line boundaries.
+ */
+class CXXABB_API RotatingFileSink : public FileSink
+{
+public:
+	/** @brief throws OpenFileException
+	 *  @param _uiMaxBytes size limit of one file
+	 *  @param _iMaxFiles number of rotated files kept besides the active one
+	 */
+	RotatingFileSink(const std::string & _sPath, UInt64 _uiMaxBytes, int _iMaxFiles);
+
+	void Write(const struct iovec * _pLines, int _iCount);
+
+	/** @brief Rotations since opened */
+	UInt64 Rotations() const
+	{
+		return ui_Rotations;
+	}
+
+private:
+	void Rotate();
+
+	UInt64 ui_MaxBytes;
+	int i_MaxFiles;
+	UInt64 ui_Rotations;
+};
+
+}  /* namespace Log */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_LOG_SINK_H_ */
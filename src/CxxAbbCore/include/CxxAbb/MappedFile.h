@@ -0,0 +1,191 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * MappedFile.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Memory mapped file with Buffer views
+ *
+ */
+
+
+#ifndef CXXABB_CORE_MAPPEDFILE_H_
+#define CXXABB_CORE_MAPPEDFILE_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/NonCopyable.h>
+
+#include <string>
+
+namespace CxxAbb
+{
+
+/** @brief A file mapped into memory, read through Buffer views without copies
+ *
+ * The whole file is mapped at Open(). Pages are read in by the kernel on first
+ * touch, Advise() tells it the access pattern so it can read ahead or not.
+ * View() and FixedView() return a BufferView of a region of the mapping: nothing
+ * is copied, copies of the view refer to the mapping too, and every view is
+ * valid until the file is closed.
+ *
+ * Views of a ReadOnly mapping must not be written, the pages are write
+ * protected. Writes to a Shared ReadWrite mapping reach the file (Sync() waits
+ * for them), writes to a Private one stay in this process.
+ *
+ * @code
+ * CxxAbb::MappedFile file("/data/trades.bin");
+ * file.Advise(CxxAbb::MappedFile::AdviceSequential);
+ * CxxAbb::BufferView<char> view = file.View(0, file.Size());
+ * CxxAbb::BinaryReader reader(view.begin(), view.size());
+ * @endcode
+ */
+class CXXABB_API MappedFile : private NonCopyable
+{
+public:
+	enum Access
+	{
+		ReadOnly,
+		ReadWrite
+	};
+
+	enum Sharing
+	{
+		Shared,
+		Private   /// copy on write, changes never reach the file
+	};
+
+	enum Flags
+	{
+		Populate = 1,   /// read the whole file in at Open() instead of on first touch
+		HugePages = 2   /// place the mapping on a huge page boundary and ask for huge pages
+	};
+
+	enum Advice
+	{
+		AdviceNormal,
+		AdviceSequential,
+		AdviceRandom,
+		AdviceWillNeed,
+		AdviceDontNeed    /// drop the pages for now, writes to a Private mapping are lost
+	};
+
+	static const std::size_t HugePageSize = 2 * 1024 * 1024;
+
+	MappedFile();
+
+	/** @brief Same as Open() */
+	explicit MappedFile(const std::string & _sPath, Access _eAccess = ReadOnly, Sharing _eSharing = Shared,
+			int _iFlags = 0, std::size_t _tSize = 0);
+
+	~MappedFile();
+
+	/** @brief Maps _sPath, closing the current mapping first
+	 *
+	 * @param _iFlags Flags combination
+	 * @param _tSize 0 maps the file as it is. Otherwise ReadWrite only: the file is
+	 *        created if missing and truncated or extended to _tSize before mapping
+	 * @throws OpenFileException if the file can not be opened, FileException if it
+	 *         can not be sized or mapped, InvalidArgumentException for a ReadOnly _tSize
+	 */
+	void Open(const std::string & _sPath, Access _eAccess = ReadOnly, Sharing _eSharing = Shared,
+			int _iFlags = 0, std::size_t _tSize = 0);
+
+	/** @brief Unmaps, views become invalid. Unsynced writes of a Shared mapping still reach the file */
+	void Close();
+
+	bool IsOpen() const
+	{
+		return b_Open;
+	}
+
+	const std::string & Path() const
+	{
+		return s_Path;
+	}
+
+	/** @brief Mapped bytes, the file size at Open() */
+	std::size_t Size() const
+	{
+		return t_Size;
+	}
+
+	/** @brief Start of the mapping, NullPtr if closed or the file is empty */
+	char * Data()
+	{
+		return p_Data;
+	}
+
+	const char * Data() const
+	{
+		return p_Data;
+	}
+
+	/** @brief Access pattern hint for [_tOffset, _tOffset + _tLength), 0 length to the end
+	 *
+	 * The range is widened to whole pages. A hint, errors are ignored.
+	 */
+	void Advise(Advice _eAdvice, std::size_t _tOffset = 0, std::size_t _tLength = 0);
+
+	/** @brief Writes dirty pages of a Shared ReadWrite mapping back to the file
+	 *
+	 * @param _bWait false only schedules the write back
+	 * @throws WriteFileException
+	 */
+	void Sync(bool _bWait = true);
+
+	/** @brief View of _tLength bytes from _tOffset, throws RangeException past the end */
+	BufferView<char> View(std::size_t _tOffset, std::size_t _tLength)
+	{
+		CheckRange(_tOffset, _tLength);
+		return BufferView<char>(p_Data + _tOffset, _tLength);
+	}
+
+	/** @brief View of _tCount T from _tOffset, which must be aligned for T */
+	template <typename T>
+	BufferView<T> FixedView(std::size_t _tOffset, std::size_t _tCount)
+	{
+		if (_tCount > t_Size / sizeof(T))
+			throw RangeException("MappedFile view past the end");
+		CheckRange(_tOffset, _tCount * sizeof(T));
+		if (_tOffset % sizeof(T))
+			throw InvalidArgumentException("MappedFile view misaligned");
+		return BufferView<T>(reinterpret_cast<T*>(p_Data + _tOffset), _tCount);
+	}
+
+private:
+	void CheckRange(std::size_t _tOffset, std::size_t _tLength) const
+	{
+		if (_tOffset > t_Size || _tLength > t_Size - _tOffset)
+			throw RangeException("MappedFile view past the end");
+	}
+
+	std::string s_Path;
+	char * p_Data;
+	std::size_t t_Size;
+	Access e_Access;
+	Sharing e_Sharing;
+	bool b_Open;
+};
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_MAPPEDFILE_H_ */
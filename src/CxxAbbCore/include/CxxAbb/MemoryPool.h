@@ -31,6 +31,8 @@
 
 #include <CxxAbb/Core.h>
 #include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Result.h>
+#include <CxxAbb/Sys/CacheAligned.h>
 #include <CxxAbb/Sys/Mutex.h>
 #include <vector>
 
@@ -61,6 +63,10 @@ public:
 	 */
 	void * Get();
 
+	/** @brief Get memory block, ENOMEM instead of OutOfMemoryException when the pool is exhausted
+	 */
+	Result<void*> TryGet();
+
 	/** @brief Release a memory block and put it back to pool
 	 *  Has the same semantic as *free()*
 	 */
@@ -98,7 +104,8 @@ private:
 	std::size_t t_BlockSize;
 	int i_MaxBlocks;
 	int i_AllocatedBlocks;
-	CxxAbb::Sys::FastMutex mtx_Lock;
+	/// on its own line, pools are often placed next to the data they serve
+	CxxAbb::Sys::CachePadded<CxxAbb::Sys::FastMutex> mtx_Lock;
 
 	enum
 	{
@@ -0,0 +1,115 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Counter.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Metrics
+ * Comment     : Sharded counters and gauges
+ *
+ */
+
+#ifndef CXXABB_METRICS_COUNTER_H_
+#define CXXABB_METRICS_COUNTER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+#include <CxxAbb/Sys/StripedCounter.h>
+
+namespace CxxAbb
+{
+
+namespace Metrics
+{
+
+/** @brief Monotonic event counter
+ *
+ * Add() is one uncontended relaxed atomic add on the current CPU's cache line.
+ * Value() sums the stripes without stopping writers.
+ */
+class CXXABB_API Counter : private NonCopyable
+{
+public:
+	void Increment()
+	{
+		Add(1);
+	}
+
+	void Add(UInt64 _uiValue)
+	{
+		m_Stripes.Add(static_cast<Int64>(_uiValue));
+	}
+
+	UInt64 Value() const
+	{
+		return static_cast<UInt64>(m_Stripes.Value());
+	}
+
+	void Reset()
+	{
+		m_Stripes.Reset();
+	}
+
+private:
+	Sys::StripedCounter m_Stripes;
+};
+
+/** @brief Current value of a quantity (queue depth, pool size, ...)
+ *
+ * A single atomic on its own cache line: Set() has to win over concurrent Add()
+ * so the value cannot be sharded. Use a Counter pair for hot up/down counts.
+ */
+class CXXABB_API Gauge : private NonCopyable
+{
+public:
+	Gauge()
+		: i_Value(0)
+	{}
+
+	void Set(Int64 _iValue)
+	{
+		i_Value->Store(_iValue, Sys::MemoryOrderRelaxed);
+	}
+
+	void Add(Int64 _iValue)
+	{
+		i_Value->FetchAdd(_iValue, Sys::MemoryOrderRelaxed);
+	}
+
+	void Sub(Int64 _iValue)
+	{
+		i_Value->FetchSub(_iValue, Sys::MemoryOrderRelaxed);
+	}
+
+	Int64 Value() const
+	{
+		return i_Value->Load(Sys::MemoryOrderRelaxed);
+	}
+
+private:
+	Sys::CachePadded<Sys::Atomic<Int64> > i_Value;   /// Registry allocates gauges with new
+};
+
+}  /* namespace Metrics */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_METRICS_COUNTER_H_ */
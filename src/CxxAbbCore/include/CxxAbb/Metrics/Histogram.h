@@ -0,0 +1,198 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Histogram.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Metrics
+ * Comment     : Sharded log-linear latency histogram
+ *
+ */
+
+#ifndef CXXABB_METRICS_HISTOGRAM_H_
+#define CXXABB_METRICS_HISTOGRAM_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Timestamp.h>
+#include <CxxAbb/Metrics/Counter.h>
+
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Metrics
+{
+
+/** @brief Merged, point in time content of one or more Histograms
+ *
+ * Buckets are log-linear: values below 32 have exact buckets, above that every
+ * power of two range is split in 16 linear sub buckets (relative error < 6.25%).
+ */
+class CXXABB_API HistogramSnapshot
+{
+public:
+	enum
+	{
+		SubBucketBits = 4,
+		SubBuckets = 1 << SubBucketBits,
+		Buckets = (64 - SubBucketBits + 1) * SubBuckets
+	};
+
+	HistogramSnapshot();
+
+	static unsigned int BucketOf(UInt64 _uiValue)
+	{
+		if (_uiValue < SubBuckets)
+			return static_cast<unsigned int>(_uiValue);
+
+		unsigned int uiMsb = 63 - static_cast<unsigned int>(__builtin_clzll(_uiValue));
+		unsigned int uiShift = uiMsb - SubBucketBits;
+		return (uiShift + 1) * SubBuckets + static_cast<unsigned int>((_uiValue >> uiShift) & (SubBuckets - 1));
+	}
+
+	/** @brief Smallest value counted in _uiBucket */
+	static UInt64 BucketLow(unsigned int _uiBucket);
+
+	/** @brief Largest value counted in _uiBucket */
+	static UInt64 BucketHigh(unsigned int _uiBucket);
+
+	void Merge(const HistogramSnapshot & _other);
+
+	/** @brief Value at _dPercent in [0, 100], upper bucket bound limited by Max() */
+	UInt64 Percentile(double _dPercent) const;
+
+	double Mean() const;
+
+	UInt64 Count() const
+	{
+		return ui_Count;
+	}
+
+	UInt64 Sum() const
+	{
+		return ui_Sum;
+	}
+
+	UInt64 Max() const
+	{
+		return ui_Max;
+	}
+
+	const std::vector<UInt64> & BucketCounts() const
+	{
+		return lst_Buckets;
+	}
+
+private:
+	friend class Histogram;
+
+	std::vector<UInt64> lst_Buckets;
+	UInt64 ui_Count;
+	UInt64 ui_Sum;
+	UInt64 ui_Max;
+};
+
+/** @brief Distribution of recorded values (typically latencies)
+ *
+ * Record() touches only the shard of the current CPU: a bucket increment, a sum
+ * add and a max update that rarely writes. Shards are allocated on first use.
+ * Snapshot() merges the shards without stopping writers.
+ */
+class CXXABB_API Histogram : private NonCopyable
+{
+public:
+	Histogram();
+
+	~Histogram();
+
+	void Record(UInt64 _uiValue)
+	{
+		Shard * pShard = Sys::AtomicLoad(&p_Shards[Sys::Stripes::Current() & ui_Mask], Sys::MemoryOrderAcquire);
+		if (!pShard)
+			pShard = CreateShard();
+
+		Sys::AtomicFetchAdd(&pShard->a_Buckets[HistogramSnapshot::BucketOf(_uiValue)], static_cast<UInt64>(1),
+				Sys::MemoryOrderRelaxed);
+		Sys::AtomicFetchAdd(&pShard->ui_Sum, _uiValue, Sys::MemoryOrderRelaxed);
+
+		UInt64 uiMax = Sys::AtomicLoad(&pShard->ui_Max, Sys::MemoryOrderRelaxed);
+		while (_uiValue > uiMax && !Sys::AtomicCompareExchange(&pShard->ui_Max, uiMax, _uiValue, Sys::MemoryOrderRelaxed))
+		{
+		}
+	}
+
+	/** @brief Record microseconds elapsed since _start */
+	void RecordElapsed(const Timestamp & _start)
+	{
+		Timestamp::TimeDiff tElapsed = _start.Elapsed();
+		Record(tElapsed > 0 ? static_cast<UInt64>(tElapsed) : 0);
+	}
+
+	void Snapshot(HistogramSnapshot & _snapshot) const;
+
+	void Reset();
+
+private:
+	struct Shard
+	{
+		volatile UInt64 ui_Sum;
+		volatile UInt64 ui_Max;
+		char a_Pad[Sys::CacheLineSize - 2 * sizeof(UInt64)];
+		volatile UInt64 a_Buckets[HistogramSnapshot::Buckets];
+	};
+
+	Shard * CreateShard();
+
+	Shard * volatile * p_Shards;
+	unsigned int ui_Mask;
+};
+
+/** @brief Records the lifetime of the object in microseconds into a Histogram
+ *
+ * @code
+ * {
+ *     CxxAbb::Metrics::ScopedTimer timer(g_RequestLatency);
+ *     ...
+ * }
+ * @endcode
+ */
+class CXXABB_API ScopedTimer : private NonCopyable
+{
+public:
+	explicit ScopedTimer(Histogram & _histogram)
+		: m_Histogram(_histogram)
+	{}
+
+	~ScopedTimer()
+	{
+		m_Histogram.RecordElapsed(t_Start);
+	}
+
+private:
+	Histogram & m_Histogram;
+	Timestamp t_Start;
+};
+
+}  /* namespace Metrics */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_METRICS_HISTOGRAM_H_ */
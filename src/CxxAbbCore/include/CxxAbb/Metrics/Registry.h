@@ -0,0 +1,158 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Registry.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Metrics
+ * Comment     : Named metrics registry, snapshots and text exposition
+ *
+ */
+
+#ifndef CXXABB_METRICS_REGISTRY_H_
+#define CXXABB_METRICS_REGISTRY_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Metrics/Counter.h>
+#include <CxxAbb/Metrics/Histogram.h>
+
+#include <iosfwd>
+#include <map>
+#include <string>
+
+namespace CxxAbb
+{
+
+namespace Metrics
+{
+
+/** @brief Point in time values of a Registry
+ *
+ * Snapshots of several registries (or processes) can be merged: counters and
+ * histograms are added, gauges are summed.
+ */
+class CXXABB_API MetricsSnapshot
+{
+public:
+	enum Type
+	{
+		CounterType,
+		GaugeType,
+		HistogramType
+	};
+
+	struct Metric
+	{
+		Type e_Type;
+		std::string s_Help;
+		std::string s_Unit;
+		UInt64 ui_Counter;
+		Int64 i_Gauge;
+		HistogramSnapshot m_Histogram;
+	};
+
+	typedef std::map<std::string, Metric> MetricMap;
+
+	const MetricMap & Metrics() const
+	{
+		return lst_Metrics;
+	}
+
+	MetricMap & Metrics()
+	{
+		return lst_Metrics;
+	}
+
+	/** @brief Merge _other in, throws InvalidArgumentException on a type mismatch */
+	void Merge(const MetricsSnapshot & _other);
+
+	/** @brief Text exposition, one "name value" line per sample with # HELP / # TYPE comments
+	 *
+	 * Histograms are written as summaries: quantiles 0.5, 0.9, 0.99, 0.999, max, sum and count.
+	 */
+	void Expose(std::ostream & _os) const;
+
+private:
+	MetricMap lst_Metrics;
+};
+
+/** @brief Owner of named metrics
+ *
+ * Lookups take a lock, so look metrics up once and keep the reference; recording
+ * through the reference never locks. Metrics live as long as the registry.
+ *
+ * @code
+ * static CxxAbb::Metrics::Counter & s_Requests =
+ *     CxxAbb::Metrics::Registry::Default().GetCounter("http_requests_total", "Served requests");
+ * s_Requests.Increment();
+ * @endcode
+ */
+class CXXABB_API Registry : private NonCopyable
+{
+public:
+	Registry();
+
+	~Registry();
+
+	/** @brief Process wide registry, never destroyed so metrics stay valid during exit */
+	static Registry & Default();
+
+	/** @brief Counter named _sName, created on first use
+	 *  Throws InvalidArgumentException if the name is registered with another type
+	 */
+	Counter & GetCounter(const std::string & _sName, const std::string & _sHelp = "");
+
+	Gauge & GetGauge(const std::string & _sName, const std::string & _sHelp = "");
+
+	/** @brief Histogram named _sName, _sUnit is informational (e.g. "us") */
+	Histogram & GetHistogram(const std::string & _sName, const std::string & _sHelp = "",
+			const std::string & _sUnit = "us");
+
+	void Snapshot(MetricsSnapshot & _snapshot) const;
+
+	/** @brief Snapshot() followed by MetricsSnapshot::Expose() */
+	void Expose(std::ostream & _os) const;
+
+private:
+	struct Entry
+	{
+		MetricsSnapshot::Type e_Type;
+		std::string s_Help;
+		std::string s_Unit;
+		void * p_Metric;
+	};
+
+	typedef std::map<std::string, Entry> EntryMap;
+
+	void * Find(const std::string & _sName, MetricsSnapshot::Type _eType);
+
+	void Add(const std::string & _sName, MetricsSnapshot::Type _eType, const std::string & _sHelp,
+			const std::string & _sUnit, void * _pMetric);
+
+	EntryMap lst_Entries;
+	mutable Sys::FastMutex mtx_Entries;
+};
+
+}  /* namespace Metrics */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_METRICS_REGISTRY_H_ */
@@ -28,7 +28,7 @@
 #ifndef CXXABB_CORE_NULLTYPE_H_
 #define CXXABB_CORE_NULLTYPE_H_
 
-#include <CxxAbb/Core.h>
+#include <CxxAbb/CoreFwd.h>
 #include <typeinfo>
 
 namespace CxxAbb
@@ -0,0 +1,114 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * NumberFormat.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Locale free number to text conversion
+ *
+ */
+
+
+#ifndef CXXABB_CORE_NUMBERFORMAT_H_
+#define CXXABB_CORE_NUMBERFORMAT_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/Result.h>
+
+namespace CxxAbb
+{
+
+/** @brief Integer and double to text and back without iostreams, locale or heap
+ *
+ * FormatXxx(char *, ...) write the digits without a terminating null and return
+ * their count, the array must hold at least the matching MaxXxxChars. The
+ * Buffer<char> overloads append. ParseXxx() accept exactly what FormatXxx()
+ * writes (plus a leading '+' on decimals and any decimal double notation), the
+ * whole range must be consumed, errors are EINVAL (syntax) and ERANGE (overflow).
+ *
+ * @code
+ * char aText[CxxAbb::NumberFormat::MaxDoubleChars];
+ * std::size_t tLength = CxxAbb::NumberFormat::FormatDouble(aText, 0.1); // "0.1"
+ * CxxAbb::Result<double> d = CxxAbb::NumberFormat::ParseDouble(aText, tLength);
+ * @endcode
+ */
+class CXXABB_API NumberFormat
+{
+public:
+
+enum
+{
+	MaxUInt64Chars = 20,
+	MaxInt64Chars = 20,
+	MaxHexChars = 16,
+	MaxBinaryChars = 64,
+	MaxDoubleChars = 32
+};
+
+/// Decimal, no leading zeros
+static std::size_t FormatUInt64(char * _zOut, UInt64 _uiValue);
+static std::size_t FormatInt64(char * _zOut, Int64 _iValue);
+
+/// Hexadecimal without "0x" and leading zeros, lower case unless _bUpper
+static std::size_t FormatHex(char * _zOut, UInt64 _uiValue, bool _bUpper = false);
+
+/// Base 2 without leading zeros
+static std::size_t FormatBinary(char * _zOut, UInt64 _uiValue);
+
+/** @brief Shortest digits that read back to the same double
+ *
+ * Grisu2, which is shortest for all but a tiny fraction of doubles and always
+ * round-trips. Plain notation for 1e-6 <= |v| < 1e21 ("0.001", "1.5",
+ * "100"), exponent otherwise ("1e+21", "2.5e-7"), "nan", "inf" and "-inf".
+ */
+static std::size_t FormatDouble(char * _zOut, double _dValue);
+
+static std::size_t FormatUInt64(Buffer<char> & _buf, UInt64 _uiValue);
+static std::size_t FormatInt64(Buffer<char> & _buf, Int64 _iValue);
+static std::size_t FormatHex(Buffer<char> & _buf, UInt64 _uiValue, bool _bUpper = false);
+static std::size_t FormatBinary(Buffer<char> & _buf, UInt64 _uiValue);
+static std::size_t FormatDouble(Buffer<char> & _buf, double _dValue);
+
+static Result<UInt64> ParseUInt64(const char * _pText, std::size_t _tLength);
+static Result<Int64> ParseInt64(const char * _pText, std::size_t _tLength);
+
+/// Accepts an optional "0x" / "0X" prefix, either case
+static Result<UInt64> ParseHex(const char * _pText, std::size_t _tLength);
+
+/// Accepts an optional "0b" / "0B" prefix
+static Result<UInt64> ParseBinary(const char * _pText, std::size_t _tLength);
+
+/** @brief Correctly rounded, also "nan", "inf" and "infinity" in any case
+ *
+ * Up to 19 significant digits with a small exponent are converted exactly in
+ * place, anything else goes to strtod, '.' is the decimal point whatever
+ * LC_NUMERIC says. Decimal notation only: hexadecimal floats ("0x1p3") are
+ * EINVAL. Overflow is ERANGE, underflow is not an error: a value below the
+ * smallest denormal reads as a zero of its sign and a denormal as itself, where
+ * strtod would also set ERANGE.
+ */
+static Result<double> ParseDouble(const char * _pText, std::size_t _tLength);
+
+};
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_NUMBERFORMAT_H_ */
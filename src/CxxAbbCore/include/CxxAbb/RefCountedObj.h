@@ -31,6 +31,7 @@
 #include <CxxAbb/Core.h>
 #include <CxxAbb/NonCopyable.h>
 #include <CxxAbb/Sys/Atomicity.h>
+#include <CxxAbb/Sys/AtomicOps.h>
 
 namespace CxxAbb
 {
@@ -95,7 +96,7 @@ class AtomicRefCounted : private NonCopyable
 {
 public:
 	AtomicRefCounted()
-	: m_AtomicCounter()
+	: m_AtomicCounter(1)
 	{ }
 
 	explicit AtomicRefCounted(unsigned int _uiRefs)
@@ -124,6 +125,105 @@ private:
 	mutable CxxAbb::Sys::AtomicCounter m_AtomicCounter;
 };
 
+/** @brief Counting policy of IntrusiveRefCounted for objects used by one thread
+ */
+class PlainRefCount
+{
+public:
+	explicit PlainRefCount(unsigned int _uiRefs)
+	: ui_Count(_uiRefs)
+	{ }
+
+	unsigned int Add()
+	{ return ++ui_Count; }
+
+	/// @return count after the decrement
+	unsigned int Remove()
+	{ return --ui_Count; }
+
+	unsigned int Count() const
+	{ return ui_Count; }
+
+private:
+	unsigned int ui_Count;
+};
+
+/** @brief Counting policy of IntrusiveRefCounted for objects shared between threads
+ *
+ * Increments are relaxed, a new reference is always made from an existing one.
+ * The decrement is acquire-release so the deleting thread sees all writes
+ * done through other references.
+ */
+class AtomicRefCount
+{
+public:
+	explicit AtomicRefCount(unsigned int _uiRefs)
+	: ui_Count(_uiRefs)
+	{ }
+
+	unsigned int Add()
+	{ return CxxAbb::Sys::AtomicFetchAdd(&ui_Count, 1U, CxxAbb::Sys::MemoryOrderRelaxed) + 1; }
+
+	/// @return count after the decrement
+	unsigned int Remove()
+	{ return CxxAbb::Sys::AtomicFetchSub(&ui_Count, 1U, CxxAbb::Sys::MemoryOrderAcqRel) - 1; }
+
+	unsigned int Count() const
+	{ return CxxAbb::Sys::AtomicLoad(&ui_Count, CxxAbb::Sys::MemoryOrderRelaxed); }
+
+private:
+	volatile unsigned int ui_Count;
+};
+
+/** @brief Reference counting base without virtual functions (CRTP)
+ *
+ * Same contract as RefCounted (initial count one, deleted at zero), but
+ * refAdd() / refRem() are resolved at compile time and inline into
+ * AutoPtr and IntrusivePtr. The object carries no vtable unless Derived
+ * declares one. CountPolicy is PlainRefCount or AtomicRefCount.
+ *
+ * @code
+ * class Order : public CxxAbb::IntrusiveRefCounted<Order, CxxAbb::AtomicRefCount>
+ * { ... };
+ * CxxAbb::IntrusivePtr<Order> ptrOrder(new Order);
+ * @endcode
+ *
+ * Objects are deleted as Derived; a Derived that is itself derived from
+ * and released through a base pointer needs a virtual destructor.
+ */
+template <class Derived, class CountPolicy = AtomicRefCount>
+class IntrusiveRefCounted : private NonCopyable
+{
+public:
+	unsigned int refAdd() const
+	{ return m_Count.Add(); }
+
+	void refRem() const
+	{
+		if (m_Count.Remove() == 0)
+			delete static_cast<const Derived*>(this);
+	}
+
+	unsigned int refCount() const
+	{ return m_Count.Count(); }
+
+protected:
+	IntrusiveRefCounted()
+	: m_Count(1)
+	{ }
+
+	explicit IntrusiveRefCounted(unsigned int _uiRefs)
+	: m_Count(_uiRefs)
+	{ }
+
+	/// not virtual, never deleted through this type
+	~IntrusiveRefCounted()
+	{ }
+
+private:
+	mutable CountPolicy m_Count;
+};
+
 } /* namespace CxxAbb */
 
 
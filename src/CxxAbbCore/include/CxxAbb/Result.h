@@ -0,0 +1,221 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Result.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Value or error code without exceptions
+ *
+ */
+
+
+#ifndef CXXABB_CORE_RESULT_H_
+#define CXXABB_CORE_RESULT_H_
+
+
+#include <CxxAbb/Core.h>
+#include <new>
+
+namespace CxxAbb
+{
+
+/** @brief Error half of a Result, created with Fail()
+ */
+template <typename E>
+class Failure
+{
+public:
+	explicit Failure(const E & _error) : m_Error(_error)
+	{}
+
+	const E & Error() const
+	{
+		return m_Error;
+	}
+
+private:
+	E m_Error;
+};
+
+template <typename E>
+inline Failure<E> Fail(const E & _error)
+{
+	return Failure<E>(_error);
+}
+
+/** @brief Either a value or an error, for failure paths too frequent for exceptions
+ *
+ * T is constructed only on success and need not be default constructible, nothing
+ * is allocated. Library TryXxx() functions use errno values as E (e.g. ENOENT, ENOMEM).
+ *
+ * @code
+ * CxxAbb::Result<void*> block = pool.TryGet();
+ * if (!block.IsOk())
+ *     return block.Error();
+ * Use(block.Value());
+ * ...
+ * return CxxAbb::Fail(ETIMEDOUT);
+ * @endcode
+ */
+template <typename T, typename E = int>
+class CXXABB_API Result
+{
+public:
+	Result(const T & _value) : m_Error(), b_Ok(true)
+	{
+		new (m_Storage.z_Data) T(_value);
+	}
+
+	Result(const Failure<E> & _failure) : m_Error(_failure.Error()), b_Ok(false)
+	{}
+
+	Result(const Result & _rhs) : m_Error(_rhs.m_Error), b_Ok(_rhs.b_Ok)
+	{
+		if (b_Ok)
+			new (m_Storage.z_Data) T(*_rhs.Pointer());
+	}
+
+	~Result()
+	{
+		if (b_Ok)
+			Pointer()->~T();
+	}
+
+	Result& operator = (const Result & _rhs)
+	{
+		if (this != &_rhs)
+		{
+			if (b_Ok && _rhs.b_Ok)
+				*Pointer() = *_rhs.Pointer();
+			else
+			{
+				if (b_Ok)
+					Pointer()->~T();
+				b_Ok = false;
+				if (_rhs.b_Ok)
+				{
+					new (m_Storage.z_Data) T(*_rhs.Pointer());
+					b_Ok = true;
+				}
+			}
+			m_Error = _rhs.m_Error;
+		}
+		return *this;
+	}
+
+	bool IsOk() const
+	{
+		return b_Ok;
+	}
+
+	bool IsError() const
+	{
+		return !b_Ok;
+	}
+
+	/** @brief The value, throws NullValueException on error (check IsOk() first)
+	 */
+	const T & Value() const
+	{
+		if (!b_Ok)
+			throw CxxAbb::NullValueException("Result holds an error");
+		return *Pointer();
+	}
+
+	T & Value()
+	{
+		if (!b_Ok)
+			throw CxxAbb::NullValueException("Result holds an error");
+		return *Pointer();
+	}
+
+	const T & Value(const T & _def) const
+	{
+		return b_Ok ? *Pointer() : _def;
+	}
+
+	/** @brief The error, a default constructed E on success
+	 */
+	const E & Error() const
+	{
+		return m_Error;
+	}
+
+private:
+	T * Pointer()
+	{
+		return reinterpret_cast<T*>(m_Storage.z_Data);
+	}
+
+	const T * Pointer() const
+	{
+		return reinterpret_cast<const T*>(m_Storage.z_Data);
+	}
+
+	/// Uninitialized storage, T need not be default constructible
+	union Storage
+	{
+		char z_Data[sizeof(T)];
+		long double d_Align;
+		void * p_Align;
+		CxxAbb::Int64 i_Align;
+	};
+
+	Storage m_Storage;
+	E m_Error;
+	bool b_Ok;
+};
+
+/** @brief Success without a value, or an error
+ */
+template <typename E>
+class CXXABB_API Result<void, E>
+{
+public:
+	Result() : m_Error(), b_Ok(true)
+	{}
+
+	Result(const Failure<E> & _failure) : m_Error(_failure.Error()), b_Ok(false)
+	{}
+
+	bool IsOk() const
+	{
+		return b_Ok;
+	}
+
+	bool IsError() const
+	{
+		return !b_Ok;
+	}
+
+	const E & Error() const
+	{
+		return m_Error;
+	}
+
+private:
+	E m_Error;
+	bool b_Ok;
+};
+
+}  /* namespace CxxAbb */
+
+
+#endif /* CXXABB_CORE_RESULT_H_ */
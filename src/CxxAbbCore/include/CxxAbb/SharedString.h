@@ -0,0 +1,230 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SharedString.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Immutable reference counted string
+ *
+ */
+
+
+#ifndef CXXABB_CORE_SHAREDSTRING_H_
+#define CXXABB_CORE_SHAREDSTRING_H_
+
+// not Core.h: it includes this header through Exception.h
+#include <CxxAbb/CoreFwd.h>
+#include <CxxAbb/Types.h>
+
+#include <cstring>
+#include <iosfwd>
+#include <string>
+
+namespace CxxAbb
+{
+
+/** @brief Immutable string, copies share one buffer
+ *
+ * Up to MaxInline characters live in the 16 byte object itself, copying those is
+ * a 16 byte copy. Longer strings take one allocation holding an atomic reference
+ * count next to the characters, a copy only increments the count, so copies may
+ * be taken and dropped by any thread. Always null terminated.
+ *
+ * The interface follows the read only part of std::string so it can replace
+ * one in names, messages and identifiers that are set once and copied around.
+ */
+class CXXABB_API SharedString
+{
+public:
+	static const std::size_t MaxInline = 15;
+
+	SharedString()
+	{
+		std::memset(u_Data.a_Inline, 0, sizeof(u_Data.a_Inline));
+		u_Data.a_Inline[MaxInline] = static_cast<char>(MaxInline);
+	}
+
+	SharedString(const char * _zValue)
+	{
+		Init(_zValue, std::strlen(_zValue));
+	}
+
+	SharedString(const char * _pData, std::size_t _tSize)
+	{
+		Init(_pData, _tSize);
+	}
+
+	SharedString(const std::string & _sValue)
+	{
+		Init(_sValue.data(), _sValue.size());
+	}
+
+	SharedString(const SharedString & _rhs)
+		: u_Data(_rhs.u_Data)
+	{
+		if (!IsInline())
+			AddRef();
+	}
+
+	~SharedString()
+	{
+		if (!IsInline())
+			Release();
+	}
+
+	SharedString & operator = (const SharedString & _rhs)
+	{
+		SharedString tmp(_rhs);
+		swap(tmp);
+		return *this;
+	}
+
+	void swap(SharedString & _rhs)
+	{
+		Data tmp = u_Data;
+		u_Data = _rhs.u_Data;
+		_rhs.u_Data = tmp;
+	}
+
+	const char * c_str() const
+	{
+		return IsInline() ? u_Data.a_Inline : u_Data.p_Rep->a_Chars;
+	}
+
+	const char * data() const
+	{
+		return c_str();
+	}
+
+	std::size_t size() const
+	{
+		return IsInline() ? MaxInline - static_cast<unsigned char>(u_Data.a_Inline[MaxInline]) : u_Data.p_Rep->t_Size;
+	}
+
+	std::size_t length() const
+	{
+		return size();
+	}
+
+	bool empty() const
+	{
+		return size() == 0;
+	}
+
+	std::string str() const
+	{
+		return std::string(data(), size());
+	}
+
+	/** @brief Copy, lets code written against std::string names and messages keep compiling */
+	operator std::string() const
+	{
+		return str();
+	}
+
+	/** @brief True if the characters are held in the object, no buffer is shared */
+	bool IsInline() const
+	{
+		return u_Data.a_Inline[MaxInline] != HeapTag;
+	}
+
+	/** @brief <0, 0, >0 like std::string::compare */
+	int compare(const char * _pData, std::size_t _tSize) const;
+
+	int compare(const SharedString & _rhs) const
+	{
+		return compare(_rhs.data(), _rhs.size());
+	}
+
+	bool Equals(const char * _pData, std::size_t _tSize) const
+	{
+		return size() == _tSize && std::memcmp(data(), _pData, _tSize) == 0;
+	}
+
+	bool operator == (const SharedString & _rhs) const
+	{
+		if (!IsInline() && u_Data.p_Rep == _rhs.u_Data.p_Rep)
+			return true;
+		return Equals(_rhs.data(), _rhs.size());
+	}
+
+	bool operator == (const std::string & _rhs) const
+	{
+		return Equals(_rhs.data(), _rhs.size());
+	}
+
+	bool operator == (const char * _rhs) const
+	{
+		return Equals(_rhs, std::strlen(_rhs));
+	}
+
+	template <typename T>
+	bool operator != (const T & _rhs) const
+	{
+		return !(*this == _rhs);
+	}
+
+	bool operator < (const SharedString & _rhs) const
+	{
+		return compare(_rhs) < 0;
+	}
+
+private:
+	static const char HeapTag = static_cast<char>(0xFF);
+
+	struct Rep
+	{
+		volatile UInt32 ui_RefCount;
+		std::size_t t_Size;
+		char a_Chars[1];
+	};
+
+	/// a_Inline[MaxInline] holds MaxInline - size, which doubles as the terminator
+	/// of a full inline string, or HeapTag when p_Rep is used
+	union Data
+	{
+		Rep * p_Rep;
+		char a_Inline[MaxInline + 1];
+	};
+
+	void Init(const char * _pData, std::size_t _tSize);
+
+	void AddRef();
+
+	void Release();
+
+	Data u_Data;
+};
+
+inline bool operator == (const std::string & _lhs, const SharedString & _rhs)
+{
+	return _rhs == _lhs;
+}
+
+inline bool operator == (const char * _lhs, const SharedString & _rhs)
+{
+	return _rhs == _lhs;
+}
+
+CXXABB_API std::ostream & operator << (std::ostream & _os, const SharedString & _value);
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_SHAREDSTRING_H_ */
@@ -29,6 +29,11 @@
 #define CXXABB_DP_SINGLETON_H_
 
 #include "CxxAbb/NonCopyable.h"
+#include "CxxAbb/NullType.h"
+#include "CxxAbb/Sys/AtomicOps.h"
+#include "CxxAbb/Sys/CallOnce.h"
+
+#include <cstddef>
 
 
 namespace CxxAbb
@@ -36,7 +41,55 @@ namespace CxxAbb
 namespace Dp
 {
 
+/** @brief Ordered destruction of Singleton instances at exit
+ *
+ * Every Singleton registers itself once its constructor has finished. A singleton
+ * that uses another one in its constructor therefore registers after it, and
+ * DestroyAll() destroys in reverse registration order: dependants first.
+ * DestroyAll() is installed with atexit() on the first registration and may
+ * also be called explicitly for a controlled shutdown.
+ */
+class CXXABB_API SingletonRegistry
+{
+public:
+	typedef void (*Destroyer)();
+
+	/** @brief Registration record, owned by the registered Singleton (static storage) */
+	struct Entry
+	{
+		Destroyer fp_Destroy;
+		Entry * p_Next;
+	};
+
+	static void Register(Entry & _entry);
+
+	/** @brief Destroy registered instances, last registered first
+	 *
+	 * Instances created while destroying (a destructor using another singleton)
+	 * are destroyed too, before returning.
+	 */
+	static void DestroyAll();
+
+	/** @brief Number of live registered instances */
+	static std::size_t Count();
+
+private:
+	static void InstallAtExit();
+	static void Lock();
+	static void Unlock();
+
+	static Entry * p_Head;
+	static volatile int i_Lock;
+	static Sys::OnceFlag s_AtExit;
+};
+
 /** @brief Singleton design pattern helper
+ *
+ * Instance is created on first use. Once created Instance() costs a single acquire
+ * load; concurrent first calls construct exactly one instance (CallOnce).
+ * Instances are destroyed by SingletonRegistry in reverse dependency order at exit.
+ * Calling Instance() after destruction creates a new instance which is registered
+ * again (destroyed by a later DestroyAll(), leaked if exit handlers already ran).
  *
  * Use:
  * @code
@@ -59,36 +112,51 @@ public:
 
 	static SC* Instance()
 	{
-		//TODO: use a lock here
-		if(!p_Instance)
-		{
-			p_Instance = new SC;
-		}
-		return p_Instance;
-	}
+		SC * p = Sys::AtomicLoad(&p_Instance, Sys::MemoryOrderAcquire);
+		if (p)
+			return p;
 
-//	static SC & Instance()
-//	{
-//		static SC mInstance;
-//		return mInstance;
-//	}
+		Sys::CallOnce(s_Once, &Singleton::Create);
+		return Sys::AtomicLoad(&p_Instance, Sys::MemoryOrderAcquire);
+	}
 
 protected:
 	Singleton()
 	{}
 
 	virtual ~Singleton()
+	{}
+
+private:
+	static void Create()
 	{
-		if(p_Instance)
-			delete p_Instance;
+		SC * p = new SC;
+		s_Entry.fp_Destroy = &Singleton::Destroy;
+		SingletonRegistry::Register(s_Entry);
+		Sys::AtomicStore(&p_Instance, p, Sys::MemoryOrderRelease);
 	}
 
-private:
-	static SC* p_Instance;
+	static void Destroy()
+	{
+		SC * p = Sys::AtomicExchange(&p_Instance, static_cast<SC*>(NullPtr), Sys::MemoryOrderAcqRel);
+		Sys::AtomicStore(&s_Once.i_State, static_cast<int>(Sys::OnceFlag::Idle), Sys::MemoryOrderRelease);
+		delete p;
+	}
+
+	static SC * volatile p_Instance;
+	static Sys::OnceFlag s_Once;
+	static SingletonRegistry::Entry s_Entry;
 };
 
+// constant initializers (0, not NullPtr) so the statics are set before any dynamic initialization
+template <class SC>
+SC * volatile Singleton<SC>::p_Instance = 0;
+
+template <class SC>
+Sys::OnceFlag Singleton<SC>::s_Once = CXXABB_ONCE_INIT;
+
 template <class SC>
-SC* Singleton<SC>::p_Instance = NULL;
+SingletonRegistry::Entry Singleton<SC>::s_Entry = { 0, 0 };
 
 } /* namespace Dp */
 } /* namespace CxxAbb */
@@ -31,6 +31,7 @@
 #include <CxxAbb/Core.h>
 #include <CxxAbb/Debug.h>
 #include <CxxAbb/Exception.h>
+#include <CxxAbb/Sys/AtomicOps.h>
 
 #include <memory>
 
@@ -117,6 +118,48 @@ private:
 	unsigned int ui_RefCount;
 };
 
+/** @brief ExternalRefCounter whose count may be linked and unlinked by many threads
+ *
+ * Opt in for SmartPtr copies that are taken and dropped on different threads,
+ * like values handed out by shared containers. Each link and unlink is a locked
+ * read modify write, so keep ExternalRefCounter for single thread ownership.
+ * A single SmartPtr object is still not safe to assign while others read it.
+ */
+template<class Obj, class DestroyPolicy>
+class AtomicExternalRefCounter
+{
+public:
+	AtomicExternalRefCounter()
+		: ui_RefCount(1)
+	{}
+
+	void link()
+	{
+		Sys::AtomicFetchAdd(&ui_RefCount, 1U, Sys::MemoryOrderRelaxed);
+	}
+
+	bool unlink(Obj * &_ptr)
+	{
+		if (Sys::AtomicFetchSub(&ui_RefCount, 1U, Sys::MemoryOrderAcqRel) == 1)
+		{
+			DestroyPolicy::destroy(_ptr);
+			return true;
+		}
+		return false;
+	}
+
+	unsigned int count() const
+	{
+		return Sys::AtomicLoad(&ui_RefCount, Sys::MemoryOrderRelaxed);
+	}
+
+private:
+	AtomicExternalRefCounter(const AtomicExternalRefCounter &);
+	AtomicExternalRefCounter& operator = (AtomicExternalRefCounter &);
+
+	unsigned int ui_RefCount;
+};
+
 template <class Obj>
 class ExternalRefCountedDeleter
 {
@@ -501,6 +544,170 @@ private:
 	StoredType p_Obj;
 };
 
+/** @brief Intrusive reference counted pointer for IntrusiveRefCounted objects
+ *
+ * Same ownership rules as AutoPtr: the constructor and assign() take over
+ * the initial reference, pass _shared = true to add one instead. Count
+ * operations are called on the static type, with IntrusiveRefCounted they
+ * are inlined. Pointers convert implicitly to pointers of base classes.
+ * Dereferencing a null pointer is an ASSERT, not an exception.
+ */
+template <class Obj>
+class IntrusivePtr
+{
+public:
+	IntrusivePtr() : p_Obj(NullPtr)
+	{
+	}
+
+	explicit IntrusivePtr(Obj* _obj) : p_Obj(_obj)
+	{
+	}
+
+	IntrusivePtr(Obj* _obj, bool _shared) : p_Obj(_obj)
+	{
+		if (_shared && p_Obj) p_Obj->refAdd();
+	}
+
+	IntrusivePtr(const IntrusivePtr& _ptr) : p_Obj(_ptr.p_Obj)
+	{
+		if (p_Obj) p_Obj->refAdd();
+	}
+
+	template <class Other>
+	IntrusivePtr(const IntrusivePtr<Other>& _ptr) : p_Obj(_ptr.get())
+	{
+		if (p_Obj) p_Obj->refAdd();
+	}
+
+	~IntrusivePtr()
+	{
+		if (p_Obj) p_Obj->refRem();
+	}
+
+	/// Assign new raw pointer and take sole ownership
+	IntrusivePtr& assign(Obj* _obj)
+	{
+		IntrusivePtr(_obj).swap(*this);
+		return *this;
+	}
+
+	IntrusivePtr& assign(Obj* _obj, bool _shared)
+	{
+		IntrusivePtr(_obj, _shared).swap(*this);
+		return *this;
+	}
+
+	IntrusivePtr& operator = (const IntrusivePtr& _ptr)
+	{
+		IntrusivePtr(_ptr).swap(*this);
+		return *this;
+	}
+
+	template <class Other>
+	IntrusivePtr& operator = (const IntrusivePtr<Other>& _ptr)
+	{
+		IntrusivePtr(_ptr).swap(*this);
+		return *this;
+	}
+
+	void reset(Obj* _pObj = NullPtr)
+	{
+		IntrusivePtr(_pObj).swap(*this);
+	}
+
+	bool isNull() const
+	{
+		return p_Obj == NullPtr;
+	}
+
+	/// Raw pointer with one more reference, for the caller to release
+	Obj* duplicate() const
+	{
+		if (p_Obj) p_Obj->refAdd();
+		return p_Obj;
+	}
+
+	/// Give up ownership without releasing the reference
+	Obj* detach()
+	{
+		Obj* pObj = p_Obj;
+		p_Obj = NullPtr;
+		return pObj;
+	}
+
+	Obj* get() const
+	{
+		return p_Obj;
+	}
+
+	Obj* operator -> () const
+	{
+		ASSERT(p_Obj);
+		return p_Obj;
+	}
+
+	Obj& operator * () const
+	{
+		ASSERT(p_Obj);
+		return *p_Obj;
+	}
+
+	bool operator ! () const
+	{
+		return p_Obj == NullPtr;
+	}
+
+	bool operator == (const IntrusivePtr& _ptr) const
+	{
+		return p_Obj == _ptr.p_Obj;
+	}
+
+	bool operator == (const Obj* _ptr) const
+	{
+		return p_Obj == _ptr;
+	}
+
+	bool operator != (const IntrusivePtr& _ptr) const
+	{
+		return p_Obj != _ptr.p_Obj;
+	}
+
+	bool operator != (const Obj* _ptr) const
+	{
+		return p_Obj != _ptr;
+	}
+
+	bool operator < (const IntrusivePtr& _ptr) const
+	{
+		return p_Obj < _ptr.p_Obj;
+	}
+
+	void swap(IntrusivePtr& _ptr)
+	{
+		std::swap(p_Obj, _ptr.p_Obj);
+	}
+
+	/// Cast via dynamic_cast between class hierarchy
+	template <class Other>
+	IntrusivePtr<Other> cast() const
+	{
+		Other* pOther = dynamic_cast<Other*>(p_Obj);
+		return IntrusivePtr<Other>(pOther, true);
+	}
+
+	/// Cast via static_cast between class hierarchy
+	template <class Other>
+	IntrusivePtr<Other> unsafeCast() const
+	{
+		Other* pOther = static_cast<Other*>(p_Obj);
+		return IntrusivePtr<Other>(pOther, true);
+	}
+
+private:
+	Obj* p_Obj;
+};
+
 /** @brief Smart pointer with life time limited to defined scope
  * Strict Ownership - Should be only one owner for pointee
  * NonCopyable - Pointer cannot assign or copy (no assignment op).
@@ -1666,6 +1873,12 @@ inline void swap(AutoPtr<Obj>& _p1, AutoPtr<Obj>& _p2)
 	_p1.swap(_p2);
 }
 
+template <class Obj>
+inline void swap(IntrusivePtr<Obj>& _p1, IntrusivePtr<Obj>& _p2)
+{
+	_p1.swap(_p2);
+}
+
 template <class Obj>
 inline void swap(ScopedPtr<Obj>& _p1, ScopedPtr<Obj>& _p2)
 {
@@ -31,6 +31,9 @@
 
 #include <CxxAbb/Core.h>
 #include <CxxAbb/Platform.h>
+#include <CxxAbb/Buffer.h>
+
+#include <cstring>
 
 namespace CxxAbb
 {
@@ -108,10 +111,90 @@ inline UInt64 Swab(UInt64 _value)
 
 #endif
 
+/// Bulk swaps of _tCount elements, in place or from _pSrc to _pDst (which may be
+/// the same array but must not partially overlap). Run on the fastest kernel this
+/// CPU has, see ByteOrder::SetKernel()
+
+CXXABB_API void SwabArray(const UInt16 * _pSrc, UInt16 * _pDst, std::size_t _tCount);
+CXXABB_API void SwabArray(const UInt32 * _pSrc, UInt32 * _pDst, std::size_t _tCount);
+CXXABB_API void SwabArray(const UInt64 * _pSrc, UInt64 * _pDst, std::size_t _tCount);
+
+inline void SwabArray(const Int16 * _pSrc, Int16 * _pDst, std::size_t _tCount)
+{
+	SwabArray(reinterpret_cast<const UInt16 *>(_pSrc), reinterpret_cast<UInt16 *>(_pDst), _tCount);
+}
+
+inline void SwabArray(const Int32 * _pSrc, Int32 * _pDst, std::size_t _tCount)
+{
+	SwabArray(reinterpret_cast<const UInt32 *>(_pSrc), reinterpret_cast<UInt32 *>(_pDst), _tCount);
+}
+
+inline void SwabArray(const Int64 * _pSrc, Int64 * _pDst, std::size_t _tCount)
+{
+	SwabArray(reinterpret_cast<const UInt64 *>(_pSrc), reinterpret_cast<UInt64 *>(_pDst), _tCount);
+}
+
+inline void SwabArray(const Int8 * _pSrc, Int8 * _pDst, std::size_t _tCount)
+{
+	if (_pSrc != _pDst)
+		std::memmove(_pDst, _pSrc, _tCount);
+}
+
+inline void SwabArray(const UInt8 * _pSrc, UInt8 * _pDst, std::size_t _tCount)
+{
+	if (_pSrc != _pDst)
+		std::memmove(_pDst, _pSrc, _tCount);
+}
+
+template <typename T>
+inline void SwabArray(T * _pData, std::size_t _tCount)
+{
+	SwabArray(static_cast<const T *>(_pData), _pData, _tCount);
+}
+
+/// Swaps the used part of _buffer
+template <typename T>
+inline void SwabArray(Buffer<T> & _buffer)
+{
+	SwabArray(_buffer.begin(), _buffer.size());
+}
+
 class CXXABB_API ByteOrder
 {
 public:
 
+/// Byte order of serialized data, see BinaryWriter and BinaryReader
+enum Order
+{
+	OrderBigEndian = 0,
+	OrderLittleEndian,
+	OrderNetwork = OrderBigEndian,
+#ifdef CXXABB_ARCH_LITTLE_ENDIAN
+	OrderHost = OrderLittleEndian
+#else
+	OrderHost = OrderBigEndian
+#endif
+};
+
+/// Bulk swap kernels, Auto picks the best one the CPU supports
+enum Kernel
+{
+	KernelAuto = 0,
+	KernelScalar,
+	KernelSsse3,
+	KernelAvx2
+};
+
+/// Use _eKernel for SwabArray(), false (and no change) if this CPU lacks it
+static bool SetKernel(Kernel _eKernel);
+
+/// Kernel SwabArray() currently runs, never KernelAuto
+static Kernel ActiveKernel();
+
+static bool KernelSupported(Kernel _eKernel);
+
+static const char * KernelName(Kernel _eKernel);
+
 /// Runtime endianess check
 
 static inline bool BigEndian()
@@ -189,6 +272,49 @@ static inline T NetworkToHost(T _value)
 #endif
 }
 
+/// Bulk conversions between Host and Network Byte Order, in place or copying
+
+template <typename T>
+static inline void HostToNetwork(const T * _pSrc, T * _pDst, std::size_t _tCount)
+{
+#ifdef CXXABB_ARCH_LITTLE_ENDIAN
+	SwabArray(_pSrc, _pDst, _tCount);
+#else
+	if (_pSrc != _pDst)
+		std::memmove(_pDst, _pSrc, _tCount * sizeof(T));
+#endif
+}
+
+template <typename T>
+static inline void NetworkToHost(const T * _pSrc, T * _pDst, std::size_t _tCount)
+{
+	HostToNetwork(_pSrc, _pDst, _tCount); // same permutation both ways
+}
+
+template <typename T>
+static inline void HostToNetwork(T * _pData, std::size_t _tCount)
+{
+	HostToNetwork(static_cast<const T *>(_pData), _pData, _tCount);
+}
+
+template <typename T>
+static inline void NetworkToHost(T * _pData, std::size_t _tCount)
+{
+	HostToNetwork(static_cast<const T *>(_pData), _pData, _tCount);
+}
+
+template <typename T>
+static inline void HostToNetwork(Buffer<T> & _buffer)
+{
+	HostToNetwork(_buffer.begin(), _buffer.size());
+}
+
+template <typename T>
+static inline void NetworkToHost(Buffer<T> & _buffer)
+{
+	HostToNetwork(_buffer.begin(), _buffer.size());
+}
+
 };
 
 } /* namespace CxxAbb */
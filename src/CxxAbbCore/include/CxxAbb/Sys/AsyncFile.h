@@ -0,0 +1,261 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * AsyncFile.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Sys
+ * Comment     : Asynchronous file I/O on io_uring with a worker pool fallback
+ *
+ */
+
+
+#ifndef CXXABB_CORE_ASYNCFILE_H_
+#define CXXABB_CORE_ASYNCFILE_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/Future.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/WaitCondition.h>
+
+#include <string>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+class ThreadPool;
+
+namespace Dp
+{
+class AsyncFileOp;
+class AsyncRing;
+}
+
+/** @brief File read and written at explicit offsets without blocking the caller
+ *
+ * Reads, writes and syncs are queued to the kernel through io_uring where it is
+ * available, a batch of them with a single system call. A completion thread
+ * reaps the results and resolves the returned futures or calls the given
+ * callbacks. Where io_uring is missing or not permitted a small pool of worker
+ * threads runs plain pread/pwrite/fsync instead, behind the same interface.
+ *
+ * At most QueueDepth() operations are in flight, submitting more blocks until
+ * earlier ones complete. Buffers must stay alive and untouched until their
+ * operation completes. Operations are not ordered against each other: Fsync()
+ * covers the writes completed before it is submitted, not the ones still queued.
+ *
+ * Callbacks run on the completion thread (or a pool worker) and should be short.
+ * They, and Future continuations run inline by them, may submit to the same file
+ * only while the queue has room: waiting there for a slot would wait on the very
+ * thread that frees it, so such a submission throws IllegalStateException instead.
+ *
+ * Failures of single operations, including the io_uring ring breaking down, are
+ * reported through their futures or callbacks; once submitted every operation
+ * completes exactly once.
+ *
+ * @code
+ * CxxAbb::Sys::AsyncFile file("/data/blocks.bin");
+ * CxxAbb::Sys::AsyncFile::Batch batch;
+ * CxxAbb::Sys::Future<std::size_t> first = batch.Read(0, bufA);
+ * CxxAbb::Sys::Future<std::size_t> second = batch.Read(65536, bufB);
+ * file.Submit(batch);
+ * std::size_t tRead = first.Get() + second.Get();
+ * @endcode
+ */
+class CXXABB_API AsyncFile : private NonCopyable
+{
+public:
+	enum Access
+	{
+		ReadOnly,
+		WriteOnly,
+		ReadWrite
+	};
+
+	enum Flags
+	{
+		Create = 1,
+		Truncate = 2,
+		Direct = 4     /// bypass the page cache, buffers, offsets and lengths must be block aligned
+	};
+
+	enum Backend
+	{
+		BackendAuto,         /// io_uring if the kernel allows it, else the thread pool
+		BackendUring,
+		BackendThreadPool
+	};
+
+	static const unsigned int DefaultQueueDepth = 64;
+
+	/** @brief Completion callback
+	 *  @param _lResult bytes transferred (0 for a sync), or -errno on failure
+	 *  @param _pData as given with the operation
+	 */
+	typedef void (*Callback)(long _lResult, void * _pData);
+
+	/** @brief Operations collected to be submitted together by Submit()
+	 *
+	 * A Batch is not bound to a file until submitted, and can be reused after.
+	 */
+	class CXXABB_API Batch : private NonCopyable
+	{
+	public:
+		Batch()
+		{}
+
+		/** @brief Drops operations that were never submitted, their futures are broken */
+		~Batch();
+
+		/** @brief Reads up to _buf.capacity() bytes at _tOffset, the buffer size is set to the count read */
+		Future<std::size_t> Read(std::size_t _tOffset, Buffer<char> & _buf);
+		void Read(std::size_t _tOffset, Buffer<char> & _buf, Callback _callback, void * _pData = NullPtr);
+
+		/** @brief Writes _buf.size() bytes at _tOffset */
+		Future<std::size_t> Write(std::size_t _tOffset, const Buffer<char> & _buf);
+		void Write(std::size_t _tOffset, const Buffer<char> & _buf, Callback _callback, void * _pData = NullPtr);
+
+		/** @brief Flushes completed writes to the device, _bDataOnly skips metadata not needed to read them back */
+		Future<std::size_t> Fsync(bool _bDataOnly = false);
+		void Fsync(bool _bDataOnly, Callback _callback, void * _pData = NullPtr);
+
+		std::size_t Size() const
+		{
+			return lst_Ops.size();
+		}
+
+		bool Empty() const
+		{
+			return lst_Ops.empty();
+		}
+
+	private:
+		friend class AsyncFile;
+
+		Future<std::size_t> Add(Dp::AsyncFileOp * _pOp);
+
+		std::vector<Dp::AsyncFileOp*> lst_Ops;
+	};
+
+	AsyncFile();
+
+	/** @brief Same as Open() */
+	explicit AsyncFile(const std::string & _sPath, Access _eAccess = ReadOnly, int _iFlags = 0,
+			Backend _eBackend = BackendAuto, unsigned int _uiQueueDepth = DefaultQueueDepth);
+
+	/** @brief Waits for operations in flight, then closes */
+	~AsyncFile();
+
+	/** @brief Opens _sPath, closing the current file first
+	 *
+	 * @param _iFlags Flags combination
+	 * @param _uiQueueDepth operations in flight at most, rounded up to a power of two
+	 * @throws OpenFileException if the file can not be opened, SystemException if
+	 *         BackendUring is asked for and io_uring can not be set up
+	 */
+	void Open(const std::string & _sPath, Access _eAccess = ReadOnly, int _iFlags = 0,
+			Backend _eBackend = BackendAuto, unsigned int _uiQueueDepth = DefaultQueueDepth);
+
+	/** @brief Waits for operations in flight, stops the completion thread and closes the file */
+	void Close();
+
+	bool IsOpen() const
+	{
+		return i_Fd >= 0;
+	}
+
+	const std::string & Path() const
+	{
+		return s_Path;
+	}
+
+	/** @brief Backend in use, never BackendAuto while open */
+	Backend GetBackend() const
+	{
+		return e_Backend;
+	}
+
+	unsigned int QueueDepth() const
+	{
+		return ui_Depth;
+	}
+
+	/** @brief File size now, throws FileException */
+	std::size_t Size() const;
+
+	/** @brief Single operations, see Batch */
+	Future<std::size_t> Read(std::size_t _tOffset, Buffer<char> & _buf);
+	void Read(std::size_t _tOffset, Buffer<char> & _buf, Callback _callback, void * _pData = NullPtr);
+	Future<std::size_t> Write(std::size_t _tOffset, const Buffer<char> & _buf);
+	void Write(std::size_t _tOffset, const Buffer<char> & _buf, Callback _callback, void * _pData = NullPtr);
+	Future<std::size_t> Fsync(bool _bDataOnly = false);
+
+	/** @brief Submits and empties _batch. Blocks while the queue is full
+	 *
+	 * Failures of single operations are reported through their futures or callbacks.
+	 * @throws IllegalStateException if not open, or if called from a completion of
+	 *         this file without room in the queue. _batch is left as it was then
+	 */
+	void Submit(Batch & _batch);
+
+	/** @brief Operations submitted and not yet completed */
+	std::size_t Pending() const;
+
+	/** @brief Blocks until every submitted operation has completed */
+	void Drain();
+
+	/** @brief True if this kernel lets the process set up an io_uring. Probed once */
+	static bool UringSupported();
+
+private:
+	friend class Dp::AsyncFileOp;
+	friend class Dp::AsyncRing;
+
+	void Submit(Dp::AsyncFileOp ** _pOps, std::size_t _tCount);
+	void SubmitOne(Dp::AsyncFileOp * _pOp);
+
+	/// Blocks until _tCount more operations may be put in flight
+	void Acquire(std::size_t _tCount);
+	bool TryAcquire(std::size_t _tCount);
+	void Release(std::size_t _tCount);
+
+	std::string s_Path;
+	int i_Fd;
+	Backend e_Backend;
+	unsigned int ui_Depth;
+	Dp::AsyncRing * p_Ring;
+	ThreadPool * p_Pool;
+
+	std::size_t t_InFlight;
+	unsigned int ui_Waiters;
+	mutable FastMutex mtx_Slots;
+	WaitCondition m_Slots;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_ASYNCFILE_H_ */
@@ -0,0 +1,311 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * AtomicOps.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Lock-free atomic operations on machine words and pointers
+ *
+ */
+
+#ifndef CXXABB_CORE_ATOMICOPS_H_
+#define CXXABB_CORE_ATOMICOPS_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "NotImplemented: AtomicOps requires GCC compatible atomic builtins"
+#endif
+
+/// GCC 4.7+ and clang provide __atomic builtins with explicit memory ordering.
+/// Older GCC only has __sync builtins, which are always full barriers.
+#if defined(__ATOMIC_ACQUIRE)
+#define CXXABB_HAS_ATOMIC_BUILTINS 1
+#endif
+
+namespace CxxAbb
+{
+namespace Sys
+{
+
+/** @brief Memory ordering constraints of atomic operations
+ *
+ * Relaxed - only atomicity, no ordering
+ * Acquire - later loads/stores can not move before this load
+ * Release - earlier loads/stores can not move after this store
+ * AcqRel  - both Acquire and Release (read-modify-write)
+ * SeqCst  - single total order between all SeqCst operations
+ */
+enum MemoryOrder
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	MemoryOrderRelaxed = __ATOMIC_RELAXED,
+	MemoryOrderAcquire = __ATOMIC_ACQUIRE,
+	MemoryOrderRelease = __ATOMIC_RELEASE,
+	MemoryOrderAcqRel = __ATOMIC_ACQ_REL,
+	MemoryOrderSeqCst = __ATOMIC_SEQ_CST
+#else
+	MemoryOrderRelaxed = 0,
+	MemoryOrderAcquire,
+	MemoryOrderRelease,
+	MemoryOrderAcqRel,
+	MemoryOrderSeqCst
+#endif
+};
+
+/// Atomic operations on integral and pointer types.
+/// Type T must be naturally aligned and at most pointer (or 8 bytes) wide.
+
+template <typename T>
+inline T AtomicLoad(const volatile T * _p, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_load_n(_p, _order);
+#else
+	(void) _order;
+	T tVal = *_p;
+	__sync_synchronize();
+	return tVal;
+#endif
+}
+
+template <typename T>
+inline void AtomicStore(volatile T * _p, T _value, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	__atomic_store_n(_p, _value, _order);
+#else
+	(void) _order;
+	__sync_synchronize();
+	*_p = _value;
+	__sync_synchronize();
+#endif
+}
+
+template <typename T>
+inline T AtomicExchange(volatile T * _p, T _value, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_exchange_n(_p, _value, _order);
+#else
+	(void) _order;
+	__sync_synchronize();
+	return __sync_lock_test_and_set(_p, _value);
+#endif
+}
+
+/** @brief Compare and swap
+ * If *_p equals _expected, store _desired and return true.
+ * Otherwise load current value in to _expected and return false.
+ */
+template <typename T>
+inline bool AtomicCompareExchange(volatile T * _p, T & _expected, T _desired,
+	MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_compare_exchange_n(_p, &_expected, _desired, false, _order,
+		_order == MemoryOrderAcqRel ? MemoryOrderAcquire :
+		(_order == MemoryOrderRelease ? MemoryOrderRelaxed : _order));
+#else
+	(void) _order;
+	T tOld = __sync_val_compare_and_swap(_p, _expected, _desired);
+	if (tOld == _expected)
+		return true;
+	_expected = tOld;
+	return false;
+#endif
+}
+
+template <typename T>
+inline T AtomicFetchAdd(volatile T * _p, T _value, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_fetch_add(_p, _value, _order);
+#else
+	(void) _order;
+	return __sync_fetch_and_add(_p, _value);
+#endif
+}
+
+template <typename T>
+inline T AtomicFetchSub(volatile T * _p, T _value, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_fetch_sub(_p, _value, _order);
+#else
+	(void) _order;
+	return __sync_fetch_and_sub(_p, _value);
+#endif
+}
+
+template <typename T>
+inline T AtomicFetchOr(volatile T * _p, T _value, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_fetch_or(_p, _value, _order);
+#else
+	(void) _order;
+	return __sync_fetch_and_or(_p, _value);
+#endif
+}
+
+template <typename T>
+inline T AtomicFetchAnd(volatile T * _p, T _value, MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	return __atomic_fetch_and(_p, _value, _order);
+#else
+	(void) _order;
+	return __sync_fetch_and_and(_p, _value);
+#endif
+}
+
+/** @brief Memory fence
+ */
+inline void AtomicThreadFence(MemoryOrder _order = MemoryOrderSeqCst)
+{
+#ifdef CXXABB_HAS_ATOMIC_BUILTINS
+	__atomic_thread_fence(_order);
+#else
+	(void) _order;
+	__sync_synchronize();
+#endif
+}
+
+/** @brief Hint the CPU that caller is in a spin-wait loop
+ */
+inline void CpuRelax()
+{
+#if (CXXABB_ARCH == CXXABB_ARCH_IA32) || (CXXABB_ARCH == CXXABB_ARCH_AMD64)
+	__asm__ __volatile__("pause" ::: "memory");
+#else
+	__asm__ __volatile__("" ::: "memory");
+#endif
+}
+
+/** @brief Atomic variable of integral or pointer type
+ *
+ * Operations default to sequential consistency. Hot paths should pass
+ * the weakest MemoryOrder that is still correct.
+ *
+ * @code
+ * CxxAbb::Sys::Atomic<int> iState(0);
+ * int iExpected = 0;
+ * if (iState.CompareExchange(iExpected, 1, CxxAbb::Sys::MemoryOrderAcqRel))
+ * {
+ *     ...
+ * }
+ * @endcode
+ */
+template <typename T>
+class Atomic : private NonCopyable
+{
+public:
+	Atomic() : t_Value(T())
+	{}
+
+	explicit Atomic(T _value) : t_Value(_value)
+	{}
+
+	T Load(MemoryOrder _order = MemoryOrderSeqCst) const
+	{
+		return AtomicLoad(&t_Value, _order);
+	}
+
+	void Store(T _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		AtomicStore(&t_Value, _value, _order);
+	}
+
+	T Exchange(T _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicExchange(&t_Value, _value, _order);
+	}
+
+	bool CompareExchange(T & _expected, T _desired, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicCompareExchange(&t_Value, _expected, _desired, _order);
+	}
+
+	T FetchAdd(T _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicFetchAdd(&t_Value, _value, _order);
+	}
+
+	T FetchSub(T _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicFetchSub(&t_Value, _value, _order);
+	}
+
+	T FetchOr(T _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicFetchOr(&t_Value, _value, _order);
+	}
+
+	T FetchAnd(T _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicFetchAnd(&t_Value, _value, _order);
+	}
+
+private:
+	volatile T t_Value;
+};
+
+/** @brief Pointer specialization. Arithmetic operations are not provided.
+ */
+template <typename T>
+class Atomic<T*> : private NonCopyable
+{
+public:
+	Atomic() : p_Value(NullPtr)
+	{}
+
+	explicit Atomic(T * _value) : p_Value(_value)
+	{}
+
+	T * Load(MemoryOrder _order = MemoryOrderSeqCst) const
+	{
+		return AtomicLoad(&p_Value, _order);
+	}
+
+	void Store(T * _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		AtomicStore(&p_Value, _value, _order);
+	}
+
+	T * Exchange(T * _value, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicExchange(&p_Value, _value, _order);
+	}
+
+	bool CompareExchange(T * & _expected, T * _desired, MemoryOrder _order = MemoryOrderSeqCst)
+	{
+		return AtomicCompareExchange(&p_Value, _expected, _desired, _order);
+	}
+
+private:
+	T * volatile p_Value;
+};
+
+} /* namespace Sys */
+} /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_ATOMICOPS_H_ */
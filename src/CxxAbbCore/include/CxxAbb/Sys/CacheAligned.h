@@ -0,0 +1,191 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * CacheAligned.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Cache line padding helpers
+ *
+ */
+
+
+#ifndef CXXABB_CORE_CACHEALIGNED_H_
+#define CXXABB_CORE_CACHEALIGNED_H_
+
+#include <CxxAbb/Core.h>
+
+#include <cstddef>
+#include <new>
+
+#if (CXXABB_COMPILER == CXXABB_COMPILER_MSC)
+#define CXXABB_ALIGNED(N) __declspec(align(N))
+#else
+#define CXXABB_ALIGNED(N) __attribute__((aligned(N)))
+#endif
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/// Destructive interference size of the supported targets
+static const std::size_t CacheLineSize = 64;
+
+/** @brief Zero filled storage starting on a cache line, release with FreeCacheAligned() */
+CXXABB_API void * AllocateCacheAligned(std::size_t _tBytes);
+
+CXXABB_API void FreeCacheAligned(void * _pMemory);
+
+/** @brief T alone on its cache line(s)
+ *
+ * Starts on a line boundary and is padded up to a multiple of CacheLineSize,
+ * so a hot member written by one thread does not slow down readers of its
+ * neighbours. Static and automatic instances and instances created by new are
+ * aligned. As a member it raises the alignment of the enclosing class, which
+ * plain new does not honour: use CachePadded for members of heap objects.
+ *
+ * @code
+ * CxxAbb::Sys::CacheAligned<CxxAbb::Sys::Atomic<long> > lRequests;
+ * lRequests->FetchAdd(1);
+ * @endcode
+ */
+template <typename T>
+class CXXABB_ALIGNED(64) CacheAligned
+{
+public:
+	CacheAligned() : m_Value()
+	{}
+
+	template <typename A>
+	explicit CacheAligned(const A & _arg) : m_Value(_arg)
+	{}
+
+	T & Value()
+	{
+		return m_Value;
+	}
+
+	const T & Value() const
+	{
+		return m_Value;
+	}
+
+	T & operator * ()
+	{
+		return m_Value;
+	}
+
+	const T & operator * () const
+	{
+		return m_Value;
+	}
+
+	T * operator -> ()
+	{
+		return &m_Value;
+	}
+
+	const T * operator -> () const
+	{
+		return &m_Value;
+	}
+
+	static void * operator new (std::size_t _tBytes)
+	{
+		return AllocateCacheAligned(_tBytes);
+	}
+
+	static void * operator new [] (std::size_t _tBytes)
+	{
+		return AllocateCacheAligned(_tBytes);
+	}
+
+	static void operator delete (void * _pMemory)
+	{
+		FreeCacheAligned(_pMemory);
+	}
+
+	static void operator delete [] (void * _pMemory)
+	{
+		FreeCacheAligned(_pMemory);
+	}
+
+private:
+	T m_Value;
+};
+
+/** @brief T with a full cache line of padding on each side
+ *
+ * Isolates T whatever the alignment of the storage, at the cost of two extra
+ * lines. Meant for hot members of classes that are allocated with new.
+ */
+template <typename T>
+class CachePadded
+{
+public:
+	CachePadded() : m_Value()
+	{}
+
+	template <typename A>
+	explicit CachePadded(const A & _arg) : m_Value(_arg)
+	{}
+
+	T & Value()
+	{
+		return m_Value;
+	}
+
+	const T & Value() const
+	{
+		return m_Value;
+	}
+
+	T & operator * ()
+	{
+		return m_Value;
+	}
+
+	const T & operator * () const
+	{
+		return m_Value;
+	}
+
+	T * operator -> ()
+	{
+		return &m_Value;
+	}
+
+	const T * operator -> () const
+	{
+		return &m_Value;
+	}
+
+private:
+	char a_PadBefore[CacheLineSize];
+	T m_Value;
+	char a_PadAfter[CacheLineSize];
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_CACHEALIGNED_H_ */
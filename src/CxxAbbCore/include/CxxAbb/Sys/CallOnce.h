@@ -0,0 +1,121 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * CallOnce.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : One time initialization
+ *
+ */
+
+#ifndef CXXABB_CORE_CALLONCE_H_
+#define CXXABB_CORE_CALLONCE_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#include <sched.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief State of a CallOnce() site
+ *
+ * Plain aggregate so a namespace scope or static member flag initialized with
+ * CXXABB_ONCE_INIT is ready before any constructor runs.
+ */
+struct OnceFlag
+{
+	enum State
+	{
+		Idle = 0,
+		Running,
+		Done
+	};
+
+	volatile int i_State;
+
+	bool IsDone() const
+	{
+		return AtomicLoad(&i_State, MemoryOrderAcquire) == Done;
+	}
+};
+
+#define CXXABB_ONCE_INIT { CxxAbb::Sys::OnceFlag::Idle }
+
+/** @brief Run _func exactly once for _flag
+ *
+ * Fast path is a single acquire load. Concurrent callers wait until the first
+ * caller returns, so every caller sees the effects of _func. If _func throws
+ * the flag is reset and the exception propagates; the next caller retries.
+ *
+ * @code
+ * static CxxAbb::Sys::OnceFlag s_Once = CXXABB_ONCE_INIT;
+ * CxxAbb::Sys::CallOnce(s_Once, &InitTables);
+ * @endcode
+ */
+template <typename Func>
+void CallOnce(OnceFlag & _flag, Func _func)
+{
+	if (_flag.IsDone())
+		return;
+
+	int iExpected = OnceFlag::Idle;
+	if (AtomicCompareExchange(&_flag.i_State, iExpected, static_cast<int>(OnceFlag::Running), MemoryOrderAcquire))
+	{
+		try
+		{
+			_func();
+		}
+		catch (...)
+		{
+			AtomicStore(&_flag.i_State, static_cast<int>(OnceFlag::Idle), MemoryOrderRelease);
+			throw;
+		}
+		AtomicStore(&_flag.i_State, static_cast<int>(OnceFlag::Done), MemoryOrderRelease);
+		return;
+	}
+
+	// another thread is running _func, initializers are short so spin then yield
+	unsigned int uiSpins = 0;
+	int iState;
+	while ((iState = AtomicLoad(&_flag.i_State, MemoryOrderAcquire)) != OnceFlag::Done)
+	{
+		if (iState == OnceFlag::Idle)
+		{
+			// the running initializer threw, compete again
+			CallOnce(_flag, _func);
+			return;
+		}
+		if (++uiSpins < 128)
+			CpuRelax();
+		else
+			sched_yield();
+	}
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_CALLONCE_H_ */
@@ -0,0 +1,250 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ConcurrentHashMap.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Sys
+ * Comment     : Sharded hash map for shared tables
+ *
+ */
+
+
+#ifndef CXXABB_CORE_CONCURRENTHASHMAP_H_
+#define CXXABB_CORE_CONCURRENTHASHMAP_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/FlatHashMap.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Sys/StripedCounter.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Hash map shared by many threads, values held by counted pointers
+ *
+ * Keys are spread over power of two many shards by the top bits of their hash,
+ * each shard a FlatHashMap behind its own cache line padded RWSpinLock. Readers
+ * of different shards never touch a common cache line and readers of one shard
+ * run side by side, so read throughput grows with the cores as long as the keys
+ * do not all fall into one shard.
+ *
+ * Find() hands out a counted copy of the value, a ValuePtr whose count is
+ * atomic: it stays valid after a concurrent Erase() or InsertOrAssign(), which
+ * drop only the map's reference, and may be dropped on any thread.
+ * Values are shared, not copied, so V must be safe for concurrent readers or
+ * treated as immutable once inserted. Values whose last reference is the map's
+ * are released after the shard lock is given up, so their destructors may use
+ * the map.
+ *
+ * @code
+ * CxxAbb::Sys::ConcurrentHashMap<std::string, Session> sessions;
+ * CxxAbb::Sys::ConcurrentHashMap<std::string, Session>::ValuePtr session;
+ * if (sessions.Find(sId, session))
+ *     session->Touch();
+ * @endcode
+ */
+template <typename K, typename V, typename H = Hash<K>, typename E = EqualTo<K> >
+class ConcurrentHashMap : private NonCopyable
+{
+public:
+	typedef SmartPtr<V, DeleteDestroyPolicy<V>, AtomicExternalRefCounter<V, DeleteDestroyPolicy<V> > > ValuePtr;
+
+	/** @brief _uiShards is rounded up to a power of two, 0 takes 4 per Stripes::Count() */
+	explicit ConcurrentHashMap(unsigned int _uiShards = 0, const H & _hash = H(), const E & _equal = E())
+		: p_Shards(NullPtr),
+		  ui_ShardBits(0),
+		  m_Hash(_hash),
+		  m_Equal(_equal)
+	{
+		unsigned int uiWanted = _uiShards ? _uiShards : 4 * Stripes::Count();
+		while ((1U << ui_ShardBits) < uiWanted)
+			++ui_ShardBits;
+		p_Shards = new CachePadded<Shard>[1U << ui_ShardBits];
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+			FlatMap(NullPtr, m_Hash, m_Equal).Swap(p_Shards[i]->m_Map);
+	}
+
+	~ConcurrentHashMap()
+	{
+		delete [] p_Shards;
+	}
+
+	unsigned int ShardCount() const
+	{
+		return 1U << ui_ShardBits;
+	}
+
+	/** @brief Copies the value of _key into _value, which is left alone on a miss */
+	template <typename Q>
+	bool Find(const Q & _key, ValuePtr & _value) const
+	{
+		const Shard & shard = ShardFor(_key);
+		RWSpinLock::ScopedReadLock lock(shard.m_Lock);
+		typename FlatMap::ConstIterator it = shard.m_Map.Find(_key);
+		if (it == shard.m_Map.end())
+			return false;
+		_value = it->second;
+		return true;
+	}
+
+	template <typename Q>
+	bool Contains(const Q & _key) const
+	{
+		const Shard & shard = ShardFor(_key);
+		RWSpinLock::ScopedReadLock lock(shard.m_Lock);
+		return shard.m_Map.Contains(_key);
+	}
+
+	/** @brief Sets the value of _key, true if _key was new */
+	bool InsertOrAssign(const K & _key, const ValuePtr & _value)
+	{
+		Shard & shard = ShardFor(_key);
+		ValuePtr released;
+		{
+			RWSpinLock::ScopedLock lock(shard.m_Lock);
+			std::pair<typename FlatMap::Iterator, bool> inserted = shard.m_Map.Insert(_key, _value);
+			if (inserted.second)
+				return true;
+			released = inserted.first->second;
+			inserted.first->second = _value;
+		}
+		return false;
+	}
+
+	/** @brief Takes ownership of _pValue (new allocated) */
+	bool InsertOrAssign(const K & _key, V * _pValue)
+	{
+		return InsertOrAssign(_key, ValuePtr(_pValue));
+	}
+
+	template <typename Q>
+	bool Erase(const Q & _key)
+	{
+		Shard & shard = ShardFor(_key);
+		ValuePtr released;
+		{
+			RWSpinLock::ScopedLock lock(shard.m_Lock);
+			typename FlatMap::Iterator it = shard.m_Map.Find(_key);
+			if (it == shard.m_Map.end())
+				return false;
+			released = it->second;
+			shard.m_Map.Erase(it);
+		}
+		return true;
+	}
+
+	/** @brief Value of _key, inserting _factory() first if there is none
+	 *
+	 * _factory() returns a new allocated V * or a ValuePtr. It runs outside the
+	 * shard lock, so it may be slow and may use this map, but threads missing the
+	 * same key at the same time may each run it: the first value inserted wins and
+	 * the others are dropped after the lock is given up. Nothing is inserted if
+	 * it throws.
+	 */
+	template <typename F>
+	ValuePtr ComputeIfAbsent(const K & _key, F _factory)
+	{
+		Shard & shard = ShardFor(_key);
+		{
+			RWSpinLock::ScopedReadLock lock(shard.m_Lock);
+			typename FlatMap::ConstIterator it = shard.m_Map.Find(_key);
+			if (it != shard.m_Map.end())
+				return it->second;
+		}
+
+		ValuePtr value(_factory());
+		ValuePtr winner;
+		{
+			RWSpinLock::ScopedLock lock(shard.m_Lock);
+			winner = shard.m_Map.Insert(_key, value).first->second;
+		}
+		return winner;
+	}
+
+	/** @brief Sum over the shards, each read at a different moment */
+	std::size_t Size() const
+	{
+		std::size_t tSize = 0;
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			RWSpinLock::ScopedReadLock lock(p_Shards[i]->m_Lock);
+			tSize += p_Shards[i]->m_Map.Size();
+		}
+		return tSize;
+	}
+
+	/** @brief Empties one shard at a time, its values are released outside its lock */
+	void Clear()
+	{
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			FlatMap released(NullPtr, m_Hash, m_Equal);
+			{
+				RWSpinLock::ScopedLock lock(p_Shards[i]->m_Lock);
+				released.Swap(p_Shards[i]->m_Map);
+			}
+		}
+	}
+
+	/** @brief Calls _func(key, value) for every element, one shard at a time under its read lock */
+	template <typename F>
+	void ForEach(F _func) const
+	{
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			RWSpinLock::ScopedReadLock lock(p_Shards[i]->m_Lock);
+			for (typename FlatMap::ConstIterator it = p_Shards[i]->m_Map.begin(); it != p_Shards[i]->m_Map.end(); ++it)
+				_func(it->first, it->second);
+		}
+	}
+
+private:
+	typedef FlatHashMap<K, ValuePtr, H, E> FlatMap;
+
+	struct Shard
+	{
+		mutable RWSpinLock m_Lock;
+		FlatMap m_Map;
+	};
+
+	/// Top bits pick the shard, FlatHashMap probes with the low ones
+	template <typename Q>
+	Shard & ShardFor(const Q & _key) const
+	{
+		return ui_ShardBits ? *p_Shards[m_Hash(_key) >> (64 - ui_ShardBits)] : *p_Shards[0];
+	}
+
+	CachePadded<Shard> * p_Shards;
+	unsigned int ui_ShardBits;
+	H m_Hash;
+	E m_Equal;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_CONCURRENTHASHMAP_H_ */
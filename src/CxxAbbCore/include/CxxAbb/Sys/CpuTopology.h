@@ -0,0 +1,120 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * CpuTopology.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Processor, cache, NUMA and cgroup limits of the host
+ *
+ */
+
+
+#ifndef CXXABB_CORE_CPUTOPOLOGY_H_
+#define CXXABB_CORE_CPUTOPOLOGY_H_
+
+#include <CxxAbb/Core.h>
+
+#include <string>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief One cache as seen from the first online CPU
+ */
+struct CXXABB_API CacheInfo
+{
+	CacheInfo()
+		: i_Level(0),
+		  t_Size(0),
+		  t_LineSize(0),
+		  i_Ways(0)
+	{}
+
+	int i_Level;                     /// 1, 2, 3 ...
+	std::string s_Type;              /// "Data", "Instruction" or "Unified"
+	std::size_t t_Size;              /// bytes
+	std::size_t t_LineSize;          /// coherency line size in bytes
+	int i_Ways;                      /// associativity, 0 if unknown
+	std::vector<int> lst_SharedCpus; /// logical CPUs sharing this cache
+};
+
+/** @brief NUMA node with its CPUs and local memory
+ */
+struct CXXABB_API NumaNode
+{
+	NumaNode()
+		: i_Id(0),
+		  ui_MemoryBytes(0)
+	{}
+
+	int i_Id;
+	std::vector<int> lst_Cpus;
+	UInt64 ui_MemoryBytes;
+};
+
+/** @brief Snapshot of the processor layout and the limits imposed on this process
+ *
+ * Filled from /sys/devices/system/cpu, /sys/devices/system/node and the cgroup
+ * (v1 or v2) of the process. Fields that cannot be read keep their defaults, a
+ * machine without NUMA information reports a single node with every CPU.
+ * @see Environment::Topology()
+ */
+struct CXXABB_API CpuTopology
+{
+	CpuTopology()
+		: i_PhysicalCores(0),
+		  i_Packages(0),
+		  i_ThreadsPerCore(1),
+		  t_CacheLineSize(64),
+		  d_QuotaCpus(0.0),
+		  i_EffectiveCpus(1)
+	{}
+
+	/** @brief Data or unified cache of _iLevel, NullPtr if not reported */
+	const CacheInfo * Cache(int _iLevel) const;
+
+	/** @brief Node owning _iCpu, NullPtr if unknown */
+	const NumaNode * NodeOf(int _iCpu) const;
+
+	std::vector<int> lst_OnlineCpus;              /// logical CPUs
+	std::vector<int> lst_CoreOf;                  /// index by CPU: physical core number (0 .. i_PhysicalCores - 1), -1 offline
+	std::vector<std::vector<int> > lst_Siblings;  /// index by CPU: SMT siblings including the CPU itself
+	int i_PhysicalCores;
+	int i_Packages;
+	int i_ThreadsPerCore;
+
+	std::vector<NumaNode> lst_Nodes;
+	std::vector<CacheInfo> lst_Caches;
+	std::size_t t_CacheLineSize;                  /// L1 data line, 64 if not reported
+
+	std::vector<int> lst_AllowedCpus;             /// online CPUs left by cpuset and affinity
+	double d_QuotaCpus;                           /// CFS quota / period, 0 when unlimited
+	int i_EffectiveCpus;                          /// CPUs worth running threads on, see Environment::EffectiveProcessorCount()
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_CPUTOPOLOGY_H_ */
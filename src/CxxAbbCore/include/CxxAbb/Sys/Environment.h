@@ -29,6 +29,9 @@
 #define CXXABB_CORE_ENVIRONMENT_H_
 
 #include <CxxAbb/Core.h>
+#include <CxxAbb/Result.h>
+#include <CxxAbb/Sys/CpuTopology.h>
+#include <CxxAbb/Sys/EnvironmentSnapshot.h>
 
 namespace CxxAbb
 {
@@ -38,6 +41,15 @@ namespace Sys
 
 /** @brief System independent environment information accessor
  *  Gives access to Environment variables, System details, etc.
+ *
+ *  Get() / Has() work on the live process environment, under a lock. Hot paths
+ *  should read Snapshot() instead, which is lock-free and hands out an immutable
+ *  copy published by the last Set() or Refresh(). The host details (OsName(),
+ *  HostName(), EthernetAddress() ...) are served from that copy.
+ *
+ *  Every thread keeps a reference to the snapshot it read last and drops it when
+ *  it sees a newer one or exits, a replaced snapshot is freed once the readers
+ *  holding it let go.
  */
 class CXXABB_API Environment
 {
@@ -52,32 +64,48 @@ public:
 	 */
 	static std::string Get(const std::string & _key, const std::string & _default);
 
+	/** @brief Get environment variable by name. ENOENT if not found, never throws NotFoundException.
+	 */
+	static Result<std::string> TryGet(const std::string & _key);
+
 	/** @brief Check if environment variable is set
 	 */
 	static bool Has(const std::string & _key);
 
-	/** @brief Set environment variable
+	/** @brief Set environment variable and publish a new Snapshot() with it,
+	 *  host details are carried over from the current one
 	 */
 	static void Set(const std::string & _key, const std::string & _value);
 
-	/** @brief Get OS Name
+	/** @brief Current snapshot of the variables and host details, lock-free.
+	 *  The snapshot stays valid (and unchanged) after later publishes while the
+	 *  Ptr is held.
+	 */
+	static EnvironmentSnapshot::Ptr Snapshot();
+
+	/** @brief Re-read the process environment and host details and publish them
+	 *  as the new Snapshot()
+	 */
+	static void Refresh();
+
+	/** @brief Get OS Name, from Snapshot()
 	 */
 	static std::string OsName();
 
-	/** @brief Get Host Name
+	/** @brief Get Host Name, from Snapshot()
 	 */
 	static std::string HostName();
 
-	/** @brief Get Ethernet Address as hex[] or string
+	/** @brief Get Ethernet Address as hex[] or string, from Snapshot()
 	 */
 	static std::string EthernetAddress();
 	static void EthernetAddress(NodeId & _address);
 
-	/** @brief Get OS release version
+	/** @brief Get OS release version, from Snapshot()
 	 */
 	static std::string OsVersion();
 
-	/** @brief Get OS Architecture
+	/** @brief Get OS Architecture, from Snapshot()
 	 */
 	static std::string OsArchitecture();
 
@@ -85,6 +113,20 @@ public:
 	 */
 	static unsigned int ProcessorCount();
 
+	/** @brief Processors this process can use: online CPUs limited by affinity,
+	 *  cgroup cpuset and CFS quota (rounded up). Size thread pools with this one.
+	 */
+	static unsigned int EffectiveProcessorCount();
+
+	/** @brief Processor, cache and NUMA layout and cgroup limits, read once and cached
+	 */
+	static const CpuTopology & Topology();
+
+	/** @brief Read the topology from sysfs / procfs below _sRoot, uncached
+	 *  ("/" is this host, another root reads a captured tree)
+	 */
+	static void ReadTopology(CpuTopology & _topology, const std::string & _sRoot = "/");
+
 	/** @brief Get CxxAbb library version
 	 */
 	static std::string LibraryVersionString();
@@ -97,6 +139,12 @@ private:
 	Environment() {}
 	~Environment() {}
 
+	static void InitSnapshot();
+	static const EnvironmentSnapshot & ThreadSnapshot();
+	static const EnvironmentSnapshot & UpdateThreadSnapshot();
+	static void CaptureSnapshot(EnvironmentSnapshot & _snapshot, const EnvironmentSnapshot * _pHost);
+	static void PublishSnapshot(EnvironmentSnapshot * _pSnapshot, EnvironmentSnapshot::Ptr & _released);
+
 	void operator=(const Environment);
 };
 
@@ -0,0 +1,146 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * EnvironmentSnapshot.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Immutable snapshot of environment variables and host details
+ *
+ */
+
+#ifndef CXXABB_CORE_ENVIRONMENTSNAPSHOT_H_
+#define CXXABB_CORE_ENVIRONMENTSNAPSHOT_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/RefCountedObj.h>
+#include <CxxAbb/SmartPtr.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Immutable copy of the environment variables and host details
+ *
+ * Published by Environment::Set() and Environment::Refresh(), read with
+ * Environment::Snapshot() without taking a lock. A snapshot is never changed
+ * once published; references and pointers taken from it stay valid as long as a
+ * Ptr to it is held, a newer snapshot simply replaces it for later readers.
+ * It is freed when the last Ptr is dropped. Variables changed by ::setenv show
+ * up after the next Refresh().
+ */
+class CXXABB_API EnvironmentSnapshot : public IntrusiveRefCounted<EnvironmentSnapshot, AtomicRefCount>
+{
+public:
+	typedef IntrusivePtr<const EnvironmentSnapshot> Ptr;
+
+	typedef UInt8 NodeId[6]; /// Ethernet address.
+	typedef std::pair<std::string, std::string> Variable;
+	typedef std::vector<Variable> VariableList; /// sorted by name
+
+	/** @brief Value of _key, NullPtr if not set */
+	const std::string * Find(const std::string & _key) const;
+
+	/** @brief Value of _key, throws NotFoundException if not set */
+	const std::string & Get(const std::string & _key) const;
+
+	/** @brief Value of _key, _default if not set */
+	const std::string & Get(const std::string & _key, const std::string & _default) const;
+
+	bool Has(const std::string & _key) const
+	{
+		return Find(_key) != NullPtr;
+	}
+
+	const VariableList & Variables() const
+	{
+		return lst_Variables;
+	}
+
+	const std::string & OsName() const
+	{
+		return s_OsName;
+	}
+
+	const std::string & OsVersion() const
+	{
+		return s_OsVersion;
+	}
+
+	const std::string & OsArchitecture() const
+	{
+		return s_OsArchitecture;
+	}
+
+	const std::string & HostName() const
+	{
+		return s_HostName;
+	}
+
+	/** @brief Ethernet address as "xx:xx:xx:xx:xx:xx" */
+	const std::string & EthernetAddress() const
+	{
+		return s_EthernetAddress;
+	}
+
+	const NodeId & EthernetNodeId() const
+	{
+		return a_NodeId;
+	}
+
+	unsigned int ProcessorCount() const
+	{
+		return ui_ProcessorCount;
+	}
+
+	/** @brief 1 for the first snapshot, incremented by every publish */
+	UInt64 Generation() const
+	{
+		return ui_Generation;
+	}
+
+private:
+	friend class Environment;
+	friend class IntrusiveRefCounted<EnvironmentSnapshot, AtomicRefCount>;
+
+	EnvironmentSnapshot();
+	~EnvironmentSnapshot() {}
+
+	VariableList lst_Variables;
+	std::string s_OsName;
+	std::string s_OsVersion;
+	std::string s_OsArchitecture;
+	std::string s_HostName;
+	std::string s_EthernetAddress;
+	NodeId a_NodeId;
+	unsigned int ui_ProcessorCount;
+	UInt64 ui_Generation;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_ENVIRONMENTSNAPSHOT_H_ */
@@ -0,0 +1,77 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Executor.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Task execution interface
+ *
+ */
+
+#ifndef CXXABB_CORE_EXECUTOR_H_
+#define CXXABB_CORE_EXECUTOR_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Runnable.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Executor interface
+ *  Runs submitted tasks on some execution context (caller thread, worker pool, ...)
+ *  Executor takes the ownership of a submitted task and deletes it after Run().
+ *  Exceptions escaping from a task are reported to CxxAbb::ThreadErrorHandler.
+ */
+class CXXABB_API Executor
+{
+public:
+	virtual ~Executor()
+	{}
+
+	/** @brief Submit a heap allocated task for execution
+	 */
+	virtual void Execute(CxxAbb::Runnable * _pTask) = 0;
+
+protected:
+	/** @brief Run and delete a task, report escaped exceptions to ThreadErrorHandler
+	 */
+	static void RunTask(CxxAbb::Runnable * _pTask);
+};
+
+/** @brief Executor which runs tasks immediately in the calling thread
+ */
+class CXXABB_API InlineExecutor : public Executor
+{
+public:
+	void Execute(CxxAbb::Runnable * _pTask);
+
+	/** @brief Shared stateless instance
+	 */
+	static InlineExecutor & Instance();
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_EXECUTOR_H_ */
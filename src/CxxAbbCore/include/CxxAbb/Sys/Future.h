@@ -0,0 +1,700 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Future.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Promise/Future pair with continuations
+ *
+ */
+
+#ifndef CXXABB_CORE_FUTURE_H_
+#define CXXABB_CORE_FUTURE_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/RefCountedObj.h>
+#include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Sys/Executor.h>
+#include <vector>
+#include <new>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+template <typename T> class Future;
+template <typename T> class Promise;
+
+/** @brief Continuation attached to a future. Scheduled on its executor at completion.
+ *  Internal building block of Future::Then(), WhenAll() and WhenAny()
+ */
+class CXXABB_API FutureContinuation : public CxxAbb::Runnable
+{
+public:
+	explicit FutureContinuation(Executor & _executor)
+		: p_Next(NullPtr),
+		  p_Executor(&_executor)
+	{}
+
+	virtual ~FutureContinuation()
+	{}
+
+	/// Hand over to executor, which deletes this after Run()
+	void Schedule()
+	{
+		p_Executor->Execute(this);
+	}
+
+	FutureContinuation * p_Next;
+
+private:
+	Executor * p_Executor;
+};
+
+/** @brief Shared state of a Promise and its Futures
+ *
+ * Completion is published by a single state transition Pending -> Setting -> Ready/Failed.
+ * Readers check completion with an acquire load and never take a lock.
+ * Continuations are pushed to a lock-free stack, which is closed on completion.
+ * SigEvent is touched only when a thread actually blocks in Wait().
+ */
+template <typename T>
+class FutureState : public CxxAbb::AtomicRefCounted
+{
+public:
+	enum State
+	{
+		Pending = 0,
+		Setting,
+		Ready,
+		Failed
+	};
+
+	FutureState()
+		: i_State(Pending),
+		  i_Waiters(0),
+		  p_Continuations(NullPtr),
+		  p_Error(NullPtr),
+		  m_Event(false)
+	{}
+
+	~FutureState()
+	{
+		if (i_State.Load(MemoryOrderAcquire) == Ready)
+			Value()->~T();
+		delete p_Error;
+
+		FutureContinuation * pCont = p_Continuations.Load(MemoryOrderAcquire);
+		while (pCont && pCont != Closed())
+		{
+			FutureContinuation * pNext = pCont->p_Next;
+			delete pCont;
+			pCont = pNext;
+		}
+	}
+
+	bool IsReady() const
+	{
+		int iState = i_State.Load(MemoryOrderAcquire);
+		return iState == Ready || iState == Failed;
+	}
+
+	bool HasError() const
+	{
+		return i_State.Load(MemoryOrderAcquire) == Failed;
+	}
+
+	const CxxAbb::Exception * Error() const
+	{
+		return HasError() ? p_Error : NullPtr;
+	}
+
+	bool TrySetValue(const T & _value)
+	{
+		int iExpected = Pending;
+		if (!i_State.CompareExchange(iExpected, Setting, MemoryOrderAcquire))
+			return false;
+
+		try
+		{
+			new (m_Storage.z_Data) T(_value);
+		}
+		catch(...)
+		{
+			i_State.Store(Pending, MemoryOrderRelease);
+			throw;
+		}
+
+		Complete(Ready);
+		return true;
+	}
+
+	bool TrySetError(const CxxAbb::Exception & _ex)
+	{
+		int iExpected = Pending;
+		if (!i_State.CompareExchange(iExpected, Setting, MemoryOrderAcquire))
+			return false;
+
+		p_Error = _ex.Clone();
+		Complete(Failed);
+		return true;
+	}
+
+	void Wait()
+	{
+		if (IsReady())
+			return;
+
+		i_Waiters.FetchAdd(1);
+		while (!IsReady())
+		{
+			m_Event.Wait();
+		}
+		i_Waiters.FetchSub(1);
+	}
+
+	bool TryWait(long _lMilliSeconds)
+	{
+		if (IsReady())
+			return true;
+
+		i_Waiters.FetchAdd(1);
+		if (!IsReady())
+			m_Event.TryWait(_lMilliSeconds);
+		i_Waiters.FetchSub(1);
+
+		return IsReady();
+	}
+
+	/// Value of a completed state, throws the stored exception if failed
+	const T & Get() const
+	{
+		if (i_State.Load(MemoryOrderAcquire) == Failed)
+			p_Error->Rethrow();
+		return *Value();
+	}
+
+	/// Run now if completed, else run at completion
+	void AddContinuation(FutureContinuation * _pCont)
+	{
+		FutureContinuation * pHead = p_Continuations.Load(MemoryOrderAcquire);
+		for (;;)
+		{
+			if (pHead == Closed())
+			{
+				_pCont->Schedule();
+				return;
+			}
+
+			_pCont->p_Next = pHead;
+			if (p_Continuations.CompareExchange(pHead, _pCont, MemoryOrderAcqRel))
+				return;
+		}
+	}
+
+private:
+	static FutureContinuation * Closed()
+	{
+		return reinterpret_cast<FutureContinuation*>(1);
+	}
+
+	T * Value()
+	{
+		return reinterpret_cast<T*>(m_Storage.z_Data);
+	}
+
+	const T * Value() const
+	{
+		return reinterpret_cast<const T*>(m_Storage.z_Data);
+	}
+
+	void Complete(int _iState)
+	{
+		// Store of state and load of waiters are both SeqCst, pairs with Wait()
+		i_State.Store(_iState);
+		if (i_Waiters.Load() > 0)
+			m_Event.Set();
+
+		FutureContinuation * pList = p_Continuations.Exchange(Closed(), MemoryOrderAcqRel);
+
+		// stack is LIFO, run in registration order
+		FutureContinuation * pOrdered = NullPtr;
+		while (pList)
+		{
+			FutureContinuation * pNext = pList->p_Next;
+			pList->p_Next = pOrdered;
+			pOrdered = pList;
+			pList = pNext;
+		}
+
+		while (pOrdered)
+		{
+			FutureContinuation * pNext = pOrdered->p_Next;
+			pOrdered->Schedule();
+			pOrdered = pNext;
+		}
+	}
+
+	/// Uninitialized storage, T need not be default constructible
+	union Storage
+	{
+		char z_Data[sizeof(T)];
+		long double d_Align;
+		void * p_Align;
+		CxxAbb::Int64 i_Align;
+	};
+
+	Atomic<int> i_State;
+	Atomic<int> i_Waiters;
+	Atomic<FutureContinuation*> p_Continuations;
+	Storage m_Storage;
+	CxxAbb::Exception * p_Error;
+	CxxAbb::Sys::SigEvent m_Event;
+};
+
+/** @brief Read side of an asynchronous result
+ *
+ * Future is a cheap, copyable handle to a shared state. Any number of copies
+ * can wait for and read the result. The result is produced by a Promise.
+ *
+ * @code
+ * CxxAbb::Sys::Promise<int> promise;
+ * CxxAbb::Sys::Future<int> future = promise.GetFuture();
+ * ... // hand over promise to a producer, which calls promise.SetValue(42)
+ * int i = future.Get();
+ * @endcode
+ */
+template <typename T>
+class Future
+{
+	typedef FutureState<T> StateType;
+
+public:
+	typedef T ValueType;
+
+	/// Future without state, IsValid() is false
+	Future()
+	{}
+
+	Future(const Future & _other)
+		: ptr_State(_other.ptr_State)
+	{}
+
+	~Future()
+	{}
+
+	Future & operator = (const Future & _other)
+	{
+		ptr_State = _other.ptr_State;
+		return *this;
+	}
+
+	/** @brief Check if this future refers a shared state
+	 */
+	bool IsValid() const
+	{
+		return !ptr_State.isNull();
+	}
+
+	/** @brief Check if result (value or exception) is available. Never blocks.
+	 */
+	bool IsReady() const
+	{
+		return State()->IsReady();
+	}
+
+	/** @brief Check if completed with an exception
+	 */
+	bool HasException() const
+	{
+		return State()->HasError();
+	}
+
+	/** @brief Stored exception of a failed future, NULL otherwise
+	 */
+	const CxxAbb::Exception * Error() const
+	{
+		return State()->Error();
+	}
+
+	/** @brief Block until result is available
+	 */
+	void Wait() const
+	{
+		State()->Wait();
+	}
+
+	/** @brief Block at most x milliseconds until result is available
+	 */
+	bool TryWait(long _lMilliSeconds) const
+	{
+		return State()->TryWait(_lMilliSeconds);
+	}
+
+	/** @brief Block until result is available and return it
+	 *  Rethrows the exception set by the producer
+	 */
+	const T & Get() const
+	{
+		StateType * pState = State();
+		pState->Wait();
+		return pState->Get();
+	}
+
+	/** @brief Wait at most x milliseconds for the result
+	 *  Return false on timeout. Rethrows the exception set by the producer.
+	 */
+	bool TryGet(T & _value, long _lMilliSeconds) const
+	{
+		StateType * pState = State();
+		if (!pState->TryWait(_lMilliSeconds))
+			return false;
+		_value = pState->Get();
+		return true;
+	}
+
+	/** @brief Attach a continuation, which is called with the value once available
+	 *
+	 * Function object must define result_type (see std::unary_function) and accept const T&.
+	 * If this future fails, the function is not called and the exception is forwarded.
+	 * Exceptions thrown by the function fail the returned future.
+	 * Continuation runs in the completing thread (InlineExecutor) or on the given executor.
+	 */
+	template <class Func>
+	Future<typename Func::result_type> Then(Func _func,
+		Executor & _executor = InlineExecutor::Instance()) const;
+
+	/** @brief Attach a function as continuation
+	 */
+	template <typename R>
+	Future<R> Then(R (*_fpFunc)(const T &),
+		Executor & _executor = InlineExecutor::Instance()) const;
+
+	/** @brief Attach a low level continuation (internal)
+	 */
+	void AddContinuation(FutureContinuation * _pCont) const
+	{
+		State()->AddContinuation(_pCont);
+	}
+
+private:
+	template <typename U> friend class Promise;
+
+	explicit Future(StateType * _pState)
+		: ptr_State(_pState, true)
+	{}
+
+	StateType * State() const
+	{
+		if (ptr_State.isNull())
+			throw CxxAbb::IllegalStateException("Future has no shared state");
+		return const_cast<StateType*>(ptr_State.get());
+	}
+
+	CxxAbb::AutoPtr<StateType> ptr_State;
+};
+
+/** @brief Write side of an asynchronous result
+ *
+ * A Promise is satisfied exactly once, either with a value or an exception.
+ * Destroying an unsatisfied Promise fails its futures with IllegalStateException
+ * (broken promise), so that waiters never block forever.
+ */
+template <typename T>
+class Promise : private CxxAbb::NonCopyable
+{
+	typedef FutureState<T> StateType;
+
+public:
+	Promise()
+		: ptr_State(new StateType)
+	{}
+
+	~Promise()
+	{
+		if (!ptr_State->IsReady())
+			ptr_State->TrySetError(CxxAbb::IllegalStateException("Broken promise"));
+	}
+
+	/** @brief Get a future, which shares the state with this promise
+	 */
+	Future<T> GetFuture() const
+	{
+		return Future<T>(const_cast<StateType*>(ptr_State.get()));
+	}
+
+	/** @brief Set value. Throws IllegalStateException if already satisfied
+	 */
+	void SetValue(const T & _value)
+	{
+		if (!ptr_State->TrySetValue(_value))
+			throw CxxAbb::IllegalStateException("Promise already satisfied");
+	}
+
+	/** @brief Set exception. Throws IllegalStateException if already satisfied
+	 */
+	void SetException(const CxxAbb::Exception & _ex)
+	{
+		if (!ptr_State->TrySetError(_ex))
+			throw CxxAbb::IllegalStateException("Promise already satisfied");
+	}
+
+	/** @brief Set value if not yet satisfied. Return false if already satisfied
+	 */
+	bool TrySetValue(const T & _value)
+	{
+		return ptr_State->TrySetValue(_value);
+	}
+
+	/** @brief Set exception if not yet satisfied. Return false if already satisfied
+	 */
+	bool TrySetException(const CxxAbb::Exception & _ex)
+	{
+		return ptr_State->TrySetError(_ex);
+	}
+
+	bool IsSatisfied() const
+	{
+		return ptr_State->IsReady();
+	}
+
+private:
+	CxxAbb::AutoPtr<StateType> ptr_State;
+};
+
+/** @brief Continuation of Future::Then()
+ */
+template <typename T, class Func, typename R>
+class ThenContinuation : public FutureContinuation
+{
+public:
+	ThenContinuation(const Future<T> & _source, Func _func, Executor & _executor)
+		: FutureContinuation(_executor),
+		  m_Source(_source),
+		  m_Func(_func)
+	{}
+
+	Future<R> GetFuture() const
+	{
+		return m_Promise.GetFuture();
+	}
+
+	void Run()
+	{
+		if (m_Source.HasException())
+		{
+			m_Promise.SetException(*m_Source.Error());
+			return;
+		}
+
+		try
+		{
+			m_Promise.SetValue(m_Func(m_Source.Get()));
+		}
+		catch(CxxAbb::Exception & ex)
+		{
+			m_Promise.TrySetException(ex);
+		}
+		catch(std::exception & ex)
+		{
+			m_Promise.TrySetException(CxxAbb::RuntimeException(ex.what()));
+		}
+		catch(...)
+		{
+			m_Promise.TrySetException(CxxAbb::UnhandledException("Unknown exception in continuation"));
+		}
+	}
+
+private:
+	Future<T> m_Source;
+	Func m_Func;
+	Promise<R> m_Promise;
+};
+
+template <typename T>
+template <class Func>
+Future<typename Func::result_type> Future<T>::Then(Func _func, Executor & _executor) const
+{
+	typedef ThenContinuation<T, Func, typename Func::result_type> ContinuationType;
+
+	ContinuationType * pCont = new ContinuationType(*this, _func, _executor);
+	Future<typename Func::result_type> mResult = pCont->GetFuture();
+	AddContinuation(pCont);
+	return mResult;
+}
+
+template <typename T>
+template <typename R>
+Future<R> Future<T>::Then(R (*_fpFunc)(const T &), Executor & _executor) const
+{
+	typedef ThenContinuation<T, R (*)(const T &), R> ContinuationType;
+
+	ContinuationType * pCont = new ContinuationType(*this, _fpFunc, _executor);
+	Future<R> mResult = pCont->GetFuture();
+	AddContinuation(pCont);
+	return mResult;
+}
+
+/** @brief Aggregation state of WhenAll()
+ */
+template <typename T>
+class WhenAllState : public CxxAbb::AtomicRefCounted
+{
+public:
+	explicit WhenAllState(const std::vector< Future<T> > & _futures)
+		: m_Futures(_futures),
+		  i_Remaining(static_cast<int>(_futures.size()))
+	{}
+
+	void OnComplete(std::size_t _idx)
+	{
+		if (m_Futures[_idx].HasException())
+			m_Promise.TrySetException(*m_Futures[_idx].Error());
+
+		if (i_Remaining.FetchSub(1, MemoryOrderAcqRel) == 1 && !m_Promise.IsSatisfied())
+		{
+			std::vector<T> vValues;
+			vValues.reserve(m_Futures.size());
+			for (std::size_t i = 0; i < m_Futures.size(); ++i)
+			{
+				vValues.push_back(m_Futures[i].Get());
+			}
+			m_Promise.TrySetValue(vValues);
+		}
+	}
+
+	std::vector< Future<T> > m_Futures;
+	Atomic<int> i_Remaining;
+	Promise< std::vector<T> > m_Promise;
+};
+
+/** @brief Aggregation state of WhenAny()
+ */
+template <typename T>
+class WhenAnyState : public CxxAbb::AtomicRefCounted
+{
+public:
+	void OnComplete(std::size_t _idx)
+	{
+		m_Promise.TrySetValue(_idx);
+	}
+
+	Promise<std::size_t> m_Promise;
+};
+
+/** @brief Continuation which reports completion of an input future to an aggregator
+ */
+template <class Aggregator>
+class AggregateContinuation : public FutureContinuation
+{
+public:
+	AggregateContinuation(Aggregator * _pAggregator, std::size_t _idx)
+		: FutureContinuation(InlineExecutor::Instance()),
+		  ptr_Aggregator(_pAggregator, true),
+		  t_Index(_idx)
+	{}
+
+	void Run()
+	{
+		ptr_Aggregator->OnComplete(t_Index);
+	}
+
+private:
+	CxxAbb::AutoPtr<Aggregator> ptr_Aggregator;
+	std::size_t t_Index;
+};
+
+/** @brief Future of all values, ready when every input is ready
+ *  Fails with the first exception of any input. Empty input gives an empty vector.
+ */
+template <typename T>
+Future< std::vector<T> > WhenAll(const std::vector< Future<T> > & _futures)
+{
+	CxxAbb::AutoPtr< WhenAllState<T> > ptrState(new WhenAllState<T>(_futures));
+	Future< std::vector<T> > mResult = ptrState->m_Promise.GetFuture();
+
+	if (_futures.empty())
+	{
+		ptrState->m_Promise.SetValue(std::vector<T>());
+		return mResult;
+	}
+
+	for (std::size_t i = 0; i < _futures.size(); ++i)
+	{
+		_futures[i].AddContinuation(
+			new AggregateContinuation< WhenAllState<T> >(ptrState.get(), i));
+	}
+
+	return mResult;
+}
+
+/** @brief Future of the index of the first input which becomes ready (value or exception)
+ *  Throws InvalidArgumentException for empty input.
+ */
+template <typename T>
+Future<std::size_t> WhenAny(const std::vector< Future<T> > & _futures)
+{
+	if (_futures.empty())
+		throw CxxAbb::InvalidArgumentException("WhenAny: no futures given");
+
+	CxxAbb::AutoPtr< WhenAnyState<T> > ptrState(new WhenAnyState<T>);
+	Future<std::size_t> mResult = ptrState->m_Promise.GetFuture();
+
+	for (std::size_t i = 0; i < _futures.size(); ++i)
+	{
+		_futures[i].AddContinuation(
+			new AggregateContinuation< WhenAnyState<T> >(ptrState.get(), i));
+	}
+
+	return mResult;
+}
+
+/** @brief Future which is already satisfied with the value
+ */
+template <typename T>
+Future<T> MakeReadyFuture(const T & _value)
+{
+	Promise<T> mPromise;
+	mPromise.SetValue(_value);
+	return mPromise.GetFuture();
+}
+
+/** @brief Future which is already failed with the exception
+ */
+template <typename T>
+Future<T> MakeExceptionalFuture(const CxxAbb::Exception & _ex)
+{
+	Promise<T> mPromise;
+	mPromise.SetException(_ex);
+	return mPromise.GetFuture();
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FUTURE_H_ */
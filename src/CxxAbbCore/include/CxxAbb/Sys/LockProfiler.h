@@ -0,0 +1,194 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LockProfiler.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Lock contention profiling of named mutexes
+ *
+ */
+
+#ifndef CXXABB_CORE_LOCKPROFILER_H_
+#define CXXABB_CORE_LOCKPROFILER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/SpinLock.h>
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Snapshot of a LockProfile, see LockProfiler::Snapshot()
+ *
+ * Histogram bucket i counts durations in [2^i, 2^(i+1)) nanoseconds,
+ * bucket 0 also holds zero and the last bucket is open ended.
+ */
+struct CXXABB_API LockStats
+{
+	enum
+	{
+		Buckets = 40
+	};
+
+	struct Site
+	{
+		std::string s_File;
+		std::string s_Line;
+		std::string s_Func;
+		UInt64 ui_Acquisitions;
+		UInt64 ui_Contended;
+		UInt64 ui_WaitNs;
+	};
+
+	std::string s_Name;
+	UInt64 ui_Locks;               /// number of locks sharing the name
+	UInt64 ui_Acquisitions;
+	UInt64 ui_Contended;           /// acquisitions that had to wait
+	UInt64 ui_WaitNs;              /// total wait time of contended acquisitions
+	UInt64 ui_HoldNs;              /// total hold time
+	UInt64 ui_WaitHistogram[Buckets];
+	UInt64 ui_HoldHistogram[Buckets];
+	std::vector<Site> lst_Sites;    /// call sites, most wait time first
+
+	/** @brief Approximate percentile (upper bucket bound in ns), _dPercent in [0, 100] */
+	static UInt64 Percentile(const UInt64 (&_histogram)[Buckets], double _dPercent);
+};
+
+/** @brief Live counters of all locks sharing a name (internal to Mutex / FastMutex)
+ *
+ * Updated with relaxed atomic increments by lock holders and waiters.
+ * Profiles are owned by LockProfiler and live until exit.
+ */
+class CXXABB_API LockProfile : private NonCopyable
+{
+public:
+	enum
+	{
+		MaxSites = 32
+	};
+
+	explicit LockProfile(const std::string & _sName);
+
+	const std::string & Name() const
+	{
+		return s_Name;
+	}
+
+	void AddLock()
+	{
+		ui_Locks.FetchAdd(1, MemoryOrderRelaxed);
+	}
+
+	void Acquired(UInt64 _uiWaitNs, bool _bContended, const SourceLineInfo * _pWhere);
+
+	void Released(UInt64 _uiHoldNs);
+
+	void Reset();
+
+	void Snapshot(LockStats & _stats) const;
+
+private:
+	/// Sites are appended under m_SiteLock and published by ui_Sites, lookups are lock free.
+	/// CXXABB_SOURCEINFO strings are literals, so sites compare by pointer.
+	struct Site
+	{
+		const char * z_File;
+		const char * z_Line;
+		const char * z_Func;
+		Atomic<UInt64> ui_Acquisitions;
+		Atomic<UInt64> ui_Contended;
+		Atomic<UInt64> ui_WaitNs;
+	};
+
+	Site * FindSite(const SourceLineInfo & _where);
+
+	static unsigned int Bucket(UInt64 _uiNs);
+
+	std::string s_Name;
+	Atomic<UInt64> ui_Locks;
+	Atomic<UInt64> ui_Acquisitions;
+	Atomic<UInt64> ui_Contended;
+	Atomic<UInt64> ui_WaitNs;
+	Atomic<UInt64> ui_HoldNs;
+	Atomic<UInt64> ui_WaitHistogram[LockStats::Buckets];
+	Atomic<UInt64> ui_HoldHistogram[LockStats::Buckets];
+	Site a_Sites[MaxSites];
+	Atomic<unsigned int> ui_Sites;
+	SpinLock m_SiteLock;
+};
+
+/** @brief Opt-in lock contention profiler
+ *
+ * Only named locks are profiled (Mutex(name), FastMutex(name)); all locks with the
+ * same name share one profile. Profiling starts with Enable(); while disabled a named
+ * lock pays one relaxed load per Lock(). Define CXXABB_NO_LOCK_PROFILING when building
+ * the library to compile the instrumentation out.
+ *
+ * Call sites are recorded when locking with a SourceLineInfo:
+ * @code
+ * CxxAbb::Sys::FastMutex m_Mutex("Cache.Index");
+ * ...
+ * CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex, CXXABB_SOURCEINFO);
+ * ...
+ * CxxAbb::Sys::LockProfiler::Dump(std::cerr);
+ * @endcode
+ */
+class CXXABB_API LockProfiler
+{
+public:
+	static void Enable(bool _bEnable = true);
+
+	static bool IsEnabled()
+	{
+		return AtomicLoad(&i_Enabled, MemoryOrderRelaxed) != 0;
+	}
+
+	/** @brief Profile of locks named _sName, created on first use */
+	static LockProfile * Register(const std::string & _sName);
+
+	/** @brief Statistics of all profiles, most total wait time first */
+	static void Snapshot(std::vector<LockStats> & _stats);
+
+	/** @brief Write a human readable report, _tTopSites call sites per lock */
+	static void Dump(std::ostream & _os, std::size_t _tTopSites = 5);
+
+	/** @brief Clear counters of all profiles */
+	static void Reset();
+
+	/** @brief Monotonic clock in nanoseconds */
+	static UInt64 Now();
+
+private:
+	static volatile int i_Enabled;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_LOCKPROFILER_H_ */
@@ -0,0 +1,446 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LruCache.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Sys
+ * Comment     : Sharded LRU cache with per entry expiry
+ *
+ */
+
+
+#ifndef CXXABB_CORE_LRUCACHE_H_
+#define CXXABB_CORE_LRUCACHE_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/FlatHashMap.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/Timestamp.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Sys/StripedCounter.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Point in time counters of a LruCache, summed over its shards */
+struct LruCacheStats
+{
+	UInt64 ui_Hits;
+	UInt64 ui_Misses;
+	UInt64 ui_Evictions;   /// entries dropped to make room
+	UInt64 ui_Expirations; /// entries dropped because their time to live was over
+	std::size_t t_Size;
+	std::size_t t_Cost;
+};
+
+/** @brief Bounded cache shared by many threads, least recently used entries go first
+ *
+ * Keys are spread over power of two many shards by the top bits of their hash.
+ * Each shard is a FlatHashMap index into an intrusive doubly linked recency
+ * list behind its own SpinLock, so a hit, an insert and an eviction are all O(1)
+ * and threads working on different shards do not meet. Recency is per shard:
+ * the evicted entry is the oldest of its shard, not necessarily of the cache.
+ *
+ * Every entry has a cost (1 unless given) and each shard holds at most its part
+ * of the capacity in cost. An entry may also have a time to live; expiry is
+ * checked against Timestamp::MonotonicCoarse() when the entry is looked up or evicted,
+ * PurgeExpired() drops all expired entries at once.
+ *
+ * Values are handed out as ValuePtr copies with an atomic count, they stay valid
+ * after the entry is evicted and may be dropped on any thread. Dropped values are released after the shard lock is given up.
+ *
+ * @code
+ * CxxAbb::Sys::LruCache<std::string, Page> pages(10000, 30 * CxxAbb::Timestamp::Resolution());
+ * CxxAbb::Sys::LruCache<std::string, Page>::ValuePtr page;
+ * if (!pages.Find(sUrl, page))
+ * {
+ *     page.assign(Render(sUrl));
+ *     pages.Insert(sUrl, page);
+ * }
+ * @endcode
+ */
+template <typename K, typename V, typename H = Hash<K>, typename E = EqualTo<K> >
+class LruCache : private NonCopyable
+{
+public:
+	typedef SmartPtr<V, DeleteDestroyPolicy<V>, AtomicExternalRefCounter<V, DeleteDestroyPolicy<V> > > ValuePtr;
+
+	/** @brief Cache holding up to _tCapacity cost
+	 *
+	 * @param _tTimeToLive default time to live in microseconds, 0 never expires
+	 * @param _uiShards rounded up to a power of two, 0 takes one per Stripes::Count()
+	 *        but keeps at least 64 capacity in each shard
+	 */
+	explicit LruCache(std::size_t _tCapacity, Timestamp::TimeDiff _tTimeToLive = 0, unsigned int _uiShards = 0,
+			const H & _hash = H(), const E & _equal = E())
+		: p_Shards(NullPtr),
+		  ui_ShardBits(0),
+		  t_TimeToLive(_tTimeToLive),
+		  m_Hash(_hash)
+	{
+		unsigned int uiWanted = _uiShards;
+		if (!uiWanted)
+		{
+			uiWanted = Stripes::Count();
+			while (uiWanted > 1 && _tCapacity / uiWanted < MinShardCapacity)
+				uiWanted /= 2;
+		}
+		while ((1U << ui_ShardBits) < uiWanted)
+			++ui_ShardBits;
+
+		p_Shards = new CachePadded<Shard>[1U << ui_ShardBits];
+		std::size_t tShardCapacity = (_tCapacity + ShardCount() - 1) >> ui_ShardBits;
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			p_Shards[i]->t_Capacity = tShardCapacity;
+			Index(NullPtr, m_Hash, _equal).Swap(p_Shards[i]->m_Index);
+		}
+	}
+
+	~LruCache()
+	{
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+			Release(p_Shards[i]->p_Newest);
+		delete [] p_Shards;
+	}
+
+	unsigned int ShardCount() const
+	{
+		return 1U << ui_ShardBits;
+	}
+
+	/** @brief Copies the value of _key into _value and marks it most recently used
+	 *
+	 * An expired entry is dropped and counts as a miss. _value is left alone on a miss.
+	 */
+	template <typename Q>
+	bool Find(const Q & _key, ValuePtr & _value)
+	{
+		Shard & shard = ShardFor(_key);
+		Node * pDead = NullPtr;
+		{
+			SpinLock::ScopedLock lock(shard.m_Lock);
+			typename Index::Iterator it = shard.m_Index.Find(_key);
+			if (it == shard.m_Index.end())
+			{
+				++shard.ui_Misses;
+				return false;
+			}
+
+			Node * pNode = it->second;
+			if (pNode->t_Expiry == 0 || pNode->t_Expiry > Now())
+			{
+				shard.MoveToFront(pNode);
+				++shard.ui_Hits;
+				_value = pNode->m_Value;
+				return true;
+			}
+
+			shard.m_Index.Erase(it);
+			shard.Unlink(pNode);
+			++shard.ui_Expirations;
+			++shard.ui_Misses;
+			pDead = pNode;
+		}
+		Release(pDead);
+		return false;
+	}
+
+	/** @brief Inserts or replaces the entry of _key with the default time to live */
+	bool Insert(const K & _key, const ValuePtr & _value)
+	{
+		return Insert(_key, _value, 1, t_TimeToLive);
+	}
+
+	/** @brief Inserts or replaces the entry of _key as the most recently used
+	 *
+	 * Least recently used entries of the shard are evicted until the cost fits.
+	 * @param _tTimeToLive microseconds, 0 never expires
+	 * @return false, and nothing is stored, if _tCost alone is over the shard capacity
+	 */
+	bool Insert(const K & _key, const ValuePtr & _value, std::size_t _tCost, Timestamp::TimeDiff _tTimeToLive)
+	{
+		Shard & shard = ShardFor(_key);
+		if (_tCost > shard.t_Capacity)
+			return false;
+
+		Timestamp::TimeVal tExpiry = _tTimeToLive > 0 ? Now() + _tTimeToLive : 0;
+		Node * pNode = new Node(_key, _value, tExpiry, _tCost);
+		Node * pDead = NullPtr;
+		{
+			SpinLock::ScopedLock lock(shard.m_Lock);
+			std::pair<typename Index::Iterator, bool> inserted;
+			try
+			{
+				inserted = shard.m_Index.Insert(_key, pNode);
+			}
+			catch (...)
+			{
+				delete pNode;
+				throw;
+			}
+			if (!inserted.second)
+			{
+				pDead = inserted.first->second;
+				shard.Unlink(pDead);
+				inserted.first->second = pNode;
+			}
+			shard.PushFront(pNode);
+
+			while (shard.t_Cost > shard.t_Capacity)
+			{
+				Node * pOldest = shard.p_Oldest;
+				shard.m_Index.Erase(pOldest->m_Key);
+				shard.Unlink(pOldest);
+				if (pOldest->t_Expiry != 0 && pOldest->t_Expiry <= Now())
+					++shard.ui_Expirations;
+				else
+					++shard.ui_Evictions;
+				pOldest->p_Next = pDead;
+				pDead = pOldest;
+			}
+		}
+		Release(pDead);
+		return true;
+	}
+
+	template <typename Q>
+	bool Erase(const Q & _key)
+	{
+		Shard & shard = ShardFor(_key);
+		Node * pNode = NullPtr;
+		{
+			SpinLock::ScopedLock lock(shard.m_Lock);
+			typename Index::Iterator it = shard.m_Index.Find(_key);
+			if (it == shard.m_Index.end())
+				return false;
+			pNode = it->second;
+			shard.m_Index.Erase(it);
+			shard.Unlink(pNode);
+		}
+		Release(pNode);
+		return true;
+	}
+
+	/** @brief Drops every expired entry, a walk over the whole cache
+	 * @return number of entries dropped
+	 */
+	std::size_t PurgeExpired()
+	{
+		std::size_t tPurged = 0;
+		Timestamp::TimeVal tNow = Now();
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			Shard & shard = *p_Shards[i];
+			Node * pDead = NullPtr;
+			{
+				SpinLock::ScopedLock lock(shard.m_Lock);
+				Node * pNode = shard.p_Newest;
+				while (pNode)
+				{
+					Node * pNext = pNode->p_Next;
+					if (pNode->t_Expiry != 0 && pNode->t_Expiry <= tNow)
+					{
+						shard.m_Index.Erase(pNode->m_Key);
+						shard.Unlink(pNode);
+						++shard.ui_Expirations;
+						pNode->p_Next = pDead;
+						pDead = pNode;
+						++tPurged;
+					}
+					pNode = pNext;
+				}
+			}
+			Release(pDead);
+		}
+		return tPurged;
+	}
+
+	void Clear()
+	{
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			Shard & shard = *p_Shards[i];
+			Node * pDead = NullPtr;
+			{
+				SpinLock::ScopedLock lock(shard.m_Lock);
+				pDead = shard.p_Newest;
+				shard.p_Newest = NullPtr;
+				shard.p_Oldest = NullPtr;
+				shard.t_Cost = 0;
+				shard.m_Index.Clear();
+			}
+			Release(pDead);
+		}
+	}
+
+	/** @brief Entries, expired ones not yet dropped included */
+	std::size_t Size() const
+	{
+		std::size_t tSize = 0;
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			SpinLock::ScopedLock lock(p_Shards[i]->m_Lock);
+			tSize += p_Shards[i]->m_Index.Size();
+		}
+		return tSize;
+	}
+
+	/** @brief Counters since construction, each shard read at a different moment */
+	LruCacheStats Stats() const
+	{
+		LruCacheStats stats = LruCacheStats();
+		for (unsigned int i = 0; i < ShardCount(); ++i)
+		{
+			const Shard & shard = *p_Shards[i];
+			SpinLock::ScopedLock lock(shard.m_Lock);
+			stats.ui_Hits += shard.ui_Hits;
+			stats.ui_Misses += shard.ui_Misses;
+			stats.ui_Evictions += shard.ui_Evictions;
+			stats.ui_Expirations += shard.ui_Expirations;
+			stats.t_Size += shard.m_Index.Size();
+			stats.t_Cost += shard.t_Cost;
+		}
+		return stats;
+	}
+
+private:
+	static const std::size_t MinShardCapacity = 64;
+
+	struct Node
+	{
+		Node(const K & _key, const ValuePtr & _value, Timestamp::TimeVal _tExpiry, std::size_t _tCost)
+			: m_Key(_key),
+			  m_Value(_value),
+			  t_Expiry(_tExpiry),
+			  t_Cost(_tCost),
+			  p_Prev(NullPtr),
+			  p_Next(NullPtr)
+		{}
+
+		K m_Key;
+		ValuePtr m_Value;
+		Timestamp::TimeVal t_Expiry;  /// 0 never expires
+		std::size_t t_Cost;
+		Node * p_Prev;  /// more recently used
+		Node * p_Next;  /// less recently used
+	};
+
+	typedef FlatHashMap<K, Node*, H, E> Index;
+
+	struct Shard
+	{
+		Shard()
+			: p_Newest(NullPtr),
+			  p_Oldest(NullPtr),
+			  t_Cost(0),
+			  t_Capacity(0),
+			  ui_Hits(0),
+			  ui_Misses(0),
+			  ui_Evictions(0),
+			  ui_Expirations(0)
+		{}
+
+		void PushFront(Node * _pNode)
+		{
+			_pNode->p_Next = p_Newest;
+			if (p_Newest)
+				p_Newest->p_Prev = _pNode;
+			else
+				p_Oldest = _pNode;
+			p_Newest = _pNode;
+			t_Cost += _pNode->t_Cost;
+		}
+
+		void Unlink(Node * _pNode)
+		{
+			if (_pNode->p_Prev)
+				_pNode->p_Prev->p_Next = _pNode->p_Next;
+			else
+				p_Newest = _pNode->p_Next;
+			if (_pNode->p_Next)
+				_pNode->p_Next->p_Prev = _pNode->p_Prev;
+			else
+				p_Oldest = _pNode->p_Prev;
+			_pNode->p_Prev = NullPtr;
+			_pNode->p_Next = NullPtr;
+			t_Cost -= _pNode->t_Cost;
+		}
+
+		void MoveToFront(Node * _pNode)
+		{
+			if (_pNode != p_Newest)
+			{
+				Unlink(_pNode);
+				PushFront(_pNode);
+			}
+		}
+
+		mutable SpinLock m_Lock;
+		Index m_Index;
+		Node * p_Newest;
+		Node * p_Oldest;
+		std::size_t t_Cost;
+		std::size_t t_Capacity;
+		UInt64 ui_Hits;
+		UInt64 ui_Misses;
+		UInt64 ui_Evictions;
+		UInt64 ui_Expirations;
+	};
+
+	static Timestamp::TimeVal Now()
+	{
+		return Timestamp::MonotonicCoarse();
+	}
+
+	/// Deletes a chain of unlinked nodes, outside the shard lock
+	static void Release(Node * _pNode)
+	{
+		while (_pNode)
+		{
+			Node * pNext = _pNode->p_Next;
+			delete _pNode;
+			_pNode = pNext;
+		}
+	}
+
+	/// Top bits pick the shard, FlatHashMap probes with the low ones
+	template <typename Q>
+	Shard & ShardFor(const Q & _key) const
+	{
+		return ui_ShardBits ? *p_Shards[m_Hash(_key) >> (64 - ui_ShardBits)] : *p_Shards[0];
+	}
+
+	CachePadded<Shard> * p_Shards;
+	unsigned int ui_ShardBits;
+	Timestamp::TimeDiff t_TimeToLive;
+	H m_Hash;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_LRUCACHE_H_ */
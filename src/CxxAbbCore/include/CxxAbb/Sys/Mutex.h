@@ -32,6 +32,8 @@
 #include <CxxAbb/NonCopyable.h>
 #include "MutexImpl.h"
 
+#include <string>
+
 namespace CxxAbb
 {
 namespace Sys
@@ -48,15 +50,29 @@ public:
 	typedef CxxAbb::Sys::ScopedLock<Mutex> ScopedLock;
 
 	Mutex(); // Throws SystemException if Initialization failed
+
+	/** @brief Named lock, profiled while LockProfiler is enabled */
+	explicit Mutex(const std::string & _sName);
+
 	~Mutex();
 
 	void Lock();
+
+	/** @brief Lock and record _where as call site for LockProfiler */
+	void Lock(const SourceLineInfo & _where);
+
 	bool TryLock();
 	bool TryLock(long _lMiliSeconds);
 	void Unlock();
 	void UnlockNoThrow();
 
 private:
+	void ProfiledLock(const SourceLineInfo * _pWhere);
+	void ProfiledAcquired(UInt64 _uiStart, bool _bContended, const SourceLineInfo * _pWhere);
+	void ProfiledUnlock();
+
+	LockProfile * p_Profile;
+	UInt64 ui_Acquired;
 };
 
 
@@ -70,13 +86,30 @@ public:
 	typedef CxxAbb::Sys::ScopedLock<FastMutex> ScopedLock;
 
 	FastMutex();
+
+	/** @brief Named lock, profiled while LockProfiler is enabled */
+	explicit FastMutex(const std::string & _sName);
+
 	~FastMutex();
 
 	void Lock();
+
+	/** @brief Lock and record _where as call site for LockProfiler */
+	void Lock(const SourceLineInfo & _where);
+
 	bool TryLock();
 	bool TryLock(long _lMiliSeconds);
 	void Unlock();
 	void UnlockNoThrow();
+
+private:
+	void ProfiledLock(const SourceLineInfo * _pWhere);
+	void ProfiledAcquired(UInt64 _uiStart, bool _bContended, const SourceLineInfo * _pWhere);
+	void ProfiledUnlock();
+
+	LockProfile * p_Profile;
+	UInt64 ui_Acquired;
+	int i_Depth;   /// recursion depth, hold time is measured at the outermost level
 };
 
 
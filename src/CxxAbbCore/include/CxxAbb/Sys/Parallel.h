@@ -0,0 +1,405 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Parallel.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Data parallel algorithms over index and Buffer ranges
+ *
+ */
+
+#ifndef CXXABB_CORE_PARALLEL_H_
+#define CXXABB_CORE_PARALLEL_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/Buffer.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Sys/ThreadPool.h>
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Shared state of the tasks of one parallel algorithm call (internal)
+ *
+ * Counts outstanding tasks and keeps the first exception.
+ * Join() helps running queued tasks, so nested parallel calls from pool threads do not starve the pool.
+ */
+class CXXABB_API ParallelJob : private CxxAbb::NonCopyable
+{
+public:
+	explicit ParallelJob(ThreadPool & _pool);
+	~ParallelJob();
+
+	/** @brief Hand over a task which calls Done() at the end
+	 */
+	void Spawn(CxxAbb::Runnable * _pTask);
+
+	void Done();
+
+	/** @brief Record current exception (call inside a catch block)
+	 */
+	void Fail();
+
+	bool Failed() const
+	{
+		return i_Failed.Load(MemoryOrderRelaxed) != 0;
+	}
+
+	/** @brief Split only while there are workers without queued work
+	 */
+	bool ShouldSplit() const
+	{
+		return p_Pool->QueueDepth() < p_Pool->ThreadCount();
+	}
+
+	/** @brief Wait for all spawned tasks, rethrow the first exception
+	 *
+	 * Call once. Returns only after the last task has finished touching the job,
+	 * so the job may be destroyed right after.
+	 */
+	void Join();
+
+	/** @brief Grain for a range of given length, 0 means automatic
+	 */
+	std::size_t Grain(std::size_t _tLength, std::size_t _tGrain) const;
+
+private:
+	ThreadPool * p_Pool;
+	Atomic<long> l_Pending;
+	Atomic<int> i_Failed;
+	CxxAbb::Exception * p_Error;
+	SigEvent m_Done;
+};
+
+/** @brief Recursive range splitting task of ParallelFor (internal)
+ *
+ * Halves the range and hands the upper half to the pool while it is larger than the grain
+ * and idle workers exist, then runs the body on what is left. Splitting adapts to load:
+ * with busy workers ranges are not split further.
+ */
+template <class Body>
+class ParallelRangeTask : public CxxAbb::Runnable
+{
+public:
+	ParallelRangeTask(ParallelJob & _job, const Body & _body, std::size_t _tBegin, std::size_t _tEnd, std::size_t _tGrain)
+		: p_Job(&_job), p_Body(&_body), t_Begin(_tBegin), t_End(_tEnd), t_Grain(_tGrain)
+	{}
+
+	void Run()
+	{
+		Execute(*p_Job, *p_Body, t_Begin, t_End, t_Grain);
+		p_Job->Done();
+	}
+
+	static void Execute(ParallelJob & _job, const Body & _body, std::size_t _tBegin, std::size_t _tEnd, std::size_t _tGrain)
+	{
+		try
+		{
+			while (_tEnd - _tBegin > _tGrain && _job.ShouldSplit())
+			{
+				std::size_t tMid = _tBegin + (_tEnd - _tBegin) / 2;
+				_job.Spawn(new ParallelRangeTask(_job, _body, tMid, _tEnd, _tGrain));
+				_tEnd = tMid;
+			}
+
+			if (!_job.Failed())
+				_body(_tBegin, _tEnd);
+		}
+		catch(...)
+		{
+			_job.Fail();
+		}
+	}
+
+private:
+	ParallelJob * p_Job;
+	const Body * p_Body;
+	std::size_t t_Begin;
+	std::size_t t_End;
+	std::size_t t_Grain;
+};
+
+/** @brief Adapts a pointer range body to an index range body (internal)
+ */
+template <typename T, class Body>
+class ParallelPointerBody
+{
+public:
+	ParallelPointerBody(T * _pBase, const Body & _body)
+		: p_Base(_pBase), p_Body(&_body)
+	{}
+
+	void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		(*p_Body)(p_Base + _tBegin, p_Base + _tEnd);
+	}
+
+private:
+	T * p_Base;
+	const Body * p_Body;
+};
+
+/** @brief Collects partial results of ParallelReduce keyed by range start (internal)
+ */
+template <typename R, class Map>
+class ParallelReduceBody
+{
+public:
+	typedef std::vector< std::pair<std::size_t, R> > Partials;
+
+	explicit ParallelReduceBody(const Map & _map)
+		: p_Map(&_map)
+	{}
+
+	void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		R mPartial = (*p_Map)(_tBegin, _tEnd);
+		SpinLock::ScopedLock lock(m_Lock);
+		m_Partials.push_back(std::make_pair(_tBegin, mPartial));
+	}
+
+	template <class Combine>
+	R Fold(const R & _identity, const Combine & _combine)
+	{
+		// in range order, combine need to be associative only
+		std::sort(m_Partials.begin(), m_Partials.end(), FirstLess());
+		R mResult = _identity;
+		for (typename Partials::const_iterator it = m_Partials.begin(); it != m_Partials.end(); ++it)
+		{
+			mResult = _combine(mResult, it->second);
+		}
+		return mResult;
+	}
+
+private:
+	struct FirstLess
+	{
+		bool operator()(const std::pair<std::size_t, R> & _a, const std::pair<std::size_t, R> & _b) const
+		{
+			return _a.first < _b.first;
+		}
+	};
+
+	const Map * p_Map;
+	mutable SpinLock m_Lock;
+	mutable Partials m_Partials;
+};
+
+/** @brief Index range to pointer range adapter of the Buffer overload of ParallelReduce (internal)
+ */
+template <typename T, class Map>
+class ParallelPointerMap
+{
+public:
+	ParallelPointerMap(const T * _pBase, const Map & _map)
+		: p_Base(_pBase), p_Map(&_map)
+	{}
+
+	typename Map::result_type operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		return (*p_Map)(p_Base + _tBegin, p_Base + _tEnd);
+	}
+
+private:
+	const T * p_Base;
+	const Map * p_Map;
+};
+
+/** @brief Sorts chunks and merges neighbours for ParallelSort (internal)
+ */
+template <typename T, class Compare>
+class ParallelSortBody
+{
+public:
+	ParallelSortBody(const std::vector<T*> & _bounds, std::size_t _tWidth, const Compare & _cmp)
+		: p_Bounds(&_bounds), t_Width(_tWidth), p_Cmp(&_cmp)
+	{}
+
+	/// Width 0 sorts chunk i, otherwise merges the pair of runs starting at i * 2 * width
+	void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		const std::vector<T*> & bounds = *p_Bounds;
+		for (std::size_t i = _tBegin; i < _tEnd; ++i)
+		{
+			if (t_Width == 0)
+			{
+				std::sort(bounds[i], bounds[i + 1], *p_Cmp);
+			}
+			else
+			{
+				std::size_t tFirst = i * 2 * t_Width;
+				std::inplace_merge(bounds[tFirst], bounds[tFirst + t_Width], bounds[tFirst + 2 * t_Width], *p_Cmp);
+			}
+		}
+	}
+
+private:
+	const std::vector<T*> * p_Bounds;
+	std::size_t t_Width;
+	const Compare * p_Cmp;
+};
+
+/** @brief Call _body(begin, end) on sub ranges of [_tBegin, _tEnd) in parallel
+ *
+ * Ranges are split adaptively down to _tGrain indices. Calling thread takes part.
+ * First exception thrown by the body is rethrown after all started sub ranges finished,
+ * sub ranges not yet started are skipped.
+ *
+ * @param _body function object with void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+ * @param _tGrain smallest range worth a task, 0 picks one from range length and pool size
+ *
+ * @code
+ * struct Square { void operator()(std::size_t b, std::size_t e) const { for (; b < e; ++b) v[b] *= v[b]; } ... };
+ * CxxAbb::Sys::ParallelFor(0, v.size(), Square(v));
+ * @endcode
+ */
+template <class Body>
+void ParallelFor(std::size_t _tBegin, std::size_t _tEnd, const Body & _body,
+		std::size_t _tGrain = 0, ThreadPool & _pool = ThreadPool::Default())
+{
+	if (_tEnd <= _tBegin)
+		return;
+
+	ParallelJob job(_pool);
+	ParallelRangeTask<Body>::Execute(job, _body, _tBegin, _tEnd, job.Grain(_tEnd - _tBegin, _tGrain));
+	job.Join();
+}
+
+/** @brief Call _body(T* begin, T* end) on sub ranges of the buffer content in parallel
+ */
+template <typename T, class Body>
+void ParallelFor(CxxAbb::Buffer<T> & _buffer, const Body & _body,
+		std::size_t _tGrain = 0, ThreadPool & _pool = ThreadPool::Default())
+{
+	ParallelFor(0, _buffer.size(), ParallelPointerBody<T, Body>(_buffer.begin(), _body), _tGrain, _pool);
+}
+
+/** @brief Reduce [_tBegin, _tEnd) in parallel
+ *
+ * Each sub range is mapped to a partial result, partials are combined in range order,
+ * starting with _identity. So _combine need to be associative, but not commutative.
+ *
+ * @param _map function object with R operator()(std::size_t _tBegin, std::size_t _tEnd) const
+ * @param _combine function object with R operator()(const R &, const R &) const
+ */
+template <typename R, class Map, class Combine>
+R ParallelReduce(std::size_t _tBegin, std::size_t _tEnd, const R & _identity, const Map & _map, const Combine & _combine,
+		std::size_t _tGrain = 0, ThreadPool & _pool = ThreadPool::Default())
+{
+	ParallelReduceBody<R, Map> body(_map);
+	ParallelFor(_tBegin, _tEnd, body, _tGrain, _pool);
+	return body.Fold(_identity, _combine);
+}
+
+/** @brief Reduce buffer content in parallel
+ *  @param _map function object with result_type operator()(const T * _pBegin, const T * _pEnd) const
+ */
+template <typename T, class Map, class Combine>
+typename Map::result_type ParallelReduce(const CxxAbb::Buffer<T> & _buffer, const typename Map::result_type & _identity,
+		const Map & _map, const Combine & _combine, std::size_t _tGrain = 0, ThreadPool & _pool = ThreadPool::Default())
+{
+	return ParallelReduce(0, _buffer.size(), _identity, ParallelPointerMap<T, Map>(_buffer.begin(), _map),
+			_combine, _tGrain, _pool);
+}
+
+/** @brief Sort [_pBegin, _pEnd) in parallel, not stable
+ *
+ * Range is cut in a power of two number of chunks of at least _tGrain elements,
+ * chunks are sorted in parallel and merged pairwise in parallel rounds.
+ */
+template <typename T, class Compare>
+void ParallelSort(T * _pBegin, T * _pEnd, const Compare & _cmp,
+		std::size_t _tGrain = 0, ThreadPool & _pool = ThreadPool::Default())
+{
+	std::size_t tLength = static_cast<std::size_t>(_pEnd - _pBegin);
+	std::size_t tThreads = _pool.ThreadCount() + 1;
+	if (_tGrain == 0)
+		_tGrain = std::max(static_cast<std::size_t>(4096), tLength / (tThreads * 4));
+
+	std::size_t tChunks = 1;
+	while (tChunks < tThreads * 2 && tLength / (tChunks * 2) >= _tGrain)
+	{
+		tChunks *= 2;
+	}
+
+	if (tChunks == 1)
+	{
+		std::sort(_pBegin, _pEnd, _cmp);
+		return;
+	}
+
+	std::vector<T*> vBounds(tChunks + 1);
+	for (std::size_t i = 0; i <= tChunks; ++i)
+	{
+		vBounds[i] = _pBegin + tLength / tChunks * i;
+	}
+	vBounds[tChunks] = _pEnd;
+
+	ParallelFor(0, tChunks, ParallelSortBody<T, Compare>(vBounds, 0, _cmp), 1, _pool);
+	for (std::size_t tWidth = 1; tWidth < tChunks; tWidth *= 2)
+	{
+		ParallelFor(0, tChunks / (2 * tWidth), ParallelSortBody<T, Compare>(vBounds, tWidth, _cmp), 1, _pool);
+	}
+}
+
+/** @brief Sort [_pBegin, _pEnd) in parallel in ascending order
+ */
+template <typename T>
+void ParallelSort(T * _pBegin, T * _pEnd)
+{
+	ParallelSort(_pBegin, _pEnd, std::less<T>());
+}
+
+/** @brief Sort buffer content in parallel
+ */
+template <typename T, class Compare>
+void ParallelSort(CxxAbb::Buffer<T> & _buffer, const Compare & _cmp,
+		std::size_t _tGrain = 0, ThreadPool & _pool = ThreadPool::Default())
+{
+	ParallelSort(_buffer.begin(), _buffer.end(), _cmp, _tGrain, _pool);
+}
+
+/** @brief Sort buffer content in parallel in ascending order
+ */
+template <typename T>
+void ParallelSort(CxxAbb::Buffer<T> & _buffer)
+{
+	ParallelSort(_buffer.begin(), _buffer.end(), std::less<T>());
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_PARALLEL_H_ */
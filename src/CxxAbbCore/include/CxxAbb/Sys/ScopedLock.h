@@ -55,6 +55,12 @@ public:
 		m_Mutex.Lock(_lMilliseconds);
 	}
 
+	/** @brief Lock passing the call site, see LockProfiler */
+	ScopedLock(MutexClass& _mutex, const CxxAbb::SourceLineInfo & _where): m_Mutex(_mutex)
+	{
+		m_Mutex.Lock(_where);
+	}
+
 	~ScopedLock()
 	{
 		m_Mutex.Unlock();
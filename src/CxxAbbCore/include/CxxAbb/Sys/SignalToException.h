@@ -48,6 +48,12 @@ class CXXABB_API  SignalToException
 {
 public:
 	typedef void (*SigHandlerFunc)(int);
+	typedef void (*CrashHandlerFunc)(int);
+
+	enum
+	{
+		MaxCrashHandlers = 8
+	};
 	typedef struct JumpBuffer
 	{
 		sigjmp_buf m_Env;
@@ -62,6 +68,15 @@ public:
 
 	static void ThrowException(int _iSigNum);
 
+	/** @brief Run _handler from SignalHandler() before the signal is turned into an exception
+	 *
+	 * Meant for last moment work such as flushing logs. Handlers run in signal
+	 * context on the faulting thread and must not rely on locks held elsewhere.
+	 * @return false when all MaxCrashHandlers slots are taken
+	 */
+	static bool AddCrashHandler(CrashHandlerFunc _handler);
+	static void RemoveCrashHandler(CrashHandlerFunc _handler);
+
 	sigjmp_buf& CurrentEnv();
 
 protected:
@@ -69,7 +84,10 @@ protected:
 
 	static JumpBufferVec& GetJumpBuffers();
 
+	static void RunCrashHandlers(int _iSigNum);
+
 private:
+	static CrashHandlerFunc volatile a_CrashHandlers[MaxCrashHandlers];
 
 	static JumpBufferVec m_JumpBuffers;
 	friend class CxxAbb::Sys::ThreadImpl;
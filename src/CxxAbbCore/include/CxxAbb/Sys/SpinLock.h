@@ -0,0 +1,190 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SpinLock.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Test-and-test-and-set spin lock for very short critical sections
+ *
+ */
+
+#ifndef CXXABB_CORE_SPINLOCK_H_
+#define CXXABB_CORE_SPINLOCK_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+
+#include <sched.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Busy waiting lock
+ *
+ * Never puts the thread to sleep, only use for a few instructions long critical sections
+ * (e.g. linking a node to a list). Not recursive.
+ */
+class CXXABB_API SpinLock : private CxxAbb::NonCopyable
+{
+public:
+	typedef CxxAbb::Sys::ScopedLock<SpinLock> ScopedLock;
+
+	SpinLock()
+		: i_Locked(0)
+	{}
+
+	void Lock()
+	{
+		unsigned int uiSpins = 0;
+		while (i_Locked.Exchange(1, MemoryOrderAcquire))
+		{
+			// spin on a plain load, do not bounce the cache line with writes
+			while (i_Locked.Load(MemoryOrderRelaxed))
+			{
+				if (++uiSpins < MaxSpins)
+					CpuRelax();
+				else
+					sched_yield();
+			}
+		}
+	}
+
+	bool TryLock()
+	{
+		return i_Locked.Load(MemoryOrderRelaxed) == 0 && i_Locked.Exchange(1, MemoryOrderAcquire) == 0;
+	}
+
+	void Unlock()
+	{
+		i_Locked.Store(0, MemoryOrderRelease);
+	}
+
+private:
+	static const unsigned int MaxSpins = 128;
+
+	Atomic<int> i_Locked;
+};
+
+/** @brief Busy waiting reader-writer lock
+ *
+ * Any number of readers or one writer. A waiting writer keeps new readers out, so
+ * a steady stream of readers can not starve it. Same rules as SpinLock: short
+ * critical sections, not recursive, a reader must not upgrade.
+ */
+class CXXABB_API RWSpinLock : private CxxAbb::NonCopyable
+{
+public:
+	/// Exclusive
+	typedef CxxAbb::Sys::ScopedLock<RWSpinLock> ScopedLock;
+
+	class ScopedReadLock : private CxxAbb::NonCopyable
+	{
+	public:
+		explicit ScopedReadLock(RWSpinLock & _lock)
+			: m_Lock(_lock)
+		{
+			m_Lock.ReadLock();
+		}
+
+		~ScopedReadLock()
+		{
+			m_Lock.ReadUnlock();
+		}
+
+	private:
+		RWSpinLock & m_Lock;
+	};
+
+	RWSpinLock()
+		: ui_State(0)
+	{}
+
+	void Lock()
+	{
+		unsigned int uiSpins = 0;
+		for (;;)
+		{
+			UInt32 uiState = ui_State.Load(MemoryOrderRelaxed);
+			if ((uiState & ~WriterWaiting) == 0)
+			{
+				if (ui_State.CompareExchange(uiState, Writer, MemoryOrderAcquire))
+					return;
+				continue;
+			}
+			if (!(uiState & WriterWaiting))
+				ui_State.FetchOr(WriterWaiting, MemoryOrderRelaxed);
+			Backoff(uiSpins);
+		}
+	}
+
+	void Unlock()
+	{
+		ui_State.FetchAnd(~static_cast<UInt32>(Writer), MemoryOrderRelease);
+	}
+
+	void ReadLock()
+	{
+		unsigned int uiSpins = 0;
+		for (;;)
+		{
+			UInt32 uiState = ui_State.Load(MemoryOrderRelaxed);
+			if (!(uiState & (Writer | WriterWaiting)) &&
+					ui_State.CompareExchange(uiState, uiState + Reader, MemoryOrderAcquire))
+				return;
+			Backoff(uiSpins);
+		}
+	}
+
+	void ReadUnlock()
+	{
+		ui_State.FetchSub(Reader, MemoryOrderRelease);
+	}
+
+private:
+	enum
+	{
+		Writer = 1,
+		WriterWaiting = 2,
+		Reader = 4
+	};
+
+	static const unsigned int MaxSpins = 128;
+
+	static void Backoff(unsigned int & _uiSpins)
+	{
+		if (++_uiSpins < MaxSpins)
+			CpuRelax();
+		else
+			sched_yield();
+	}
+
+	Atomic<UInt32> ui_State;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_SPINLOCK_H_ */
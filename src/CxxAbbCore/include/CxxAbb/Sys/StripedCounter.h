@@ -0,0 +1,136 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * StripedCounter.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Counter striped over per CPU cache lines
+ *
+ */
+
+
+#ifndef CXXABB_CORE_STRIPEDCOUNTER_H_
+#define CXXABB_CORE_STRIPEDCOUNTER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+
+#include <sched.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Stripe selection shared by striped structures
+ *
+ * A structure keeps one cache line sized cell per stripe and a writer updates
+ * the cell of the CPU it runs on, so writers on different CPUs never share a line.
+ * Threads migrating between CPUs may meet on a cell, updates are atomic anyway.
+ */
+class CXXABB_API Stripes
+{
+public:
+	/** @brief Number of stripes, power of two covering the processor count (max 64) */
+	static unsigned int Count();
+
+	/** @brief Stripe hint of the calling thread, callers mask it with Count() - 1 */
+	static unsigned int Current()
+	{
+		int iCpu = ::sched_getcpu();
+		return iCpu >= 0 ? static_cast<unsigned int>(iCpu) : ThreadIndex();
+	}
+
+private:
+	static unsigned int ThreadIndex();
+};
+
+/** @brief Drop-in for a hot shared AtomicCounter (request counts, byte totals)
+ *
+ * Add() is one uncontended relaxed atomic add on the current CPU's cache line
+ * instead of a lock xadd on a line bouncing between all cores. Value() sums the
+ * stripes without stopping writers, so it is exact only once writers are quiet.
+ * Costs CacheLineSize bytes per stripe.
+ */
+class CXXABB_API StripedCounter : private NonCopyable
+{
+public:
+	StripedCounter();
+
+	~StripedCounter();
+
+	void Add(Int64 _iValue)
+	{
+		AtomicFetchAdd(&p_Cells[Stripes::Current() & ui_Mask].i_Value, _iValue, MemoryOrderRelaxed);
+	}
+
+	void Sub(Int64 _iValue)
+	{
+		Add(-_iValue);
+	}
+
+	StripedCounter & operator ++ ()
+	{
+		Add(1);
+		return *this;
+	}
+
+	StripedCounter & operator -- ()
+	{
+		Add(-1);
+		return *this;
+	}
+
+	StripedCounter & operator += (Int64 _iValue)
+	{
+		Add(_iValue);
+		return *this;
+	}
+
+	StripedCounter & operator -= (Int64 _iValue)
+	{
+		Add(-_iValue);
+		return *this;
+	}
+
+	Int64 Value() const;
+
+	/** @brief Zero all stripes, adds racing with Reset() may survive it */
+	void Reset();
+
+private:
+	struct Cell
+	{
+		volatile Int64 i_Value;
+		char a_Pad[CacheLineSize - sizeof(Int64)];
+	};
+
+	Cell * p_Cells;
+	unsigned int ui_Mask;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_STRIPEDCOUNTER_H_ */
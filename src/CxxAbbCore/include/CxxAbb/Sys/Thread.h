@@ -31,6 +31,7 @@
 #include <CxxAbb/Core.h>
 #include <CxxAbb/NonCopyable.h>
 #include <CxxAbb/Runnable.h>
+#include <CxxAbb/SharedString.h>
 #include <CxxAbb/Sys/Mutex.h>
 #include <CxxAbb/Sys/ScopedLock.h>
 #include "ThreadImpl.h"
@@ -70,7 +71,7 @@ public:
 	/** @brief Create thread with a name
 	 *  name will be shown in monitoring tools and used in logging
 	 */
-	Thread(std::string _name);
+	Thread(const std::string & _name);
 
 	virtual ~Thread();
 
@@ -78,9 +79,11 @@ public:
 	 */
 	CxxAbb::UInt32 Tid() const;
 
-	std::string & Name();
+	/** @brief Copy of the current name, cheap and safe against a concurrent rename
+	 */
+	SharedString Name() const;
 
-	void Name(std::string _name);
+	void Name(const std::string & _name);
 
 	Thread::State CurrentState();
 
@@ -110,8 +113,8 @@ private:
 	std::string GenName();
 	void SetName();
 
-	std::string s_Name;
-	CxxAbb::Sys::FastMutex mtx_LocalData;
+	SharedString s_Name;
+	mutable CxxAbb::Sys::FastMutex mtx_LocalData;
 };
 
 }  /* namespace Sys */
@@ -0,0 +1,111 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ThreadPool.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Fixed size pool of worker threads
+ *
+ */
+
+#ifndef CXXABB_CORE_THREADPOOL_H_
+#define CXXABB_CORE_THREADPOOL_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+#include <CxxAbb/Sys/Executor.h>
+#include <CxxAbb/Sys/Mutex.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+/** @brief Fixed number of worker threads executing queued tasks in FIFO order
+ *
+ * Threads are started once and reused, submitting a task is a queue push.
+ * Threads blocked on a join can help with RunPending() instead of idling.
+ */
+class CXXABB_API ThreadPool : public Executor, private CxxAbb::NonCopyable
+{
+public:
+	/** @brief Create and start pool
+	 *  @param _uiThreads number of workers, 0 for Environment::EffectiveProcessorCount()
+	 *  @param _sName thread name prefix
+	 */
+	explicit ThreadPool(unsigned int _uiThreads = 0, const std::string & _sName = "Pool");
+
+	/** @brief Finish queued tasks and join workers
+	 */
+	virtual ~ThreadPool();
+
+	/** @brief Queue task, pool takes ownership and deletes it after Run()
+	 */
+	void Execute(CxxAbb::Runnable * _pTask);
+
+	/** @brief Run one queued task in the calling thread
+	 *  @return false if queue was empty
+	 */
+	bool RunPending();
+
+	unsigned int ThreadCount() const
+	{
+		return static_cast<unsigned int>(lst_Workers.size());
+	}
+
+	/** @brief Number of queued, not yet started tasks. Never blocks, may be stale
+	 */
+	std::size_t QueueDepth() const
+	{
+		return t_Queued->Load(MemoryOrderRelaxed);
+	}
+
+	/** @brief Process wide pool with one worker per processor
+	 */
+	static ThreadPool & Default();
+
+private:
+	class Worker;
+	friend class Worker;
+
+	CxxAbb::Runnable * Take(Worker & _worker);
+	CxxAbb::Runnable * Pop();
+
+	std::vector<Worker*> lst_Workers;
+	std::vector<Worker*> lst_Idle;
+	std::deque<CxxAbb::Runnable*> lst_Tasks;
+	CachePadded<Atomic<std::size_t> > t_Queued;   /// polled by QueueDepth() without the queue lock
+	bool b_Stopping;
+	FastMutex mtx_Queue;
+};
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_THREADPOOL_H_ */
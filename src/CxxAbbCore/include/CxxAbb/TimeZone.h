@@ -30,6 +30,7 @@
 
 #include <CxxAbb/Core.h>
 #include <CxxAbb/DateTime.h>
+#include <CxxAbb/SharedString.h>
 #include <CxxAbb/Timestamp.h>
 
 namespace CxxAbb
@@ -104,7 +105,7 @@ public:
 
 	inline void Swap(TimeZoneInfo & _rhs)
 	{
-		std::swap(s_Zone, _rhs.s_Zone);
+		s_Zone.swap(_rhs.s_Zone);
 	}
 
 	inline TimeZoneInfo& operator = (const TimeZoneInfo& _rhs)
@@ -121,7 +122,7 @@ private:
 	void SetTz();
 	void CalculateTzd();
 
-	std::string s_Zone;
+	SharedString s_Zone;
 };
 
 }  /* namespace CxxAbb */
@@ -74,6 +74,12 @@ public:
 	 */
 	void Now();
 
+	/** @brief Set timestamp for NOW from the coarse system clock
+	 * Last scheduler tick (1-4 ms granularity on Linux), several times cheaper
+	 * than Now(). Good enough for expiry and timeout checks.
+	 */
+	void NowCoarse();
+
 	/** @brief Swap
 	 *
 	 */
@@ -133,6 +139,12 @@ public:
 	 */
 	static Timestamp FromUtc(UtcTimeVal val);
 
+	/** @brief Coarse monotonic clock in microseconds, from an unspecified start
+	 *  Not a point in calendar time and not affected by changes of the system
+	 *  clock, for expiry and timeout checks. Same tick granularity as NowCoarse().
+	 */
+	static TimeVal MonotonicCoarse();
+
 	/** @brief Resolution of the timestamp
 	 *  Always 1000000
 	 */
@@ -0,0 +1,156 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Tracer.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Trace
+ * Comment     : Per-thread event tracer with Chrome trace export
+ *
+ */
+
+#ifndef CXXABB_TRACE_TRACER_H_
+#define CXXABB_TRACE_TRACER_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#include <string>
+#include <time.h>
+
+namespace CxxAbb
+{
+
+namespace Trace
+{
+
+/** @brief Process wide event tracer
+ *
+ * Events go to a lock free ring buffer of the recording thread (single producer,
+ * the flusher thread is the single consumer). A full ring drops events, recording
+ * never blocks. While started, a background flusher drains the rings into a
+ * Chrome / Perfetto JSON trace file (chrome://tracing, ui.perfetto.dev).
+ * Threads are named from Sys::Thread::Name().
+ *
+ * Event names must outlive the trace (string literals), only the pointer is stored.
+ *
+ * Use the CXXABB_TRACE_* macros, they compile to nothing with CXXABB_NO_TRACING:
+ * @code
+ * CxxAbb::Trace::Tracer::Start("app.trace.json");
+ * {
+ *     CXXABB_TRACE_SCOPE("LoadConfig");
+ *     ...
+ *     CXXABB_TRACE_INSTANT("ConfigParsed");
+ * }
+ * CxxAbb::Trace::Tracer::Stop();
+ * @endcode
+ */
+class CXXABB_API Tracer
+{
+public:
+	/** @brief Start tracing into _sPath (truncated), throws FileException
+	 *  @param _lFlushMilliSeconds flusher period
+	 *  @param _tRingEvents per thread ring capacity, rounded up to a power of two
+	 */
+	static void Start(const std::string & _sPath, long _lFlushMilliSeconds = 100,
+			std::size_t _tRingEvents = 16384);
+
+	/** @brief Stop tracing, drain remaining events and close the trace file */
+	static void Stop();
+
+	static bool IsEnabled()
+	{
+		return Sys::AtomicLoad(&i_Enabled, Sys::MemoryOrderRelaxed) != 0;
+	}
+
+	/** @brief Trace clock in ticks (TSC on x86, nanoseconds otherwise) */
+	static UInt64 Now()
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		return __builtin_ia32_rdtsc();
+#else
+		struct timespec ts;
+		::clock_gettime(CLOCK_MONOTONIC, &ts);
+		return static_cast<UInt64>(ts.tv_sec) * static_cast<UInt64>(1000000000) + static_cast<UInt64>(ts.tv_nsec);
+#endif
+	}
+
+	/** @brief Record a span [_uiStart, _uiEnd) of Now() ticks */
+	static void Complete(const char * _zName, UInt64 _uiStart, UInt64 _uiEnd);
+
+	static void Instant(const char * _zName);
+
+	static void Counter(const char * _zName, Int64 _iValue);
+
+	/** @brief Events lost on full rings since Start() */
+	static UInt64 Dropped();
+
+	/** @brief Events written to the trace file since Start() */
+	static UInt64 Written();
+
+private:
+	static volatile int i_Enabled;
+};
+
+/** @brief Records its lifetime as a span, see CXXABB_TRACE_SCOPE */
+class CXXABB_API Span : private NonCopyable
+{
+public:
+	explicit Span(const char * _zName)
+		: z_Name(Tracer::IsEnabled() ? _zName : NullPtr),
+		  ui_Start(z_Name ? Tracer::Now() : 0)
+	{}
+
+	~Span()
+	{
+		if (z_Name)
+			Tracer::Complete(z_Name, ui_Start, Tracer::Now());
+	}
+
+private:
+	const char * z_Name;
+	UInt64 ui_Start;
+};
+
+}  /* namespace Trace */
+
+}  /* namespace CxxAbb */
+
+
+#ifndef CXXABB_NO_TRACING
+
+#define CXXABB_TRACE_SCOPE(NAME) \
+	CxxAbb::Trace::Span CXXABB_DO_JOIN(cxxabbTraceSpan, __LINE__)(NAME)
+
+#define CXXABB_TRACE_INSTANT(NAME) \
+	do { if (CxxAbb::Trace::Tracer::IsEnabled()) CxxAbb::Trace::Tracer::Instant(NAME); } while (0)
+
+#define CXXABB_TRACE_COUNTER(NAME, VALUE) \
+	do { if (CxxAbb::Trace::Tracer::IsEnabled()) CxxAbb::Trace::Tracer::Counter(NAME, VALUE); } while (0)
+
+#else
+
+#define CXXABB_TRACE_SCOPE(NAME)
+#define CXXABB_TRACE_INSTANT(NAME)			do { } while (0)
+#define CXXABB_TRACE_COUNTER(NAME, VALUE)	do { } while (0)
+
+#endif
+
+#endif /* CXXABB_TRACE_TRACER_H_ */
@@ -0,0 +1,128 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BinaryReader.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Endian aware binary decoder over Buffer
+ *
+ */
+
+#include <CxxAbb/BinaryReader.h>
+#include <CxxAbb/Exception.h>
+
+#include <sstream>
+
+namespace CxxAbb
+{
+
+BinaryReader::BinaryReader(const char * _pData, std::size_t _tSize, ByteOrder::Order _eOrder)
+	: p_Data(_pData),
+	  t_Size(_tSize),
+	  t_Position(0),
+	  e_Order(_eOrder),
+	  b_Swap(_eOrder != ByteOrder::OrderHost)
+{
+}
+
+BinaryReader::BinaryReader(const Buffer<char> & _buffer, ByteOrder::Order _eOrder)
+	: p_Data(_buffer.begin()),
+	  t_Size(_buffer.size()),
+	  t_Position(0),
+	  e_Order(_eOrder),
+	  b_Swap(_eOrder != ByteOrder::OrderHost)
+{
+}
+
+void BinaryReader::Underflow(std::size_t _tSize) const
+{
+	std::ostringstream msg;
+	msg << "BinaryReader: " << _tSize << " bytes needed at offset " << t_Position
+		<< ", " << (t_Size - t_Position) << " left";
+	throw RangeException(msg.str());
+}
+
+float BinaryReader::ReadFloat()
+{
+	UInt32 uiBits = Get<UInt32>();
+	float fValue;
+	std::memcpy(&fValue, &uiBits, sizeof(fValue));
+	return fValue;
+}
+
+double BinaryReader::ReadDouble()
+{
+	UInt64 uiBits = Get<UInt64>();
+	double dValue;
+	std::memcpy(&dValue, &uiBits, sizeof(dValue));
+	return dValue;
+}
+
+UInt64 BinaryReader::ReadVarUInt64()
+{
+	UInt64 uiValue = 0;
+	std::size_t tPos = t_Position;
+	for (unsigned int uiShift = 0; ; uiShift += 7)
+	{
+		if (tPos == t_Size)
+			Underflow(tPos - t_Position + 1);
+
+		UInt8 uiByte = static_cast<UInt8>(p_Data[tPos++]);
+		if (uiShift == 63 && uiByte > 1)
+			throw DataFormatException("BinaryReader: varint longer than 64 bits");
+
+		uiValue |= static_cast<UInt64>(uiByte & 0x7F) << uiShift;
+		if (!(uiByte & 0x80))
+			break;
+	}
+	t_Position = tPos;
+	return uiValue;
+}
+
+UInt32 BinaryReader::ReadVarUInt32()
+{
+	std::size_t tStart = t_Position;
+	UInt64 uiValue = ReadVarUInt64();
+	if (uiValue > 0xFFFFFFFFULL)
+	{
+		t_Position = tStart;
+		throw DataFormatException("BinaryReader: varint longer than 32 bits");
+	}
+	return static_cast<UInt32>(uiValue);
+}
+
+Int32 BinaryReader::ReadVarInt32()
+{
+	return static_cast<Int32>(UnZigZag(ReadVarUInt32()));
+}
+
+ByteView BinaryReader::ReadBlobView()
+{
+	std::size_t tStart = t_Position;
+	UInt64 uiSize = ReadVarUInt64();
+	if (uiSize > Remaining())
+	{
+		t_Position = tStart;
+		throw RangeException("BinaryReader: blob length exceeds the data left");
+	}
+	return ReadView(static_cast<std::size_t>(uiSize));
+}
+
+} /* namespace CxxAbb */
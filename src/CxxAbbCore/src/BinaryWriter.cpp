@@ -0,0 +1,113 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BinaryWriter.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Endian aware binary encoder over Buffer
+ *
+ */
+
+#include <CxxAbb/BinaryWriter.h>
+#include <CxxAbb/Exception.h>
+
+#include <algorithm>
+
+namespace CxxAbb
+{
+
+BinaryWriter::BinaryWriter(Buffer<char> & _buffer, ByteOrder::Order _eOrder)
+	: m_Buffer(_buffer),
+	  e_Order(_eOrder),
+	  b_Swap(_eOrder != ByteOrder::OrderHost)
+{
+}
+
+void BinaryWriter::Grow(std::size_t _tBytes, bool _bGeometric)
+{
+	const std::size_t tLimit = m_Buffer.max();
+	std::size_t tNeed = m_Buffer.size() + _tBytes;
+	if (tNeed > tLimit || tNeed < _tBytes)
+		throw OutOfMemoryException("BinaryWriter: buffer limit reached");
+
+	std::size_t tCapacity = tNeed;
+	if (_bGeometric)
+		tCapacity = m_Buffer.capacity() < tLimit / 2 ? std::max(tNeed, 2 * m_Buffer.capacity()) : tLimit;
+	m_Buffer.resize(tCapacity, true);
+}
+
+void BinaryWriter::WriteFloat(float _fValue)
+{
+	UInt32 uiBits;
+	std::memcpy(&uiBits, &_fValue, sizeof(uiBits));
+	Put(uiBits);
+}
+
+void BinaryWriter::WriteDouble(double _dValue)
+{
+	UInt64 uiBits;
+	std::memcpy(&uiBits, &_dValue, sizeof(uiBits));
+	Put(uiBits);
+}
+
+void BinaryWriter::WriteVarUInt64(UInt64 _uiValue)
+{
+	char aBytes[10];
+	std::size_t tSize = 0;
+	while (_uiValue >= 0x80)
+	{
+		aBytes[tSize++] = static_cast<char>((_uiValue & 0x7F) | 0x80);
+		_uiValue >>= 7;
+	}
+	aBytes[tSize++] = static_cast<char>(_uiValue);
+	WriteBytes(aBytes, tSize);
+}
+
+void BinaryWriter::WriteBytes(const void * _pData, std::size_t _tSize)
+{
+	if (_tSize > m_Buffer.capacity() - m_Buffer.size())
+		Grow(_tSize);
+	if (_tSize)
+		std::memcpy(m_Buffer.begin() + m_Buffer.size(), _pData, _tSize);
+	m_Buffer.size(m_Buffer.size() + _tSize);
+}
+
+void BinaryWriter::WriteBlob(const void * _pData, std::size_t _tSize)
+{
+	// one check for prefix and body so a failed write leaves no orphan length
+	std::size_t tNeed = SizeOfBlob(_tSize);
+	if (tNeed > m_Buffer.capacity() - m_Buffer.size())
+		Grow(tNeed);
+	WriteVarUInt64(_tSize);
+	WriteBytes(_pData, _tSize);
+}
+
+std::size_t BinaryWriter::SizeOfVarUInt(UInt64 _uiValue)
+{
+	std::size_t tSize = 1;
+	while (_uiValue >= 0x80)
+	{
+		_uiValue >>= 7;
+		++tSize;
+	}
+	return tSize;
+}
+
+} /* namespace CxxAbb */
@@ -0,0 +1,483 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Bitmap.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Dynamically sized bitmap with bulk word operations
+ *
+ */
+
+#include <CxxAbb/Bitmap.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CXXABB_BITMAP_X86 1
+#include <immintrin.h>
+#endif
+
+namespace CxxAbb
+{
+
+namespace
+{
+
+typedef Bitmap::Word Word;
+
+struct BitmapKernels
+{
+	Bitmap::Kernel e_Kernel;
+	void (* fp_And)(Word *, const Word *, std::size_t);
+	void (* fp_Or)(Word *, const Word *, std::size_t);
+	void (* fp_AndNot)(Word *, const Word *, std::size_t);
+	void (* fp_Xor)(Word *, const Word *, std::size_t);
+	std::size_t (* fp_Count)(const Word *, std::size_t);
+	std::size_t (* fp_CountAnd)(const Word *, const Word *, std::size_t);
+};
+
+void ScalarAnd(Word * _pDst, const Word * _pSrc, std::size_t _tWords)
+{
+	for (std::size_t i = 0; i < _tWords; ++i)
+		_pDst[i] &= _pSrc[i];
+}
+
+void ScalarOr(Word * _pDst, const Word * _pSrc, std::size_t _tWords)
+{
+	for (std::size_t i = 0; i < _tWords; ++i)
+		_pDst[i] |= _pSrc[i];
+}
+
+void ScalarAndNot(Word * _pDst, const Word * _pSrc, std::size_t _tWords)
+{
+	for (std::size_t i = 0; i < _tWords; ++i)
+		_pDst[i] &= ~_pSrc[i];
+}
+
+void ScalarXor(Word * _pDst, const Word * _pSrc, std::size_t _tWords)
+{
+	for (std::size_t i = 0; i < _tWords; ++i)
+		_pDst[i] ^= _pSrc[i];
+}
+
+std::size_t ScalarCount(const Word * _pWords, std::size_t _tWords)
+{
+	std::size_t tCount = 0;
+	for (std::size_t i = 0; i < _tWords; ++i)
+		tCount += Popcount(_pWords[i]);
+	return tCount;
+}
+
+std::size_t ScalarCountAnd(const Word * _pLhs, const Word * _pRhs, std::size_t _tWords)
+{
+	std::size_t tCount = 0;
+	for (std::size_t i = 0; i < _tWords; ++i)
+		tCount += Popcount(_pLhs[i] & _pRhs[i]);
+	return tCount;
+}
+
+const BitmapKernels g_ScalarKernels =
+	{ Bitmap::KernelScalar, &ScalarAnd, &ScalarOr, &ScalarAndNot, &ScalarXor, &ScalarCount, &ScalarCountAnd };
+
+#ifdef CXXABB_BITMAP_X86
+
+/// The scalar loops again, Popcount() now inlines to the popcnt instruction
+__attribute__((target("popcnt")))
+std::size_t PopcntCount(const Word * _pWords, std::size_t _tWords)
+{
+	std::size_t tCount = 0;
+	for (std::size_t i = 0; i < _tWords; ++i)
+		tCount += static_cast<std::size_t>(__builtin_popcountll(_pWords[i]));
+	return tCount;
+}
+
+__attribute__((target("popcnt")))
+std::size_t PopcntCountAnd(const Word * _pLhs, const Word * _pRhs, std::size_t _tWords)
+{
+	std::size_t tCount = 0;
+	for (std::size_t i = 0; i < _tWords; ++i)
+		tCount += static_cast<std::size_t>(__builtin_popcountll(_pLhs[i] & _pRhs[i]));
+	return tCount;
+}
+
+const BitmapKernels g_PopcntKernels =
+	{ Bitmap::KernelPopcnt, &ScalarAnd, &ScalarOr, &ScalarAndNot, &ScalarXor, &PopcntCount, &PopcntCountAnd };
+
+#define CXXABB_BITMAP_AVX2_OP(NAME, EXPR, SCALAR) \
+	__attribute__((target("avx2"))) \
+	void Avx2##NAME(Word * _pDst, const Word * _pSrc, std::size_t _tWords) \
+	{ \
+		std::size_t i = 0; \
+		for (; i + 4 <= _tWords; i += 4) \
+		{ \
+			__m256i dst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pDst + i)); \
+			__m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pSrc + i)); \
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(_pDst + i), EXPR); \
+		} \
+		SCALAR(_pDst + i, _pSrc + i, _tWords - i); \
+	}
+
+CXXABB_BITMAP_AVX2_OP(And, _mm256_and_si256(dst, src), ScalarAnd)
+CXXABB_BITMAP_AVX2_OP(Or, _mm256_or_si256(dst, src), ScalarOr)
+CXXABB_BITMAP_AVX2_OP(AndNot, _mm256_andnot_si256(src, dst), ScalarAndNot)
+CXXABB_BITMAP_AVX2_OP(Xor, _mm256_xor_si256(dst, src), ScalarXor)
+
+#undef CXXABB_BITMAP_AVX2_OP
+
+/** Bit count of each byte through a 4 bit lookup (vpshufb), summed per 64 bit lane
+ * by vpsadbw. W. Mula, N. Kurz, D. Lemire: Faster Population Counts Using AVX2.
+ */
+__attribute__((target("avx2")))
+inline __m256i Avx2CountLanes(__m256i _value)
+{
+	const __m256i lookup = _mm256_setr_epi8(
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+	__m256i low = _mm256_and_si256(_value, lowNibble);
+	__m256i high = _mm256_and_si256(_mm256_srli_epi16(_value, 4), lowNibble);
+	__m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+	return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+inline std::size_t Avx2Sum(__m256i _lanes)
+{
+	return static_cast<std::size_t>(_mm256_extract_epi64(_lanes, 0) + _mm256_extract_epi64(_lanes, 1) +
+		_mm256_extract_epi64(_lanes, 2) + _mm256_extract_epi64(_lanes, 3));
+}
+
+__attribute__((target("avx2,popcnt")))
+std::size_t Avx2Count(const Word * _pWords, std::size_t _tWords)
+{
+	__m256i total = _mm256_setzero_si256();
+	std::size_t i = 0;
+	for (; i + 4 <= _tWords; i += 4)
+		total = _mm256_add_epi64(total, Avx2CountLanes(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pWords + i))));
+	return Avx2Sum(total) + PopcntCount(_pWords + i, _tWords - i);
+}
+
+__attribute__((target("avx2,popcnt")))
+std::size_t Avx2CountAnd(const Word * _pLhs, const Word * _pRhs, std::size_t _tWords)
+{
+	__m256i total = _mm256_setzero_si256();
+	std::size_t i = 0;
+	for (; i + 4 <= _tWords; i += 4)
+	{
+		__m256i both = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pLhs + i)),
+			_mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pRhs + i)));
+		total = _mm256_add_epi64(total, Avx2CountLanes(both));
+	}
+	return Avx2Sum(total) + PopcntCountAnd(_pLhs + i, _pRhs + i, _tWords - i);
+}
+
+const BitmapKernels g_Avx2Kernels =
+	{ Bitmap::KernelAvx2, &Avx2And, &Avx2Or, &Avx2AndNot, &Avx2Xor, &Avx2Count, &Avx2CountAnd };
+
+#endif /* CXXABB_BITMAP_X86 */
+
+const BitmapKernels * Lookup(Bitmap::Kernel _eKernel)
+{
+	switch (_eKernel)
+	{
+	case Bitmap::KernelScalar:
+		return &g_ScalarKernels;
+#ifdef CXXABB_BITMAP_X86
+	case Bitmap::KernelPopcnt:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("popcnt") ? &g_PopcntKernels : NullPtr;
+	case Bitmap::KernelAvx2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") ? &g_Avx2Kernels : NullPtr;
+#endif
+	case Bitmap::KernelAuto:
+		for (int i = Bitmap::KernelAvx2; i > Bitmap::KernelAuto; --i)
+		{
+			const BitmapKernels * pKernels = Lookup(static_cast<Bitmap::Kernel>(i));
+			if (pKernels)
+				return pKernels;
+		}
+		break;
+	default:
+		break;
+	}
+	return NullPtr;
+}
+
+/// Resolved on the first call, racing first callers all store the same table
+const BitmapKernels * g_pKernels = 0;
+
+inline const BitmapKernels & Kernels()
+{
+	const BitmapKernels * pKernels = Sys::AtomicLoad(&g_pKernels, Sys::MemoryOrderAcquire);
+	if (!pKernels)
+	{
+		pKernels = Lookup(Bitmap::KernelAuto);
+		Sys::AtomicStore(&g_pKernels, pKernels, Sys::MemoryOrderRelease);
+	}
+	return *pKernels;
+}
+
+Word * AllocateWords(std::size_t _tWords)
+{
+	return static_cast<Word *>(Sys::AllocateCacheAligned(_tWords * sizeof(Word)));
+}
+
+}
+
+const std::size_t Bitmap::npos;
+
+Bitmap::Bitmap()
+	: p_Words(NullPtr),
+	  t_WordCount(0),
+	  t_Bits(0)
+{
+}
+
+Bitmap::Bitmap(std::size_t _tBits, bool _bValue)
+	: p_Words(AllocateWords(WordsFor(_tBits))),
+	  t_WordCount(WordsFor(_tBits)),
+	  t_Bits(_tBits)
+{
+	if (_bValue)
+		SetAll();
+}
+
+Bitmap::Bitmap(const Bitmap & _other)
+	: p_Words(AllocateWords(_other.t_WordCount)),
+	  t_WordCount(_other.t_WordCount),
+	  t_Bits(_other.t_Bits)
+{
+	if (t_WordCount)
+		std::memcpy(p_Words, _other.p_Words, t_WordCount * sizeof(Word));
+}
+
+Bitmap::~Bitmap()
+{
+	Sys::FreeCacheAligned(p_Words);
+}
+
+Bitmap & Bitmap::operator =(const Bitmap & _other)
+{
+	if (this != &_other)
+	{
+		Bitmap copy(_other);
+		Swap(copy);
+	}
+	return *this;
+}
+
+void Bitmap::Swap(Bitmap & _other)
+{
+	std::swap(p_Words, _other.p_Words);
+	std::swap(t_WordCount, _other.t_WordCount);
+	std::swap(t_Bits, _other.t_Bits);
+}
+
+void Bitmap::Resize(std::size_t _tBits, bool _bValue)
+{
+	std::size_t tOldBits = t_Bits;
+	std::size_t tWords = WordsFor(_tBits);
+	if (tWords != t_WordCount)
+	{
+		Word * pWords = AllocateWords(tWords);
+		if (t_WordCount)
+			std::memcpy(pWords, p_Words, std::min(tWords, t_WordCount) * sizeof(Word));
+		Sys::FreeCacheAligned(p_Words);
+		p_Words = pWords;
+		t_WordCount = tWords;
+	}
+	t_Bits = _tBits;
+
+	if (_tBits < tOldBits)
+		TrimTail();
+	else if (_bValue)
+		SetRange(tOldBits, _tBits);
+}
+
+void Bitmap::SetAll()
+{
+	if (t_WordCount)
+		std::memset(p_Words, 0xFF, t_WordCount * sizeof(Word));
+	TrimTail();
+}
+
+void Bitmap::ResetAll()
+{
+	if (t_WordCount)
+		std::memset(p_Words, 0, t_WordCount * sizeof(Word));
+}
+
+void Bitmap::SetRange(std::size_t _tBegin, std::size_t _tEnd)
+{
+	ASSERT(_tBegin <= _tEnd && _tEnd <= t_Bits);
+	if (_tBegin >= _tEnd)
+		return;
+
+	std::size_t tFirst = _tBegin / WordBits;
+	std::size_t tLast = (_tEnd - 1) / WordBits;
+	Word uiFirstMask = ~Word(0) << (_tBegin % WordBits);
+	Word uiLastMask = ~Word(0) >> (WordBits - 1 - (_tEnd - 1) % WordBits);
+	if (tFirst == tLast)
+	{
+		p_Words[tFirst] |= uiFirstMask & uiLastMask;
+		return;
+	}
+	p_Words[tFirst] |= uiFirstMask;
+	for (std::size_t i = tFirst + 1; i < tLast; ++i)
+		p_Words[i] = ~Word(0);
+	p_Words[tLast] |= uiLastMask;
+}
+
+std::size_t Bitmap::Count() const
+{
+	return Kernels().fp_Count(p_Words, t_WordCount);
+}
+
+bool Bitmap::Any() const
+{
+	for (std::size_t i = 0; i < t_WordCount; ++i)
+	{
+		if (p_Words[i])
+			return true;
+	}
+	return false;
+}
+
+std::size_t Bitmap::FindNext(std::size_t _tBit) const
+{
+	if (_tBit >= t_Bits)
+		return npos;
+
+	std::size_t i = _tBit / WordBits;
+	Word uiWord = p_Words[i] & (~Word(0) << (_tBit % WordBits));
+	while (!uiWord)
+	{
+		if (++i == t_WordCount)
+			return npos;
+		uiWord = p_Words[i];
+	}
+	return i * WordBits + CountTrailingZeros(uiWord);
+}
+
+std::size_t Bitmap::FindNextZero(std::size_t _tBit) const
+{
+	if (_tBit >= t_Bits)
+		return npos;
+
+	std::size_t i = _tBit / WordBits;
+	Word uiWord = ~p_Words[i] & (~Word(0) << (_tBit % WordBits));
+	while (!uiWord)
+	{
+		if (++i == t_WordCount)
+			return npos;
+		uiWord = ~p_Words[i];
+	}
+	// the tail past Size() reads as free, it is not
+	std::size_t tBit = i * WordBits + CountTrailingZeros(uiWord);
+	return tBit < t_Bits ? tBit : npos;
+}
+
+Bitmap & Bitmap::And(const Bitmap & _other)
+{
+	std::size_t tWords = std::min(t_WordCount, _other.t_WordCount);
+	Kernels().fp_And(p_Words, _other.p_Words, tWords);
+	if (t_WordCount > tWords)
+		std::memset(p_Words + tWords, 0, (t_WordCount - tWords) * sizeof(Word));
+	return *this;
+}
+
+Bitmap & Bitmap::Or(const Bitmap & _other)
+{
+	Kernels().fp_Or(p_Words, _other.p_Words, std::min(t_WordCount, _other.t_WordCount));
+	TrimTail();
+	return *this;
+}
+
+Bitmap & Bitmap::AndNot(const Bitmap & _other)
+{
+	Kernels().fp_AndNot(p_Words, _other.p_Words, std::min(t_WordCount, _other.t_WordCount));
+	return *this;
+}
+
+Bitmap & Bitmap::Xor(const Bitmap & _other)
+{
+	Kernels().fp_Xor(p_Words, _other.p_Words, std::min(t_WordCount, _other.t_WordCount));
+	TrimTail();
+	return *this;
+}
+
+std::size_t Bitmap::CountAnd(const Bitmap & _other) const
+{
+	return Kernels().fp_CountAnd(p_Words, _other.p_Words, std::min(t_WordCount, _other.t_WordCount));
+}
+
+bool Bitmap::operator ==(const Bitmap & _other) const
+{
+	return t_Bits == _other.t_Bits &&
+		(!t_WordCount || std::memcmp(p_Words, _other.p_Words, t_WordCount * sizeof(Word)) == 0);
+}
+
+void Bitmap::TrimTail()
+{
+	if (t_Bits % WordBits)
+		p_Words[t_WordCount - 1] &= ~Word(0) >> (WordBits - t_Bits % WordBits);
+}
+
+bool Bitmap::SetKernel(Bitmap::Kernel _eKernel)
+{
+	const BitmapKernels * pKernels = Lookup(_eKernel);
+	if (!pKernels)
+		return false;
+
+	Sys::AtomicStore(&g_pKernels, pKernels, Sys::MemoryOrderRelease);
+	return true;
+}
+
+Bitmap::Kernel Bitmap::ActiveKernel()
+{
+	return Kernels().e_Kernel;
+}
+
+bool Bitmap::KernelSupported(Bitmap::Kernel _eKernel)
+{
+	return Lookup(_eKernel) != NullPtr;
+}
+
+const char * Bitmap::KernelName(Bitmap::Kernel _eKernel)
+{
+	switch (_eKernel)
+	{
+	case KernelAuto:
+		return "auto";
+	case KernelScalar:
+		return "scalar";
+	case KernelPopcnt:
+		return "popcnt";
+	case KernelAvx2:
+		return "avx2";
+	}
+	return "unknown";
+}
+
+} /* namespace CxxAbb */
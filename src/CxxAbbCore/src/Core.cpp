@@ -31,6 +31,7 @@
 #include <CxxAbb/Buffer.h>
 #include <CxxAbb/Cloneable.h>
 #include <CxxAbb/Config.h>
+#include <CxxAbb/CoreFwd.h>
 #include <CxxAbb/Debug.h>
 #include <CxxAbb/Exception.h>
 #include <CxxAbb/Memory.h>
@@ -34,23 +34,38 @@ namespace CxxAbb
 Exception::Exception(int _iCode)
 		: p_Nested(0), i_Code(_iCode)
 {
-
+	BuildWhat();
 }
 
 Exception::Exception(const std::string& _sMsg, int _iCode)
 		: s_Msg(_sMsg), p_Nested(0), i_Code(_iCode)
 {
-
+	BuildWhat();
 }
 
 Exception::Exception(const std::string& _sMsg, const Exception& _mNested, int _iCode)
 		: s_Msg(_sMsg), p_Nested(_mNested.Clone()), i_Code(_iCode)
 {
+	BuildWhat();
+}
+
+Exception::Exception(int _iCode, DeferWhat)
+		: p_Nested(0), i_Code(_iCode)
+{
+}
+
+Exception::Exception(const std::string& _sMsg, int _iCode, DeferWhat)
+		: s_Msg(_sMsg), p_Nested(0), i_Code(_iCode)
+{
+}
 
+Exception::Exception(const std::string& _sMsg, const Exception& _mNested, int _iCode, DeferWhat)
+		: s_Msg(_sMsg), p_Nested(_mNested.Clone()), i_Code(_iCode)
+{
 }
 
 Exception::Exception(const Exception& _mExc)
-		: std::exception(_mExc), s_Msg(_mExc.Message()), i_Code(_mExc.Code())
+		: std::exception(_mExc), s_Msg(_mExc.s_Msg), s_What(_mExc.s_What), i_Code(_mExc.Code())
 {
 	p_Nested = _mExc.Nested() ? _mExc.Nested()->Clone() : 0;
 }
@@ -67,7 +82,8 @@ Exception& Exception::operator =(const Exception& _mExc)
 		if (p_Nested) delete p_Nested;
 		i_Code = _mExc.Code();
 		p_Nested = _mExc.Nested() ? _mExc.Nested()->Clone() : 0;
-		s_Msg = _mExc.Message();
+		s_Msg = _mExc.s_Msg;
+		s_What = _mExc.s_What;
 	}
 
 	return *this;
@@ -85,14 +101,19 @@ const char* Exception::ClassName() const throw ()
 }
 
 const char* Exception::what() const throw ()
+{
+	return s_What.empty() ? s_Msg.c_str() : s_What.c_str();
+}
+
+void Exception::BuildWhat()
 {
 	std::string sWhat = Name();
 	if (!s_Msg.empty())
 	{
 		sWhat.append(": ");
-		sWhat.append(s_Msg);
+		sWhat.append(s_Msg.data(), s_Msg.size());
 	}
-	return sWhat.c_str();
+	s_What = sWhat;
 }
 
 Exception* Exception::Clone() const
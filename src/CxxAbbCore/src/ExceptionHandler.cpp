@@ -29,12 +29,40 @@
 #include <CxxAbb/Debug.h>
 #include <CxxAbb/Sys/Mutex.h>
 #include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Singleton.h>
 
 namespace CxxAbb
 {
 
-ExceptionHandler* ThreadErrorHandler::p_CurrentHandler = new CxxAbb::ExceptionHandler;
-CxxAbb::Sys::FastMutex ThreadErrorHandler::m_Mutex;
+namespace
+{
+
+/** @brief Current handler of ThreadErrorHandler
+ *  Default handler is owned here until Set() hands it back to the caller
+ */
+class ThreadErrorHandlerState: public Dp::Singleton<ThreadErrorHandlerState>
+{
+	friend class Dp::Singleton<ThreadErrorHandlerState>;
+
+public:
+	ExceptionHandler * p_Current;
+	ExceptionHandler * p_Default;
+	CxxAbb::Sys::FastMutex m_Mutex;
+
+private:
+	ThreadErrorHandlerState()
+		: p_Current(new CxxAbb::ExceptionHandler),
+		  p_Default(p_Current)
+	{}
+
+	~ThreadErrorHandlerState()
+	{
+		if (p_Current == p_Default)
+			delete p_Default;
+	}
+};
+
+}
 
 void ExceptionHandler::Exception(const CxxAbb::Exception & _e)
 {
@@ -55,25 +83,30 @@ ExceptionHandler * ThreadErrorHandler::Set(ExceptionHandler * _new)
 {
 	CHECKNULL(_new);
 
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
-	ExceptionHandler * old = p_CurrentHandler;
-	p_CurrentHandler = _new;
+	ThreadErrorHandlerState * pState = ThreadErrorHandlerState::Instance();
+	CxxAbb::Sys::FastMutex::ScopedLock lock(pState->m_Mutex);
+	ExceptionHandler * old = pState->p_Current;
+	pState->p_Current = _new;
+	if (old == pState->p_Default)
+		pState->p_Default = NullPtr; // caller owns it now
 	return old;
 }
 
 ExceptionHandler * ThreadErrorHandler::Get()
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
-	return p_CurrentHandler;
+	ThreadErrorHandlerState * pState = ThreadErrorHandlerState::Instance();
+	CxxAbb::Sys::FastMutex::ScopedLock lock(pState->m_Mutex);
+	return pState->p_Current;
 }
 
 void ThreadErrorHandler::Handle(const CxxAbb::Exception & _e)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	ThreadErrorHandlerState * pState = ThreadErrorHandlerState::Instance();
+	CxxAbb::Sys::FastMutex::ScopedLock lock(pState->m_Mutex);
 
 	try
 	{
-		p_CurrentHandler->Exception(_e);
+		pState->p_Current->Exception(_e);
 	}
 	catch(...)
 	{
@@ -82,11 +115,12 @@ void ThreadErrorHandler::Handle(const CxxAbb::Exception & _e)
 
 void ThreadErrorHandler::Handle(const std::exception & _e)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	ThreadErrorHandlerState * pState = ThreadErrorHandlerState::Instance();
+	CxxAbb::Sys::FastMutex::ScopedLock lock(pState->m_Mutex);
 
 	try
 	{
-		p_CurrentHandler->Exception(_e);
+		pState->p_Current->Exception(_e);
 	}
 	catch(...)
 	{
@@ -95,11 +129,12 @@ void ThreadErrorHandler::Handle(const std::exception & _e)
 
 void ThreadErrorHandler::Handle()
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	ThreadErrorHandlerState * pState = ThreadErrorHandlerState::Instance();
+	CxxAbb::Sys::FastMutex::ScopedLock lock(pState->m_Mutex);
 
 	try
 	{
-		p_CurrentHandler->Exception();
+		pState->p_Current->Exception();
 	}
 	catch(...)
 	{
@@ -0,0 +1,74 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Context.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Machine context of a fiber (internal)
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_CONTEXT_H_
+#define CXXABB_CORE_FIBER_CONTEXT_H_
+
+#include <CxxAbb/Core.h>
+
+#if (CXXABB_ARCH == CXXABB_ARCH_AMD64) && defined(__GNUC__)
+#define CXXABB_DEF_FIBER_CONTEXT_X86_64
+#else
+#include <ucontext.h>
+#endif
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+typedef void (*ContextEntry)(void *);
+
+/** @brief Saved execution context
+ *  On x86_64 only the stack pointer, callee saved registers live on the stack itself
+ */
+struct Context
+{
+#ifdef CXXABB_DEF_FIBER_CONTEXT_X86_64
+	void * p_StackPtr;
+#else
+	ucontext_t t_Context;
+	ContextEntry fp_Entry;
+	void * p_Arg;
+#endif
+};
+
+/** @brief Prepare context to run _fpEntry(_pArg) on the given stack
+ *  Entry function must never return, it has to switch away at the end
+ */
+void ContextMake(Context & _ctx, void * _pStack, std::size_t _tSize, ContextEntry _fpEntry, void * _pArg);
+
+/** @brief Save current context into _from and continue from _to
+ */
+void ContextSwitch(Context & _from, Context & _to);
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_CONTEXT_H_ */
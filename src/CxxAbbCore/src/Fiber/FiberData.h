@@ -0,0 +1,124 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * FiberData.h
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber control block and carrier thread (internal)
+ *
+ */
+
+#ifndef CXXABB_CORE_FIBER_FIBERDATA_H_
+#define CXXABB_CORE_FIBER_FIBERDATA_H_
+
+#include <CxxAbb/Core.h>
+#include <CxxAbb/NonCopyable.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Fiber/Scheduler.h>
+#include <CxxAbb/Fiber/StackPool.h>
+
+#include "Context.h"
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+/** @brief Control block of a fiber
+ *
+ * Run state protocol, makes a wake-up safe while the fiber is still switching out:
+ *   Runnable -> Running           carrier picks the fiber
+ *   Running  -> Parked            carrier, after the fiber switched out to park
+ *   Running  -> WakePending       waker, fiber has not switched out yet; carrier requeues it
+ *   Parked   -> Runnable          waker, fiber is queued
+ */
+class FiberData : private CxxAbb::NonCopyable
+{
+public:
+	enum RunState
+	{
+		Runnable = 0,
+		Running,
+		Parked,
+		WakePending
+	};
+
+	enum SwitchReason
+	{
+		SwitchYield = 0,
+		SwitchPark,
+		SwitchFinish
+	};
+
+	FiberData(Scheduler & _scheduler, CxxAbb::Runnable * _pTask, const StackPool::Stack & _stack)
+		: p_Scheduler(&_scheduler),
+		  p_Task(_pTask),
+		  m_Stack(_stack),
+		  i_State(Runnable),
+		  e_Switch(SwitchYield),
+		  p_Prev(NullPtr),
+		  p_Next(NullPtr)
+	{}
+
+	Context m_Context;
+	Scheduler * p_Scheduler;
+	CxxAbb::Runnable * p_Task;
+	StackPool::Stack m_Stack;
+	CxxAbb::Sys::Atomic<int> i_State;
+	SwitchReason e_Switch;
+	FiberData * p_Prev;   /// list of all live fibers of the scheduler
+	FiberData * p_Next;
+};
+
+/** @brief OS thread running fibers of a scheduler
+ */
+class Carrier : public CxxAbb::Runnable
+{
+public:
+	Carrier(Scheduler & _scheduler, const std::string & _sName)
+		: p_Scheduler(&_scheduler),
+		  p_Current(NullPtr),
+		  m_Wake(true),
+		  b_Idle(false),
+		  m_Thread(_sName)
+	{}
+
+	void Run();
+
+	/// Carrier of the calling thread, NULL if not a carrier
+	static Carrier * Current();
+
+	Scheduler * p_Scheduler;
+	Context m_Context;
+	FiberData * p_Current;
+	CxxAbb::Sys::SigEvent m_Wake;
+	bool b_Idle;
+	CxxAbb::Sys::Thread m_Thread;
+};
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
+
+#endif /* CXXABB_CORE_FIBER_FIBERDATA_H_ */
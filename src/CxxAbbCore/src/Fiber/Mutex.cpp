@@ -0,0 +1,108 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Mutex.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber aware mutex
+ *
+ */
+
+
+#include <CxxAbb/Fiber/Mutex.h>
+#include <CxxAbb/Debug.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+FastMutex::FastMutex()
+	: i_Locked(0)
+{
+}
+
+FastMutex::~FastMutex()
+{
+	ASSERT (m_Waiters.Empty());
+}
+
+void FastMutex::Lock()
+{
+	if (TryLock())
+		return;
+
+	Waiter waiter;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+		if (TryLock())
+			return;
+		m_Waiters.PushBack(waiter);
+	}
+
+	// Unlock() hands over the ownership
+	waiter.Block();
+}
+
+bool FastMutex::TryLock()
+{
+	int iExpected = 0;
+	return i_Locked.CompareExchange(iExpected, 1, CxxAbb::Sys::MemoryOrderAcquire);
+}
+
+bool FastMutex::TryLock(long _lMiliSeconds)
+{
+	if (TryLock())
+		return true;
+
+	Waiter waiter;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+		if (TryLock())
+			return true;
+		m_Waiters.PushBack(waiter);
+	}
+
+	if (waiter.Block(_lMiliSeconds))
+		return true;
+
+	CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+	m_Waiters.Remove(waiter);
+	return false;
+}
+
+void FastMutex::Unlock()
+{
+	Waiter * pNext;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+		pNext = m_Waiters.ClaimFront();
+		if (!pNext)
+			i_Locked.Store(0, CxxAbb::Sys::MemoryOrderRelease);
+	}
+
+	if (pNext)
+		pNext->Wake();
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,461 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Scheduler.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : M:N scheduler running fibers on carrier threads
+ *
+ */
+
+
+#include <CxxAbb/Fiber/Scheduler.h>
+#include <CxxAbb/Fiber/Waiter.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Debug.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "FiberData.h"
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+namespace
+{
+
+__thread Carrier * p_CurrentCarrier = 0;
+
+}
+
+/// Never inlined: a fiber may resume on another thread, the TLS address must not be cached across a switch
+__attribute__((noinline)) Carrier * Carrier::Current()
+{
+	return p_CurrentCarrier;
+}
+
+void Carrier::Run()
+{
+	p_CurrentCarrier = this;
+
+	FiberData * pFiber;
+	while ((pFiber = p_Scheduler->Next(*this)) != NullPtr)
+	{
+		p_Current = pFiber;
+		pFiber->i_State.Store(FiberData::Running, CxxAbb::Sys::MemoryOrderRelease);
+		ContextSwitch(m_Context, pFiber->m_Context);
+		p_Current = NullPtr;
+
+		switch (pFiber->e_Switch)
+		{
+		case FiberData::SwitchYield:
+			pFiber->i_State.Store(FiberData::Runnable, CxxAbb::Sys::MemoryOrderRelease);
+			p_Scheduler->Enqueue(pFiber);
+			break;
+
+		case FiberData::SwitchPark:
+			{
+				int iExpected = FiberData::Running;
+				if (!pFiber->i_State.CompareExchange(iExpected, FiberData::Parked, CxxAbb::Sys::MemoryOrderAcqRel))
+				{
+					// woken before it was switched out
+					pFiber->i_State.Store(FiberData::Runnable, CxxAbb::Sys::MemoryOrderRelease);
+					p_Scheduler->Enqueue(pFiber);
+				}
+			}
+			break;
+
+		case FiberData::SwitchFinish:
+			p_Scheduler->Destroy(pFiber);
+			break;
+		}
+	}
+
+	p_CurrentCarrier = NullPtr;
+}
+
+Scheduler::Scheduler(unsigned int _uiCarriers /*= 1*/, std::size_t _tStackSize /*= StackPool::DefaultStackSize*/)
+	: m_Stacks(_tStackSize),
+	  p_Fibers(NullPtr),
+	  t_FiberCount(0),
+	  b_Started(false),
+	  b_Stopping(false),
+	  m_Idle(false)
+{
+	ASSERT (_uiCarriers > 0);
+
+	m_Idle.Set();
+	for (unsigned int i = 0; i < _uiCarriers; ++i)
+	{
+		std::ostringstream oss;
+		oss << "FiberCarrier-" << i;
+		lst_Carriers.push_back(new Carrier(*this, oss.str()));
+	}
+}
+
+Scheduler::~Scheduler()
+{
+	Stop();
+
+	for (std::vector<Carrier*>::iterator it = lst_Carriers.begin(); it != lst_Carriers.end(); ++it)
+	{
+		delete *it;
+	}
+}
+
+void Scheduler::Start()
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+
+	if (b_Started)
+		return;
+	if (b_Stopping)
+		throw CxxAbb::IllegalStateException("Fiber scheduler stopped");
+
+	b_Started = true;
+	for (std::vector<Carrier*>::iterator it = lst_Carriers.begin(); it != lst_Carriers.end(); ++it)
+	{
+		(*it)->m_Thread.Start(**it);
+	}
+}
+
+void Scheduler::Stop()
+{
+	bool bJoin;
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+		bJoin = b_Started;
+		b_Started = false;
+		b_Stopping = true;
+		for (std::vector<Carrier*>::iterator it = lst_Carriers.begin(); it != lst_Carriers.end(); ++it)
+		{
+			(*it)->m_Wake.Set();
+		}
+	}
+
+	if (bJoin)
+	{
+		for (std::vector<Carrier*>::iterator it = lst_Carriers.begin(); it != lst_Carriers.end(); ++it)
+		{
+			(*it)->m_Thread.Join();
+		}
+	}
+
+	// carriers are gone, discard what is left
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+		lst_Ready.clear();
+		lst_Timers.clear();
+		lst_Idle.clear();
+	}
+
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Fibers);
+	while (p_Fibers)
+	{
+		FiberData * pFiber = p_Fibers;
+		Unlink(pFiber);
+		delete pFiber->p_Task;
+		m_Stacks.Release(pFiber->m_Stack);
+		delete pFiber;
+	}
+	t_FiberCount = 0;
+	m_Idle.Set();
+}
+
+void Scheduler::Execute(CxxAbb::Runnable * _pTask)
+{
+	CHECKNULL(_pTask);
+
+	FiberData * pFiber = NullPtr;
+	try
+	{
+		StackPool::Stack stack = m_Stacks.Allocate();
+		pFiber = new FiberData(*this, _pTask, stack);
+		ContextMake(pFiber->m_Context, stack.p_Base, stack.t_Size, FiberEntry, pFiber);
+	}
+	catch(...)
+	{
+		if (pFiber)
+		{
+			m_Stacks.Release(pFiber->m_Stack);
+			delete pFiber;
+		}
+		delete _pTask;
+		throw;
+	}
+
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Fibers);
+		pFiber->p_Next = p_Fibers;
+		if (p_Fibers)
+			p_Fibers->p_Prev = pFiber;
+		p_Fibers = pFiber;
+		if (t_FiberCount++ == 0)
+			m_Idle.Reset();
+	}
+
+	Enqueue(pFiber);
+}
+
+void Scheduler::WaitIdle()
+{
+	m_Idle.Wait();
+}
+
+bool Scheduler::TryWaitIdle(long _lMilliSeconds)
+{
+	return m_Idle.TryWait(_lMilliSeconds);
+}
+
+std::size_t Scheduler::FiberCount() const
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Fibers);
+	return t_FiberCount;
+}
+
+bool Scheduler::InFiber()
+{
+	return CurrentFiber() != NullPtr;
+}
+
+void Scheduler::Yield()
+{
+	Carrier * pCarrier = Carrier::Current();
+	if (!pCarrier || !pCarrier->p_Current)
+	{
+		CxxAbb::Sys::Thread::Yield();
+		return;
+	}
+
+	FiberData * pFiber = pCarrier->p_Current;
+	pFiber->e_Switch = FiberData::SwitchYield;
+	ContextSwitch(pFiber->m_Context, pCarrier->m_Context);
+}
+
+void Scheduler::Sleep(long _lMilliSeconds)
+{
+	if (!InFiber())
+	{
+		CxxAbb::Sys::Thread::Sleep(_lMilliSeconds);
+		return;
+	}
+
+	// nobody notifies, only the timer wakes
+	Waiter waiter;
+	waiter.Block(_lMilliSeconds);
+}
+
+FiberData * Scheduler::CurrentFiber()
+{
+	Carrier * pCarrier = Carrier::Current();
+	return pCarrier ? pCarrier->p_Current : NullPtr;
+}
+
+void Scheduler::Park()
+{
+	Carrier * pCarrier = Carrier::Current();
+	ASSERT (pCarrier && pCarrier->p_Current);
+
+	FiberData * pFiber = pCarrier->p_Current;
+	pFiber->e_Switch = FiberData::SwitchPark;
+	ContextSwitch(pFiber->m_Context, pCarrier->m_Context);
+}
+
+void Scheduler::FiberEntry(void * _pArg)
+{
+	FiberData * pFiber = static_cast<FiberData*>(_pArg);
+
+	RunTask(pFiber->p_Task);
+	pFiber->p_Task = NullPtr;
+
+	// carrier releases the stack we are running on, never resumed
+	pFiber->e_Switch = FiberData::SwitchFinish;
+	ContextSwitch(pFiber->m_Context, Carrier::Current()->m_Context);
+}
+
+void Scheduler::Resume(FiberData * _pFiber)
+{
+	for (;;)
+	{
+		int iState = _pFiber->i_State.Load(CxxAbb::Sys::MemoryOrderAcquire);
+		if (iState == FiberData::Running)
+		{
+			if (_pFiber->i_State.CompareExchange(iState, FiberData::WakePending, CxxAbb::Sys::MemoryOrderAcqRel))
+				return;
+		}
+		else if (iState == FiberData::Parked)
+		{
+			if (_pFiber->i_State.CompareExchange(iState, FiberData::Runnable, CxxAbb::Sys::MemoryOrderAcqRel))
+			{
+				Enqueue(_pFiber);
+				return;
+			}
+		}
+		else
+		{
+			return;
+		}
+	}
+}
+
+void Scheduler::Enqueue(FiberData * _pFiber)
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+
+	lst_Ready.push_back(_pFiber);
+	if (!lst_Idle.empty())
+	{
+		Carrier * pCarrier = lst_Idle.back();
+		lst_Idle.pop_back();
+		pCarrier->b_Idle = false;
+		pCarrier->m_Wake.Set();
+	}
+}
+
+FiberData * Scheduler::Next(Carrier & _carrier)
+{
+	for (;;)
+	{
+		bool bFired = false;
+		Waiter * pExpired = NullPtr;
+		long lWait = MaxIdleWait;
+
+		{
+			CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+
+			if (b_Stopping)
+				return NullPtr;
+
+			if (!lst_Timers.empty())
+			{
+				CxxAbb::Timestamp::TimeVal tNow = CxxAbb::Timestamp().EpochMicroseconds();
+				TimerMap::iterator it = lst_Timers.begin();
+				if (it->first <= tNow)
+				{
+					bFired = true;
+					pExpired = it->second;
+					pExpired->b_TimerArmed = false;
+					lst_Timers.erase(it);
+
+					// lost against a notification, waiter removes itself
+					if (!pExpired->Claim(Waiter::TimedOut))
+						pExpired = NullPtr;
+				}
+				else if (it->first - tNow < MaxIdleWait * 1000)
+				{
+					lWait = static_cast<long>((it->first - tNow + 999) / 1000);
+				}
+			}
+
+			if (!bFired)
+			{
+				if (!lst_Ready.empty())
+				{
+					FiberData * pFiber = lst_Ready.front();
+					lst_Ready.pop_front();
+					return pFiber;
+				}
+
+				_carrier.b_Idle = true;
+				lst_Idle.push_back(&_carrier);
+			}
+		}
+
+		if (bFired)
+		{
+			if (pExpired)
+				pExpired->Wake();
+			continue;
+		}
+
+		_carrier.m_Wake.TryWait(lWait);
+
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+		if (_carrier.b_Idle)
+		{
+			_carrier.b_Idle = false;
+			lst_Idle.erase(std::find(lst_Idle.begin(), lst_Idle.end(), &_carrier));
+		}
+	}
+}
+
+void Scheduler::Destroy(FiberData * _pFiber)
+{
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Fibers);
+		Unlink(_pFiber);
+		if (--t_FiberCount == 0)
+			m_Idle.Set();
+	}
+
+	m_Stacks.Release(_pFiber->m_Stack);
+	delete _pFiber;
+}
+
+void Scheduler::ArmTimer(Waiter & _waiter, long _lMilliSeconds)
+{
+	CxxAbb::Timestamp::TimeVal tDeadline = CxxAbb::Timestamp().EpochMicroseconds()
+			+ static_cast<CxxAbb::Timestamp::TimeVal>(_lMilliSeconds) * 1000;
+
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+
+	_waiter.t_TimerPos = lst_Timers.insert(std::make_pair(tDeadline, &_waiter));
+	_waiter.b_TimerArmed = true;
+
+	// earliest deadline changed, let an idle carrier recompute its wait
+	if (_waiter.t_TimerPos == lst_Timers.begin() && !lst_Idle.empty())
+	{
+		Carrier * pCarrier = lst_Idle.back();
+		lst_Idle.pop_back();
+		pCarrier->b_Idle = false;
+		pCarrier->m_Wake.Set();
+	}
+}
+
+void Scheduler::DisarmTimer(Waiter & _waiter)
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Queue);
+
+	if (_waiter.b_TimerArmed)
+	{
+		lst_Timers.erase(_waiter.t_TimerPos);
+		_waiter.b_TimerArmed = false;
+	}
+}
+
+void Scheduler::Unlink(FiberData * _pFiber)
+{
+	if (_pFiber->p_Prev)
+		_pFiber->p_Prev->p_Next = _pFiber->p_Next;
+	else
+		p_Fibers = _pFiber->p_Next;
+	if (_pFiber->p_Next)
+		_pFiber->p_Next->p_Prev = _pFiber->p_Prev;
+	_pFiber->p_Prev = _pFiber->p_Next = NullPtr;
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
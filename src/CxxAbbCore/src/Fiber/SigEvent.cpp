@@ -0,0 +1,118 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SigEvent.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber aware event
+ *
+ */
+
+
+#include <CxxAbb/Fiber/SigEvent.h>
+#include <CxxAbb/Debug.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+SigEvent::SigEvent(bool _autoreset /*= true*/)
+	: b_AutoReset(_autoreset),
+	  b_EventHappened(false)
+{
+}
+
+SigEvent::~SigEvent()
+{
+	ASSERT (m_Waiters.Empty());
+}
+
+void SigEvent::Set()
+{
+	Waiter * pChain;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+		if (b_AutoReset)
+		{
+			pChain = m_Waiters.ClaimFront();
+			if (!pChain)
+				b_EventHappened = true;
+		}
+		else
+		{
+			b_EventHappened = true;
+			pChain = m_Waiters.ClaimAll();
+		}
+	}
+
+	WaitQueue::WakeAll(pChain);
+}
+
+void SigEvent::Wait()
+{
+	Waiter waiter;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+		if (Consume())
+			return;
+		m_Waiters.PushBack(waiter);
+	}
+
+	waiter.Block();
+}
+
+bool SigEvent::TryWait(long _lMiliSeconds)
+{
+	Waiter waiter;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+		if (Consume())
+			return true;
+		m_Waiters.PushBack(waiter);
+	}
+
+	if (waiter.Block(_lMiliSeconds))
+		return true;
+
+	CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+	m_Waiters.Remove(waiter);
+	return false;
+}
+
+void SigEvent::Reset()
+{
+	CxxAbb::Sys::SpinLock::ScopedLock lock(m_Spin);
+	b_EventHappened = false;
+}
+
+bool SigEvent::Consume()
+{
+	if (!b_EventHappened)
+		return false;
+	if (b_AutoReset)
+		b_EventHappened = false;
+	return true;
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
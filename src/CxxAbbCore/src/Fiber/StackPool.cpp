@@ -0,0 +1,121 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * StackPool.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Pool of guard paged fiber stacks
+ *
+ */
+
+
+#include <CxxAbb/Fiber/StackPool.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Debug.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+StackPool::StackPool(std::size_t _tStackSize /*= DefaultStackSize*/, std::size_t _tMaxCached /*= 1024*/)
+	: t_StackSize(0),
+	  t_PageSize(static_cast<std::size_t>(sysconf(_SC_PAGESIZE))),
+	  t_MaxCached(_tMaxCached)
+{
+	ASSERT (_tStackSize > 0);
+	t_StackSize = (_tStackSize + t_PageSize - 1) / t_PageSize * t_PageSize;
+}
+
+StackPool::~StackPool()
+{
+	for (std::vector<void*>::iterator it = lst_Free.begin(); it != lst_Free.end(); ++it)
+	{
+		Unmap(*it);
+	}
+}
+
+StackPool::Stack StackPool::Allocate()
+{
+	Stack stack;
+	stack.t_Size = t_StackSize;
+
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Free);
+		if (!lst_Free.empty())
+		{
+			stack.p_Base = static_cast<char*>(lst_Free.back()) + t_PageSize;
+			lst_Free.pop_back();
+			return stack;
+		}
+	}
+
+	void * pMap = mmap(NullPtr, t_StackSize + t_PageSize, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (pMap == MAP_FAILED)
+		throw CxxAbb::OutOfMemoryException("StackPool mmap failed");
+
+	// lowest page is the guard, stack grows down towards it
+	if (mprotect(pMap, t_PageSize, PROT_NONE) != 0)
+	{
+		munmap(pMap, t_StackSize + t_PageSize);
+		throw CxxAbb::SystemException("StackPool mprotect failed");
+	}
+
+	stack.p_Base = static_cast<char*>(pMap) + t_PageSize;
+	return stack;
+}
+
+void StackPool::Release(const Stack & _stack)
+{
+	ASSERT (_stack.t_Size == t_StackSize);
+	void * pMap = static_cast<char*>(_stack.p_Base) - t_PageSize;
+
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Free);
+		if (lst_Free.size() < t_MaxCached)
+		{
+			lst_Free.push_back(pMap);
+			return;
+		}
+	}
+
+	Unmap(pMap);
+}
+
+std::size_t StackPool::CachedCount() const
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Free);
+	return lst_Free.size();
+}
+
+void StackPool::Unmap(void * _pMap)
+{
+	munmap(_pMap, t_StackSize + t_PageSize);
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,62 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * WaitCondition.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber aware condition variable
+ *
+ */
+
+
+#include <CxxAbb/Fiber/WaitCondition.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+void WaitCondition::Signal()
+{
+	Waiter * pWaiter;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lckQueue(m_Spin);
+		pWaiter = m_Waiters.ClaimFront();
+	}
+
+	if (pWaiter)
+		pWaiter->Wake();
+}
+
+void WaitCondition::SignalAll()
+{
+	Waiter * pChain;
+	{
+		CxxAbb::Sys::SpinLock::ScopedLock lckQueue(m_Spin);
+		pChain = m_Waiters.ClaimAll();
+	}
+
+	WaitQueue::WakeAll(pChain);
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
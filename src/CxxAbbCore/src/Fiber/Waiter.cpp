@@ -0,0 +1,171 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Waiter.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Wait queue building block of fiber synchronization objects
+ *
+ */
+
+
+#include <CxxAbb/Fiber/Waiter.h>
+
+#include "FiberData.h"
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+Waiter::Waiter()
+	: p_Prev(NullPtr),
+	  p_Next(NullPtr),
+	  b_Linked(false),
+	  p_Fiber(Scheduler::CurrentFiber()),
+	  p_Event(NullPtr),
+	  i_Status(Waiting),
+	  b_TimerArmed(false),
+	  t_TimerPos()
+{
+	if (!p_Fiber)
+		p_Event = new CxxAbb::Sys::SigEvent(false);
+}
+
+Waiter::~Waiter()
+{
+	delete p_Event;
+}
+
+void Waiter::Wake()
+{
+	FiberData * pFiber = p_Fiber;
+	if (pFiber)
+		pFiber->p_Scheduler->Resume(pFiber);
+	else
+		p_Event->Set();
+}
+
+void Waiter::Block()
+{
+	if (p_Fiber)
+		Scheduler::Park();
+	else
+		p_Event->Wait();
+}
+
+bool Waiter::Block(long _lMilliSeconds)
+{
+	if (p_Fiber)
+	{
+		Scheduler * pScheduler = p_Fiber->p_Scheduler;
+		pScheduler->ArmTimer(*this, _lMilliSeconds);
+		Scheduler::Park();
+		pScheduler->DisarmTimer(*this);
+	}
+	else
+	{
+		if (!p_Event->TryWait(_lMilliSeconds) && Claim(TimedOut))
+			return false;
+
+		// notified, maybe just after the timeout
+		p_Event->Wait();
+	}
+
+	return i_Status.Load(CxxAbb::Sys::MemoryOrderAcquire) == Notified;
+}
+
+void WaitQueue::PushBack(Waiter & _waiter)
+{
+	_waiter.p_Prev = p_Tail;
+	_waiter.p_Next = NullPtr;
+	if (p_Tail)
+		p_Tail->p_Next = &_waiter;
+	else
+		p_Head = &_waiter;
+	p_Tail = &_waiter;
+	_waiter.b_Linked = true;
+}
+
+void WaitQueue::Remove(Waiter & _waiter)
+{
+	if (!_waiter.b_Linked)
+		return;
+
+	if (_waiter.p_Prev)
+		_waiter.p_Prev->p_Next = _waiter.p_Next;
+	else
+		p_Head = _waiter.p_Next;
+	if (_waiter.p_Next)
+		_waiter.p_Next->p_Prev = _waiter.p_Prev;
+	else
+		p_Tail = _waiter.p_Prev;
+
+	_waiter.p_Prev = _waiter.p_Next = NullPtr;
+	_waiter.b_Linked = false;
+}
+
+Waiter * WaitQueue::ClaimFront()
+{
+	while (p_Head)
+	{
+		Waiter * pWaiter = p_Head;
+		Remove(*pWaiter);
+		if (pWaiter->Claim(Waiter::Notified))
+			return pWaiter;
+	}
+	return NullPtr;
+}
+
+Waiter * WaitQueue::ClaimAll()
+{
+	Waiter * pChain = NullPtr;
+	Waiter * pLast = NullPtr;
+	while (p_Head)
+	{
+		Waiter * pWaiter = p_Head;
+		Remove(*pWaiter);
+		if (pWaiter->Claim(Waiter::Notified))
+		{
+			// unlinked, p_Next is free to chain the claimed ones
+			if (pLast)
+				pLast->p_Next = pWaiter;
+			else
+				pChain = pWaiter;
+			pLast = pWaiter;
+		}
+	}
+	return pChain;
+}
+
+void WaitQueue::WakeAll(Waiter * _pChain)
+{
+	while (_pChain)
+	{
+		Waiter * pNext = _pChain->p_Next;
+		_pChain->Wake();
+		_pChain = pNext;
+	}
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,116 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Context.gcc.x86_64.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber context switch in GCC x86_64 - inline assembly
+ *
+ */
+
+
+#include <cstring>
+
+/**
+ * Switch saves callee saved registers (System V AMD64 ABI), MXCSR and x87 control word
+ * on the current stack and stores the stack pointer. Resuming is the reverse.
+ *
+ * Saved frame, from the saved stack pointer upwards:
+ *   [mxcsr, x87 cw] [r15] [r14] [r13] [r12] [rbx] [rbp] [return address]
+ *
+ * A new context returns into CxxAbbFiberStart with entry function in r13 and argument in r12.
+ */
+extern "C" void CxxAbbFiberSwitch(void ** _ppFromSp, void * _pToSp);
+extern "C" void CxxAbbFiberStart();
+
+__asm__ (
+	".text\n"
+	".globl CxxAbbFiberSwitch\n"
+	".type CxxAbbFiberSwitch,@function\n"
+	".align 16\n"
+	"CxxAbbFiberSwitch:\n"
+	"	pushq %rbp\n"
+	"	pushq %rbx\n"
+	"	pushq %r12\n"
+	"	pushq %r13\n"
+	"	pushq %r14\n"
+	"	pushq %r15\n"
+	"	subq $8, %rsp\n"
+	"	stmxcsr (%rsp)\n"
+	"	fnstcw 4(%rsp)\n"
+	"	movq %rsp, (%rdi)\n"
+	"	movq %rsi, %rsp\n"
+	"	ldmxcsr (%rsp)\n"
+	"	fldcw 4(%rsp)\n"
+	"	addq $8, %rsp\n"
+	"	popq %r15\n"
+	"	popq %r14\n"
+	"	popq %r13\n"
+	"	popq %r12\n"
+	"	popq %rbx\n"
+	"	popq %rbp\n"
+	"	ret\n"
+	".size CxxAbbFiberSwitch,.-CxxAbbFiberSwitch\n"
+	".globl CxxAbbFiberStart\n"
+	".type CxxAbbFiberStart,@function\n"
+	".align 16\n"
+	"CxxAbbFiberStart:\n"
+	"	movq %r12, %rdi\n"
+	"	callq *%r13\n"
+	"	ud2\n"
+	".size CxxAbbFiberStart,.-CxxAbbFiberStart\n"
+);
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+void ContextMake(Context & _ctx, void * _pStack, std::size_t _tSize, ContextEntry _fpEntry, void * _pArg)
+{
+	CxxAbb::UPtrT uiTop = reinterpret_cast<CxxAbb::UPtrT>(_pStack) + _tSize;
+	uiTop &= ~static_cast<CxxAbb::UPtrT>(15);
+
+	// 16 byte aligned frame, so that CxxAbbFiberStart calls entry with an ABI aligned stack
+	void ** pFrame = reinterpret_cast<void**>(uiTop - 80);
+	std::memset(pFrame, 0, 80);
+
+	CxxAbb::UInt32 uiMxcsr = 0x1F80;
+	CxxAbb::UInt16 uiFpuCw = 0x037F;
+	std::memcpy(pFrame, &uiMxcsr, sizeof(uiMxcsr));
+	std::memcpy(reinterpret_cast<char*>(pFrame) + 4, &uiFpuCw, sizeof(uiFpuCw));
+
+	void (*fpStart)() = CxxAbbFiberStart;
+	std::memcpy(&pFrame[3], &_fpEntry, sizeof(void*));   // r13
+	pFrame[4] = _pArg;                                     // r12
+	std::memcpy(&pFrame[7], &fpStart, sizeof(void*));    // return address
+
+	_ctx.p_StackPtr = pFrame;
+}
+
+void ContextSwitch(Context & _from, Context & _to)
+{
+	CxxAbbFiberSwitch(&_from.p_StackPtr, _to.p_StackPtr);
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
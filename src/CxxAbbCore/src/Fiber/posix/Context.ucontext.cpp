@@ -0,0 +1,74 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Context.ucontext.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber context switch with POSIX ucontext - portable fallback
+ *
+ */
+
+
+#include <CxxAbb/Exception.h>
+
+namespace CxxAbb
+{
+
+namespace Fiber
+{
+
+namespace
+{
+
+/// makecontext passes only int arguments, pointer is split into two halves
+extern "C" void ContextTrampoline(unsigned int _uiHigh, unsigned int _uiLow)
+{
+	CxxAbb::UPtrT uiPtr = (static_cast<CxxAbb::UPtrT>(_uiHigh) << 16 << 16) | _uiLow;
+	Context * pCtx = reinterpret_cast<Context*>(uiPtr);
+	pCtx->fp_Entry(pCtx->p_Arg);
+}
+
+}
+
+void ContextMake(Context & _ctx, void * _pStack, std::size_t _tSize, ContextEntry _fpEntry, void * _pArg)
+{
+	if (getcontext(&_ctx.t_Context) != 0)
+		throw CxxAbb::SystemException("getcontext failed");
+
+	_ctx.t_Context.uc_stack.ss_sp = _pStack;
+	_ctx.t_Context.uc_stack.ss_size = _tSize;
+	_ctx.t_Context.uc_link = NullPtr;
+	_ctx.fp_Entry = _fpEntry;
+	_ctx.p_Arg = _pArg;
+
+	CxxAbb::UPtrT uiPtr = reinterpret_cast<CxxAbb::UPtrT>(&_ctx);
+	makecontext(&_ctx.t_Context, reinterpret_cast<void (*)()>(ContextTrampoline), 2,
+			static_cast<unsigned int>(uiPtr >> 16 >> 16), static_cast<unsigned int>(uiPtr));
+}
+
+void ContextSwitch(Context & _from, Context & _to)
+{
+	if (swapcontext(&_from.t_Context, &_to.t_Context) != 0)
+		throw CxxAbb::SystemException("swapcontext failed");
+}
+
+}  /* namespace Fiber */
+
+}  /* namespace CxxAbb */
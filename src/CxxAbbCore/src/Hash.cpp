@@ -0,0 +1,77 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Hash.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Hash functors for the hash containers
+ *
+ */
+
+
+#include <CxxAbb/Hash.h>
+#include <CxxAbb/BitOps.h>
+
+namespace CxxAbb
+{
+
+namespace
+{
+
+const UInt64 C1 = 0x87C37B91114253D5ULL;
+const UInt64 C2 = 0x4CF5AD432745937FULL;
+
+inline UInt64 Load64(const unsigned char * _pData)
+{
+	UInt64 uiValue;
+	std::memcpy(&uiValue, _pData, sizeof(uiValue));
+	return uiValue;
+}
+
+/// One MurmurHash3 style round
+inline UInt64 Round(UInt64 _uiHash, UInt64 _uiWord)
+{
+	_uiWord *= C1;
+	_uiWord = RotateLeft(_uiWord, 31);
+	_uiWord *= C2;
+	_uiHash ^= _uiWord;
+	return RotateLeft(_uiHash, 27) * 5 + 0x52DCE729;
+}
+
+}  /* namespace */
+
+UInt64 HashBytes(const void * _pData, std::size_t _tSize, UInt64 _uiSeed)
+{
+	const unsigned char * p = static_cast<const unsigned char *>(_pData);
+	UInt64 uiHash = _uiSeed ^ (static_cast<UInt64>(_tSize) * C2);
+
+	std::size_t tLeft = _tSize;
+	for (; tLeft >= 8; tLeft -= 8, p += 8)
+		uiHash = Round(uiHash, Load64(p));
+	if (tLeft)
+	{
+		UInt64 uiTail = 0;
+		std::memcpy(&uiTail, p, tLeft);
+		uiHash = Round(uiHash, uiTail);
+	}
+	return HashMix(uiHash ^ _tSize);
+}
+
+}  /* namespace CxxAbb */
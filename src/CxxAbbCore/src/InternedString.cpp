@@ -0,0 +1,180 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * InternedString.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Process wide table of unique strings
+ *
+ */
+
+
+#include <CxxAbb/InternedString.h>
+#include <CxxAbb/FlatHashMap.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+#include <CxxAbb/Sys/SpinLock.h>
+
+#include <ostream>
+
+namespace CxxAbb
+{
+
+namespace
+{
+
+/// Characters of an entry, or of a string being looked up
+struct Key
+{
+	const char * p_Data;
+	std::size_t t_Size;
+	UInt64 ui_Hash;
+};
+
+struct KeyHash
+{
+	UInt64 operator ()(const Key & _key) const
+	{
+		return _key.ui_Hash;
+	}
+};
+
+struct KeyEqual
+{
+	bool operator ()(const Key & _lhs, const Key & _rhs) const
+	{
+		return _lhs.t_Size == _rhs.t_Size && std::memcmp(_lhs.p_Data, _rhs.p_Data, _lhs.t_Size) == 0;
+	}
+};
+
+struct Shard
+{
+	Sys::RWSpinLock m_Lock;
+	FlatHashMap<Key, Dp::InternEntry*, KeyHash, KeyEqual> m_Entries;
+};
+
+const unsigned int ShardBits = 5;
+
+/// Never destroyed: handles in static objects stay valid while those are torn down
+Sys::CachePadded<Shard> * Shards()
+{
+	static Sys::CachePadded<Shard> * s_pShards = new Sys::CachePadded<Shard>[1U << ShardBits];
+	return s_pShards;
+}
+
+Dp::InternEntry * NewEntry(const char * _pData, std::size_t _tSize, UInt64 _uiHash)
+{
+	Dp::InternEntry * pEntry = new Dp::InternEntry();
+	pEntry->m_Value = SharedString(_pData, _tSize);
+	pEntry->ui_Hash = _uiHash;
+	return pEntry;
+}
+
+Dp::InternEntry * EmptyEntry()
+{
+	static Dp::InternEntry * s_pEntry = NewEntry("", 0, HashBytes("", 0));
+	return s_pEntry;
+}
+
+}
+
+InternedString::InternedString()
+	: p_Entry(EmptyEntry())
+{}
+
+InternedString::InternedString(const char * _zValue)
+{
+	Intern(_zValue, std::strlen(_zValue));
+}
+
+InternedString::InternedString(const char * _pData, std::size_t _tSize)
+{
+	Intern(_pData, _tSize);
+}
+
+InternedString::InternedString(const std::string & _sValue)
+{
+	Intern(_sValue.data(), _sValue.size());
+}
+
+InternedString::InternedString(const SharedString & _value)
+{
+	Intern(_value.data(), _value.size());
+}
+
+void InternedString::Intern(const char * _pData, std::size_t _tSize)
+{
+	if (_tSize == 0)
+	{
+		p_Entry = EmptyEntry();
+		return;
+	}
+
+	Key key = { _pData, _tSize, HashBytes(_pData, _tSize) };
+	Shard & shard = *Shards()[key.ui_Hash >> (64 - ShardBits)];
+	{
+		Sys::RWSpinLock::ScopedReadLock lock(shard.m_Lock);
+		FlatHashMap<Key, Dp::InternEntry*, KeyHash, KeyEqual>::ConstIterator it = shard.m_Entries.Find(key);
+		if (it != shard.m_Entries.end())
+		{
+			p_Entry = it->second;
+			return;
+		}
+	}
+
+	Sys::RWSpinLock::ScopedLock lock(shard.m_Lock);
+	FlatHashMap<Key, Dp::InternEntry*, KeyHash, KeyEqual>::Iterator it = shard.m_Entries.Find(key);
+	if (it != shard.m_Entries.end())
+	{
+		p_Entry = it->second;
+		return;
+	}
+
+	Dp::InternEntry * pEntry = NewEntry(_pData, _tSize, key.ui_Hash);
+	// the table key points into the entry, which never moves
+	key.p_Data = pEntry->m_Value.data();
+	try
+	{
+		shard.m_Entries.Insert(key, pEntry);
+	}
+	catch (...)
+	{
+		delete pEntry;
+		throw;
+	}
+	p_Entry = pEntry;
+}
+
+std::size_t InternedString::TableSize()
+{
+	std::size_t tSize = 0;
+	for (unsigned int i = 0; i < (1U << ShardBits); ++i)
+	{
+		Sys::RWSpinLock::ScopedReadLock lock(Shards()[i]->m_Lock);
+		tSize += Shards()[i]->m_Entries.Size();
+	}
+	return tSize;
+}
+
+std::ostream & operator << (std::ostream & _os, const InternedString & _value)
+{
+	return _os << _value.Value();
+}
+
+} /* namespace CxxAbb */
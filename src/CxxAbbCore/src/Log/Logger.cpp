@@ -0,0 +1,766 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Logger.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Logging
+ * Comment     : Asynchronous logger with per thread lock free rings
+ *
+ */
+
+#include <CxxAbb/Log/Logger.h>
+#include <CxxAbb/Log/Sink.h>
+#include <CxxAbb/DateTime.h>
+#include <CxxAbb/NumberFormat.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Timestamp.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/SignalToException.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Exception.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace CxxAbb
+{
+
+namespace Log
+{
+
+namespace
+{
+
+/** @brief Binary log record, formatted only by the writer
+ *
+ * String arguments are copied to a_Text, their value holds (offset << 8) | length.
+ */
+struct Record
+{
+	enum
+	{
+		TextBytes = 112
+	};
+
+	Timestamp::TimeVal i_Time;        /// epoch microseconds
+	const char * z_Format;
+	UInt8 e_Level;
+	UInt8 ui_Args;
+	UInt8 ui_TextUsed;
+	UInt8 a_Types[Logger::MaxArgs];
+	union
+	{
+		Int64 i;
+		UInt64 ui;
+		double d;
+		const void * p;
+	} a_Values[Logger::MaxArgs];
+	char a_Text[TextBytes];
+};
+
+/** @brief Single producer single consumer ring of one thread, records are filled in place */
+class Ring : private NonCopyable
+{
+public:
+	Ring(std::size_t _tCapacity, int _iTid)
+		: a_Records(new Record[_tCapacity]()), // zeroed, page faults happen here and not while logging
+		  t_Mask(_tCapacity - 1),
+		  ui_Head(0),
+		  ui_Tail(0),
+		  i_Tid(_iTid),
+		  i_Exited(0)
+	{}
+
+	~Ring()
+	{
+		delete [] a_Records;
+	}
+
+	/// producer side, NullPtr when full
+	Record * Reserve()
+	{
+		if (ui_Head - Sys::AtomicLoad(&ui_Tail, Sys::MemoryOrderAcquire) > t_Mask)
+			return NullPtr;
+		return &a_Records[ui_Head & t_Mask];
+	}
+
+	void Commit()
+	{
+		Sys::AtomicStore(&ui_Head, ui_Head + 1, Sys::MemoryOrderRelease);
+	}
+
+	/// consumer side, NullPtr when empty
+	const Record * Front() const
+	{
+		UInt64 uiTail = ui_Tail;
+		if (uiTail == Sys::AtomicLoad(&ui_Head, Sys::MemoryOrderAcquire))
+			return NullPtr;
+		return &a_Records[uiTail & t_Mask];
+	}
+
+	void Pop()
+	{
+		Sys::AtomicStore(&ui_Tail, ui_Tail + 1, Sys::MemoryOrderRelease);
+	}
+
+	Record * a_Records;
+	std::size_t t_Mask;
+	volatile UInt64 ui_Head;
+	char a_Pad[64];           /// keep producer and consumer indexes on separate lines
+	volatile UInt64 ui_Tail;
+	int i_Tid;
+	volatile int i_Exited;
+};
+
+/** @brief Formatted lines waiting for the sink, one iovec per line */
+class Batch : private NonCopyable
+{
+public:
+	enum
+	{
+		SlabBytes = 256 * 1024,
+		MaxLine = 4096,
+		MaxLines = 1024
+	};
+
+	Batch()
+		: a_Slab(new char[SlabBytes]),
+		  t_Used(0),
+		  i_Lines(0)
+	{}
+
+	~Batch()
+	{
+		delete [] a_Slab;
+	}
+
+	bool HasRoom() const
+	{
+		return i_Lines < MaxLines && SlabBytes - t_Used >= MaxLine;
+	}
+
+	/// space for the next line, at least MaxLine bytes
+	char * Begin()
+	{
+		return a_Slab + t_Used;
+	}
+
+	void Add(std::size_t _tLength)
+	{
+		a_Lines[i_Lines].iov_base = a_Slab + t_Used;
+		a_Lines[i_Lines].iov_len = _tLength;
+		++i_Lines;
+		t_Used += _tLength;
+	}
+
+	void Write(Sink & _sink)
+	{
+		if (i_Lines > 0)
+			_sink.Write(a_Lines, i_Lines);
+		t_Used = 0;
+		i_Lines = 0;
+	}
+
+	/// lines already formatted but not yet written, with plain write(2) only
+	void CrashWrite(int _iFd)
+	{
+		for (int i = 0; i < i_Lines && _iFd >= 0; ++i)
+		{
+			const char * pData = static_cast<const char*>(a_Lines[i].iov_base);
+			std::size_t tLeft = a_Lines[i].iov_len;
+			while (tLeft > 0)
+			{
+				ssize_t tWritten = ::write(_iFd, pData, tLeft);
+				if (tWritten < 0 && errno == EINTR)
+					continue;
+				if (tWritten <= 0)
+					return;
+				pData += tWritten;
+				tLeft -= static_cast<std::size_t>(tWritten);
+			}
+		}
+		t_Used = 0;
+		i_Lines = 0;
+	}
+
+private:
+	char * a_Slab;
+	std::size_t t_Used;
+	int i_Lines;
+	struct iovec a_Lines[MaxLines];
+};
+
+/** @brief Bounded appender for one line */
+class LineWriter
+{
+public:
+	LineWriter(char * _pBegin, std::size_t _tCapacity)
+		: p_Begin(_pBegin),
+		  p_Pos(_pBegin),
+		  p_End(_pBegin + _tCapacity - 1) // room for the newline
+	{}
+
+	void Append(const char * _pData, std::size_t _tLength)
+	{
+		std::size_t tRoom = static_cast<std::size_t>(p_End - p_Pos);
+		if (_tLength > tRoom)
+			_tLength = tRoom;
+		std::memcpy(p_Pos, _pData, _tLength);
+		p_Pos += _tLength;
+	}
+
+	void Append(const char * _zText)
+	{
+		Append(_zText, std::strlen(_zText));
+	}
+
+	void Append(char _c)
+	{
+		if (p_Pos < p_End)
+			*p_Pos++ = _c;
+	}
+
+	void AppendUInt(UInt64 _uiValue, int _iWidth = 0)
+	{
+		char aDigits[NumberFormat::MaxUInt64Chars];
+		int iLength = static_cast<int>(NumberFormat::FormatUInt64(aDigits, _uiValue));
+		for (; iLength < _iWidth; --_iWidth)
+			Append('0');
+		Append(aDigits, static_cast<std::size_t>(iLength));
+	}
+
+	void AppendInt(Int64 _iValue)
+	{
+		char aDigits[NumberFormat::MaxInt64Chars];
+		Append(aDigits, NumberFormat::FormatInt64(aDigits, _iValue));
+	}
+
+	void AppendDouble(double _dValue)
+	{
+		char aDigits[NumberFormat::MaxDoubleChars];
+		Append(aDigits, NumberFormat::FormatDouble(aDigits, _dValue));
+	}
+
+	/// terminates the line, returns its length
+	std::size_t Finish()
+	{
+		*p_Pos++ = '\n';
+		return static_cast<std::size_t>(p_Pos - p_Begin);
+	}
+
+private:
+	char * p_Begin;
+	char * p_Pos;
+	char * p_End;
+};
+
+/** @brief The writer thread, woken through a POSIX semaphore since sem_post() is async signal safe */
+class Writer: public CxxAbb::Runnable
+{
+public:
+	Writer()
+		: i_Stop(0),
+		  i_Running(0),
+		  i_Tid(0),
+		  l_Interval(100)
+	{
+		::sem_init(&m_Wake, 0, 0);
+	}
+
+	void Run();
+
+	/// one post is enough however many wakes are pending
+	void Wake()
+	{
+		int iValue = 0;
+		if (::sem_getvalue(&m_Wake, &iValue) != 0 || iValue <= 0)
+			::sem_post(&m_Wake);
+	}
+
+	sem_t m_Wake;
+	volatile int i_Stop;
+	volatile int i_Running;    /// between Start() and Stop(), the thread may not have begun yet
+	volatile int i_Tid;        /// kernel id of the writer thread once it runs
+	long l_Interval;
+
+private:
+	/// waits up to l_Interval for a wake, then takes every post made meanwhile
+	void Sleep();
+};
+
+/// Logger state, never destroyed: threads may log while the process exits
+struct LoggerState
+{
+	LoggerState()
+		: p_Sink(NullPtr),
+		  p_Thread(NullPtr),
+		  e_Overflow(OverflowDrop),
+		  t_RingRecords(4096),
+		  ui_Dropped(0),
+		  ui_Written(0),
+		  ui_FlushRequested(0),
+		  ui_FlushDone(0),
+		  i_CrashFlushing(0),
+		  i_CachedSecond(-1)
+	{
+		std::memset(a_CachedPrefix, 0, sizeof(a_CachedPrefix));
+		::pthread_key_create(&t_Key, &LoggerState::ThreadExit);
+	}
+
+	/// the writer frees the ring once drained, a later record of this thread gets a new one
+	static void ThreadExit(void * _pRing);
+
+	Sys::FastMutex mtx_Control;   /// serializes Start / Stop
+	Sys::FastMutex mtx_Rings;     /// ring list, batch and sink
+	std::vector<Ring*> lst_Rings;
+
+	Sink * p_Sink;
+	Batch m_Batch;
+	Writer m_Writer;
+	Sys::Thread * p_Thread;
+
+	volatile int e_Overflow;
+	std::size_t t_RingRecords;
+	Sys::Atomic<UInt64> ui_Dropped;
+	Sys::Atomic<UInt64> ui_Written;
+	Sys::Atomic<UInt64> ui_FlushRequested;
+	Sys::Atomic<UInt64> ui_FlushDone;
+	volatile int i_CrashFlushing;  /// set while a crash handler runs, a nested crash skips the flush
+
+	/// "YYYY-MM-DD hh:mm:ss" of i_CachedSecond, DateTime conversion once per second
+	Int64 i_CachedSecond;
+	char a_CachedPrefix[48];
+
+	pthread_key_t t_Key;
+};
+
+const int CrashWaitMilliSeconds = 200;
+
+LoggerState * g_State = 0;
+Sys::OnceFlag g_StateOnce = CXXABB_ONCE_INIT;
+Sys::OnceFlag g_CrashHandlerOnce = CXXABB_ONCE_INIT;
+__thread Ring * t_Ring = 0;
+
+void LoggerState::ThreadExit(void * _pRing)
+{
+	if (t_Ring == _pRing)
+		t_Ring = 0;
+	Sys::AtomicStore(&static_cast<Ring*>(_pRing)->i_Exited, 1, Sys::MemoryOrderRelease);
+}
+
+void CreateState()
+{
+	g_State = new LoggerState;
+}
+
+LoggerState & State()
+{
+	Sys::CallOnce(g_StateOnce, &CreateState);
+	return *g_State;
+}
+
+void InstallCrashHandler()
+{
+#if defined(CXXABB_OS_FAMILY_UNIX)
+	Sys::SignalToException::AddCrashHandler(&Logger::CrashFlush);
+#endif
+}
+
+void AppendTime(LoggerState & _state, LineWriter & _line, Timestamp::TimeVal _iTime)
+{
+	Int64 iSecond = _iTime / Timestamp::MuSecPerSecond;
+	if (iSecond != _state.i_CachedSecond)
+	{
+		DateTime dt(static_cast<std::time_t>(iSecond));
+		std::sprintf(_state.a_CachedPrefix, "%04d-%02d-%02d %02d:%02d:%02d",
+				dt.Year(), dt.Month(), dt.Day(), dt.Hour(), dt.Minute(), dt.Second());
+		_state.i_CachedSecond = iSecond;
+	}
+	_line.Append(_state.a_CachedPrefix);
+	_line.Append('.');
+	_line.AppendUInt(static_cast<UInt64>(_iTime % Timestamp::MuSecPerSecond), 6);
+}
+
+void AppendArg(LineWriter & _line, const Record & _record, int _iArg)
+{
+	char aBuffer[40];
+	switch (_record.a_Types[_iArg])
+	{
+		case Arg::TypeInt:
+			_line.AppendInt(_record.a_Values[_iArg].i);
+			break;
+		case Arg::TypeUInt:
+			_line.AppendUInt(_record.a_Values[_iArg].ui);
+			break;
+		case Arg::TypeDouble:
+			_line.AppendDouble(_record.a_Values[_iArg].d);
+			break;
+		case Arg::TypeBool:
+			_line.Append(_record.a_Values[_iArg].ui ? "true" : "false");
+			break;
+		case Arg::TypeChar:
+			_line.Append(static_cast<char>(_record.a_Values[_iArg].ui));
+			break;
+		case Arg::TypeString:
+			_line.Append(_record.a_Text + (_record.a_Values[_iArg].ui >> 8),
+					static_cast<std::size_t>(_record.a_Values[_iArg].ui & 0xFF));
+			break;
+		case Arg::TypePointer:
+			std::sprintf(aBuffer, "%p", _record.a_Values[_iArg].p);
+			_line.Append(aBuffer);
+			break;
+	}
+}
+
+void Format(LoggerState & _state, LineWriter & _line, const Record & _record, int _iTid)
+{
+	AppendTime(_state, _line, _record.i_Time);
+	_line.Append(' ');
+	_line.Append(Logger::LevelName(static_cast<Level>(_record.e_Level)));
+	_line.Append(" [");
+	_line.AppendUInt(static_cast<UInt64>(_iTid));
+	_line.Append("] ");
+
+	int iArg = 0;
+	for (const char * z = _record.z_Format; *z; ++z)
+	{
+		if (z[0] == '{' && z[1] == '}' && iArg < _record.ui_Args)
+		{
+			AppendArg(_line, _record, iArg++);
+			++z;
+		}
+		else
+			_line.Append(*z);
+	}
+}
+
+/** @brief Format all queued records into the sink, frees rings of exited threads once empty
+ *  Call with mtx_Rings held and a sink set.
+ */
+void Drain(LoggerState & _state)
+{
+	UInt64 uiWritten = 0;
+	for (std::size_t i = 0; i < _state.lst_Rings.size();)
+	{
+		Ring * pRing = _state.lst_Rings[i];
+		bool bExited = Sys::AtomicLoad(&pRing->i_Exited, Sys::MemoryOrderAcquire) != 0;
+
+		for (const Record * pRecord = pRing->Front(); pRecord; pRecord = pRing->Front())
+		{
+			if (!_state.m_Batch.HasRoom())
+				_state.m_Batch.Write(*_state.p_Sink);
+
+			LineWriter line(_state.m_Batch.Begin(), Batch::MaxLine);
+			Format(_state, line, *pRecord, pRing->i_Tid);
+			_state.m_Batch.Add(line.Finish());
+			pRing->Pop();
+			++uiWritten;
+		}
+
+		if (bExited)
+		{
+			delete pRing;
+			_state.lst_Rings[i] = _state.lst_Rings.back();
+			_state.lst_Rings.pop_back();
+		}
+		else
+			++i;
+	}
+	_state.m_Batch.Write(*_state.p_Sink);
+	_state.ui_Written.FetchAdd(uiWritten, Sys::MemoryOrderRelaxed);
+}
+
+void Writer::Sleep()
+{
+	struct timeval tv;
+	struct timespec abstime;
+	::gettimeofday(&tv, NULL);
+	abstime.tv_sec = tv.tv_sec + l_Interval / 1000;
+	abstime.tv_nsec = tv.tv_usec * 1000 + (l_Interval % 1000) * 1000000;
+	if (abstime.tv_nsec >= 1000000000)
+	{
+		abstime.tv_nsec -= 1000000000;
+		abstime.tv_sec++;
+	}
+
+	while (::sem_timedwait(&m_Wake, &abstime) != 0 && errno == EINTR)
+	{
+	}
+	while (::sem_trywait(&m_Wake) == 0)
+	{
+	}
+}
+
+void Writer::Run()
+{
+	LoggerState & state = State();
+	Sys::AtomicStore(&i_Tid, static_cast<int>(::syscall(SYS_gettid)), Sys::MemoryOrderRelease);
+	while (!Sys::AtomicLoad(&i_Stop, Sys::MemoryOrderAcquire))
+	{
+		Sleep();
+
+		Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+		UInt64 uiTicket = state.ui_FlushRequested.Load(Sys::MemoryOrderAcquire);
+		Drain(state);
+		if (uiTicket != state.ui_FlushDone.Load(Sys::MemoryOrderRelaxed))
+		{
+			state.p_Sink->Flush();
+			state.ui_FlushDone.Store(uiTicket, Sys::MemoryOrderRelease);
+		}
+	}
+	Sys::AtomicStore(&i_Tid, 0, Sys::MemoryOrderRelease);
+}
+
+Ring * CreateRing()
+{
+	LoggerState & state = State();
+	Ring * pRing = new Ring(state.t_RingRecords, static_cast<int>(::syscall(SYS_gettid)));
+	{
+		Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+		state.lst_Rings.push_back(pRing);
+	}
+	::pthread_setspecific(state.t_Key, pRing);
+	t_Ring = pRing;
+	return pRing;
+}
+
+/// Ring slot for a record, waits for room under OverflowBlock, NullPtr when dropped
+Record * Reserve(Ring & _ring, Level _eLevel)
+{
+	Record * pRecord = _ring.Reserve();
+	if (pRecord)
+		return pRecord;
+
+	LoggerState & state = *g_State;
+	if (Sys::AtomicLoad(&state.e_Overflow, Sys::MemoryOrderRelaxed) == OverflowBlock)
+	{
+		// the writer may be stopped meanwhile, then IsEnabled() turns false
+		while (!pRecord && Logger::IsEnabled(_eLevel))
+		{
+			state.m_Writer.Wake();
+			Sys::Thread::Yield();
+			pRecord = _ring.Reserve();
+		}
+		if (pRecord)
+			return pRecord;
+	}
+	state.ui_Dropped.FetchAdd(1, Sys::MemoryOrderRelaxed);
+	return NullPtr;
+}
+
+}
+
+volatile int Logger::i_Level = LevelFatal + 1;
+
+void Logger::Start(Sink * _pSink, const LoggerOptions & _options)
+{
+	LoggerState & state = State();
+	Sys::FastMutex::ScopedLock control(state.mtx_Control);
+	if (state.p_Thread)
+	{
+		delete _pSink;
+		throw IllegalStateException("Logger already started");
+	}
+	if (!_pSink)
+		throw InvalidArgumentException("Logger needs a sink");
+
+	{
+		Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+		std::size_t tCapacity = 16;
+		while (tCapacity < _options.t_RingRecords)
+		{
+			tCapacity *= 2;
+		}
+		// only rings of threads that log for the first time get the new capacity
+		state.t_RingRecords = tCapacity;
+		state.e_Overflow = _options.e_Overflow;
+		state.ui_Dropped.Store(0);
+		state.ui_Written.Store(0);
+		state.p_Sink = _pSink;
+	}
+
+	Sys::CallOnce(g_CrashHandlerOnce, &InstallCrashHandler);
+
+	state.m_Writer.l_Interval = _options.l_FlushMilliSeconds > 0 ? _options.l_FlushMilliSeconds : 1;
+	Sys::AtomicStore(&state.m_Writer.i_Stop, 0, Sys::MemoryOrderRelease);
+	Sys::AtomicStore(&state.m_Writer.i_Running, 1, Sys::MemoryOrderRelease);
+	state.p_Thread = new Sys::Thread("LogWriter");
+	state.p_Thread->Start(state.m_Writer);
+
+	Sys::AtomicStore(&i_Level, static_cast<int>(_options.e_Level), Sys::MemoryOrderRelease);
+}
+
+void Logger::Stop()
+{
+	LoggerState & state = State();
+	Sys::FastMutex::ScopedLock control(state.mtx_Control);
+	if (!state.p_Thread)
+		return;
+
+	Sys::AtomicStore(&i_Level, static_cast<int>(LevelFatal + 1), Sys::MemoryOrderRelease);
+
+	Sys::AtomicStore(&state.m_Writer.i_Stop, 1, Sys::MemoryOrderRelease);
+	state.m_Writer.Wake();
+	state.p_Thread->Join();
+	delete state.p_Thread;
+	state.p_Thread = NullPtr;
+	Sys::AtomicStore(&state.m_Writer.i_Running, 0, Sys::MemoryOrderRelease);
+
+	Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+	Drain(state);
+	state.p_Sink->Flush();
+	delete state.p_Sink;
+	state.p_Sink = NullPtr;
+}
+
+void Logger::Flush()
+{
+	LoggerState & state = State();
+	Sys::FastMutex::ScopedLock control(state.mtx_Control);
+	if (!state.p_Thread)
+		return;
+
+	UInt64 uiTicket = state.ui_FlushRequested.FetchAdd(1, Sys::MemoryOrderAcqRel) + 1;
+	while (static_cast<Int64>(state.ui_FlushDone.Load(Sys::MemoryOrderAcquire) - uiTicket) < 0)
+	{
+		state.m_Writer.Wake();
+		Sys::Thread::Sleep(1);
+	}
+}
+
+void Logger::CrashFlush(int)
+{
+	// runs in a signal handler: atomics, sem_post(), nanosleep() and write() only
+	if (!g_State)
+		return;
+
+	LoggerState & state = *g_State;
+	if (!Sys::AtomicLoad(&state.m_Writer.i_Running, Sys::MemoryOrderAcquire))
+		return;
+	int iIdle = 0;
+	if (!Sys::AtomicCompareExchange(&state.i_CrashFlushing, iIdle, 1))
+		return;
+
+	if (Sys::AtomicLoad(&state.m_Writer.i_Tid, Sys::MemoryOrderAcquire) == static_cast<int>(::syscall(SYS_gettid)))
+	{
+		// the writer itself crashed, it will not drain again: keep what it has formatted
+		state.m_Batch.CrashWrite(state.p_Sink->Descriptor());
+	}
+	else
+	{
+		UInt64 uiTicket = state.ui_FlushRequested.FetchAdd(1, Sys::MemoryOrderAcqRel) + 1;
+		::sem_post(&state.m_Writer.m_Wake);
+
+		// do not wait forever for a writer blocked by the crashed thread
+		struct timespec tick = { 0, 1000000 };
+		for (int i = 0; i < CrashWaitMilliSeconds; ++i)
+		{
+			if (static_cast<Int64>(state.ui_FlushDone.Load(Sys::MemoryOrderAcquire) - uiTicket) >= 0)
+				break;
+			::nanosleep(&tick, NullPtr);
+		}
+	}
+	Sys::AtomicStore(&state.i_CrashFlushing, 0, Sys::MemoryOrderRelease);
+}
+
+void Logger::SetLevel(Level _eLevel)
+{
+	LoggerState & state = State();
+	Sys::FastMutex::ScopedLock control(state.mtx_Control);
+	if (state.p_Thread)
+		Sys::AtomicStore(&i_Level, static_cast<int>(_eLevel), Sys::MemoryOrderRelease);
+}
+
+const char * Logger::LevelName(Level _eLevel)
+{
+	switch (_eLevel)
+	{
+		case LevelTrace:   return "TRACE";
+		case LevelDebug:   return "DEBUG";
+		case LevelInfo:    return "INFO ";
+		case LevelWarning: return "WARN ";
+		case LevelError:   return "ERROR";
+		case LevelFatal:   return "FATAL";
+	}
+	return "?    ";
+}
+
+void Logger::Write(Level _eLevel, const char * _zFormat, const Arg * _pArgs, int _iArgs)
+{
+	if (!IsEnabled(_eLevel))
+		return;
+
+	// null again once ThreadExit() retired the ring, for records from later key destructors
+	Ring * pRing = t_Ring;
+	if (!pRing)
+		pRing = CreateRing();
+
+	Record * pRecord = Reserve(*pRing, _eLevel);
+	if (!pRecord)
+		return;
+
+	pRecord->i_Time = Timestamp().EpochMicroseconds();
+	pRecord->z_Format = _zFormat;
+	pRecord->e_Level = static_cast<UInt8>(_eLevel);
+	pRecord->ui_Args = static_cast<UInt8>(_iArgs < MaxArgs ? _iArgs : MaxArgs);
+	pRecord->ui_TextUsed = 0;
+	for (int i = 0; i < pRecord->ui_Args; ++i)
+	{
+		const Arg & arg = _pArgs[i];
+		pRecord->a_Types[i] = static_cast<UInt8>(arg.e_Type);
+		if (arg.e_Type == Arg::TypeString)
+		{
+			std::size_t tOffset = pRecord->ui_TextUsed;
+			std::size_t tLength = arg.t_Length;
+			if (tLength > Record::TextBytes - tOffset)
+				tLength = Record::TextBytes - tOffset;
+			std::memcpy(pRecord->a_Text + tOffset, arg.z_String, tLength);
+			pRecord->ui_TextUsed = static_cast<UInt8>(tOffset + tLength);
+			pRecord->a_Values[i].ui = (static_cast<UInt64>(tOffset) << 8) | tLength;
+		}
+		else
+			pRecord->a_Values[i].ui = arg.u_Value.ui;
+	}
+	pRing->Commit();
+}
+
+UInt64 Logger::Dropped()
+{
+	return State().ui_Dropped.Load(Sys::MemoryOrderRelaxed);
+}
+
+UInt64 Logger::Written()
+{
+	return State().ui_Written.Load(Sys::MemoryOrderRelaxed);
+}
+
+}  /* namespace Log */
+
+}  /* namespace CxxAbb */
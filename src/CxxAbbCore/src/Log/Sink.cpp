@@ -0,0 +1,223 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Sink.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Logging
+ * Comment     : Log output destinations: file and rotating file
+ *
+ */
+
+#include <CxxAbb/Log/Sink.h>
+#include <CxxAbb/Exception.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <limits.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+namespace CxxAbb
+{
+
+namespace Log
+{
+
+Sink::~Sink()
+{
+}
+
+void Sink::Flush()
+{
+}
+
+int Sink::Descriptor() const
+{
+	return -1;
+}
+
+FileSink::FileSink(const std::string & _sPath, bool _bTruncate)
+	: s_Path(_sPath),
+	  i_Fd(-1),
+	  b_Owned(true),
+	  ui_Size(0),
+	  ui_Errors(0)
+{
+	Open(_bTruncate);
+}
+
+FileSink::FileSink(int _iFd)
+	: i_Fd(_iFd),
+	  b_Owned(false),
+	  ui_Size(0),
+	  ui_Errors(0)
+{
+}
+
+FileSink::~FileSink()
+{
+	Close();
+}
+
+void FileSink::Open(bool _bTruncate)
+{
+	int iFlags = O_WRONLY | O_CREAT | O_APPEND | (_bTruncate ? O_TRUNC : 0);
+	i_Fd = ::open(s_Path.c_str(), iFlags, 0644);
+	if (i_Fd < 0)
+		throw OpenFileException(s_Path, errno);
+
+	struct stat st;
+	ui_Size = (::fstat(i_Fd, &st) == 0) ? static_cast<UInt64>(st.st_size) : 0;
+}
+
+void FileSink::Close()
+{
+	if (b_Owned && i_Fd >= 0)
+		::close(i_Fd);
+	i_Fd = -1;
+}
+
+void FileSink::Write(const struct iovec * _pLines, int _iCount)
+{
+	WriteAll(_pLines, _iCount);
+}
+
+void FileSink::WriteAll(const struct iovec * _pLines, int _iCount)
+{
+	if (i_Fd < 0)
+	{
+		++ui_Errors;
+		return;
+	}
+
+	struct iovec aPartial[1];
+	while (_iCount > 0)
+	{
+		int iBatch = _iCount < IOV_MAX ? _iCount : IOV_MAX;
+		ssize_t tWritten = ::writev(i_Fd, _pLines, iBatch);
+		if (tWritten < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			++ui_Errors;
+			return;
+		}
+		ui_Size += static_cast<UInt64>(tWritten);
+
+		// skip the lines written completely, continue inside a partially written one
+		std::size_t tLeft = static_cast<std::size_t>(tWritten);
+		while (_iCount > 0 && tLeft >= _pLines->iov_len)
+		{
+			tLeft -= _pLines->iov_len;
+			++_pLines;
+			--_iCount;
+		}
+		if (_iCount > 0 && tLeft > 0)
+		{
+			aPartial[0].iov_base = static_cast<char *>(_pLines->iov_base) + tLeft;
+			aPartial[0].iov_len = _pLines->iov_len - tLeft;
+			WriteAll(aPartial, 1);
+			++_pLines;
+			--_iCount;
+		}
+	}
+}
+
+void FileSink::Flush()
+{
+	if (i_Fd >= 0)
+		::fdatasync(i_Fd);
+}
+
+int FileSink::Descriptor() const
+{
+	return i_Fd;
+}
+
+RotatingFileSink::RotatingFileSink(const std::string & _sPath, UInt64 _uiMaxBytes, int _iMaxFiles)
+	: FileSink(_sPath),
+	  ui_MaxBytes(_uiMaxBytes > 0 ? _uiMaxBytes : 1),
+	  i_MaxFiles(_iMaxFiles > 0 ? _iMaxFiles : 1),
+	  ui_Rotations(0)
+{
+}
+
+void RotatingFileSink::Write(const struct iovec * _pLines, int _iCount)
+{
+	while (_iCount > 0)
+	{
+		// the lines that still fit, at least one so an oversized line goes to a fresh file
+		int iFit = 0;
+		UInt64 uiSize = ui_Size;
+		while (iFit < _iCount && (uiSize + _pLines[iFit].iov_len <= ui_MaxBytes || (iFit == 0 && uiSize == 0)))
+		{
+			uiSize += _pLines[iFit].iov_len;
+			++iFit;
+		}
+
+		if (iFit == 0)
+		{
+			Rotate();
+			continue;
+		}
+		WriteAll(_pLines, iFit);
+		_pLines += iFit;
+		_iCount -= iFit;
+	}
+}
+
+void RotatingFileSink::Rotate()
+{
+	Close();
+
+	std::ostringstream ssOldest;
+	ssOldest << s_Path << '.' << i_MaxFiles;
+	::unlink(ssOldest.str().c_str());
+	for (int i = i_MaxFiles - 1; i >= 1; --i)
+	{
+		std::ostringstream ssFrom, ssTo;
+		ssFrom << s_Path << '.' << i;
+		ssTo << s_Path << '.' << (i + 1);
+		::rename(ssFrom.str().c_str(), ssTo.str().c_str());
+	}
+	::rename(s_Path.c_str(), (s_Path + ".1").c_str());
+
+	try
+	{
+		Open(true);
+	}
+	catch (...)
+	{
+		// keep logging to nowhere rather than throwing on the writer thread
+		i_Fd = -1;
+		ui_Size = 0;
+	}
+	++ui_Rotations;
+}
+
+}  /* namespace Log */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,226 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * MappedFile.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Memory mapped file with Buffer views
+ *
+ */
+
+
+#include <CxxAbb/MappedFile.h>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace CxxAbb
+{
+
+namespace
+{
+
+std::size_t PageSize()
+{
+	static const std::size_t s_tPageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+	return s_tPageSize;
+}
+
+/// Closes the descriptor on every way out of Open(), the mapping keeps the file
+class FdGuard
+{
+public:
+	explicit FdGuard(int _iFd) : i_Fd(_iFd)
+	{}
+
+	~FdGuard()
+	{
+		::close(i_Fd);
+	}
+
+private:
+	int i_Fd;
+};
+
+/** Maps _tSize bytes of _iFd at a HugePageSize aligned address: reserves
+ * _tSize + HugePageSize of address space, maps the file over its aligned part
+ * with MAP_FIXED and gives back the rest.
+ */
+void * MapAligned(std::size_t _tSize, int _iProt, int _iFlags, int _iFd)
+{
+	std::size_t tReserved = _tSize + MappedFile::HugePageSize;
+	void * pReserved = ::mmap(NullPtr, tReserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (pReserved == MAP_FAILED)
+		return MAP_FAILED;
+
+	char * pStart = static_cast<char*>(pReserved);
+	char * pAligned = reinterpret_cast<char*>((reinterpret_cast<UPtrT>(pStart) + MappedFile::HugePageSize - 1)
+			& ~static_cast<UPtrT>(MappedFile::HugePageSize - 1));
+	void * pMapped = ::mmap(pAligned, _tSize, _iProt, _iFlags | MAP_FIXED, _iFd, 0);
+	if (pMapped == MAP_FAILED)
+	{
+		::munmap(pReserved, tReserved);
+		return MAP_FAILED;
+	}
+
+	char * pMappedEnd = pAligned + ((_tSize + PageSize() - 1) & ~(PageSize() - 1));
+	if (pAligned > pStart)
+		::munmap(pStart, static_cast<std::size_t>(pAligned - pStart));
+	if (pStart + tReserved > pMappedEnd)
+		::munmap(pMappedEnd, static_cast<std::size_t>(pStart + tReserved - pMappedEnd));
+	return pMapped;
+}
+
+int AdviceFlag(MappedFile::Advice _eAdvice)
+{
+	switch (_eAdvice)
+	{
+	case MappedFile::AdviceSequential:
+		return MADV_SEQUENTIAL;
+	case MappedFile::AdviceRandom:
+		return MADV_RANDOM;
+	case MappedFile::AdviceWillNeed:
+		return MADV_WILLNEED;
+	case MappedFile::AdviceDontNeed:
+		return MADV_DONTNEED;
+	default:
+		return MADV_NORMAL;
+	}
+}
+
+}
+
+MappedFile::MappedFile()
+	: p_Data(NullPtr),
+	  t_Size(0),
+	  e_Access(ReadOnly),
+	  e_Sharing(Shared),
+	  b_Open(false)
+{
+}
+
+MappedFile::MappedFile(const std::string & _sPath, Access _eAccess, Sharing _eSharing, int _iFlags, std::size_t _tSize)
+	: p_Data(NullPtr),
+	  t_Size(0),
+	  e_Access(ReadOnly),
+	  e_Sharing(Shared),
+	  b_Open(false)
+{
+	Open(_sPath, _eAccess, _eSharing, _iFlags, _tSize);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+void MappedFile::Open(const std::string & _sPath, Access _eAccess, Sharing _eSharing, int _iFlags, std::size_t _tSize)
+{
+	if (_tSize && _eAccess == ReadOnly)
+		throw InvalidArgumentException("MappedFile size given for a read only file: " + _sPath);
+
+	Close();
+
+	int iOpenFlags = _eAccess == ReadOnly ? O_RDONLY : (O_RDWR | (_tSize ? O_CREAT : 0));
+	int iFd = ::open(_sPath.c_str(), iOpenFlags | O_CLOEXEC, 0644);
+	if (iFd < 0)
+		throw OpenFileException(_sPath, errno);
+	FdGuard guard(iFd);
+
+	std::size_t tSize = _tSize;
+	if (tSize)
+	{
+		if (::ftruncate(iFd, static_cast<off_t>(tSize)) != 0)
+			throw FileException(_sPath, errno);
+	}
+	else
+	{
+		struct stat st;
+		if (::fstat(iFd, &st) != 0)
+			throw FileException(_sPath, errno);
+		tSize = static_cast<std::size_t>(st.st_size);
+	}
+
+	char * pData = NullPtr;
+	if (tSize)
+	{
+		int iProt = _eAccess == ReadOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+		int iFlags = _eSharing == Shared ? MAP_SHARED : MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+		if (_iFlags & Populate)
+			iFlags |= MAP_POPULATE;
+#endif
+		bool bHuge = (_iFlags & HugePages) && tSize >= HugePageSize;
+		void * pMapped = bHuge ? MapAligned(tSize, iProt, iFlags, iFd) : ::mmap(NullPtr, tSize, iProt, iFlags, iFd, 0);
+		if (pMapped == MAP_FAILED)
+			throw FileException(_sPath, errno);
+		pData = static_cast<char*>(pMapped);
+
+#if defined(MADV_HUGEPAGE)
+		if (bHuge)
+			::madvise(pData, tSize, MADV_HUGEPAGE);
+#endif
+#if !defined(MAP_POPULATE)
+		if (_iFlags & Populate)
+			::madvise(pData, tSize, MADV_WILLNEED);
+#endif
+	}
+
+	s_Path = _sPath;
+	p_Data = pData;
+	t_Size = tSize;
+	e_Access = _eAccess;
+	e_Sharing = _eSharing;
+	b_Open = true;
+}
+
+void MappedFile::Close()
+{
+	if (p_Data)
+		::munmap(p_Data, t_Size);
+	p_Data = NullPtr;
+	t_Size = 0;
+	b_Open = false;
+}
+
+void MappedFile::Advise(Advice _eAdvice, std::size_t _tOffset, std::size_t _tLength)
+{
+	if (!p_Data || _tOffset >= t_Size)
+		return;
+
+	if (_tLength == 0 || _tLength > t_Size - _tOffset)
+		_tLength = t_Size - _tOffset;
+	std::size_t tStart = _tOffset & ~(PageSize() - 1);
+	::madvise(p_Data + tStart, _tOffset + _tLength - tStart, AdviceFlag(_eAdvice));
+}
+
+void MappedFile::Sync(bool _bWait)
+{
+	if (!p_Data || e_Access == ReadOnly || e_Sharing == Private)
+		return;
+
+	if (::msync(p_Data, t_Size, _bWait ? MS_SYNC : MS_ASYNC) != 0)
+		throw WriteFileException(s_Path, errno);
+}
+
+}  /* namespace CxxAbb */
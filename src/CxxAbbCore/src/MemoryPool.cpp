@@ -31,6 +31,8 @@
 #include <CxxAbb/Sys/ScopedLock.h>
 #include <CxxAbb/Debug.h>
 
+#include <cerrno>
+
 namespace CxxAbb
 {
 
@@ -64,28 +66,36 @@ MemoryPool::~MemoryPool()
 
 void* MemoryPool::Get()
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Lock);
+	Result<void*> block = TryGet();
+	if (!block.IsOk())
+		throw CxxAbb::OutOfMemoryException("MemoryPool max limit reached", block.Error());
+	return block.Value();
+}
+
+Result<void*> MemoryPool::TryGet()
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(*mtx_Lock);
 
 	if (m_Memblocks.empty())
 	{
 		if (i_MaxBlocks == 0 || i_AllocatedBlocks < i_MaxBlocks)
 		{
 			++i_AllocatedBlocks;
-			return new char[t_BlockSize];
+			return static_cast<void*>(new char[t_BlockSize]);
 		}
-		else throw CxxAbb::OutOfMemoryException("MemoryPool max limit reached");
+		else return Fail(ENOMEM);
 	}
 	else
 	{
 		char* ptr = m_Memblocks.back();
 		m_Memblocks.pop_back();
-		return ptr;
+		return static_cast<void*>(ptr);
 	}
 }
 
 void MemoryPool::Release(void* _pBlock)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_Lock);
+	CxxAbb::Sys::FastMutex::ScopedLock lock(*mtx_Lock);
 
 	m_Memblocks.push_back(reinterpret_cast<char*>(_pBlock));
 }
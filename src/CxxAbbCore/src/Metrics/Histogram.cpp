@@ -0,0 +1,168 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Histogram.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Metrics
+ * Comment     : Sharded log-linear latency histogram
+ *
+ */
+
+#include <CxxAbb/Metrics/Histogram.h>
+
+#include <algorithm>
+
+namespace CxxAbb
+{
+
+namespace Metrics
+{
+
+HistogramSnapshot::HistogramSnapshot()
+	: lst_Buckets(Buckets, 0),
+	  ui_Count(0),
+	  ui_Sum(0),
+	  ui_Max(0)
+{
+}
+
+UInt64 HistogramSnapshot::BucketLow(unsigned int _uiBucket)
+{
+	if (_uiBucket < SubBuckets)
+		return _uiBucket;
+
+	unsigned int uiShift = _uiBucket / SubBuckets - 1;
+	UInt64 uiSub = _uiBucket % SubBuckets;
+	return (SubBuckets + uiSub) << uiShift;
+}
+
+UInt64 HistogramSnapshot::BucketHigh(unsigned int _uiBucket)
+{
+	if (_uiBucket < SubBuckets)
+		return _uiBucket;
+
+	unsigned int uiShift = _uiBucket / SubBuckets - 1;
+	return BucketLow(_uiBucket) + ((static_cast<UInt64>(1) << uiShift) - 1);
+}
+
+void HistogramSnapshot::Merge(const HistogramSnapshot & _other)
+{
+	for (std::size_t i = 0; i < lst_Buckets.size(); ++i)
+	{
+		lst_Buckets[i] += _other.lst_Buckets[i];
+	}
+	ui_Count += _other.ui_Count;
+	ui_Sum += _other.ui_Sum;
+	ui_Max = std::max(ui_Max, _other.ui_Max);
+}
+
+UInt64 HistogramSnapshot::Percentile(double _dPercent) const
+{
+	if (ui_Count == 0)
+		return 0;
+
+	UInt64 uiRank = static_cast<UInt64>(static_cast<double>(ui_Count) * _dPercent / 100.0);
+	if (uiRank >= ui_Count)
+		uiRank = ui_Count - 1;
+
+	UInt64 uiSeen = 0;
+	for (unsigned int i = 0; i < lst_Buckets.size(); ++i)
+	{
+		uiSeen += lst_Buckets[i];
+		if (uiSeen > uiRank)
+			return std::min(BucketHigh(i), ui_Max);
+	}
+	return ui_Max;
+}
+
+double HistogramSnapshot::Mean() const
+{
+	return ui_Count ? static_cast<double>(ui_Sum) / static_cast<double>(ui_Count) : 0.0;
+}
+
+Histogram::Histogram()
+	: p_Shards(static_cast<Shard * volatile *>(Sys::AllocateCacheAligned(sizeof(Shard*) * Sys::Stripes::Count()))),
+	  ui_Mask(Sys::Stripes::Count() - 1)
+{
+}
+
+Histogram::~Histogram()
+{
+	for (unsigned int i = 0; i <= ui_Mask; ++i)
+	{
+		Sys::FreeCacheAligned(p_Shards[i]);
+	}
+	Sys::FreeCacheAligned(const_cast<Shard**>(p_Shards));
+}
+
+Histogram::Shard * Histogram::CreateShard()
+{
+	Shard * volatile & pSlot = p_Shards[Sys::Stripes::Current() & ui_Mask];
+	Shard * pShard = static_cast<Shard*>(Sys::AllocateCacheAligned(sizeof(Shard)));
+	Shard * pExpected = NullPtr;
+	if (!Sys::AtomicCompareExchange(&pSlot, pExpected, pShard, Sys::MemoryOrderAcqRel))
+	{
+		// another writer on this shard won
+		Sys::FreeCacheAligned(pShard);
+		return pExpected;
+	}
+	return pShard;
+}
+
+void Histogram::Snapshot(HistogramSnapshot & _snapshot) const
+{
+	_snapshot = HistogramSnapshot();
+	for (unsigned int i = 0; i <= ui_Mask; ++i)
+	{
+		const Shard * pShard = Sys::AtomicLoad(&p_Shards[i], Sys::MemoryOrderAcquire);
+		if (!pShard)
+			continue;
+
+		for (unsigned int b = 0; b < HistogramSnapshot::Buckets; ++b)
+		{
+			UInt64 uiCount = Sys::AtomicLoad(&pShard->a_Buckets[b], Sys::MemoryOrderRelaxed);
+			_snapshot.lst_Buckets[b] += uiCount;
+			_snapshot.ui_Count += uiCount;
+		}
+		_snapshot.ui_Sum += Sys::AtomicLoad(&pShard->ui_Sum, Sys::MemoryOrderRelaxed);
+		_snapshot.ui_Max = std::max(_snapshot.ui_Max, Sys::AtomicLoad(&pShard->ui_Max, Sys::MemoryOrderRelaxed));
+	}
+}
+
+void Histogram::Reset()
+{
+	for (unsigned int i = 0; i <= ui_Mask; ++i)
+	{
+		Shard * pShard = Sys::AtomicLoad(&p_Shards[i], Sys::MemoryOrderAcquire);
+		if (!pShard)
+			continue;
+
+		for (unsigned int b = 0; b < HistogramSnapshot::Buckets; ++b)
+		{
+			Sys::AtomicStore(&pShard->a_Buckets[b], static_cast<UInt64>(0), Sys::MemoryOrderRelaxed);
+		}
+		Sys::AtomicStore(&pShard->ui_Sum, static_cast<UInt64>(0), Sys::MemoryOrderRelaxed);
+		Sys::AtomicStore(&pShard->ui_Max, static_cast<UInt64>(0), Sys::MemoryOrderRelaxed);
+	}
+}
+
+}  /* namespace Metrics */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,246 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Registry.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Metrics
+ * Comment     : Named metrics registry, snapshots and text exposition
+ *
+ */
+
+#include <CxxAbb/Metrics/Registry.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Exception.h>
+
+#include <ostream>
+
+namespace CxxAbb
+{
+
+namespace Metrics
+{
+
+namespace
+{
+
+Registry * g_Default = 0;
+Sys::OnceFlag g_DefaultOnce = CXXABB_ONCE_INIT;
+
+void CreateDefault()
+{
+	g_Default = new Registry;
+}
+
+const char * TypeName(MetricsSnapshot::Type _eType)
+{
+	switch (_eType)
+	{
+		case MetricsSnapshot::CounterType:   return "counter";
+		case MetricsSnapshot::GaugeType:     return "gauge";
+		case MetricsSnapshot::HistogramType: return "summary";
+	}
+	return "untyped";
+}
+
+}
+
+void MetricsSnapshot::Merge(const MetricsSnapshot & _other)
+{
+	for (MetricMap::const_iterator it = _other.lst_Metrics.begin(); it != _other.lst_Metrics.end(); ++it)
+	{
+		MetricMap::iterator mine = lst_Metrics.find(it->first);
+		if (mine == lst_Metrics.end())
+		{
+			lst_Metrics.insert(*it);
+			continue;
+		}
+		if (mine->second.e_Type != it->second.e_Type)
+			throw InvalidArgumentException("metric type mismatch: " + it->first);
+
+		mine->second.ui_Counter += it->second.ui_Counter;
+		mine->second.i_Gauge += it->second.i_Gauge;
+		mine->second.m_Histogram.Merge(it->second.m_Histogram);
+	}
+}
+
+void MetricsSnapshot::Expose(std::ostream & _os) const
+{
+	static const double dQuantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+	for (MetricMap::const_iterator it = lst_Metrics.begin(); it != lst_Metrics.end(); ++it)
+	{
+		const std::string & sName = it->first;
+		const Metric & metric = it->second;
+
+		if (!metric.s_Help.empty())
+			_os << "# HELP " << sName << ' ' << metric.s_Help << '\n';
+		_os << "# TYPE " << sName << ' ' << TypeName(metric.e_Type) << '\n';
+
+		switch (metric.e_Type)
+		{
+			case CounterType:
+				_os << sName << ' ' << metric.ui_Counter << '\n';
+				break;
+			case GaugeType:
+				_os << sName << ' ' << metric.i_Gauge << '\n';
+				break;
+			case HistogramType:
+				if (!metric.s_Unit.empty())
+					_os << "# UNIT " << sName << ' ' << metric.s_Unit << '\n';
+				for (std::size_t i = 0; i < sizeof(dQuantiles) / sizeof(dQuantiles[0]); ++i)
+				{
+					_os << sName << "{quantile=\"" << dQuantiles[i] << "\"} "
+						<< metric.m_Histogram.Percentile(dQuantiles[i] * 100.0) << '\n';
+				}
+				_os << sName << "_max " << metric.m_Histogram.Max() << '\n';
+				_os << sName << "_sum " << metric.m_Histogram.Sum() << '\n';
+				_os << sName << "_count " << metric.m_Histogram.Count() << '\n';
+				break;
+		}
+	}
+	_os.flush();
+}
+
+Registry::Registry()
+{
+}
+
+Registry::~Registry()
+{
+	for (EntryMap::iterator it = lst_Entries.begin(); it != lst_Entries.end(); ++it)
+	{
+		switch (it->second.e_Type)
+		{
+			case MetricsSnapshot::CounterType:
+				delete static_cast<Counter*>(it->second.p_Metric);
+				break;
+			case MetricsSnapshot::GaugeType:
+				delete static_cast<Gauge*>(it->second.p_Metric);
+				break;
+			case MetricsSnapshot::HistogramType:
+				delete static_cast<Histogram*>(it->second.p_Metric);
+				break;
+		}
+	}
+}
+
+Registry & Registry::Default()
+{
+	Sys::CallOnce(g_DefaultOnce, &CreateDefault);
+	return *g_Default;
+}
+
+void * Registry::Find(const std::string & _sName, MetricsSnapshot::Type _eType)
+{
+	EntryMap::iterator it = lst_Entries.find(_sName);
+	if (it == lst_Entries.end())
+		return NullPtr;
+	if (it->second.e_Type != _eType)
+		throw InvalidArgumentException("metric registered with another type: " + _sName);
+	return it->second.p_Metric;
+}
+
+void Registry::Add(const std::string & _sName, MetricsSnapshot::Type _eType, const std::string & _sHelp,
+		const std::string & _sUnit, void * _pMetric)
+{
+	Entry & entry = lst_Entries[_sName];
+	entry.e_Type = _eType;
+	entry.s_Help = _sHelp;
+	entry.s_Unit = _sUnit;
+	entry.p_Metric = _pMetric;
+}
+
+Counter & Registry::GetCounter(const std::string & _sName, const std::string & _sHelp)
+{
+	Sys::FastMutex::ScopedLock lock(mtx_Entries);
+	Counter * pCounter = static_cast<Counter*>(Find(_sName, MetricsSnapshot::CounterType));
+	if (!pCounter)
+	{
+		pCounter = new Counter;
+		Add(_sName, MetricsSnapshot::CounterType, _sHelp, "", pCounter);
+	}
+	return *pCounter;
+}
+
+Gauge & Registry::GetGauge(const std::string & _sName, const std::string & _sHelp)
+{
+	Sys::FastMutex::ScopedLock lock(mtx_Entries);
+	Gauge * pGauge = static_cast<Gauge*>(Find(_sName, MetricsSnapshot::GaugeType));
+	if (!pGauge)
+	{
+		pGauge = new Gauge;
+		Add(_sName, MetricsSnapshot::GaugeType, _sHelp, "", pGauge);
+	}
+	return *pGauge;
+}
+
+Histogram & Registry::GetHistogram(const std::string & _sName, const std::string & _sHelp,
+		const std::string & _sUnit)
+{
+	Sys::FastMutex::ScopedLock lock(mtx_Entries);
+	Histogram * pHistogram = static_cast<Histogram*>(Find(_sName, MetricsSnapshot::HistogramType));
+	if (!pHistogram)
+	{
+		pHistogram = new Histogram;
+		Add(_sName, MetricsSnapshot::HistogramType, _sHelp, _sUnit, pHistogram);
+	}
+	return *pHistogram;
+}
+
+void Registry::Snapshot(MetricsSnapshot & _snapshot) const
+{
+	_snapshot.Metrics().clear();
+
+	Sys::FastMutex::ScopedLock lock(mtx_Entries);
+	for (EntryMap::const_iterator it = lst_Entries.begin(); it != lst_Entries.end(); ++it)
+	{
+		MetricsSnapshot::Metric & metric = _snapshot.Metrics()[it->first];
+		metric.e_Type = it->second.e_Type;
+		metric.s_Help = it->second.s_Help;
+		metric.s_Unit = it->second.s_Unit;
+		metric.ui_Counter = 0;
+		metric.i_Gauge = 0;
+
+		switch (it->second.e_Type)
+		{
+			case MetricsSnapshot::CounterType:
+				metric.ui_Counter = static_cast<const Counter*>(it->second.p_Metric)->Value();
+				break;
+			case MetricsSnapshot::GaugeType:
+				metric.i_Gauge = static_cast<const Gauge*>(it->second.p_Metric)->Value();
+				break;
+			case MetricsSnapshot::HistogramType:
+				static_cast<const Histogram*>(it->second.p_Metric)->Snapshot(metric.m_Histogram);
+				break;
+		}
+	}
+}
+
+void Registry::Expose(std::ostream & _os) const
+{
+	MetricsSnapshot snapshot;
+	Snapshot(snapshot);
+	snapshot.Expose(_os);
+}
+
+}  /* namespace Metrics */
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,745 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * NumberFormat.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Locale free number to text conversion
+ *
+ */
+
+
+#include <CxxAbb/NumberFormat.h>
+#include <CxxAbb/BitOps.h>
+
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace CxxAbb
+{
+
+namespace
+{
+
+const char g_aDigitPairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+const UInt64 g_aPow10[] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+	100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+	10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/// Doubles 10^0 .. 10^22 are exact
+const double g_aExactPow10[] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+unsigned int CountDigits(UInt64 _uiValue)
+{
+	unsigned int uiDigits = 1;
+	for (;;)
+	{
+		if (_uiValue < 10)
+			return uiDigits;
+		if (_uiValue < 100)
+			return uiDigits + 1;
+		if (_uiValue < 1000)
+			return uiDigits + 2;
+		if (_uiValue < 10000)
+			return uiDigits + 3;
+		_uiValue /= 10000;
+		uiDigits += 4;
+	}
+}
+
+/// Writes the digits of _uiValue backwards from _zEnd
+void WriteDigits(char * _zEnd, UInt64 _uiValue)
+{
+	while (_uiValue >= 100)
+	{
+		unsigned int uiPair = static_cast<unsigned int>(_uiValue % 100) * 2;
+		_uiValue /= 100;
+		*--_zEnd = g_aDigitPairs[uiPair + 1];
+		*--_zEnd = g_aDigitPairs[uiPair];
+	}
+	if (_uiValue >= 10)
+	{
+		unsigned int uiPair = static_cast<unsigned int>(_uiValue) * 2;
+		*--_zEnd = g_aDigitPairs[uiPair + 1];
+		*--_zEnd = g_aDigitPairs[uiPair];
+	}
+	else
+		*--_zEnd = static_cast<char>('0' + _uiValue);
+}
+
+/// Grisu2 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+/// with Integers", PLDI 2010) on a 64 bit "do it yourself" floating point
+
+const UInt64 DpSignificandMask = 0x000FFFFFFFFFFFFFULL;
+const UInt64 DpExponentMask = 0x7FF0000000000000ULL;
+const UInt64 DpHiddenBit = 0x0010000000000000ULL;
+const int DpSignificandSize = 52;
+const int DpExponentBias = 0x3FF + DpSignificandSize;
+const int DiySignificandSize = 64;
+
+struct DiyFp
+{
+	DiyFp()
+		: ui_F(0),
+		  i_E(0)
+	{}
+
+	DiyFp(UInt64 _uiF, int _iE)
+		: ui_F(_uiF),
+		  i_E(_iE)
+	{}
+
+	explicit DiyFp(double _dValue)
+	{
+		UInt64 uiBits;
+		std::memcpy(&uiBits, &_dValue, sizeof(uiBits));
+		int iBiased = static_cast<int>((uiBits & DpExponentMask) >> DpSignificandSize);
+		UInt64 uiSignificand = uiBits & DpSignificandMask;
+		if (iBiased != 0)
+		{
+			ui_F = uiSignificand + DpHiddenBit;
+			i_E = iBiased - DpExponentBias;
+		}
+		else
+		{
+			ui_F = uiSignificand;
+			i_E = 1 - DpExponentBias;
+		}
+	}
+
+	DiyFp operator -(const DiyFp & _rhs) const
+	{
+		return DiyFp(ui_F - _rhs.ui_F, i_E);
+	}
+
+	/// Upper 64 bits of the product, rounded
+	DiyFp operator *(const DiyFp & _rhs) const
+	{
+		const UInt64 M32 = 0xFFFFFFFFULL;
+		UInt64 a = ui_F >> 32, b = ui_F & M32;
+		UInt64 c = _rhs.ui_F >> 32, d = _rhs.ui_F & M32;
+		UInt64 ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+		UInt64 tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+		tmp += 1U << 31;
+		return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), i_E + _rhs.i_E + 64);
+	}
+
+	DiyFp Normalize() const
+	{
+		unsigned int uiShift = CountLeadingZeros(ui_F);
+		return DiyFp(ui_F << uiShift, i_E - static_cast<int>(uiShift));
+	}
+
+	DiyFp NormalizeBoundary() const
+	{
+		DiyFp res = *this;
+		while (!(res.ui_F & (DpHiddenBit << 1)))
+		{
+			res.ui_F <<= 1;
+			res.i_E--;
+		}
+		res.ui_F <<= (DiySignificandSize - DpSignificandSize - 2);
+		res.i_E -= (DiySignificandSize - DpSignificandSize - 2);
+		return res;
+	}
+
+	/// Neighbours halfway to the adjacent doubles, sharing the exponent of _plus
+	void NormalizedBoundaries(DiyFp & _minus, DiyFp & _plus) const
+	{
+		_plus = DiyFp((ui_F << 1) + 1, i_E - 1).NormalizeBoundary();
+		_minus = (ui_F == DpHiddenBit) ? DiyFp((ui_F << 2) - 1, i_E - 2) : DiyFp((ui_F << 1) - 1, i_E - 1);
+		_minus.ui_F <<= _minus.i_E - _plus.i_E;
+		_minus.i_E = _plus.i_E;
+	}
+
+	UInt64 ui_F;
+	int i_E;
+};
+
+/// Normalized 10^-348 .. 10^340 in steps of 8
+struct CachedPower
+{
+	UInt64 ui_F;
+	int i_E;
+};
+
+const CachedPower g_aCachedPowers[] =
+{
+	{ 0xFA8FD5A0081C0288ULL, -1220 }, { 0xBAAEE17FA23EBF76ULL, -1193 }, { 0x8B16FB203055AC76ULL, -1166 },
+	{ 0xCF42894A5DCE35EAULL, -1140 }, { 0x9A6BB0AA55653B2DULL, -1113 }, { 0xE61ACF033D1A45DFULL, -1087 },
+	{ 0xAB70FE17C79AC6CAULL, -1060 }, { 0xFF77B1FCBEBCDC4FULL, -1034 }, { 0xBE5691EF416BD60CULL, -1007 },
+	{ 0x8DD01FAD907FFC3CULL, -980 }, { 0xD3515C2831559A83ULL, -954 }, { 0x9D71AC8FADA6C9B5ULL, -927 },
+	{ 0xEA9C227723EE8BCBULL, -901 }, { 0xAECC49914078536DULL, -874 }, { 0x823C12795DB6CE57ULL, -847 },
+	{ 0xC21094364DFB5637ULL, -821 }, { 0x9096EA6F3848984FULL, -794 }, { 0xD77485CB25823AC7ULL, -768 },
+	{ 0xA086CFCD97BF97F4ULL, -741 }, { 0xEF340A98172AACE5ULL, -715 }, { 0xB23867FB2A35B28EULL, -688 },
+	{ 0x84C8D4DFD2C63F3BULL, -661 }, { 0xC5DD44271AD3CDBAULL, -635 }, { 0x936B9FCEBB25C996ULL, -608 },
+	{ 0xDBAC6C247D62A584ULL, -582 }, { 0xA3AB66580D5FDAF6ULL, -555 }, { 0xF3E2F893DEC3F126ULL, -529 },
+	{ 0xB5B5ADA8AAFF80B8ULL, -502 }, { 0x87625F056C7C4A8BULL, -475 }, { 0xC9BCFF6034C13053ULL, -449 },
+	{ 0x964E858C91BA2655ULL, -422 }, { 0xDFF9772470297EBDULL, -396 }, { 0xA6DFBD9FB8E5B88FULL, -369 },
+	{ 0xF8A95FCF88747D94ULL, -343 }, { 0xB94470938FA89BCFULL, -316 }, { 0x8A08F0F8BF0F156BULL, -289 },
+	{ 0xCDB02555653131B6ULL, -263 }, { 0x993FE2C6D07B7FACULL, -236 }, { 0xE45C10C42A2B3B06ULL, -210 },
+	{ 0xAA242499697392D3ULL, -183 }, { 0xFD87B5F28300CA0EULL, -157 }, { 0xBCE5086492111AEBULL, -130 },
+	{ 0x8CBCCC096F5088CCULL, -103 }, { 0xD1B71758E219652CULL, -77 }, { 0x9C40000000000000ULL, -50 },
+	{ 0xE8D4A51000000000ULL, -24 }, { 0xAD78EBC5AC620000ULL, 3 }, { 0x813F3978F8940984ULL, 30 },
+	{ 0xC097CE7BC90715B3ULL, 56 }, { 0x8F7E32CE7BEA5C70ULL, 83 }, { 0xD5D238A4ABE98068ULL, 109 },
+	{ 0x9F4F2726179A2245ULL, 136 }, { 0xED63A231D4C4FB27ULL, 162 }, { 0xB0DE65388CC8ADA8ULL, 189 },
+	{ 0x83C7088E1AAB65DBULL, 216 }, { 0xC45D1DF942711D9AULL, 242 }, { 0x924D692CA61BE758ULL, 269 },
+	{ 0xDA01EE641A708DEAULL, 295 }, { 0xA26DA3999AEF774AULL, 322 }, { 0xF209787BB47D6B85ULL, 348 },
+	{ 0xB454E4A179DD1877ULL, 375 }, { 0x865B86925B9BC5C2ULL, 402 }, { 0xC83553C5C8965D3DULL, 428 },
+	{ 0x952AB45CFA97A0B3ULL, 455 }, { 0xDE469FBD99A05FE3ULL, 481 }, { 0xA59BC234DB398C25ULL, 508 },
+	{ 0xF6C69A72A3989F5CULL, 534 }, { 0xB7DCBF5354E9BECEULL, 561 }, { 0x88FCF317F22241E2ULL, 588 },
+	{ 0xCC20CE9BD35C78A5ULL, 614 }, { 0x98165AF37B2153DFULL, 641 }, { 0xE2A0B5DC971F303AULL, 667 },
+	{ 0xA8D9D1535CE3B396ULL, 694 }, { 0xFB9B7CD9A4A7443CULL, 720 }, { 0xBB764C4CA7A44410ULL, 747 },
+	{ 0x8BAB8EEFB6409C1AULL, 774 }, { 0xD01FEF10A657842CULL, 800 }, { 0x9B10A4E5E9913129ULL, 827 },
+	{ 0xE7109BFBA19C0C9DULL, 853 }, { 0xAC2820D9623BF429ULL, 880 }, { 0x80444B5E7AA7CF85ULL, 907 },
+	{ 0xBF21E44003ACDD2DULL, 933 }, { 0x8E679C2F5E44FF8FULL, 960 }, { 0xD433179D9C8CB841ULL, 986 },
+	{ 0x9E19DB92B4E31BA9ULL, 1013 }, { 0xEB96BF6EBADF77D9ULL, 1039 }, { 0xAF87023B9BF0EE6BULL, 1066 },
+};
+
+/// Power 10^-K that brings a binary exponent _iE into Grisu's target window
+DiyFp GetCachedPower(int _iE, int & _iK)
+{
+	double dk = (-61 - _iE) * 0.30102999566398114 + 347;
+	int k = static_cast<int>(dk);
+	if (dk - k > 0.0)
+		k++;
+	unsigned int uiIndex = static_cast<unsigned int>((k >> 3) + 1);
+	_iK = -(-348 + static_cast<int>(uiIndex << 3));
+	return DiyFp(g_aCachedPowers[uiIndex].ui_F, g_aCachedPowers[uiIndex].i_E);
+}
+
+void GrisuRound(char * _pDigits, int _iLength, UInt64 _uiDelta, UInt64 _uiRest, UInt64 _uiTenKappa, UInt64 _uiWpW)
+{
+	while (_uiRest < _uiWpW && _uiDelta - _uiRest >= _uiTenKappa &&
+			(_uiRest + _uiTenKappa < _uiWpW || _uiWpW - _uiRest > _uiRest + _uiTenKappa - _uiWpW))
+	{
+		_pDigits[_iLength - 1]--;
+		_uiRest += _uiTenKappa;
+	}
+}
+
+void DigitGen(const DiyFp & _w, const DiyFp & _mp, UInt64 _uiDelta, char * _pDigits, int & _iLength, int & _iK)
+{
+	const DiyFp one(1ULL << -_mp.i_E, _mp.i_E);
+	const DiyFp wpW = _mp - _w;
+	UInt32 p1 = static_cast<UInt32>(_mp.ui_F >> -one.i_E);
+	UInt64 p2 = _mp.ui_F & (one.ui_F - 1);
+	int iKappa = static_cast<int>(CountDigits(p1));
+	_iLength = 0;
+
+	while (iKappa > 0)
+	{
+		UInt32 uiDivisor = static_cast<UInt32>(g_aPow10[iKappa - 1]);
+		UInt32 d = p1 / uiDivisor;
+		p1 %= uiDivisor;
+		if (d || _iLength)
+			_pDigits[_iLength++] = static_cast<char>('0' + d);
+		iKappa--;
+		UInt64 tmp = (static_cast<UInt64>(p1) << -one.i_E) + p2;
+		if (tmp <= _uiDelta)
+		{
+			_iK += iKappa;
+			GrisuRound(_pDigits, _iLength, _uiDelta, tmp, g_aPow10[iKappa] << -one.i_E, wpW.ui_F);
+			return;
+		}
+	}
+
+	for (;;)
+	{
+		p2 *= 10;
+		_uiDelta *= 10;
+		char d = static_cast<char>(p2 >> -one.i_E);
+		if (d || _iLength)
+			_pDigits[_iLength++] = static_cast<char>('0' + d);
+		p2 &= one.ui_F - 1;
+		iKappa--;
+		if (p2 < _uiDelta)
+		{
+			_iK += iKappa;
+			int iIndex = -iKappa;
+			GrisuRound(_pDigits, _iLength, _uiDelta, p2, one.ui_F, wpW.ui_F * (iIndex < 20 ? g_aPow10[iIndex] : 0));
+			return;
+		}
+	}
+}
+
+/// Digits of a finite positive _dValue, which is digits * 10^K
+void Grisu2(double _dValue, char * _pDigits, int & _iLength, int & _iK)
+{
+	const DiyFp v(_dValue);
+	DiyFp wMinus, wPlus;
+	v.NormalizedBoundaries(wMinus, wPlus);
+
+	const DiyFp cachedPower = GetCachedPower(wPlus.i_E, _iK);
+	const DiyFp w = v.Normalize() * cachedPower;
+	DiyFp wp = wPlus * cachedPower;
+	DiyFp wm = wMinus * cachedPower;
+	wm.ui_F++;
+	wp.ui_F--;
+	DigitGen(w, wp, wp.ui_F - wm.ui_F, _pDigits, _iLength, _iK);
+}
+
+char * WriteExponent(char * _zOut, int _iExponent)
+{
+	*_zOut++ = 'e';
+	if (_iExponent < 0)
+	{
+		*_zOut++ = '-';
+		_iExponent = -_iExponent;
+	}
+	else
+		*_zOut++ = '+';
+	unsigned int uiDigits = CountDigits(static_cast<UInt64>(_iExponent));
+	WriteDigits(_zOut + uiDigits, static_cast<UInt64>(_iExponent));
+	return _zOut + uiDigits;
+}
+
+/// Lays out _iLength digits (already at _zOut) times 10^_iK, returns the end
+char * Prettify(char * _zOut, int _iLength, int _iK)
+{
+	const int kk = _iLength + _iK; // 10^(kk - 1) <= v < 10^kk
+
+	if (_iLength <= kk && kk <= 21)
+	{
+		// 1234e7 -> 12340000000
+		std::memset(_zOut + _iLength, '0', static_cast<std::size_t>(kk - _iLength));
+		return _zOut + kk;
+	}
+	if (0 < kk && kk <= 21)
+	{
+		// 1234e-2 -> 12.34
+		std::memmove(_zOut + kk + 1, _zOut + kk, static_cast<std::size_t>(_iLength - kk));
+		_zOut[kk] = '.';
+		return _zOut + _iLength + 1;
+	}
+	if (-6 < kk && kk <= 0)
+	{
+		// 1234e-6 -> 0.001234
+		const int iOffset = 2 - kk;
+		std::memmove(_zOut + iOffset, _zOut, static_cast<std::size_t>(_iLength));
+		_zOut[0] = '0';
+		_zOut[1] = '.';
+		std::memset(_zOut + 2, '0', static_cast<std::size_t>(-kk));
+		return _zOut + _iLength + iOffset;
+	}
+	if (_iLength == 1)
+	{
+		// 1e30 -> 1e+30
+		return WriteExponent(_zOut + 1, kk - 1);
+	}
+	// 1234e30 -> 1.234e+33
+	std::memmove(_zOut + 2, _zOut + 1, static_cast<std::size_t>(_iLength - 1));
+	_zOut[1] = '.';
+	return WriteExponent(_zOut + _iLength + 1, kk - 1);
+}
+
+inline bool IsDigit(char _c)
+{
+	return static_cast<unsigned char>(_c - '0') < 10;
+}
+
+inline int HexValue(char _c)
+{
+	if (IsDigit(_c))
+		return _c - '0';
+	if (_c >= 'a' && _c <= 'f')
+		return _c - 'a' + 10;
+	if (_c >= 'A' && _c <= 'F')
+		return _c - 'A' + 10;
+	return -1;
+}
+
+bool EqualsNoCase(const char * _pText, std::size_t _tLength, const char * _zLower)
+{
+	std::size_t i = 0;
+	for (; i < _tLength && _zLower[i]; ++i)
+	{
+		char c = _pText[i];
+		if (c >= 'A' && c <= 'Z')
+			c = static_cast<char>(c - 'A' + 'a');
+		if (c != _zLower[i])
+			return false;
+	}
+	return i == _tLength && !_zLower[i];
+}
+
+/// Digits only, no sign
+Result<UInt64> ParseDigits(const char * _pText, const char * _pEnd)
+{
+	if (_pText == _pEnd)
+		return Fail(EINVAL);
+	UInt64 uiValue = 0;
+	for (; _pText < _pEnd; ++_pText)
+	{
+		if (!IsDigit(*_pText))
+			return Fail(EINVAL);
+		unsigned int uiDigit = static_cast<unsigned int>(*_pText - '0');
+		if (uiValue > 1844674407370955161ULL || (uiValue == 1844674407370955161ULL && uiDigit > 5))
+		{
+			// keep checking the syntax, "99999999999999999999x" is EINVAL
+			while (++_pText < _pEnd)
+				if (!IsDigit(*_pText))
+					return Fail(EINVAL);
+			return Fail(ERANGE);
+		}
+		uiValue = uiValue * 10 + uiDigit;
+	}
+	return uiValue;
+}
+
+/// Hands a validated decimal to strtod, swapping '.' for the locale's point
+Result<double> StrToDouble(const char * _pText, std::size_t _tLength)
+{
+	char aLocal[128];
+	std::string sHeap;
+	char * zCopy = aLocal;
+	if (_tLength >= sizeof(aLocal))
+	{
+		sHeap.assign(_tLength + 1, '\0');
+		zCopy = &sHeap[0];
+	}
+	std::memcpy(zCopy, _pText, _tLength);
+	zCopy[_tLength] = '\0';
+
+	const char cPoint = std::localeconv()->decimal_point[0];
+	if (cPoint != '.')
+	{
+		char * pPoint = static_cast<char *>(std::memchr(zCopy, '.', _tLength));
+		if (pPoint)
+			*pPoint = cPoint;
+	}
+
+	errno = 0;
+	char * pEnd = NullPtr;
+	double dValue = std::strtod(zCopy, &pEnd);
+	if (pEnd != zCopy + _tLength)
+		return Fail(EINVAL);
+	if (errno == ERANGE && (dValue == HUGE_VAL || dValue == -HUGE_VAL))
+		return Fail(ERANGE);
+	return dValue;
+}
+
+}  /* namespace */
+
+std::size_t NumberFormat::FormatUInt64(char * _zOut, UInt64 _uiValue)
+{
+	unsigned int uiDigits = CountDigits(_uiValue);
+	WriteDigits(_zOut + uiDigits, _uiValue);
+	return uiDigits;
+}
+
+std::size_t NumberFormat::FormatInt64(char * _zOut, Int64 _iValue)
+{
+	if (_iValue < 0)
+	{
+		*_zOut = '-';
+		return 1 + FormatUInt64(_zOut + 1, static_cast<UInt64>(-(_iValue + 1)) + 1);
+	}
+	return FormatUInt64(_zOut, static_cast<UInt64>(_iValue));
+}
+
+std::size_t NumberFormat::FormatHex(char * _zOut, UInt64 _uiValue, bool _bUpper)
+{
+	const char * aDigits = _bUpper ? "0123456789ABCDEF" : "0123456789abcdef";
+	std::size_t tDigits = (64 - CountLeadingZeros(_uiValue | 1) + 3) / 4;
+	for (char * p = _zOut + tDigits; p != _zOut; _uiValue >>= 4)
+		*--p = aDigits[_uiValue & 0xF];
+	return tDigits;
+}
+
+std::size_t NumberFormat::FormatBinary(char * _zOut, UInt64 _uiValue)
+{
+	std::size_t tDigits = 64 - CountLeadingZeros(_uiValue | 1);
+	for (char * p = _zOut + tDigits; p != _zOut; _uiValue >>= 1)
+		*--p = static_cast<char>('0' + (_uiValue & 1));
+	return tDigits;
+}
+
+std::size_t NumberFormat::FormatDouble(char * _zOut, double _dValue)
+{
+	char * p = _zOut;
+	UInt64 uiBits;
+	std::memcpy(&uiBits, &_dValue, sizeof(uiBits));
+
+	if ((uiBits & DpExponentMask) == DpExponentMask)
+	{
+		if (uiBits & DpSignificandMask)
+		{
+			std::memcpy(p, "nan", 3);
+			return 3;
+		}
+		if (uiBits >> 63)
+			*p++ = '-';
+		std::memcpy(p, "inf", 3);
+		return static_cast<std::size_t>(p - _zOut) + 3;
+	}
+
+	if (uiBits >> 63)
+	{
+		*p++ = '-';
+		_dValue = -_dValue;
+	}
+	if (_dValue == 0.0)
+	{
+		*p++ = '0';
+		return static_cast<std::size_t>(p - _zOut);
+	}
+
+	int iLength, iK;
+	Grisu2(_dValue, p, iLength, iK);
+	return static_cast<std::size_t>(Prettify(p, iLength, iK) - _zOut);
+}
+
+std::size_t NumberFormat::FormatUInt64(Buffer<char> & _buf, UInt64 _uiValue)
+{
+	char aText[MaxUInt64Chars];
+	std::size_t tLength = FormatUInt64(aText, _uiValue);
+	_buf.append(aText, tLength);
+	return tLength;
+}
+
+std::size_t NumberFormat::FormatInt64(Buffer<char> & _buf, Int64 _iValue)
+{
+	char aText[MaxInt64Chars];
+	std::size_t tLength = FormatInt64(aText, _iValue);
+	_buf.append(aText, tLength);
+	return tLength;
+}
+
+std::size_t NumberFormat::FormatHex(Buffer<char> & _buf, UInt64 _uiValue, bool _bUpper)
+{
+	char aText[MaxHexChars];
+	std::size_t tLength = FormatHex(aText, _uiValue, _bUpper);
+	_buf.append(aText, tLength);
+	return tLength;
+}
+
+std::size_t NumberFormat::FormatBinary(Buffer<char> & _buf, UInt64 _uiValue)
+{
+	char aText[MaxBinaryChars];
+	std::size_t tLength = FormatBinary(aText, _uiValue);
+	_buf.append(aText, tLength);
+	return tLength;
+}
+
+std::size_t NumberFormat::FormatDouble(Buffer<char> & _buf, double _dValue)
+{
+	char aText[MaxDoubleChars];
+	std::size_t tLength = FormatDouble(aText, _dValue);
+	_buf.append(aText, tLength);
+	return tLength;
+}
+
+Result<UInt64> NumberFormat::ParseUInt64(const char * _pText, std::size_t _tLength)
+{
+	const char * pEnd = _pText + _tLength;
+	if (_tLength && *_pText == '+')
+		++_pText;
+	return ParseDigits(_pText, pEnd);
+}
+
+Result<Int64> NumberFormat::ParseInt64(const char * _pText, std::size_t _tLength)
+{
+	const char * pEnd = _pText + _tLength;
+	bool bNegative = false;
+	if (_tLength && (*_pText == '+' || *_pText == '-'))
+		bNegative = *_pText++ == '-';
+
+	Result<UInt64> magnitude = ParseDigits(_pText, pEnd);
+	if (magnitude.IsError())
+		return Fail(magnitude.Error());
+
+	const UInt64 uiLimit = static_cast<UInt64>(std::numeric_limits<Int64>::max());
+	if (bNegative)
+	{
+		if (magnitude.Value() > uiLimit + 1)
+			return Fail(ERANGE);
+		return magnitude.Value() ? -static_cast<Int64>(magnitude.Value() - 1) - 1 : 0;
+	}
+	if (magnitude.Value() > uiLimit)
+		return Fail(ERANGE);
+	return static_cast<Int64>(magnitude.Value());
+}
+
+Result<UInt64> NumberFormat::ParseHex(const char * _pText, std::size_t _tLength)
+{
+	const char * pEnd = _pText + _tLength;
+	if (_tLength > 2 && _pText[0] == '0' && (_pText[1] == 'x' || _pText[1] == 'X'))
+		_pText += 2;
+	if (_pText == pEnd)
+		return Fail(EINVAL);
+
+	UInt64 uiValue = 0;
+	bool bOverflow = false;
+	for (; _pText < pEnd; ++_pText)
+	{
+		int iDigit = HexValue(*_pText);
+		if (iDigit < 0)
+			return Fail(EINVAL);
+		bOverflow |= (uiValue >> 60) != 0;
+		uiValue = (uiValue << 4) | static_cast<UInt64>(iDigit);
+	}
+	if (bOverflow)
+		return Fail(ERANGE);
+	return uiValue;
+}
+
+Result<UInt64> NumberFormat::ParseBinary(const char * _pText, std::size_t _tLength)
+{
+	const char * pEnd = _pText + _tLength;
+	if (_tLength > 2 && _pText[0] == '0' && (_pText[1] == 'b' || _pText[1] == 'B'))
+		_pText += 2;
+	if (_pText == pEnd)
+		return Fail(EINVAL);
+
+	UInt64 uiValue = 0;
+	bool bOverflow = false;
+	for (; _pText < pEnd; ++_pText)
+	{
+		if (*_pText != '0' && *_pText != '1')
+			return Fail(EINVAL);
+		bOverflow |= (uiValue >> 63) != 0;
+		uiValue = (uiValue << 1) | static_cast<UInt64>(*_pText - '0');
+	}
+	if (bOverflow)
+		return Fail(ERANGE);
+	return uiValue;
+}
+
+Result<double> NumberFormat::ParseDouble(const char * _pText, std::size_t _tLength)
+{
+	const char * p = _pText;
+	const char * pEnd = _pText + _tLength;
+	bool bNegative = false;
+	if (p < pEnd && (*p == '+' || *p == '-'))
+		bNegative = *p++ == '-';
+	if (p == pEnd)
+		return Fail(EINVAL);
+
+	if (!IsDigit(*p) && *p != '.')
+	{
+		std::size_t tRest = static_cast<std::size_t>(pEnd - p);
+		if (EqualsNoCase(p, tRest, "inf") || EqualsNoCase(p, tRest, "infinity"))
+			return bNegative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+		if (EqualsNoCase(p, tRest, "nan"))
+			return std::numeric_limits<double>::quiet_NaN();
+		return Fail(EINVAL);
+	}
+
+	// mantissa * 10^iExponent, exact while at most 19 significant digits
+	UInt64 uiMantissa = 0;
+	int iSignificant = 0;
+	int iExponent = 0;
+	bool bDigits = false;
+	bool bExact = true;
+
+	for (; p < pEnd && IsDigit(*p); ++p)
+	{
+		bDigits = true;
+		if (iSignificant < 19)
+		{
+			uiMantissa = uiMantissa * 10 + static_cast<UInt64>(*p - '0');
+			iSignificant += uiMantissa != 0;
+		}
+		else
+		{
+			iExponent++;
+			bExact &= *p == '0';
+		}
+	}
+	if (p < pEnd && *p == '.')
+	{
+		for (++p; p < pEnd && IsDigit(*p); ++p)
+		{
+			bDigits = true;
+			if (iSignificant < 19)
+			{
+				uiMantissa = uiMantissa * 10 + static_cast<UInt64>(*p - '0');
+				iSignificant += uiMantissa != 0;
+				iExponent--;
+			}
+			else
+				bExact &= *p == '0';
+		}
+	}
+	if (!bDigits)
+		return Fail(EINVAL);
+
+	if (p < pEnd && (*p == 'e' || *p == 'E'))
+	{
+		++p;
+		bool bNegativeExp = false;
+		if (p < pEnd && (*p == '+' || *p == '-'))
+			bNegativeExp = *p++ == '-';
+		if (p == pEnd || !IsDigit(*p))
+			return Fail(EINVAL);
+		int iExp = 0;
+		for (; p < pEnd && IsDigit(*p); ++p)
+			if (iExp < 100000)
+				iExp = iExp * 10 + (*p - '0');
+		iExponent += bNegativeExp ? -iExp : iExp;
+	}
+	if (p != pEnd)
+		return Fail(EINVAL);
+
+	if (uiMantissa == 0)
+		return bNegative ? -0.0 : 0.0;
+
+#if defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+	// Clinger's fast path: both operands exact, so a single rounding
+	if (bExact && uiMantissa <= (1ULL << 53) && iExponent >= -22 && iExponent <= 22)
+	{
+		double dValue = static_cast<double>(uiMantissa);
+		if (iExponent < 0)
+			dValue /= g_aExactPow10[-iExponent];
+		else
+			dValue *= g_aExactPow10[iExponent];
+		return bNegative ? -dValue : dValue;
+	}
+#endif
+
+	return StrToDouble(_pText, _tLength);
+}
+
+}  /* namespace CxxAbb */
@@ -0,0 +1,86 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SharedString.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Immutable reference counted string
+ *
+ */
+
+
+#include <CxxAbb/SharedString.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <ostream>
+
+namespace CxxAbb
+{
+
+void SharedString::Init(const char * _pData, std::size_t _tSize)
+{
+	if (_tSize <= MaxInline)
+	{
+		std::memset(u_Data.a_Inline, 0, sizeof(u_Data.a_Inline));
+		if (_tSize)
+			std::memcpy(u_Data.a_Inline, _pData, _tSize);
+		u_Data.a_Inline[MaxInline] = static_cast<char>(MaxInline - _tSize);
+		return;
+	}
+
+	Rep * pRep = static_cast<Rep*>(::operator new(offsetof(Rep, a_Chars) + _tSize + 1));
+	pRep->ui_RefCount = 1;
+	pRep->t_Size = _tSize;
+	std::memcpy(pRep->a_Chars, _pData, _tSize);
+	pRep->a_Chars[_tSize] = '\0';
+
+	u_Data.p_Rep = pRep;
+	u_Data.a_Inline[MaxInline] = HeapTag;
+}
+
+void SharedString::AddRef()
+{
+	Sys::AtomicFetchAdd(&u_Data.p_Rep->ui_RefCount, 1U, Sys::MemoryOrderRelaxed);
+}
+
+void SharedString::Release()
+{
+	if (Sys::AtomicFetchSub(&u_Data.p_Rep->ui_RefCount, 1U, Sys::MemoryOrderAcqRel) == 1)
+		::operator delete(u_Data.p_Rep);
+}
+
+int SharedString::compare(const char * _pData, std::size_t _tSize) const
+{
+	std::size_t tSize = size();
+	int iResult = std::memcmp(data(), _pData, std::min(tSize, _tSize));
+	if (iResult)
+		return iResult;
+	return tSize < _tSize ? -1 : (tSize > _tSize ? 1 : 0);
+}
+
+std::ostream & operator << (std::ostream & _os, const SharedString & _value)
+{
+	return _os.write(_value.data(), static_cast<std::streamsize>(_value.size()));
+}
+
+} /* namespace CxxAbb */
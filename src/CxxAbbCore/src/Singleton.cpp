@@ -0,0 +1,103 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Singleton.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Pattern
+ * Comment     : Singleton lifetime registry
+ *
+ */
+
+#include <CxxAbb/Singleton.h>
+
+#include <cstdlib>
+#include <sched.h>
+
+namespace CxxAbb
+{
+namespace Dp
+{
+
+// constant initialized, registration may happen during static initialization of other units
+SingletonRegistry::Entry * SingletonRegistry::p_Head = 0;
+volatile int SingletonRegistry::i_Lock = 0;
+Sys::OnceFlag SingletonRegistry::s_AtExit = CXXABB_ONCE_INIT;
+
+void SingletonRegistry::Lock()
+{
+	while (Sys::AtomicExchange(&i_Lock, 1, Sys::MemoryOrderAcquire))
+	{
+		sched_yield();
+	}
+}
+
+void SingletonRegistry::Unlock()
+{
+	Sys::AtomicStore(&i_Lock, 0, Sys::MemoryOrderRelease);
+}
+
+void SingletonRegistry::InstallAtExit()
+{
+	std::atexit(&SingletonRegistry::DestroyAll);
+}
+
+void SingletonRegistry::Register(Entry & _entry)
+{
+	Sys::CallOnce(s_AtExit, &SingletonRegistry::InstallAtExit);
+
+	Lock();
+	_entry.p_Next = p_Head;
+	p_Head = &_entry;
+	Unlock();
+}
+
+void SingletonRegistry::DestroyAll()
+{
+	for (;;)
+	{
+		Lock();
+		Entry * pEntry = p_Head;
+		if (pEntry)
+			p_Head = pEntry->p_Next;
+		Unlock();
+
+		if (!pEntry)
+			break;
+
+		// destructor runs unlocked, it may use (and re-register) other singletons
+		pEntry->p_Next = NullPtr;
+		pEntry->fp_Destroy();
+	}
+}
+
+std::size_t SingletonRegistry::Count()
+{
+	std::size_t tCount = 0;
+	Lock();
+	for (Entry * pEntry = p_Head; pEntry; pEntry = pEntry->p_Next)
+	{
+		++tCount;
+	}
+	Unlock();
+	return tCount;
+}
+
+} /* namespace Dp */
+} /* namespace CxxAbb */
@@ -0,0 +1,246 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SwapByteOrder.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Bulk byte order conversion kernels
+ *
+ */
+
+#include <CxxAbb/SwapByteOrder.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CXXABB_SWAB_X86 1
+#include <immintrin.h>
+#endif
+
+namespace CxxAbb
+{
+
+namespace
+{
+
+struct SwabKernels
+{
+	ByteOrder::Kernel e_Kernel;
+	void (* fp_Swab16)(const UInt16 *, UInt16 *, std::size_t);
+	void (* fp_Swab32)(const UInt32 *, UInt32 *, std::size_t);
+	void (* fp_Swab64)(const UInt64 *, UInt64 *, std::size_t);
+};
+
+void ScalarSwab16(const UInt16 * _pSrc, UInt16 * _pDst, std::size_t _tCount)
+{
+	for (std::size_t i = 0; i < _tCount; ++i)
+		_pDst[i] = Swab16(_pSrc[i]);
+}
+
+void ScalarSwab32(const UInt32 * _pSrc, UInt32 * _pDst, std::size_t _tCount)
+{
+	for (std::size_t i = 0; i < _tCount; ++i)
+		_pDst[i] = Swab32(_pSrc[i]);
+}
+
+void ScalarSwab64(const UInt64 * _pSrc, UInt64 * _pDst, std::size_t _tCount)
+{
+	for (std::size_t i = 0; i < _tCount; ++i)
+		_pDst[i] = Swab64(_pSrc[i]);
+}
+
+const SwabKernels g_ScalarKernels = { ByteOrder::KernelScalar, &ScalarSwab16, &ScalarSwab32, &ScalarSwab64 };
+
+#ifdef CXXABB_SWAB_X86
+
+/// pshufb controls reversing each 2, 4 or 8 byte group of a 16 byte lane
+const UInt8 g_Shuffle16[16] = { 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 };
+const UInt8 g_Shuffle32[16] = { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 };
+const UInt8 g_Shuffle64[16] = { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 };
+
+/// Shuffles whole 16 byte blocks of _tBytes, returns the bytes done
+__attribute__((target("ssse3")))
+std::size_t Ssse3Shuffle(const UInt8 * _pSrc, UInt8 * _pDst, std::size_t _tBytes, const UInt8 * _pShuffle)
+{
+	const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_pShuffle));
+	std::size_t i = 0;
+	for (; i + 64 <= _tBytes; i += 64)
+	{
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_pSrc + i));
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_pSrc + i + 16));
+		__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_pSrc + i + 32));
+		__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_pSrc + i + 48));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(_pDst + i), _mm_shuffle_epi8(a, shuffle));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(_pDst + i + 16), _mm_shuffle_epi8(b, shuffle));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(_pDst + i + 32), _mm_shuffle_epi8(c, shuffle));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(_pDst + i + 48), _mm_shuffle_epi8(d, shuffle));
+	}
+	for (; i + 16 <= _tBytes; i += 16)
+	{
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_pSrc + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(_pDst + i), _mm_shuffle_epi8(a, shuffle));
+	}
+	return i;
+}
+
+/// Same with 32 byte blocks, vpshufb shuffles within each 16 byte lane so the
+/// 16 byte control is simply broadcast
+__attribute__((target("avx2")))
+std::size_t Avx2Shuffle(const UInt8 * _pSrc, UInt8 * _pDst, std::size_t _tBytes, const UInt8 * _pShuffle)
+{
+	const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_pShuffle)));
+	std::size_t i = 0;
+	for (; i + 128 <= _tBytes; i += 128)
+	{
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pSrc + i));
+		__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pSrc + i + 32));
+		__m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pSrc + i + 64));
+		__m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pSrc + i + 96));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(_pDst + i), _mm256_shuffle_epi8(a, shuffle));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(_pDst + i + 32), _mm256_shuffle_epi8(b, shuffle));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(_pDst + i + 64), _mm256_shuffle_epi8(c, shuffle));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(_pDst + i + 96), _mm256_shuffle_epi8(d, shuffle));
+	}
+	for (; i + 32 <= _tBytes; i += 32)
+	{
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_pSrc + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(_pDst + i), _mm256_shuffle_epi8(a, shuffle));
+	}
+	return i;
+}
+
+/// Vector part through Shuffle, remaining elements through the scalar loop
+#define CXXABB_SWAB_KERNEL(ISA, BITS) \
+	void ISA##Swab##BITS(const UInt##BITS * _pSrc, UInt##BITS * _pDst, std::size_t _tCount) \
+	{ \
+		std::size_t tDone = ISA##Shuffle(reinterpret_cast<const UInt8 *>(_pSrc), reinterpret_cast<UInt8 *>(_pDst), \
+			_tCount * sizeof(UInt##BITS), g_Shuffle##BITS) / sizeof(UInt##BITS); \
+		ScalarSwab##BITS(_pSrc + tDone, _pDst + tDone, _tCount - tDone); \
+	}
+
+CXXABB_SWAB_KERNEL(Ssse3, 16)
+CXXABB_SWAB_KERNEL(Ssse3, 32)
+CXXABB_SWAB_KERNEL(Ssse3, 64)
+CXXABB_SWAB_KERNEL(Avx2, 16)
+CXXABB_SWAB_KERNEL(Avx2, 32)
+CXXABB_SWAB_KERNEL(Avx2, 64)
+
+#undef CXXABB_SWAB_KERNEL
+
+const SwabKernels g_Ssse3Kernels = { ByteOrder::KernelSsse3, &Ssse3Swab16, &Ssse3Swab32, &Ssse3Swab64 };
+const SwabKernels g_Avx2Kernels = { ByteOrder::KernelAvx2, &Avx2Swab16, &Avx2Swab32, &Avx2Swab64 };
+
+#endif /* CXXABB_SWAB_X86 */
+
+const SwabKernels * Lookup(ByteOrder::Kernel _eKernel)
+{
+	switch (_eKernel)
+	{
+	case ByteOrder::KernelScalar:
+		return &g_ScalarKernels;
+#ifdef CXXABB_SWAB_X86
+	case ByteOrder::KernelSsse3:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("ssse3") ? &g_Ssse3Kernels : NullPtr;
+	case ByteOrder::KernelAvx2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") ? &g_Avx2Kernels : NullPtr;
+#endif
+	case ByteOrder::KernelAuto:
+		for (int i = ByteOrder::KernelAvx2; i > ByteOrder::KernelAuto; --i)
+		{
+			const SwabKernels * pKernels = Lookup(static_cast<ByteOrder::Kernel>(i));
+			if (pKernels)
+				return pKernels;
+		}
+		break;
+	default:
+		break;
+	}
+	return NullPtr;
+}
+
+/// Resolved on the first call, racing first callers all store the same table
+const SwabKernels * g_pKernels = 0;
+
+inline const SwabKernels & Kernels()
+{
+	const SwabKernels * pKernels = Sys::AtomicLoad(&g_pKernels, Sys::MemoryOrderAcquire);
+	if (!pKernels)
+	{
+		pKernels = Lookup(ByteOrder::KernelAuto);
+		Sys::AtomicStore(&g_pKernels, pKernels, Sys::MemoryOrderRelease);
+	}
+	return *pKernels;
+}
+
+}
+
+void SwabArray(const UInt16 * _pSrc, UInt16 * _pDst, std::size_t _tCount)
+{
+	Kernels().fp_Swab16(_pSrc, _pDst, _tCount);
+}
+
+void SwabArray(const UInt32 * _pSrc, UInt32 * _pDst, std::size_t _tCount)
+{
+	Kernels().fp_Swab32(_pSrc, _pDst, _tCount);
+}
+
+void SwabArray(const UInt64 * _pSrc, UInt64 * _pDst, std::size_t _tCount)
+{
+	Kernels().fp_Swab64(_pSrc, _pDst, _tCount);
+}
+
+bool ByteOrder::SetKernel(ByteOrder::Kernel _eKernel)
+{
+	const SwabKernels * pKernels = Lookup(_eKernel);
+	if (!pKernels)
+		return false;
+
+	Sys::AtomicStore(&g_pKernels, pKernels, Sys::MemoryOrderRelease);
+	return true;
+}
+
+ByteOrder::Kernel ByteOrder::ActiveKernel()
+{
+	return Kernels().e_Kernel;
+}
+
+bool ByteOrder::KernelSupported(ByteOrder::Kernel _eKernel)
+{
+	return Lookup(_eKernel) != NullPtr;
+}
+
+const char * ByteOrder::KernelName(ByteOrder::Kernel _eKernel)
+{
+	switch (_eKernel)
+	{
+	case KernelAuto:
+		return "auto";
+	case KernelScalar:
+		return "scalar";
+	case KernelSsse3:
+		return "ssse3";
+	case KernelAvx2:
+		return "avx2";
+	}
+	return "unknown";
+}
+
+} /* namespace CxxAbb */
@@ -0,0 +1,928 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * AsyncFile.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Sys
+ * Comment     : Asynchronous file I/O on io_uring with a worker pool fallback
+ *
+ */
+
+
+#include <CxxAbb/Sys/AsyncFile.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/ExceptionHandler.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/SpinLock.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Sys/ThreadPool.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define CXXABB_HAVE_IO_URING 1
+#endif
+#endif
+#endif
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+namespace Dp
+{
+
+/// File whose completion is being delivered on this thread, see AsyncFile::Acquire()
+__thread AsyncFile * t_pCompleting = 0;
+
+/** One queued operation. Runs itself on the pool backend, the ring backend only
+ * uses its fields and calls Complete() from the completion thread.
+ */
+class AsyncFileOp : public CxxAbb::Runnable
+{
+public:
+	enum Kind
+	{
+		OpRead,
+		OpWrite,
+		OpFsync,
+		OpDataSync
+	};
+
+	AsyncFileOp(Kind _eKind, std::size_t _tOffset, Buffer<char> * _pBuf, char * _pData, std::size_t _tLength,
+			AsyncFile::Callback _callback, void * _pCallbackData)
+		: e_Kind(_eKind),
+		  t_Offset(_tOffset),
+		  p_Buf(_pBuf),
+		  p_Callback(_callback),
+		  p_CallbackData(_pCallbackData),
+		  p_Promise(NullPtr),
+		  p_File(NullPtr)
+	{
+		m_Vec.iov_base = _pData;
+		m_Vec.iov_len = _tLength;
+	}
+
+	~AsyncFileOp()
+	{
+		delete p_Promise;
+	}
+
+	Future<std::size_t> MakeFuture()
+	{
+		p_Promise = new Promise<std::size_t>;
+		return p_Promise->GetFuture();
+	}
+
+	/// Pool backend: blocking call on a worker
+	void Run()
+	{
+		long lResult;
+		do
+		{
+			lResult = Call();
+		}
+		while (lResult == -EINTR);
+
+		AsyncFile * pFile = p_File;
+		Complete(lResult);
+		pFile->Release(1);
+	}
+
+	/// Hands the result over, never throws
+	void Complete(long _lResult)
+	{
+		AsyncFile * pOuter = t_pCompleting;
+		t_pCompleting = p_File;
+		try
+		{
+			if (e_Kind == OpRead && _lResult >= 0)
+				p_Buf->size(static_cast<std::size_t>(_lResult));
+
+			if (p_Promise)
+			{
+				if (_lResult >= 0)
+					p_Promise->SetValue(static_cast<std::size_t>(_lResult));
+				else if (e_Kind == OpRead)
+					p_Promise->SetException(ReadFileException(p_File->Path(), static_cast<int>(-_lResult)));
+				else
+					p_Promise->SetException(WriteFileException(p_File->Path(), static_cast<int>(-_lResult)));
+			}
+			else
+			{
+				p_Callback(_lResult, p_CallbackData);
+			}
+		}
+		catch(CxxAbb::Exception & ex)
+		{
+			CxxAbb::ThreadErrorHandler::Handle(ex);
+		}
+		catch(std::exception & ex)
+		{
+			CxxAbb::ThreadErrorHandler::Handle(ex);
+		}
+		catch(...)
+		{
+			CxxAbb::ThreadErrorHandler::Handle();
+		}
+		t_pCompleting = pOuter;
+	}
+
+	Kind e_Kind;
+	std::size_t t_Offset;
+	Buffer<char> * p_Buf;
+	struct iovec m_Vec;
+	AsyncFile::Callback p_Callback;
+	void * p_CallbackData;
+	Promise<std::size_t> * p_Promise;
+	AsyncFile * p_File;
+
+private:
+	long Call()
+	{
+		int iFd = p_File->i_Fd;
+		ssize_t tResult;
+		switch (e_Kind)
+		{
+		case OpRead:
+			tResult = ::pread(iFd, m_Vec.iov_base, m_Vec.iov_len, static_cast<off_t>(t_Offset));
+			break;
+		case OpWrite:
+			tResult = ::pwrite(iFd, m_Vec.iov_base, m_Vec.iov_len, static_cast<off_t>(t_Offset));
+			break;
+		case OpFsync:
+			tResult = ::fsync(iFd);
+			break;
+		default:
+			tResult = ::fdatasync(iFd);
+			break;
+		}
+		return tResult < 0 ? -static_cast<long>(errno) : static_cast<long>(tResult);
+	}
+};
+
+#if defined(CXXABB_HAVE_IO_URING)
+
+int UringSetup(unsigned int _uiEntries, struct io_uring_params * _pParams)
+{
+	return static_cast<int>(::syscall(__NR_io_uring_setup, _uiEntries, _pParams));
+}
+
+int UringEnter(int _iFd, unsigned int _uiSubmit, unsigned int _uiWait, unsigned int _uiFlags)
+{
+	return static_cast<int>(::syscall(__NR_io_uring_enter, _iFd, _uiSubmit, _uiWait, _uiFlags, NullPtr, 0));
+}
+
+/** Submission and completion rings shared with the kernel, plus the thread that
+ * reaps completions. Submissions are serialised by a lock, only the completion
+ * thread touches the completion ring. AsyncFile keeps at most the SQ size in
+ * flight, so the SQ is always free at submit and the CQ (twice as large) never
+ * overflows.
+ *
+ * Every op in flight sits in a slot, its index is the user_data of the SQE.
+ * Nothing is lost on failure: SQEs the kernel refused at submit are taken back
+ * and completed with the error, and if the completion thread can no longer wait
+ * on the ring it fails every op still in a slot and every later submission.
+ */
+class AsyncRing : public CxxAbb::Runnable
+{
+public:
+	AsyncRing(AsyncFile & _file, unsigned int _uiEntries)
+		: m_File(_file),
+		  i_Fd(-1),
+		  p_SqRing(MAP_FAILED),
+		  p_CqRing(MAP_FAILED),
+		  p_Sqes(MAP_FAILED),
+		  t_SqRingSize(0),
+		  t_CqRingSize(0),
+		  t_SqesSize(0),
+		  i_Error(0),
+		  m_Thread("AsyncFile")
+	{
+		struct io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+		i_Fd = UringSetup(_uiEntries, &params);
+		if (i_Fd < 0)
+			ThrowSystem("io_uring_setup");
+
+		t_SqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+		t_CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		bool bSingle = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (bSingle)
+			t_SqRingSize = t_CqRingSize = std::max(t_SqRingSize, t_CqRingSize);
+
+		p_SqRing = ::mmap(NullPtr, t_SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, i_Fd, IORING_OFF_SQ_RING);
+		if (p_SqRing == MAP_FAILED)
+			Fail("io_uring mmap");
+		p_CqRing = bSingle ? p_SqRing
+				: ::mmap(NullPtr, t_CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, i_Fd, IORING_OFF_CQ_RING);
+		if (p_CqRing == MAP_FAILED)
+			Fail("io_uring mmap");
+		t_SqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+		p_Sqes = ::mmap(NullPtr, t_SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, i_Fd, IORING_OFF_SQES);
+		if (p_Sqes == MAP_FAILED)
+			Fail("io_uring mmap");
+
+		char * pSq = static_cast<char*>(p_SqRing);
+		p_SqTail = reinterpret_cast<unsigned int*>(pSq + params.sq_off.tail);
+		ui_SqMask = *reinterpret_cast<unsigned int*>(pSq + params.sq_off.ring_mask);
+		p_SqArray = reinterpret_cast<unsigned int*>(pSq + params.sq_off.array);
+		ui_SqEntries = params.sq_entries;
+		ui_SqLocalTail = *p_SqTail;
+
+		char * pCq = static_cast<char*>(p_CqRing);
+		p_CqHead = reinterpret_cast<unsigned int*>(pCq + params.cq_off.head);
+		p_CqTail = reinterpret_cast<unsigned int*>(pCq + params.cq_off.tail);
+		ui_CqMask = *reinterpret_cast<unsigned int*>(pCq + params.cq_off.ring_mask);
+		p_Cqes = reinterpret_cast<struct io_uring_cqe*>(pCq + params.cq_off.cqes);
+
+		// slot ui_SqEntries is never handed out, its user_data stops the completion thread
+		lst_Slots.resize(ui_SqEntries, NullPtr);
+		for (unsigned int i = ui_SqEntries; i > 0; --i)
+			lst_Free.push_back(i - 1);
+
+		m_Thread.Start(*this);
+	}
+
+	/// Stops the completion thread with a NOP. No operation may be in flight
+	~AsyncRing()
+	{
+		{
+			FastMutex::ScopedLock lock(mtx_Submit);
+			if (!i_Error)
+			{
+				struct io_uring_sqe * pSqe = Next();
+				pSqe->opcode = IORING_OP_NOP;
+				pSqe->user_data = ui_SqEntries;
+				// the ring refuses a NOP only when it is broken, then the wait of the
+				// completion thread fails too and it leaves through Abandon()
+				unsigned int uiCount = 1;
+				Enter(uiCount);
+			}
+		}
+		m_Thread.Join();
+		Unmap();
+	}
+
+	unsigned int Entries() const
+	{
+		return ui_SqEntries;
+	}
+
+	/// Takes ownership of the ops, every one of them is completed exactly once. Never throws
+	void Submit(AsyncFileOp ** _pOps, std::size_t _tCount)
+	{
+		std::size_t tFailed;
+		int iError;
+		{
+			FastMutex::ScopedLock lock(mtx_Submit);
+			iError = i_Error;
+			if (!iError)
+			{
+				{
+					SpinLock::ScopedLock lockFree(mtx_Free);
+					for (std::size_t i = 0; i < _tCount; ++i)
+					{
+						unsigned int uiSlot = lst_Free.back();
+						lst_Free.pop_back();
+						lst_Slots[uiSlot] = _pOps[i];
+						Prepare(*Next(), *_pOps[i], uiSlot);
+					}
+				}
+
+				unsigned int uiLeft = static_cast<unsigned int>(_tCount);
+				iError = Enter(uiLeft);
+				if (uiLeft)
+				{
+					// not consumed by the kernel: take the SQEs back and free their slots
+					ui_SqLocalTail -= uiLeft;
+					AtomicStore(p_SqTail, ui_SqLocalTail, MemoryOrderRelease);
+					_pOps += _tCount - uiLeft;
+					_tCount = uiLeft;
+					FreeSlots(_pOps, _tCount);
+				}
+				else
+				{
+					_tCount = 0;
+				}
+			}
+			tFailed = _tCount;
+		}
+
+		if (tFailed)
+			FailOps(_pOps, tFailed, iError);
+	}
+
+	/// Completion thread
+	void Run()
+	{
+		std::vector<unsigned int> lstDone;
+		lstDone.reserve(ui_SqEntries);
+		bool bStop = false;
+		while (!bStop)
+		{
+			if (UringEnter(i_Fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && !Retry(errno))
+			{
+				Abandon(errno);
+				return;
+			}
+
+			unsigned int uiHead = *p_CqHead;
+			unsigned int uiTail = AtomicLoad(p_CqTail, MemoryOrderAcquire);
+			for (; uiHead != uiTail; ++uiHead)
+			{
+				const struct io_uring_cqe & cqe = p_Cqes[uiHead & ui_CqMask];
+				unsigned int uiSlot = static_cast<unsigned int>(cqe.user_data);
+				if (uiSlot == ui_SqEntries)
+				{
+					bStop = true;
+					continue;
+				}
+				AsyncFileOp * pOp = lst_Slots[uiSlot];
+				pOp->Complete(cqe.res);
+				delete pOp;
+				lstDone.push_back(uiSlot);
+			}
+			AtomicStore(p_CqHead, uiHead, MemoryOrderRelease);
+
+			if (!lstDone.empty())
+			{
+				{
+					SpinLock::ScopedLock lockFree(mtx_Free);
+					for (std::size_t i = 0; i < lstDone.size(); ++i)
+					{
+						lst_Slots[lstDone[i]] = NullPtr;
+						lst_Free.push_back(lstDone[i]);
+					}
+				}
+				m_File.Release(lstDone.size());
+				lstDone.clear();
+			}
+		}
+	}
+
+private:
+	static bool Retry(int _iErrno)
+	{
+		return _iErrno == EINTR || _iErrno == EAGAIN || _iErrno == EBUSY;
+	}
+
+	/// Next free SQE, cleared and linked into the SQ array. Caller holds mtx_Submit
+	struct io_uring_sqe * Next()
+	{
+		unsigned int uiIndex = ui_SqLocalTail++ & ui_SqMask;
+		struct io_uring_sqe * pSqe = static_cast<struct io_uring_sqe*>(p_Sqes) + uiIndex;
+		std::memset(pSqe, 0, sizeof(*pSqe));
+		p_SqArray[uiIndex] = uiIndex;
+		return pSqe;
+	}
+
+	void Prepare(struct io_uring_sqe & _sqe, AsyncFileOp & _op, unsigned int _uiSlot)
+	{
+		_sqe.fd = m_File.i_Fd;
+		_sqe.user_data = _uiSlot;
+		switch (_op.e_Kind)
+		{
+		case AsyncFileOp::OpRead:
+		case AsyncFileOp::OpWrite:
+			_sqe.opcode = _op.e_Kind == AsyncFileOp::OpRead ? IORING_OP_READV : IORING_OP_WRITEV;
+			_sqe.off = _op.t_Offset;
+			_sqe.addr = reinterpret_cast<UPtrT>(&_op.m_Vec);
+			_sqe.len = 1;
+			break;
+		default:
+			_sqe.opcode = IORING_OP_FSYNC;
+			_sqe.fsync_flags = _op.e_Kind == AsyncFileOp::OpDataSync ? IORING_FSYNC_DATASYNC : 0;
+			break;
+		}
+	}
+
+	/** Publishes the new SQEs and has the kernel consume _uiCount of them.
+	 * Transient errors are retried. Returns 0, or errno with _uiCount left at
+	 * the number of SQEs the kernel did not take
+	 */
+	int Enter(unsigned int & _uiCount)
+	{
+		AtomicStore(p_SqTail, ui_SqLocalTail, MemoryOrderRelease);
+		while (_uiCount)
+		{
+			int iDone = UringEnter(i_Fd, _uiCount, 0, 0);
+			if (iDone < 0)
+			{
+				if (Retry(errno))
+					continue;
+				return errno;
+			}
+			_uiCount -= static_cast<unsigned int>(iDone);
+		}
+		return 0;
+	}
+
+	void FreeSlots(AsyncFileOp ** _pOps, std::size_t _tCount)
+	{
+		SpinLock::ScopedLock lockFree(mtx_Free);
+		for (unsigned int i = 0; i < lst_Slots.size(); ++i)
+		{
+			if (lst_Slots[i] && std::find(_pOps, _pOps + _tCount, lst_Slots[i]) != _pOps + _tCount)
+			{
+				lst_Slots[i] = NullPtr;
+				lst_Free.push_back(i);
+			}
+		}
+	}
+
+	void FailOps(AsyncFileOp ** _pOps, std::size_t _tCount, int _iError)
+	{
+		for (std::size_t i = 0; i < _tCount; ++i)
+		{
+			_pOps[i]->Complete(-static_cast<long>(_iError));
+			delete _pOps[i];
+		}
+		m_File.Release(_tCount);
+	}
+
+	/** The completion thread can not wait on the ring any more: fail all ops in
+	 * flight and every later submission with _iErrno. The kernel may still
+	 * finish some of them, their results are dropped
+	 */
+	void Abandon(int _iErrno)
+	{
+		std::vector<AsyncFileOp*> lstOps;
+		{
+			FastMutex::ScopedLock lock(mtx_Submit);
+			i_Error = _iErrno;
+			SpinLock::ScopedLock lockFree(mtx_Free);
+			for (unsigned int i = 0; i < lst_Slots.size(); ++i)
+			{
+				if (lst_Slots[i])
+					lstOps.push_back(lst_Slots[i]);
+				lst_Slots[i] = NullPtr;
+			}
+		}
+		if (!lstOps.empty())
+			FailOps(&lstOps[0], lstOps.size(), _iErrno);
+	}
+
+	void Unmap()
+	{
+		if (p_Sqes != MAP_FAILED)
+			::munmap(p_Sqes, t_SqesSize);
+		if (p_CqRing != MAP_FAILED && p_CqRing != p_SqRing)
+			::munmap(p_CqRing, t_CqRingSize);
+		if (p_SqRing != MAP_FAILED)
+			::munmap(p_SqRing, t_SqRingSize);
+		if (i_Fd >= 0)
+			::close(i_Fd);
+	}
+
+	void Fail(const char * _pWhat)
+	{
+		int iErrno = errno;
+		Unmap();
+		errno = iErrno;
+		ThrowSystem(_pWhat);
+	}
+
+	static void ThrowSystem(const char * _pWhat)
+	{
+		std::ostringstream ss;
+		ss << _pWhat << " failed: " << std::strerror(errno);
+		throw CxxAbb::SystemException(ss.str(), errno);
+	}
+
+	AsyncFile & m_File;
+	int i_Fd;
+	void * p_SqRing;
+	void * p_CqRing;
+	void * p_Sqes;
+	std::size_t t_SqRingSize;
+	std::size_t t_CqRingSize;
+	std::size_t t_SqesSize;
+
+	unsigned int * p_SqTail;
+	unsigned int * p_SqArray;
+	unsigned int ui_SqMask;
+	unsigned int ui_SqEntries;
+	unsigned int ui_SqLocalTail;
+
+	unsigned int * p_CqHead;
+	unsigned int * p_CqTail;
+	unsigned int ui_CqMask;
+	struct io_uring_cqe * p_Cqes;
+
+	std::vector<AsyncFileOp*> lst_Slots;   /// op in flight per slot, NullPtr if free
+	std::vector<unsigned int> lst_Free;
+	SpinLock mtx_Free;                     /// slots, taken by the submitter and the completion thread
+	int i_Error;                           /// errno the completion thread gave up with, under mtx_Submit
+	FastMutex mtx_Submit;
+	Thread m_Thread;
+};
+
+#else
+
+/// Never constructed, io_uring is not available on this platform
+class AsyncRing
+{
+public:
+	AsyncRing(AsyncFile &, unsigned int)
+	{
+		throw CxxAbb::NotImplementedException("io_uring is not available on this platform");
+	}
+
+	unsigned int Entries() const
+	{
+		return 0;
+	}
+
+	void Submit(AsyncFileOp **, std::size_t)
+	{}
+};
+
+#endif
+
+}  /* namespace Dp */
+
+namespace
+{
+
+unsigned int RoundUpPow2(unsigned int _uiValue)
+{
+	unsigned int uiPow = 1;
+	while (uiPow < _uiValue)
+		uiPow <<= 1;
+	return uiPow;
+}
+
+/// Workers of the fallback pool, blocking I/O gains little past a few threads per file
+const unsigned int MaxPoolThreads = 4;
+
+OnceFlag g_UringOnce = CXXABB_ONCE_INIT;
+bool g_UringSupported = false;
+
+void ProbeUring()
+{
+#if defined(CXXABB_HAVE_IO_URING)
+	struct io_uring_params params;
+	std::memset(&params, 0, sizeof(params));
+	int iFd = Dp::UringSetup(1, &params);
+	if (iFd >= 0)
+	{
+		::close(iFd);
+		g_UringSupported = true;
+	}
+#endif
+}
+
+}
+
+AsyncFile::Batch::~Batch()
+{
+	for (std::size_t i = 0; i < lst_Ops.size(); ++i)
+		delete lst_Ops[i];
+}
+
+Future<std::size_t> AsyncFile::Batch::Add(Dp::AsyncFileOp * _pOp)
+{
+	lst_Ops.reserve(lst_Ops.size() + 1);
+	Future<std::size_t> future = _pOp->MakeFuture();
+	lst_Ops.push_back(_pOp);
+	return future;
+}
+
+Future<std::size_t> AsyncFile::Batch::Read(std::size_t _tOffset, Buffer<char> & _buf)
+{
+	return Add(new Dp::AsyncFileOp(Dp::AsyncFileOp::OpRead, _tOffset, &_buf, _buf.begin(), _buf.capacity(), NullPtr, NullPtr));
+}
+
+void AsyncFile::Batch::Read(std::size_t _tOffset, Buffer<char> & _buf, Callback _callback, void * _pData)
+{
+	CHECKNULL(_callback);
+	lst_Ops.reserve(lst_Ops.size() + 1);
+	lst_Ops.push_back(new Dp::AsyncFileOp(Dp::AsyncFileOp::OpRead, _tOffset, &_buf, _buf.begin(), _buf.capacity(),
+			_callback, _pData));
+}
+
+Future<std::size_t> AsyncFile::Batch::Write(std::size_t _tOffset, const Buffer<char> & _buf)
+{
+	return Add(new Dp::AsyncFileOp(Dp::AsyncFileOp::OpWrite, _tOffset, NullPtr, const_cast<char*>(_buf.begin()),
+			_buf.size(), NullPtr, NullPtr));
+}
+
+void AsyncFile::Batch::Write(std::size_t _tOffset, const Buffer<char> & _buf, Callback _callback, void * _pData)
+{
+	CHECKNULL(_callback);
+	lst_Ops.reserve(lst_Ops.size() + 1);
+	lst_Ops.push_back(new Dp::AsyncFileOp(Dp::AsyncFileOp::OpWrite, _tOffset, NullPtr, const_cast<char*>(_buf.begin()),
+			_buf.size(), _callback, _pData));
+}
+
+Future<std::size_t> AsyncFile::Batch::Fsync(bool _bDataOnly)
+{
+	return Add(new Dp::AsyncFileOp(_bDataOnly ? Dp::AsyncFileOp::OpDataSync : Dp::AsyncFileOp::OpFsync, 0, NullPtr,
+			NullPtr, 0, NullPtr, NullPtr));
+}
+
+void AsyncFile::Batch::Fsync(bool _bDataOnly, Callback _callback, void * _pData)
+{
+	CHECKNULL(_callback);
+	lst_Ops.reserve(lst_Ops.size() + 1);
+	lst_Ops.push_back(new Dp::AsyncFileOp(_bDataOnly ? Dp::AsyncFileOp::OpDataSync : Dp::AsyncFileOp::OpFsync, 0,
+			NullPtr, NullPtr, 0, _callback, _pData));
+}
+
+AsyncFile::AsyncFile()
+	: i_Fd(-1),
+	  e_Backend(BackendAuto),
+	  ui_Depth(0),
+	  p_Ring(NullPtr),
+	  p_Pool(NullPtr),
+	  t_InFlight(0),
+	  ui_Waiters(0)
+{
+}
+
+AsyncFile::AsyncFile(const std::string & _sPath, Access _eAccess, int _iFlags, Backend _eBackend,
+		unsigned int _uiQueueDepth)
+	: i_Fd(-1),
+	  e_Backend(BackendAuto),
+	  ui_Depth(0),
+	  p_Ring(NullPtr),
+	  p_Pool(NullPtr),
+	  t_InFlight(0),
+	  ui_Waiters(0)
+{
+	Open(_sPath, _eAccess, _iFlags, _eBackend, _uiQueueDepth);
+}
+
+AsyncFile::~AsyncFile()
+{
+	Close();
+}
+
+void AsyncFile::Open(const std::string & _sPath, Access _eAccess, int _iFlags, Backend _eBackend,
+		unsigned int _uiQueueDepth)
+{
+	Close();
+
+	int iOpenFlags = _eAccess == ReadOnly ? O_RDONLY : (_eAccess == WriteOnly ? O_WRONLY : O_RDWR);
+	if (_iFlags & Create)
+		iOpenFlags |= O_CREAT;
+	if (_iFlags & Truncate)
+		iOpenFlags |= O_TRUNC;
+#if defined(O_DIRECT)
+	if (_iFlags & Direct)
+		iOpenFlags |= O_DIRECT;
+#endif
+	int iFd = ::open(_sPath.c_str(), iOpenFlags | O_CLOEXEC, 0644);
+	if (iFd < 0)
+		throw OpenFileException(_sPath, errno);
+
+	s_Path = _sPath;
+	i_Fd = iFd;
+	ui_Depth = RoundUpPow2(_uiQueueDepth ? _uiQueueDepth : 1);
+
+	if (_eBackend == BackendUring || (_eBackend == BackendAuto && UringSupported()))
+	{
+		try
+		{
+			p_Ring = new Dp::AsyncRing(*this, ui_Depth);
+			ui_Depth = std::min(ui_Depth, p_Ring->Entries());
+			e_Backend = BackendUring;
+			return;
+		}
+		catch(CxxAbb::Exception &)
+		{
+			if (_eBackend == BackendUring)
+			{
+				Close();
+				throw;
+			}
+		}
+	}
+
+	p_Pool = new ThreadPool(std::min(ui_Depth, MaxPoolThreads), "AsyncFile");
+	e_Backend = BackendThreadPool;
+}
+
+void AsyncFile::Close()
+{
+	if (i_Fd < 0)
+		return;
+
+	Drain();
+	delete p_Ring;
+	p_Ring = NullPtr;
+	delete p_Pool;
+	p_Pool = NullPtr;
+	::close(i_Fd);
+	i_Fd = -1;
+	e_Backend = BackendAuto;
+}
+
+std::size_t AsyncFile::Size() const
+{
+	struct stat st;
+	if (::fstat(i_Fd, &st) != 0)
+		throw FileException(s_Path, errno);
+	return static_cast<std::size_t>(st.st_size);
+}
+
+Future<std::size_t> AsyncFile::Read(std::size_t _tOffset, Buffer<char> & _buf)
+{
+	Dp::AsyncFileOp * pOp = new Dp::AsyncFileOp(Dp::AsyncFileOp::OpRead, _tOffset, &_buf, _buf.begin(),
+			_buf.capacity(), NullPtr, NullPtr);
+	Future<std::size_t> future = pOp->MakeFuture();
+	SubmitOne(pOp);
+	return future;
+}
+
+void AsyncFile::Read(std::size_t _tOffset, Buffer<char> & _buf, Callback _callback, void * _pData)
+{
+	CHECKNULL(_callback);
+	SubmitOne(new Dp::AsyncFileOp(Dp::AsyncFileOp::OpRead, _tOffset, &_buf, _buf.begin(), _buf.capacity(),
+			_callback, _pData));
+}
+
+Future<std::size_t> AsyncFile::Write(std::size_t _tOffset, const Buffer<char> & _buf)
+{
+	Dp::AsyncFileOp * pOp = new Dp::AsyncFileOp(Dp::AsyncFileOp::OpWrite, _tOffset, NullPtr,
+			const_cast<char*>(_buf.begin()), _buf.size(), NullPtr, NullPtr);
+	Future<std::size_t> future = pOp->MakeFuture();
+	SubmitOne(pOp);
+	return future;
+}
+
+void AsyncFile::Write(std::size_t _tOffset, const Buffer<char> & _buf, Callback _callback, void * _pData)
+{
+	CHECKNULL(_callback);
+	SubmitOne(new Dp::AsyncFileOp(Dp::AsyncFileOp::OpWrite, _tOffset, NullPtr, const_cast<char*>(_buf.begin()),
+			_buf.size(), _callback, _pData));
+}
+
+Future<std::size_t> AsyncFile::Fsync(bool _bDataOnly)
+{
+	Dp::AsyncFileOp * pOp = new Dp::AsyncFileOp(_bDataOnly ? Dp::AsyncFileOp::OpDataSync : Dp::AsyncFileOp::OpFsync,
+			0, NullPtr, NullPtr, 0, NullPtr, NullPtr);
+	Future<std::size_t> future = pOp->MakeFuture();
+	SubmitOne(pOp);
+	return future;
+}
+
+void AsyncFile::Submit(Batch & _batch)
+{
+	if (_batch.lst_Ops.empty())
+		return;
+
+	Submit(&_batch.lst_Ops[0], _batch.lst_Ops.size());
+	_batch.lst_Ops.clear();
+}
+
+void AsyncFile::SubmitOne(Dp::AsyncFileOp * _pOp)
+{
+	try
+	{
+		Submit(&_pOp, 1);
+	}
+	catch(...)
+	{
+		delete _pOp;
+		throw;
+	}
+}
+
+/** Ops are owned by the backend once submitted, every one of them is completed
+ * exactly once from then on. Throws only before taking any of them, the caller
+ * still owns them then. Larger batches go in chunks of the queue depth
+ */
+void AsyncFile::Submit(Dp::AsyncFileOp ** _pOps, std::size_t _tCount)
+{
+	if (i_Fd < 0)
+		throw IllegalStateException("AsyncFile is not open");
+
+	// the completion thread can not wait for slots only it would free
+	bool bCompleting = Dp::t_pCompleting == this;
+	if (bCompleting && !TryAcquire(_tCount))
+		throw IllegalStateException("AsyncFile queue full, can not wait in its own completion: " + s_Path);
+
+	for (std::size_t i = 0; i < _tCount; ++i)
+		_pOps[i]->p_File = this;
+
+	while (_tCount)
+	{
+		std::size_t tChunk = std::min(_tCount, static_cast<std::size_t>(ui_Depth));
+		if (!bCompleting)
+			Acquire(tChunk);
+		if (p_Ring)
+		{
+			p_Ring->Submit(_pOps, tChunk);
+		}
+		else
+		{
+			for (std::size_t i = 0; i < tChunk; ++i)
+			{
+				try
+				{
+					p_Pool->Execute(_pOps[i]);
+				}
+				catch(...)
+				{
+					_pOps[i]->Complete(-ENOMEM);
+					delete _pOps[i];
+					Release(1);
+				}
+			}
+		}
+		_pOps += tChunk;
+		_tCount -= tChunk;
+	}
+}
+
+std::size_t AsyncFile::Pending() const
+{
+	FastMutex::ScopedLock lock(mtx_Slots);
+	return t_InFlight;
+}
+
+void AsyncFile::Drain()
+{
+	FastMutex::ScopedLock lock(mtx_Slots);
+	while (t_InFlight)
+	{
+		++ui_Waiters;
+		m_Slots.Wait(mtx_Slots);
+		--ui_Waiters;
+	}
+}
+
+void AsyncFile::Acquire(std::size_t _tCount)
+{
+	FastMutex::ScopedLock lock(mtx_Slots);
+	while (t_InFlight + _tCount > ui_Depth)
+	{
+		++ui_Waiters;
+		m_Slots.Wait(mtx_Slots);
+		--ui_Waiters;
+	}
+	t_InFlight += _tCount;
+}
+
+bool AsyncFile::TryAcquire(std::size_t _tCount)
+{
+	FastMutex::ScopedLock lock(mtx_Slots);
+	if (t_InFlight + _tCount > ui_Depth)
+		return false;
+	t_InFlight += _tCount;
+	return true;
+}
+
+void AsyncFile::Release(std::size_t _tCount)
+{
+	FastMutex::ScopedLock lock(mtx_Slots);
+	t_InFlight -= _tCount;
+	if (ui_Waiters)
+		m_Slots.SignalAll();
+}
+
+bool AsyncFile::UringSupported()
+{
+	CallOnce(g_UringOnce, &ProbeUring);
+	return g_UringSupported;
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
@@ -57,65 +57,65 @@ AtomicCounter::~AtomicCounter()
 {
 }
 
-inline AtomicCounter::operator AtomicType() const
+AtomicCounter::operator AtomicType() const
 {
 	return t_Counter;
 }
 
-inline AtomicCounter::operator int() const
+AtomicCounter::operator int() const
 {
 	return t_Counter;
 }
 
-inline AtomicType AtomicCounter::Value() const
+AtomicType AtomicCounter::Value() const
 {
 	return t_Counter;
 }
 
 /// Operators
-inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
+AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 {
 	t_Counter = _counter.Value();
 	return *this;
 }
 
-inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
+AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 {
 	t_Counter = _atomictype;
 	return *this;
 }
 
-inline AtomicCounter& AtomicCounter::operator =(Int32 _intval)
+AtomicCounter& AtomicCounter::operator =(Int32 _intval)
 {
 	t_Counter = _intval;
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++()
+AtomicType AtomicCounter::operator ++()
 {
 	t_Counter++;
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++(Int32)
+AtomicType AtomicCounter::operator ++(Int32)
 {
 	++t_Counter;
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator --()
+AtomicType AtomicCounter::operator --()
 {
 	t_Counter--;
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator --(Int32)
+AtomicType AtomicCounter::operator --(Int32)
 {
 	--t_Counter;
 	return *this;
 }
 
-inline bool AtomicCounter::operator !() const
+bool AtomicCounter::operator !() const
 {
 	return t_Counter == 0;
 }
@@ -63,7 +63,7 @@ AtomicCounter::~AtomicCounter()
 {
 }
 
-inline AtomicCounter::operator AtomicType() const
+AtomicCounter::operator AtomicType() const
 {
 	int iRet = 0;
 
@@ -78,7 +78,7 @@ inline AtomicCounter::operator AtomicType() const
 	return iRet;
 }
 
-inline AtomicType AtomicCounter::Value() const
+AtomicType AtomicCounter::Value() const
 {
 	AtomicType t;
 
@@ -94,7 +94,7 @@ inline AtomicType AtomicCounter::Value() const
 }
 
 /// Operators
-inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
+AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 {
 	pthread_cleanup_push((cleanup_proc_t)pthread_mutex_unlock, (void *)&S_Mutex);
 	pthread_mutex_lock(&S_Mutex);
@@ -107,7 +107,7 @@ inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 	return *this;
 }
 
-inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
+AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 {
 	pthread_cleanup_push((cleanup_proc_t)pthread_mutex_unlock, (void *)&S_Mutex);
 	pthread_mutex_lock(&S_Mutex);
@@ -120,7 +120,7 @@ inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++()
+AtomicType AtomicCounter::operator ++()
 {
 	pthread_cleanup_push((cleanup_proc_t)pthread_mutex_unlock, (void *)&S_Mutex);
 	pthread_mutex_lock(&S_Mutex);
@@ -133,7 +133,7 @@ inline AtomicType AtomicCounter::operator ++()
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++(Int32)
+AtomicType AtomicCounter::operator ++(Int32)
 {
 	pthread_cleanup_push((cleanup_proc_t)pthread_mutex_unlock, (void *)&S_Mutex);
 	pthread_mutex_lock(&S_Mutex);
@@ -146,7 +146,7 @@ inline AtomicType AtomicCounter::operator ++(Int32)
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator --()
+AtomicType AtomicCounter::operator --()
 {
 	pthread_cleanup_push((cleanup_proc_t)pthread_mutex_unlock, (void *)&S_Mutex);
 	pthread_mutex_lock(&S_Mutex);
@@ -159,7 +159,7 @@ inline AtomicType AtomicCounter::operator --()
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator --(Int32)
+AtomicType AtomicCounter::operator --(Int32)
 {
 	pthread_cleanup_push((cleanup_proc_t)pthread_mutex_unlock, (void *)&S_Mutex);
 	pthread_mutex_lock(&S_Mutex);
@@ -172,7 +172,7 @@ inline AtomicType AtomicCounter::operator --(Int32)
 	return *this;
 }
 
-inline bool AtomicCounter::operator !() const
+bool AtomicCounter::operator !() const
 {
 	bool bRet = false;
 
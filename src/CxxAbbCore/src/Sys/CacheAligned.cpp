@@ -0,0 +1,56 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * CacheAligned.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Cache line padding helpers
+ *
+ */
+
+
+#include <CxxAbb/Sys/CacheAligned.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+void * AllocateCacheAligned(std::size_t _tBytes)
+{
+	void * pMemory = NullPtr;
+	if (::posix_memalign(&pMemory, CacheLineSize, _tBytes ? _tBytes : 1) != 0)
+		throw std::bad_alloc();
+	std::memset(pMemory, 0, _tBytes);
+	return pMemory;
+}
+
+void FreeCacheAligned(void * _pMemory)
+{
+	std::free(_pMemory);
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
@@ -29,8 +29,16 @@
 #include <CxxAbb/Sys/Environment.h>
 #include "EnvironmentImpl.h"
 #include <CxxAbb/Version.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Exception.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <iomanip>
+#include <pthread.h>
 
 namespace CxxAbb
 {
@@ -38,6 +46,126 @@ namespace CxxAbb
 namespace Sys
 {
 
+namespace
+{
+
+/// never destroyed, may be used from static destructors
+CpuTopology * g_pTopology = 0;
+OnceFlag g_TopologyOnce = CXXABB_ONCE_INIT;
+
+void ReadHostTopology()
+{
+	CpuTopology * pTopology = new CpuTopology;
+	EnvironmentImpl::ReadTopologyImpl(*pTopology, "/");
+	g_pTopology = pTopology;
+}
+
+/// Serializes Set() and Refresh(). g_pSnapshot holds one reference to the
+/// published snapshot, t_pSnapshot one to the snapshot its thread read last,
+/// dropped by the key destructor when the thread exits.
+struct SnapshotState
+{
+	SnapshotState()
+	{
+		::pthread_key_create(&t_Key, &SnapshotState::ThreadExit);
+	}
+
+	static void ThreadExit(void * _pSnapshot);
+
+	FastMutex mtx_Publish;
+	pthread_key_t t_Key;
+};
+
+/// never destroyed, threads may exit after static destructors ran
+SnapshotState * g_pSnapshotState = 0;
+const EnvironmentSnapshot * g_pSnapshot = 0;
+OnceFlag g_SnapshotOnce = CXXABB_ONCE_INIT;
+
+__thread const EnvironmentSnapshot * t_pSnapshot = 0;
+
+void SnapshotState::ThreadExit(void * _pSnapshot)
+{
+	t_pSnapshot = 0;
+	static_cast<const EnvironmentSnapshot *>(_pSnapshot)->refRem();
+}
+
+struct VariableLess
+{
+	bool operator()(const EnvironmentSnapshot::Variable & _lhs, const std::string & _rhs) const
+	{
+		return _lhs.first < _rhs;
+	}
+
+	bool operator()(const EnvironmentSnapshot::Variable & _lhs, const EnvironmentSnapshot::Variable & _rhs) const
+	{
+		return _lhs.first < _rhs.first;
+	}
+};
+
+std::string FormatNodeId(const EnvironmentSnapshot::NodeId & _id)
+{
+	char result[18];
+	std::sprintf(result, "%02x:%02x:%02x:%02x:%02x:%02x",
+		_id[0],
+		_id[1],
+		_id[2],
+		_id[3],
+		_id[4],
+		_id[5]);
+	return std::string(result);
+}
+
+}
+
+EnvironmentSnapshot::EnvironmentSnapshot()
+	: ui_ProcessorCount(0),
+	  ui_Generation(0)
+{
+	std::memset(a_NodeId, 0, sizeof(a_NodeId));
+}
+
+const std::string * EnvironmentSnapshot::Find(const std::string & _key) const
+{
+	VariableList::const_iterator it = std::lower_bound(lst_Variables.begin(), lst_Variables.end(), _key, VariableLess());
+	if (it != lst_Variables.end() && it->first == _key)
+		return &it->second;
+	return NullPtr;
+}
+
+const std::string & EnvironmentSnapshot::Get(const std::string & _key) const
+{
+	const std::string * pValue = Find(_key);
+	if (!pValue)
+		throw CxxAbb::NotFoundException(_key);
+	return *pValue;
+}
+
+const std::string & EnvironmentSnapshot::Get(const std::string & _key, const std::string & _default) const
+{
+	const std::string * pValue = Find(_key);
+	return pValue ? *pValue : _default;
+}
+
+const CacheInfo * CpuTopology::Cache(int _iLevel) const
+{
+	for (std::size_t i = 0; i < lst_Caches.size(); ++i)
+	{
+		if (lst_Caches[i].i_Level == _iLevel && lst_Caches[i].s_Type != "Instruction")
+			return &lst_Caches[i];
+	}
+	return NullPtr;
+}
+
+const NumaNode * CpuTopology::NodeOf(int _iCpu) const
+{
+	for (std::size_t i = 0; i < lst_Nodes.size(); ++i)
+	{
+		if (std::binary_search(lst_Nodes[i].lst_Cpus.begin(), lst_Nodes[i].lst_Cpus.end(), _iCpu))
+			return &lst_Nodes[i];
+	}
+	return NullPtr;
+}
+
 std::string Environment::Get(const std::string & _key)
 {
 	return EnvironmentImpl::GetImpl(_key);
@@ -48,6 +176,11 @@ std::string Environment::Get(const std::string & _key, const std::string & _defa
 	return EnvironmentImpl::GetImpl(_key, _default);
 }
 
+Result<std::string> Environment::TryGet(const std::string & _key)
+{
+	return EnvironmentImpl::TryGetImpl(_key);
+}
+
 bool Environment::Has(const std::string & _key)
 {
 	return EnvironmentImpl::HasImpl(_key);
@@ -55,47 +188,156 @@ bool Environment::Has(const std::string & _key)
 
 void Environment::Set(const std::string & _key, const std::string & _value)
 {
-	EnvironmentImpl::SetImpl(_key, _value);
+	ThreadSnapshot();
+	EnvironmentSnapshot::Ptr ptrReleased;
+	{
+		// under the lock, concurrent Set() calls publish in the order they change the environment
+		FastMutex::ScopedLock lock(g_pSnapshotState->mtx_Publish);
+		EnvironmentImpl::SetImpl(_key, _value);
+
+		EnvironmentSnapshot * pSnapshot = new EnvironmentSnapshot;
+		try
+		{
+			CaptureSnapshot(*pSnapshot, g_pSnapshot);
+		}
+		catch (...)
+		{
+			delete pSnapshot;
+			throw;
+		}
+		PublishSnapshot(pSnapshot, ptrReleased);
+	}
+}
+
+EnvironmentSnapshot::Ptr Environment::Snapshot()
+{
+	return EnvironmentSnapshot::Ptr(&ThreadSnapshot(), true);
+}
+
+void Environment::Refresh()
+{
+	ThreadSnapshot();
+	EnvironmentSnapshot::Ptr ptrReleased;
+	{
+		FastMutex::ScopedLock lock(g_pSnapshotState->mtx_Publish);
+		EnvironmentSnapshot * pSnapshot = new EnvironmentSnapshot;
+		try
+		{
+			CaptureSnapshot(*pSnapshot, NullPtr);
+		}
+		catch (...)
+		{
+			delete pSnapshot;
+			throw;
+		}
+		PublishSnapshot(pSnapshot, ptrReleased);
+	}
+}
+
+void Environment::InitSnapshot()
+{
+	g_pSnapshotState = new SnapshotState;
+
+	EnvironmentSnapshot * pSnapshot = new EnvironmentSnapshot;
+	CaptureSnapshot(*pSnapshot, NullPtr);
+	pSnapshot->ui_Generation = 1;
+	AtomicStore(&g_pSnapshot, const_cast<const EnvironmentSnapshot *>(pSnapshot), MemoryOrderRelease);
+}
+
+/// The snapshot this thread holds a reference to, valid until the thread calls it again
+const EnvironmentSnapshot & Environment::ThreadSnapshot()
+{
+	// t_pSnapshot keeps its snapshot alive, so an equal published pointer is the same snapshot
+	const EnvironmentSnapshot * pSnapshot = t_pSnapshot;
+	if (pSnapshot && pSnapshot == AtomicLoad(&g_pSnapshot, MemoryOrderAcquire))
+		return *pSnapshot;
+	return UpdateThreadSnapshot();
+}
+
+/// First read of a thread or first one after a publish, takes the published reference under mtx_Publish
+const EnvironmentSnapshot & Environment::UpdateThreadSnapshot()
+{
+	CallOnce(g_SnapshotOnce, &Environment::InitSnapshot);
+
+	const EnvironmentSnapshot * pSnapshot;
+	{
+		FastMutex::ScopedLock lock(g_pSnapshotState->mtx_Publish);
+		pSnapshot = g_pSnapshot;
+		pSnapshot->refAdd();
+	}
+
+	EnvironmentSnapshot::Ptr ptrReleased(t_pSnapshot);
+	t_pSnapshot = pSnapshot;
+	::pthread_setspecific(g_pSnapshotState->t_Key, const_cast<EnvironmentSnapshot *>(pSnapshot));
+	return *pSnapshot;
+}
+
+/// Reads the host details unless _pHost is given to copy them from
+void Environment::CaptureSnapshot(EnvironmentSnapshot & _snapshot, const EnvironmentSnapshot * _pHost)
+{
+	EnvironmentImpl::VariablesImpl(_snapshot.lst_Variables);
+	std::sort(_snapshot.lst_Variables.begin(), _snapshot.lst_Variables.end(), VariableLess());
+
+	if (_pHost)
+	{
+		_snapshot.s_OsName = _pHost->s_OsName;
+		_snapshot.s_OsVersion = _pHost->s_OsVersion;
+		_snapshot.s_OsArchitecture = _pHost->s_OsArchitecture;
+		_snapshot.s_HostName = _pHost->s_HostName;
+		std::memcpy(_snapshot.a_NodeId, _pHost->a_NodeId, sizeof(_snapshot.a_NodeId));
+		_snapshot.s_EthernetAddress = _pHost->s_EthernetAddress;
+		_snapshot.ui_ProcessorCount = _pHost->ui_ProcessorCount;
+		return;
+	}
+
+	_snapshot.s_OsName = EnvironmentImpl::OsNameImpl();
+	_snapshot.s_OsVersion = EnvironmentImpl::OsVersionImpl();
+	_snapshot.s_OsArchitecture = EnvironmentImpl::OsArchitectureImpl();
+	_snapshot.s_HostName = EnvironmentImpl::HostNameImpl();
+	EnvironmentImpl::EthernetAddressImpl(_snapshot.a_NodeId);
+	_snapshot.s_EthernetAddress = FormatNodeId(_snapshot.a_NodeId);
+	_snapshot.ui_ProcessorCount = EnvironmentImpl::ProcessorCountImpl();
+}
+
+/// Called with mtx_Publish held, takes ownership of _pSnapshot. The reference
+/// g_pSnapshot held to the replaced one moves to _released, to be dropped
+/// after the lock is given up.
+void Environment::PublishSnapshot(EnvironmentSnapshot * _pSnapshot, EnvironmentSnapshot::Ptr & _released)
+{
+	const EnvironmentSnapshot * pOld = g_pSnapshot;
+	_pSnapshot->ui_Generation = pOld->ui_Generation + 1;
+	AtomicStore(&g_pSnapshot, const_cast<const EnvironmentSnapshot *>(_pSnapshot), MemoryOrderRelease);
+	_released.assign(pOld);
 }
 
 std::string Environment::OsName()
 {
-	return EnvironmentImpl::OsNameImpl();
+	return ThreadSnapshot().OsName();
 }
 
 std::string Environment::HostName()
 {
-	return EnvironmentImpl::HostNameImpl();
+	return ThreadSnapshot().HostName();
 }
 
 std::string Environment::EthernetAddress()
 {
-	NodeId id;
-	EnvironmentImpl::EthernetAddressImpl(id);
-	char result[18];
-	std::sprintf(result, "%02x:%02x:%02x:%02x:%02x:%02x",
-		id[0],
-		id[1],
-		id[2],
-		id[3],
-		id[4],
-		id[5]);
-	return std::string(result);
+	return ThreadSnapshot().EthernetAddress();
 }
 
 void Environment::EthernetAddress(Environment::NodeId & _address)
 {
-	EnvironmentImpl::EthernetAddressImpl(_address);
+	std::memcpy(_address, ThreadSnapshot().EthernetNodeId(), sizeof(_address));
 }
 
 std::string Environment::OsVersion()
 {
-	return EnvironmentImpl::OsVersionImpl();
+	return ThreadSnapshot().OsVersion();
 }
 
 std::string Environment::OsArchitecture()
 {
-	return EnvironmentImpl::OsArchitectureImpl();
+	return ThreadSnapshot().OsArchitecture();
 }
 
 unsigned int Environment::ProcessorCount()
@@ -103,6 +345,22 @@ unsigned int Environment::ProcessorCount()
 	return EnvironmentImpl::ProcessorCountImpl();
 }
 
+unsigned int Environment::EffectiveProcessorCount()
+{
+	return static_cast<unsigned int>(Topology().i_EffectiveCpus);
+}
+
+const CpuTopology & Environment::Topology()
+{
+	CallOnce(g_TopologyOnce, &ReadHostTopology);
+	return *g_pTopology;
+}
+
+void Environment::ReadTopology(CpuTopology & _topology, const std::string & _sRoot)
+{
+	EnvironmentImpl::ReadTopologyImpl(_topology, _sRoot);
+}
+
 std::string Environment::LibraryVersionString()
 {
 	std::stringstream ver;
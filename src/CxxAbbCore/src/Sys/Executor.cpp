@@ -0,0 +1,75 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Executor.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Task execution interface
+ *
+ */
+
+#include <CxxAbb/Sys/Executor.h>
+#include <CxxAbb/ExceptionHandler.h>
+#include <CxxAbb/Debug.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+void Executor::RunTask(CxxAbb::Runnable * _pTask)
+{
+	try
+	{
+		_pTask->Run();
+	}
+	catch(CxxAbb::Exception & ex)
+	{
+		CxxAbb::ThreadErrorHandler::Handle(ex);
+	}
+	catch(std::exception & ex)
+	{
+		CxxAbb::ThreadErrorHandler::Handle(ex);
+	}
+	catch(...)
+	{
+		CxxAbb::ThreadErrorHandler::Handle();
+	}
+
+	delete _pTask;
+}
+
+void InlineExecutor::Execute(CxxAbb::Runnable * _pTask)
+{
+	CHECKNULL(_pTask);
+
+	RunTask(_pTask);
+}
+
+InlineExecutor & InlineExecutor::Instance()
+{
+	static InlineExecutor mInstance;
+	return mInstance;
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
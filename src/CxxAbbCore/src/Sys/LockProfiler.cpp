@@ -0,0 +1,343 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LockProfiler.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Lock contention profiling of named mutexes
+ *
+ */
+
+#include <CxxAbb/Sys/LockProfiler.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/SourceLineInfo.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <time.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+namespace
+{
+
+/// Name to profile map. Named locks keep a pointer to their profile and may be
+/// static objects themselves, so the registry and profiles are never destroyed.
+struct LockProfileRegistry
+{
+	typedef std::map<std::string, LockProfile*> ProfileMap;
+
+	FastMutex m_Mutex;
+	ProfileMap lst_Profiles;
+};
+
+LockProfileRegistry * g_Registry = 0;
+OnceFlag g_RegistryOnce = CXXABB_ONCE_INIT;
+
+void CreateRegistry()
+{
+	g_Registry = new LockProfileRegistry;
+}
+
+LockProfileRegistry * Registry()
+{
+	CallOnce(g_RegistryOnce, &CreateRegistry);
+	return g_Registry;
+}
+
+bool MoreWait(const LockStats & _a, const LockStats & _b)
+{
+	return _a.ui_WaitNs > _b.ui_WaitNs;
+}
+
+bool MoreSiteWait(const LockStats::Site & _a, const LockStats::Site & _b)
+{
+	return _a.ui_WaitNs > _b.ui_WaitNs;
+}
+
+double ToMs(UInt64 _uiNs)
+{
+	return static_cast<double>(_uiNs) / 1e6;
+}
+
+double ToUs(UInt64 _uiNs)
+{
+	return static_cast<double>(_uiNs) / 1e3;
+}
+
+}
+
+volatile int LockProfiler::i_Enabled = 0;
+
+UInt64 LockStats::Percentile(const UInt64 (&_histogram)[Buckets], double _dPercent)
+{
+	UInt64 uiTotal = 0;
+	for (int i = 0; i < Buckets; ++i)
+		uiTotal += _histogram[i];
+	if (uiTotal == 0)
+		return 0;
+
+	UInt64 uiRank = static_cast<UInt64>(static_cast<double>(uiTotal) * _dPercent / 100.0);
+	if (uiRank >= uiTotal)
+		uiRank = uiTotal - 1;
+
+	UInt64 uiSeen = 0;
+	for (int i = 0; i < Buckets; ++i)
+	{
+		uiSeen += _histogram[i];
+		if (uiSeen > uiRank)
+			return (static_cast<UInt64>(1) << (i + 1)) - 1;
+	}
+	return ~static_cast<UInt64>(0);
+}
+
+LockProfile::LockProfile(const std::string & _sName)
+	: s_Name(_sName)
+{
+}
+
+unsigned int LockProfile::Bucket(UInt64 _uiNs)
+{
+	unsigned int uiBucket = 0;
+	while (_uiNs > 1 && uiBucket < LockStats::Buckets - 1)
+	{
+		_uiNs >>= 1;
+		++uiBucket;
+	}
+	return uiBucket;
+}
+
+LockProfile::Site * LockProfile::FindSite(const SourceLineInfo & _where)
+{
+	unsigned int uiSites = ui_Sites.Load(MemoryOrderAcquire);
+	for (unsigned int i = 0; i < uiSites; ++i)
+	{
+		if (a_Sites[i].z_Line == _where.line() && a_Sites[i].z_File == _where.file())
+			return &a_Sites[i];
+	}
+
+	SpinLock::ScopedLock lock(m_SiteLock);
+	uiSites = ui_Sites.Load(MemoryOrderRelaxed);
+	for (unsigned int i = 0; i < uiSites; ++i)
+	{
+		if (a_Sites[i].z_Line == _where.line() && a_Sites[i].z_File == _where.file())
+			return &a_Sites[i];
+	}
+	if (uiSites == MaxSites)
+		return NullPtr;
+
+	Site & site = a_Sites[uiSites];
+	site.z_File = _where.file();
+	site.z_Line = _where.line();
+	site.z_Func = _where.func();
+	ui_Sites.Store(uiSites + 1, MemoryOrderRelease);
+	return &site;
+}
+
+void LockProfile::Acquired(UInt64 _uiWaitNs, bool _bContended, const SourceLineInfo * _pWhere)
+{
+	ui_Acquisitions.FetchAdd(1, MemoryOrderRelaxed);
+	if (_bContended)
+	{
+		ui_Contended.FetchAdd(1, MemoryOrderRelaxed);
+		ui_WaitNs.FetchAdd(_uiWaitNs, MemoryOrderRelaxed);
+	}
+	ui_WaitHistogram[Bucket(_uiWaitNs)].FetchAdd(1, MemoryOrderRelaxed);
+
+	if (_pWhere)
+	{
+		Site * pSite = FindSite(*_pWhere);
+		if (pSite)
+		{
+			pSite->ui_Acquisitions.FetchAdd(1, MemoryOrderRelaxed);
+			if (_bContended)
+			{
+				pSite->ui_Contended.FetchAdd(1, MemoryOrderRelaxed);
+				pSite->ui_WaitNs.FetchAdd(_uiWaitNs, MemoryOrderRelaxed);
+			}
+		}
+	}
+}
+
+void LockProfile::Released(UInt64 _uiHoldNs)
+{
+	ui_HoldNs.FetchAdd(_uiHoldNs, MemoryOrderRelaxed);
+	ui_HoldHistogram[Bucket(_uiHoldNs)].FetchAdd(1, MemoryOrderRelaxed);
+}
+
+void LockProfile::Reset()
+{
+	ui_Acquisitions.Store(0, MemoryOrderRelaxed);
+	ui_Contended.Store(0, MemoryOrderRelaxed);
+	ui_WaitNs.Store(0, MemoryOrderRelaxed);
+	ui_HoldNs.Store(0, MemoryOrderRelaxed);
+	for (int i = 0; i < LockStats::Buckets; ++i)
+	{
+		ui_WaitHistogram[i].Store(0, MemoryOrderRelaxed);
+		ui_HoldHistogram[i].Store(0, MemoryOrderRelaxed);
+	}
+	// sites stay registered, only their counters are cleared
+	unsigned int uiSites = ui_Sites.Load(MemoryOrderAcquire);
+	for (unsigned int i = 0; i < uiSites; ++i)
+	{
+		a_Sites[i].ui_Acquisitions.Store(0, MemoryOrderRelaxed);
+		a_Sites[i].ui_Contended.Store(0, MemoryOrderRelaxed);
+		a_Sites[i].ui_WaitNs.Store(0, MemoryOrderRelaxed);
+	}
+}
+
+void LockProfile::Snapshot(LockStats & _stats) const
+{
+	_stats.s_Name = s_Name;
+	_stats.ui_Locks = ui_Locks.Load(MemoryOrderRelaxed);
+	_stats.ui_Acquisitions = ui_Acquisitions.Load(MemoryOrderRelaxed);
+	_stats.ui_Contended = ui_Contended.Load(MemoryOrderRelaxed);
+	_stats.ui_WaitNs = ui_WaitNs.Load(MemoryOrderRelaxed);
+	_stats.ui_HoldNs = ui_HoldNs.Load(MemoryOrderRelaxed);
+	for (int i = 0; i < LockStats::Buckets; ++i)
+	{
+		_stats.ui_WaitHistogram[i] = ui_WaitHistogram[i].Load(MemoryOrderRelaxed);
+		_stats.ui_HoldHistogram[i] = ui_HoldHistogram[i].Load(MemoryOrderRelaxed);
+	}
+
+	_stats.lst_Sites.clear();
+	unsigned int uiSites = ui_Sites.Load(MemoryOrderAcquire);
+	for (unsigned int i = 0; i < uiSites; ++i)
+	{
+		LockStats::Site site;
+		site.s_File = a_Sites[i].z_File;
+		site.s_Line = a_Sites[i].z_Line;
+		site.s_Func = a_Sites[i].z_Func;
+		site.ui_Acquisitions = a_Sites[i].ui_Acquisitions.Load(MemoryOrderRelaxed);
+		site.ui_Contended = a_Sites[i].ui_Contended.Load(MemoryOrderRelaxed);
+		site.ui_WaitNs = a_Sites[i].ui_WaitNs.Load(MemoryOrderRelaxed);
+		_stats.lst_Sites.push_back(site);
+	}
+	std::stable_sort(_stats.lst_Sites.begin(), _stats.lst_Sites.end(), MoreSiteWait);
+}
+
+void LockProfiler::Enable(bool _bEnable)
+{
+	AtomicStore(&i_Enabled, _bEnable ? 1 : 0, MemoryOrderRelaxed);
+}
+
+LockProfile * LockProfiler::Register(const std::string & _sName)
+{
+	LockProfileRegistry * pRegistry = Registry();
+	FastMutex::ScopedLock lock(pRegistry->m_Mutex);
+
+	LockProfile *& pProfile = pRegistry->lst_Profiles[_sName];
+	if (!pProfile)
+		pProfile = new LockProfile(_sName);
+	pProfile->AddLock();
+	return pProfile;
+}
+
+void LockProfiler::Snapshot(std::vector<LockStats> & _stats)
+{
+	_stats.clear();
+	{
+		LockProfileRegistry * pRegistry = Registry();
+		FastMutex::ScopedLock lock(pRegistry->m_Mutex);
+
+		_stats.resize(pRegistry->lst_Profiles.size());
+		std::size_t i = 0;
+		for (LockProfileRegistry::ProfileMap::const_iterator it = pRegistry->lst_Profiles.begin();
+				it != pRegistry->lst_Profiles.end(); ++it, ++i)
+		{
+			it->second->Snapshot(_stats[i]);
+		}
+	}
+	std::stable_sort(_stats.begin(), _stats.end(), MoreWait);
+}
+
+void LockProfiler::Dump(std::ostream & _os, std::size_t _tTopSites)
+{
+	std::vector<LockStats> vStats;
+	Snapshot(vStats);
+
+	std::ios_base::fmtflags flags = _os.flags();
+	std::streamsize precision = _os.precision();
+	_os << std::fixed << std::setprecision(3);
+
+	_os << "Lock profile (" << (IsEnabled() ? "enabled" : "disabled") << "), "
+		<< vStats.size() << " named locks, most wait first" << std::endl;
+	for (std::size_t i = 0; i < vStats.size(); ++i)
+	{
+		const LockStats & stats = vStats[i];
+		double dContended = stats.ui_Acquisitions ?
+			100.0 * static_cast<double>(stats.ui_Contended) / static_cast<double>(stats.ui_Acquisitions) : 0.0;
+
+		_os << stats.s_Name << " [" << stats.ui_Locks << " locks]"
+			<< " acquired=" << stats.ui_Acquisitions
+			<< " contended=" << stats.ui_Contended << " (" << std::setprecision(1) << dContended << "%)"
+			<< std::setprecision(3)
+			<< " wait=" << ToMs(stats.ui_WaitNs) << "ms"
+			<< " p50=" << ToUs(LockStats::Percentile(stats.ui_WaitHistogram, 50)) << "us"
+			<< " p99=" << ToUs(LockStats::Percentile(stats.ui_WaitHistogram, 99)) << "us"
+			<< " hold=" << ToMs(stats.ui_HoldNs) << "ms"
+			<< " p50=" << ToUs(LockStats::Percentile(stats.ui_HoldHistogram, 50)) << "us"
+			<< " p99=" << ToUs(LockStats::Percentile(stats.ui_HoldHistogram, 99)) << "us"
+			<< std::endl;
+
+		for (std::size_t j = 0; j < stats.lst_Sites.size() && j < _tTopSites; ++j)
+		{
+			const LockStats::Site & site = stats.lst_Sites[j];
+			_os << "    " << site.s_File << ':' << site.s_Line << ' ' << site.s_Func
+				<< " acquired=" << site.ui_Acquisitions
+				<< " contended=" << site.ui_Contended
+				<< " wait=" << ToMs(site.ui_WaitNs) << "ms" << std::endl;
+		}
+	}
+
+	_os.flags(flags);
+	_os.precision(precision);
+}
+
+void LockProfiler::Reset()
+{
+	LockProfileRegistry * pRegistry = Registry();
+	FastMutex::ScopedLock lock(pRegistry->m_Mutex);
+
+	for (LockProfileRegistry::ProfileMap::iterator it = pRegistry->lst_Profiles.begin();
+			it != pRegistry->lst_Profiles.end(); ++it)
+	{
+		it->second->Reset();
+	}
+}
+
+UInt64 LockProfiler::Now()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<UInt64>(ts.tv_sec) * static_cast<UInt64>(1000000000) + static_cast<UInt64>(ts.tv_nsec);
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
@@ -27,17 +27,38 @@
 
 #include "MutexImpl.h"
 #include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/LockProfiler.h>
+
+/// Profiling branches fold away when the library is built with CXXABB_NO_LOCK_PROFILING
+#ifndef CXXABB_NO_LOCK_PROFILING
+#define CXXABB_LOCK_PROFILED(PROFILE) (PROFILE)
+#else
+#define CXXABB_LOCK_PROFILED(PROFILE) (false && (PROFILE))
+#endif
 
 namespace CxxAbb
 {
 namespace Sys
 {
 
-Mutex::Mutex() : MutexImpl()
+Mutex::Mutex() : MutexImpl(),
+	p_Profile(NullPtr),
+	ui_Acquired(0)
 {
 
 }
 
+Mutex::Mutex(const std::string & _sName) : MutexImpl(),
+	p_Profile(NullPtr),
+	ui_Acquired(0)
+{
+#ifndef CXXABB_NO_LOCK_PROFILING
+	p_Profile = LockProfiler::Register(_sName);
+#else
+	(void)_sName;
+#endif
+}
+
 Mutex::~Mutex()
 {
 
@@ -45,29 +66,58 @@ Mutex::~Mutex()
 
 void Mutex::Lock()
 {
-	LockImpl();
+	if (CXXABB_LOCK_PROFILED(p_Profile))
+		ProfiledLock(NullPtr);
+	else
+		LockImpl();
+}
+
+void Mutex::Lock(const SourceLineInfo & _where)
+{
+	if (CXXABB_LOCK_PROFILED(p_Profile))
+		ProfiledLock(&_where);
+	else
+		LockImpl();
 }
 
 bool Mutex::TryLock()
 {
-	return TryLockImpl();
+	if (!CXXABB_LOCK_PROFILED(p_Profile))
+		return TryLockImpl();
+
+	UInt64 uiStart = LockProfiler::IsEnabled() ? LockProfiler::Now() : 0;
+	if (!TryLockImpl())
+		return false;
+	ProfiledAcquired(uiStart, false, NullPtr);
+	return true;
 }
 
 bool Mutex::TryLock(long _lMiliSeconds)
 {
-	return TryLockImpl(_lMiliSeconds);
+	if (!CXXABB_LOCK_PROFILED(p_Profile))
+		return TryLockImpl(_lMiliSeconds);
+
+	UInt64 uiStart = LockProfiler::IsEnabled() ? LockProfiler::Now() : 0;
+	bool bContended = !TryLockImpl();
+	if (bContended && !TryLockImpl(_lMiliSeconds))
+		return false;
+	ProfiledAcquired(uiStart, bContended, NullPtr);
+	return true;
 }
 
 void Mutex::Unlock()
 {
-	UnlockImpl();
+	if (CXXABB_LOCK_PROFILED(p_Profile))
+		ProfiledUnlock();
+	else
+		UnlockImpl();
 }
 
 void Mutex::UnlockNoThrow()
 {
 	try
 	{
-		UnlockImpl();
+		Unlock();
 	}
 	catch(...)
 	{
@@ -75,14 +125,63 @@ void Mutex::UnlockNoThrow()
 	}
 }
 
+void Mutex::ProfiledLock(const SourceLineInfo * _pWhere)
+{
+	if (!LockProfiler::IsEnabled())
+	{
+		LockImpl();
+		ProfiledAcquired(0, false, _pWhere);
+		return;
+	}
+
+	UInt64 uiStart = LockProfiler::Now();
+	bool bContended = !TryLockImpl();
+	if (bContended)
+		LockImpl();
+	ProfiledAcquired(uiStart, bContended, _pWhere);
+}
+
+void Mutex::ProfiledAcquired(UInt64 _uiStart, bool _bContended, const SourceLineInfo * _pWhere)
+{
+	// _uiStart is 0 when profiling was off while locking
+	UInt64 uiNow = _uiStart ? LockProfiler::Now() : 0;
+	ui_Acquired = uiNow;
+	if (_uiStart)
+		p_Profile->Acquired(_bContended ? uiNow - _uiStart : 0, _bContended, _pWhere);
+}
+
+void Mutex::ProfiledUnlock()
+{
+	UInt64 uiAcquired = ui_Acquired;
+	ui_Acquired = 0;
+	UInt64 uiNow = uiAcquired ? LockProfiler::Now() : 0;
+	UnlockImpl();
+	if (uiAcquired)
+		p_Profile->Released(uiNow - uiAcquired);
+}
 
 /// FastMutex
 
-FastMutex::FastMutex() : FastMutexImpl()
+FastMutex::FastMutex() : FastMutexImpl(),
+	p_Profile(NullPtr),
+	ui_Acquired(0),
+	i_Depth(0)
 {
 
 }
 
+FastMutex::FastMutex(const std::string & _sName) : FastMutexImpl(),
+	p_Profile(NullPtr),
+	ui_Acquired(0),
+	i_Depth(0)
+{
+#ifndef CXXABB_NO_LOCK_PROFILING
+	p_Profile = LockProfiler::Register(_sName);
+#else
+	(void)_sName;
+#endif
+}
+
 FastMutex::~FastMutex()
 {
 
@@ -90,29 +189,58 @@ FastMutex::~FastMutex()
 
 void FastMutex::Lock()
 {
-	LockImpl();
+	if (CXXABB_LOCK_PROFILED(p_Profile))
+		ProfiledLock(NullPtr);
+	else
+		LockImpl();
+}
+
+void FastMutex::Lock(const SourceLineInfo & _where)
+{
+	if (CXXABB_LOCK_PROFILED(p_Profile))
+		ProfiledLock(&_where);
+	else
+		LockImpl();
 }
 
 bool FastMutex::TryLock()
 {
-	return TryLockImpl();
+	if (!CXXABB_LOCK_PROFILED(p_Profile))
+		return TryLockImpl();
+
+	UInt64 uiStart = LockProfiler::IsEnabled() ? LockProfiler::Now() : 0;
+	if (!TryLockImpl())
+		return false;
+	ProfiledAcquired(uiStart, false, NullPtr);
+	return true;
 }
 
 bool FastMutex::TryLock(long _lMiliSeconds)
 {
-	return TryLockImpl(_lMiliSeconds);
+	if (!CXXABB_LOCK_PROFILED(p_Profile))
+		return TryLockImpl(_lMiliSeconds);
+
+	UInt64 uiStart = LockProfiler::IsEnabled() ? LockProfiler::Now() : 0;
+	bool bContended = !TryLockImpl();
+	if (bContended && !TryLockImpl(_lMiliSeconds))
+		return false;
+	ProfiledAcquired(uiStart, bContended, NullPtr);
+	return true;
 }
 
 void FastMutex::Unlock()
 {
-	UnlockImpl();
+	if (CXXABB_LOCK_PROFILED(p_Profile))
+		ProfiledUnlock();
+	else
+		UnlockImpl();
 }
 
 void FastMutex::UnlockNoThrow()
 {
 	try
 	{
-		UnlockImpl();
+		Unlock();
 	}
 	catch(...)
 	{
@@ -120,5 +248,44 @@ void FastMutex::UnlockNoThrow()
 	}
 }
 
+void FastMutex::ProfiledLock(const SourceLineInfo * _pWhere)
+{
+	if (!LockProfiler::IsEnabled())
+	{
+		LockImpl();
+		ProfiledAcquired(0, false, _pWhere);
+		return;
+	}
+
+	UInt64 uiStart = LockProfiler::Now();
+	bool bContended = !TryLockImpl();
+	if (bContended)
+		LockImpl();
+	ProfiledAcquired(uiStart, bContended, _pWhere);
+}
+
+void FastMutex::ProfiledAcquired(UInt64 _uiStart, bool _bContended, const SourceLineInfo * _pWhere)
+{
+	// _uiStart is 0 when profiling was off while locking, depth is tracked anyway
+	UInt64 uiNow = _uiStart ? LockProfiler::Now() : 0;
+	if (i_Depth++ == 0)
+		ui_Acquired = uiNow;
+	if (_uiStart)
+		p_Profile->Acquired(_bContended ? uiNow - _uiStart : 0, _bContended, _pWhere);
+}
+
+void FastMutex::ProfiledUnlock()
+{
+	UInt64 uiAcquired = 0;
+	if (--i_Depth == 0)
+	{
+		uiAcquired = ui_Acquired;
+		ui_Acquired = 0;
+	}
+	UInt64 uiNow = uiAcquired ? LockProfiler::Now() : 0;
+	UnlockImpl();
+	if (uiAcquired)
+		p_Profile->Released(uiNow - uiAcquired);
+}
 } /* namespace Sys */
 } /* namespace CxxAbb */
@@ -0,0 +1,133 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Parallel.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Data parallel algorithms over index and Buffer ranges
+ *
+ */
+
+
+#include <CxxAbb/Sys/Parallel.h>
+#include <CxxAbb/Debug.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+ParallelJob::ParallelJob(ThreadPool & _pool)
+	: p_Pool(&_pool),
+	  l_Pending(1),
+	  i_Failed(0),
+	  p_Error(NullPtr),
+	  m_Done(false)
+{
+}
+
+ParallelJob::~ParallelJob()
+{
+	ASSERT (l_Pending.Load() == 0);
+	delete p_Error;
+}
+
+void ParallelJob::Spawn(CxxAbb::Runnable * _pTask)
+{
+	l_Pending.FetchAdd(1, MemoryOrderRelaxed);
+	try
+	{
+		p_Pool->Execute(_pTask);
+	}
+	catch(...)
+	{
+		delete _pTask;
+		Done();
+		throw;
+	}
+}
+
+void ParallelJob::Done()
+{
+	if (l_Pending.FetchSub(1, MemoryOrderAcqRel) == 1)
+		m_Done.Set();
+}
+
+void ParallelJob::Fail()
+{
+	CxxAbb::Exception * pError;
+	try
+	{
+		throw;
+	}
+	catch(CxxAbb::Exception & ex)
+	{
+		pError = ex.Clone();
+	}
+	catch(std::exception & ex)
+	{
+		pError = new CxxAbb::RuntimeException(ex.what());
+	}
+	catch(...)
+	{
+		pError = new CxxAbb::UnhandledException("Unknown exception in parallel task");
+	}
+
+	int iExpected = 0;
+	if (i_Failed.CompareExchange(iExpected, 1, MemoryOrderAcqRel))
+		p_Error = pError;
+	else
+		delete pError;
+}
+
+void ParallelJob::Join()
+{
+	// drop the count held for the joiner, the last Done() sets m_Done
+	Done();
+
+	// help the pool while own tasks are outstanding, short waits when there is nothing to help with
+	while (l_Pending.Load(MemoryOrderAcquire) > 0)
+	{
+		if (!p_Pool->RunPending())
+			m_Done.TryWait(1);
+	}
+
+	// the last Done() may still be inside m_Done.Set(), the job must not be
+	// destroyed before Set() has released the event's lock
+	m_Done.Wait();
+
+	if (p_Error)
+		p_Error->Rethrow();
+}
+
+std::size_t ParallelJob::Grain(std::size_t _tLength, std::size_t _tGrain) const
+{
+	if (_tGrain > 0)
+		return _tGrain;
+
+	// about 8 ranges per thread, good balance with small scheduling overhead
+	std::size_t tGrain = _tLength / ((p_Pool->ThreadCount() + 1) * 8);
+	return tGrain > 0 ? tGrain : 1;
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
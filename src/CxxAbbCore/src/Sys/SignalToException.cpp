@@ -27,6 +27,7 @@
 
 #include <CxxAbb/Sys/SignalToException.h>
 #include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Sys/AtomicOps.h>
 #include <signal.h>
 
 #if defined(CXXABB_OS_FAMILY_UNIX)
@@ -38,6 +39,7 @@ namespace Sys
 {
 
 SignalToException::JumpBufferVec SignalToException::m_JumpBuffers;
+SignalToException::CrashHandlerFunc volatile SignalToException::a_CrashHandlers[MaxCrashHandlers] = { 0 };
 
 SignalToException::SignalToException()
 {
@@ -95,8 +97,40 @@ void SignalToException::SetupHandler(int _iSigNum, SigHandlerFunc _handler)
 	}
 }
 
+bool SignalToException::AddCrashHandler(CrashHandlerFunc _handler)
+{
+	for (int i = 0; i < MaxCrashHandlers; ++i)
+	{
+		CrashHandlerFunc fpEmpty = 0;
+		if (AtomicCompareExchange(&a_CrashHandlers[i], fpEmpty, _handler))
+			return true;
+	}
+	return false;
+}
+
+void SignalToException::RemoveCrashHandler(CrashHandlerFunc _handler)
+{
+	for (int i = 0; i < MaxCrashHandlers; ++i)
+	{
+		CrashHandlerFunc fpExpected = _handler;
+		AtomicCompareExchange(&a_CrashHandlers[i], fpExpected, static_cast<CrashHandlerFunc>(0));
+	}
+}
+
+void SignalToException::RunCrashHandlers(int _iSigNum)
+{
+	for (int i = 0; i < MaxCrashHandlers; ++i)
+	{
+		CrashHandlerFunc fpHandler = AtomicLoad(&a_CrashHandlers[i], MemoryOrderAcquire);
+		if (fpHandler)
+			fpHandler(_iSigNum);
+	}
+}
+
 void SignalToException::SignalHandler(int _iSigNum)
 {
+	RunCrashHandlers(_iSigNum);
+
 	JumpBufferVec& jb = GetJumpBuffers();
 	if (!jb.empty())
 		siglongjmp(jb.back().m_Env, _iSigNum);
@@ -0,0 +1,106 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * StripedCounter.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : Counter striped over per CPU cache lines
+ *
+ */
+
+
+#include <CxxAbb/Sys/StripedCounter.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/Environment.h>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+namespace
+{
+
+unsigned int g_StripeCount = 1;
+OnceFlag g_StripeOnce = CXXABB_ONCE_INIT;
+
+volatile unsigned int g_NextThread = 0;
+__thread unsigned int t_ThreadIndex = 0;
+
+void InitStripeCount()
+{
+	unsigned int uiCpus = Environment::ProcessorCount();
+	unsigned int uiCount = 1;
+	while (uiCount < uiCpus && uiCount < 64)
+	{
+		uiCount *= 2;
+	}
+	g_StripeCount = uiCount;
+}
+
+}
+
+unsigned int Stripes::Count()
+{
+	CallOnce(g_StripeOnce, &InitStripeCount);
+	return g_StripeCount;
+}
+
+unsigned int Stripes::ThreadIndex()
+{
+	// sched_getcpu() unavailable, spread threads round robin instead
+	if (t_ThreadIndex == 0)
+		t_ThreadIndex = AtomicFetchAdd(&g_NextThread, 1U, MemoryOrderRelaxed) + 1;
+	return t_ThreadIndex - 1;
+}
+
+StripedCounter::StripedCounter()
+	: p_Cells(static_cast<Cell*>(AllocateCacheAligned(sizeof(Cell) * Stripes::Count()))),
+	  ui_Mask(Stripes::Count() - 1)
+{
+}
+
+StripedCounter::~StripedCounter()
+{
+	FreeCacheAligned(p_Cells);
+}
+
+Int64 StripedCounter::Value() const
+{
+	Int64 iValue = 0;
+	for (unsigned int i = 0; i <= ui_Mask; ++i)
+	{
+		iValue += AtomicLoad(&p_Cells[i].i_Value, MemoryOrderRelaxed);
+	}
+	return iValue;
+}
+
+void StripedCounter::Reset()
+{
+	for (unsigned int i = 0; i <= ui_Mask; ++i)
+	{
+		AtomicStore(&p_Cells[i].i_Value, static_cast<Int64>(0), MemoryOrderRelaxed);
+	}
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
@@ -41,7 +41,7 @@ Thread::Thread() : s_Name(GenName())
 	SetName();
 }
 
-Thread::Thread(std::string _name) : s_Name(_name)
+Thread::Thread(const std::string & _name) : s_Name(_name)
 {
 	SetName();
 }
@@ -55,13 +55,13 @@ CxxAbb::UInt32 Thread::Tid() const
 	return (CxxAbb::UInt32)TidImpl();
 }
 
-std::string & Thread::Name()
+SharedString Thread::Name() const
 {
 	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_LocalData);
 	return s_Name;
 }
 
-void Thread::Name(std::string _name)
+void Thread::Name(const std::string & _name)
 {
 	CxxAbb::Sys::FastMutex::ScopedLock lock(mtx_LocalData);
 	s_Name = _name;
@@ -79,7 +79,7 @@ std::string Thread::GenName()
 
 void Thread::SetName()
 {
-	SetNameImpl(s_Name);
+	SetNameImpl(s_Name.c_str());
 }
 
 Thread::State Thread::CurrentState()
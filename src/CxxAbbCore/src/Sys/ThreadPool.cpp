@@ -0,0 +1,190 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ThreadPool.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Fixed size pool of worker threads
+ *
+ */
+
+
+#include <CxxAbb/Sys/ThreadPool.h>
+#include <CxxAbb/SourceLineInfo.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/Environment.h>
+#include <CxxAbb/Debug.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace CxxAbb
+{
+
+namespace Sys
+{
+
+class ThreadPool::Worker : public CxxAbb::Runnable
+{
+public:
+	Worker(ThreadPool & _pool, const std::string & _sName)
+		: p_Pool(&_pool),
+		  m_Wake(true),
+		  b_Idle(false),
+		  m_Thread(_sName)
+	{}
+
+	void Run()
+	{
+		CxxAbb::Runnable * pTask;
+		while ((pTask = p_Pool->Take(*this)) != NullPtr)
+		{
+			RunTask(pTask);
+		}
+	}
+
+	ThreadPool * p_Pool;
+	SigEvent m_Wake;
+	bool b_Idle;
+	Thread m_Thread;
+};
+
+ThreadPool::ThreadPool(unsigned int _uiThreads /*= 0*/, const std::string & _sName /*= "Pool"*/)
+	: t_Queued(0),
+	  b_Stopping(false),
+	  mtx_Queue(_sName + ".Queue")
+{
+	if (_uiThreads == 0)
+		_uiThreads = std::max(1U, Environment::EffectiveProcessorCount());
+
+	for (unsigned int i = 0; i < _uiThreads; ++i)
+	{
+		std::ostringstream oss;
+		oss << _sName << "-" << i;
+		lst_Workers.push_back(new Worker(*this, oss.str()));
+	}
+
+	for (std::vector<Worker*>::iterator it = lst_Workers.begin(); it != lst_Workers.end(); ++it)
+	{
+		(*it)->m_Thread.Start(**it);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		FastMutex::ScopedLock lock(mtx_Queue, CXXABB_SOURCEINFO);
+		b_Stopping = true;
+		for (std::vector<Worker*>::iterator it = lst_Workers.begin(); it != lst_Workers.end(); ++it)
+		{
+			(*it)->m_Wake.Set();
+		}
+	}
+
+	for (std::vector<Worker*>::iterator it = lst_Workers.begin(); it != lst_Workers.end(); ++it)
+	{
+		(*it)->m_Thread.Join();
+		delete *it;
+	}
+}
+
+void ThreadPool::Execute(CxxAbb::Runnable * _pTask)
+{
+	CHECKNULL(_pTask);
+
+	FastMutex::ScopedLock lock(mtx_Queue, CXXABB_SOURCEINFO);
+
+	lst_Tasks.push_back(_pTask);
+	t_Queued->Store(lst_Tasks.size(), MemoryOrderRelaxed);
+
+	if (!lst_Idle.empty())
+	{
+		Worker * pWorker = lst_Idle.back();
+		lst_Idle.pop_back();
+		pWorker->b_Idle = false;
+		pWorker->m_Wake.Set();
+	}
+}
+
+bool ThreadPool::RunPending()
+{
+	CxxAbb::Runnable * pTask;
+	{
+		FastMutex::ScopedLock lock(mtx_Queue, CXXABB_SOURCEINFO);
+		pTask = Pop();
+	}
+
+	if (!pTask)
+		return false;
+
+	RunTask(pTask);
+	return true;
+}
+
+ThreadPool & ThreadPool::Default()
+{
+	static ThreadPool mPool(0, "DefaultPool");
+	return mPool;
+}
+
+CxxAbb::Runnable * ThreadPool::Take(Worker & _worker)
+{
+	for (;;)
+	{
+		{
+			FastMutex::ScopedLock lock(mtx_Queue, CXXABB_SOURCEINFO);
+
+			CxxAbb::Runnable * pTask = Pop();
+			if (pTask)
+				return pTask;
+			if (b_Stopping)
+				return NullPtr;
+
+			_worker.b_Idle = true;
+			lst_Idle.push_back(&_worker);
+		}
+
+		_worker.m_Wake.Wait();
+
+		FastMutex::ScopedLock lock(mtx_Queue, CXXABB_SOURCEINFO);
+		if (_worker.b_Idle)
+		{
+			_worker.b_Idle = false;
+			lst_Idle.erase(std::find(lst_Idle.begin(), lst_Idle.end(), &_worker));
+		}
+	}
+}
+
+CxxAbb::Runnable * ThreadPool::Pop()
+{
+	if (lst_Tasks.empty())
+		return NullPtr;
+
+	CxxAbb::Runnable * pTask = lst_Tasks.front();
+	lst_Tasks.pop_front();
+	t_Queued->Store(lst_Tasks.size(), MemoryOrderRelaxed);
+	return pTask;
+}
+
+}  /* namespace Sys */
+
+}  /* namespace CxxAbb */
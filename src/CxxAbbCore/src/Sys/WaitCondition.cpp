@@ -40,7 +40,7 @@ void WaitCondition::Signal()
 	if(!m_WaitQueue.empty())
 	{
 		m_WaitQueue.front()->Set();
-		m_WaitQueue.pop_back();
+		m_WaitQueue.pop_front();
 	}
 }
 
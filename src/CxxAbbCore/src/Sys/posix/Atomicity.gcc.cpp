@@ -56,50 +56,50 @@ AtomicCounter::~AtomicCounter()
 {
 }
 
-inline AtomicCounter::operator AtomicType() const
+AtomicCounter::operator AtomicType() const
 {
 	return t_Counter;
 }
 
-inline AtomicType AtomicCounter::Value() const
+AtomicType AtomicCounter::Value() const
 {
 	return t_Counter;
 }
 
 /// Operators
-inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
+AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 {
 	__sync_lock_test_and_set(&t_Counter, _counter.Value());
 	return *this;
 }
 
-inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
+AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 {
 	__sync_lock_test_and_set(&t_Counter, _atomictype);
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++()
+AtomicType AtomicCounter::operator ++()
 {
 	return __sync_add_and_fetch(&t_Counter, 1);
 }
 
-inline AtomicType AtomicCounter::operator ++(Int32)
+AtomicType AtomicCounter::operator ++(Int32)
 {
 	return __sync_fetch_and_add(&t_Counter, 1);
 }
 
-inline AtomicType AtomicCounter::operator --()
+AtomicType AtomicCounter::operator --()
 {
 	return __sync_sub_and_fetch(&t_Counter, 1);
 }
 
-inline AtomicType AtomicCounter::operator --(Int32)
+AtomicType AtomicCounter::operator --(Int32)
 {
 	return __sync_fetch_and_sub(&t_Counter, 1);
 }
 
-inline bool AtomicCounter::operator !() const
+bool AtomicCounter::operator !() const
 {
 	return t_Counter == 0;
 }
@@ -56,20 +56,20 @@ AtomicCounter::~AtomicCounter()
 {
 }
 
-inline AtomicCounter::operator AtomicType() const
+AtomicCounter::operator AtomicType() const
 {
 	asm volatile ( "mfence" : : : "memory" );
 	return t_Counter;
 }
 
-inline AtomicType AtomicCounter::Value() const
+AtomicType AtomicCounter::Value() const
 {
 	asm volatile ( "mfence" : : : "memory" );
 	return t_Counter;
 }
 
 /// Operators
-inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
+AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 {
 	volatile register Int64 tmp;
 
@@ -80,7 +80,7 @@ inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 	return *this;
 }
 
-inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
+AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 {
 	volatile register Int64 tmp;
 
@@ -91,7 +91,7 @@ inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++()
+AtomicType AtomicCounter::operator ++()
 {
 	volatile register Int64 tmp;
 
@@ -102,7 +102,7 @@ inline AtomicType AtomicCounter::operator ++()
 	return (tmp + 1);
 }
 
-inline AtomicType AtomicCounter::operator ++(Int32)
+AtomicType AtomicCounter::operator ++(Int32)
 {
 	volatile register Int64 ret;
 
@@ -113,7 +113,7 @@ inline AtomicType AtomicCounter::operator ++(Int32)
 	return ret;
 }
 
-inline AtomicType AtomicCounter::operator --()
+AtomicType AtomicCounter::operator --()
 {
 	volatile register Int64 tmp;
 
@@ -124,7 +124,7 @@ inline AtomicType AtomicCounter::operator --()
 	return (tmp - 1);
 }
 
-inline AtomicType AtomicCounter::operator --(Int32)
+AtomicType AtomicCounter::operator --(Int32)
 {
 	volatile register Int64 tmp;
 
@@ -135,7 +135,7 @@ inline AtomicType AtomicCounter::operator --(Int32)
 	return tmp;
 }
 
-inline bool AtomicCounter::operator !() const
+bool AtomicCounter::operator !() const
 {
 	return t_Counter == 0;
 }
@@ -28,8 +28,17 @@
 #include "EnvironmentImpl.h"
 #include <CxxAbb/Exception.h>
 #include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Singleton.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
 #include <cstdlib> // for get set env
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <sched.h> // for sched_getaffinity
 #include <unistd.h> // for sysconf
 #include <sys/utsname.h> // for utsname
 #include <sys/param.h>
@@ -71,17 +80,39 @@
 
 #endif
 
+extern char ** environ; // not declared by every unistd.h
+
 namespace CxxAbb
 {
 
 namespace Sys
 {
 
-CxxAbb::Sys::FastMutex EnvironmentImpl::m_Mutex;
+namespace
+{
+
+class EnvironmentLock: public CxxAbb::Dp::Singleton<EnvironmentLock>
+{
+	friend class CxxAbb::Dp::Singleton<EnvironmentLock>;
+
+public:
+	CxxAbb::Sys::FastMutex m_Mutex;
+
+private:
+	EnvironmentLock()
+	{}
+};
+
+}
+
+CxxAbb::Sys::FastMutex & EnvironmentImpl::Mutex()
+{
+	return EnvironmentLock::Instance()->m_Mutex;
+}
 
 std::string EnvironmentImpl::GetImpl(const std::string & _key)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	CxxAbb::Sys::FastMutex::ScopedLock lock(Mutex());
 
 	const char* val = ::getenv(_key.c_str());
 	if (val)
@@ -92,7 +123,7 @@ std::string EnvironmentImpl::GetImpl(const std::string & _key)
 
 std::string EnvironmentImpl::GetImpl(const std::string & _key, const std::string & _default)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	CxxAbb::Sys::FastMutex::ScopedLock lock(Mutex());
 
 	const char* val = ::getenv(_key.c_str());
 	if (val)
@@ -101,24 +132,47 @@ std::string EnvironmentImpl::GetImpl(const std::string & _key, const std::string
 		return _default;
 }
 
+Result<std::string> EnvironmentImpl::TryGetImpl(const std::string & _key)
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(Mutex());
+
+	const char* val = ::getenv(_key.c_str());
+	if (val)
+		return std::string(val);
+	else
+		return Fail(ENOENT);
+}
+
 bool EnvironmentImpl::HasImpl(const std::string & _key)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	CxxAbb::Sys::FastMutex::ScopedLock lock(Mutex());
 
 	return (::getenv(_key.c_str()) != 0);
 }
 
 void EnvironmentImpl::SetImpl(const std::string & _key, const std::string & _value)
 {
-	CxxAbb::Sys::FastMutex::ScopedLock lock(m_Mutex);
+	CxxAbb::Sys::FastMutex::ScopedLock lock(Mutex());
 
 
-	std::string val = _key + "=" + _value;
-	int ret = ::putenv(const_cast<char*>(val.c_str()));
-	if (ret)
+	// setenv copies, putenv would keep a pointer to our temporary
+	if (::setenv(_key.c_str(), _value.c_str(), 1))
 	{
-		std::string msg = "Setting Environment variable failed : " + val;
-		throw CxxAbb::SystemException(msg, ret);
+		std::string msg = "Setting Environment variable failed : " + _key + "=" + _value;
+		throw CxxAbb::SystemException(msg, errno);
+	}
+}
+
+void EnvironmentImpl::VariablesImpl(std::vector<std::pair<std::string, std::string> > & _variables)
+{
+	CxxAbb::Sys::FastMutex::ScopedLock lock(Mutex());
+
+	_variables.clear();
+	for (char ** ppEntry = environ; ppEntry && *ppEntry; ++ppEntry)
+	{
+		const char * pEqual = std::strchr(*ppEntry, '=');
+		if (pEqual)
+			_variables.push_back(std::make_pair(std::string(*ppEntry, static_cast<std::size_t>(pEqual - *ppEntry)), std::string(pEqual + 1)));
 	}
 }
 
@@ -275,6 +329,324 @@ unsigned int EnvironmentImpl::ProcessorCountImpl()
 #endif
 }
 
+namespace
+{
+
+/// First line of a sysfs / procfs file
+bool ReadLine(const std::string & _sPath, std::string & _sLine)
+{
+	std::ifstream file(_sPath.c_str());
+	if (!file)
+		return false;
+	std::getline(file, _sLine);
+	return true;
+}
+
+bool ReadInt(const std::string & _sPath, long & _lValue)
+{
+	std::string sLine;
+	if (!ReadLine(_sPath, sLine))
+		return false;
+	char * pEnd = NullPtr;
+	_lValue = std::strtol(sLine.c_str(), &pEnd, 10);
+	return pEnd != sLine.c_str();
+}
+
+/// Kernel cpu list format "0-3,8,10-11", sorted and unique
+std::vector<int> ParseCpuList(const std::string & _sList)
+{
+	std::vector<int> lstCpus;
+	const char * p = _sList.c_str();
+	while (*p)
+	{
+		while (*p == ',' || *p == ' ' || *p == '\n')
+			++p;
+		if (!*p)
+			break;
+
+		char * pEnd = NullPtr;
+		long lFirst = std::strtol(p, &pEnd, 10);
+		if (pEnd == p)
+			break;
+		long lLast = lFirst;
+		p = pEnd;
+		if (*p == '-')
+		{
+			lLast = std::strtol(p + 1, &pEnd, 10);
+			if (pEnd == p + 1)
+				break;
+			p = pEnd;
+		}
+		for (long l = lFirst; l <= lLast && l < 65536; ++l)
+		{
+			lstCpus.push_back(static_cast<int>(l));
+		}
+	}
+	std::sort(lstCpus.begin(), lstCpus.end());
+	lstCpus.erase(std::unique(lstCpus.begin(), lstCpus.end()), lstCpus.end());
+	return lstCpus;
+}
+
+/// Cache sizes as reported by sysfs: "32K", "1024K", "8M"
+std::size_t ParseSize(const std::string & _sSize)
+{
+	char * pEnd = NullPtr;
+	unsigned long ulValue = std::strtoul(_sSize.c_str(), &pEnd, 10);
+	switch (*pEnd)
+	{
+		case 'K': return ulValue << 10;
+		case 'M': return ulValue << 20;
+		case 'G': return ulValue << 30;
+		default: return ulValue;
+	}
+}
+
+std::vector<int> Intersect(const std::vector<int> & _lstA, const std::vector<int> & _lstB)
+{
+	std::vector<int> lstResult;
+	std::set_intersection(_lstA.begin(), _lstA.end(), _lstB.begin(), _lstB.end(),
+			std::back_inserter(lstResult));
+	return lstResult;
+}
+
+std::string ToString(long _lValue)
+{
+	std::ostringstream oss;
+	oss << _lValue;
+	return oss.str();
+}
+
+/// First of _lstDirs holding _sFile
+bool ReadFirst(const std::vector<std::string> & _lstDirs, const std::string & _sFile, std::string & _sLine)
+{
+	for (std::size_t i = 0; i < _lstDirs.size(); ++i)
+	{
+		if (ReadLine(_lstDirs[i] + _sFile, _sLine))
+			return true;
+	}
+	return false;
+}
+
+void ReadCpus(CpuTopology & _topology, const std::string & _sCpuDir)
+{
+	std::vector<int> & lstOnline = _topology.lst_OnlineCpus;
+	std::string sLine;
+	if (ReadLine(_sCpuDir + "online", sLine))
+		lstOnline = ParseCpuList(sLine);
+	if (lstOnline.empty())
+	{
+		for (unsigned int i = 0; i < EnvironmentImpl::ProcessorCountImpl(); ++i)
+			lstOnline.push_back(static_cast<int>(i));
+	}
+
+	_topology.lst_CoreOf.assign(lstOnline.back() + 1, -1);
+	_topology.lst_Siblings.assign(lstOnline.back() + 1, std::vector<int>());
+
+	std::map<std::pair<long, long>, int> mapCores;
+	std::set<long> setPackages;
+	for (std::size_t i = 0; i < lstOnline.size(); ++i)
+	{
+		int iCpu = lstOnline[i];
+		std::string sDir = _sCpuDir + "cpu" + ToString(iCpu) + "/topology/";
+
+		long lPackage = 0;
+		long lCore = iCpu;
+		ReadInt(sDir + "physical_package_id", lPackage);
+		ReadInt(sDir + "core_id", lCore);
+
+		std::pair<long, long> key(lPackage, lCore);
+		std::map<std::pair<long, long>, int>::iterator it = mapCores.find(key);
+		if (it == mapCores.end())
+			it = mapCores.insert(std::make_pair(key, static_cast<int>(mapCores.size()))).first;
+		_topology.lst_CoreOf[iCpu] = it->second;
+		setPackages.insert(lPackage);
+
+		std::vector<int> & lstSiblings = _topology.lst_Siblings[iCpu];
+		if (ReadLine(sDir + "thread_siblings_list", sLine))
+			lstSiblings = Intersect(ParseCpuList(sLine), lstOnline);
+		if (lstSiblings.empty())
+			lstSiblings.push_back(iCpu);
+		_topology.i_ThreadsPerCore = std::max(_topology.i_ThreadsPerCore, static_cast<int>(lstSiblings.size()));
+	}
+	_topology.i_PhysicalCores = static_cast<int>(mapCores.size());
+	_topology.i_Packages = static_cast<int>(setPackages.size());
+}
+
+void ReadCaches(CpuTopology & _topology, const std::string & _sCpuDir)
+{
+	std::string sBase = _sCpuDir + "cpu" + ToString(_topology.lst_OnlineCpus.front()) + "/cache/index";
+	for (int i = 0; ; ++i)
+	{
+		std::string sDir = sBase + ToString(i) + "/";
+		long lValue = 0;
+		if (!ReadInt(sDir + "level", lValue))
+			break;
+
+		CacheInfo cache;
+		cache.i_Level = static_cast<int>(lValue);
+		ReadLine(sDir + "type", cache.s_Type);
+		std::string sLine;
+		if (ReadLine(sDir + "size", sLine))
+			cache.t_Size = ParseSize(sLine);
+		if (ReadInt(sDir + "coherency_line_size", lValue))
+			cache.t_LineSize = static_cast<std::size_t>(lValue);
+		if (ReadInt(sDir + "ways_of_associativity", lValue))
+			cache.i_Ways = static_cast<int>(lValue);
+		if (ReadLine(sDir + "shared_cpu_list", sLine))
+			cache.lst_SharedCpus = ParseCpuList(sLine);
+		_topology.lst_Caches.push_back(cache);
+	}
+
+	const CacheInfo * pL1 = _topology.Cache(1);
+	if (pL1 && pL1->t_LineSize)
+		_topology.t_CacheLineSize = pL1->t_LineSize;
+}
+
+void ReadNodes(CpuTopology & _topology, const std::string & _sNodeDir, bool _bHost)
+{
+	std::string sLine;
+	std::vector<int> lstIds;
+	if (ReadLine(_sNodeDir + "online", sLine))
+		lstIds = ParseCpuList(sLine);
+
+	for (std::size_t i = 0; i < lstIds.size(); ++i)
+	{
+		NumaNode node;
+		node.i_Id = lstIds[i];
+		std::string sDir = _sNodeDir + "node" + ToString(node.i_Id) + "/";
+		if (ReadLine(sDir + "cpulist", sLine))
+			node.lst_Cpus = ParseCpuList(sLine);
+
+		// "Node 0 MemTotal:       16318540 kB"
+		std::ifstream meminfo((sDir + "meminfo").c_str());
+		while (std::getline(meminfo, sLine))
+		{
+			std::string::size_type tPos = sLine.find("MemTotal:");
+			if (tPos != std::string::npos)
+			{
+				node.ui_MemoryBytes = static_cast<UInt64>(std::strtoull(sLine.c_str() + tPos + 9, NullPtr, 10)) << 10;
+				break;
+			}
+		}
+		_topology.lst_Nodes.push_back(node);
+	}
+
+	if (_topology.lst_Nodes.empty())
+	{
+		NumaNode node;
+		node.lst_Cpus = _topology.lst_OnlineCpus;
+		if (_bHost)
+			node.ui_MemoryBytes = static_cast<UInt64>(::sysconf(_SC_PHYS_PAGES)) * static_cast<UInt64>(::sysconf(_SC_PAGESIZE));
+		_topology.lst_Nodes.push_back(node);
+	}
+}
+
+/** Quota and cpuset of the process cgroup. Controllers are looked up at the
+ * standard mount points, below the path named in /proc/self/cgroup and at the
+ * mount root (cgroup namespaces show "/").
+ */
+void ReadCgroup(CpuTopology & _topology, const std::string & _sRoot)
+{
+	std::string sMount = _sRoot + "sys/fs/cgroup";
+	std::vector<std::string> lstCpuDirs;
+	std::vector<std::string> lstCpusetDirs;
+
+	std::ifstream cgroup((_sRoot + "proc/self/cgroup").c_str());
+	std::string sLine;
+	while (std::getline(cgroup, sLine))
+	{
+		// "hierarchy-id:controller-list:path", v2 is "0::path"
+		std::string::size_type tFirst = sLine.find(':');
+		std::string::size_type tSecond = sLine.find(':', tFirst + 1);
+		if (tFirst == std::string::npos || tSecond == std::string::npos)
+			continue;
+		std::string sControllers = "," + sLine.substr(tFirst + 1, tSecond - tFirst - 1) + ",";
+		std::string sPath = sLine.substr(tSecond + 1);
+		if (sPath == "/")
+			sPath.clear();
+
+		if (sControllers == ",,")
+		{
+			lstCpuDirs.push_back(sMount + sPath + "/");
+			lstCpusetDirs.push_back(sMount + sPath + "/");
+		}
+		if (sControllers.find(",cpu,") != std::string::npos)
+		{
+			lstCpuDirs.push_back(sMount + "/cpu,cpuacct" + sPath + "/");
+			lstCpuDirs.push_back(sMount + "/cpu" + sPath + "/");
+		}
+		if (sControllers.find(",cpuset,") != std::string::npos)
+			lstCpusetDirs.push_back(sMount + "/cpuset" + sPath + "/");
+	}
+	lstCpuDirs.push_back(sMount + "/");
+	lstCpuDirs.push_back(sMount + "/cpu,cpuacct/");
+	lstCpuDirs.push_back(sMount + "/cpu/");
+	lstCpusetDirs.push_back(sMount + "/");
+	lstCpusetDirs.push_back(sMount + "/cpuset/");
+
+	// v2 "max 100000" or "150000 100000", v1 two files with -1 for unlimited
+	if (ReadFirst(lstCpuDirs, "cpu.max", sLine))
+	{
+		double dQuota = std::strtod(sLine.c_str(), NullPtr);
+		std::string::size_type tSpace = sLine.find(' ');
+		double dPeriod = tSpace != std::string::npos ? std::strtod(sLine.c_str() + tSpace, NullPtr) : 0.0;
+		if (sLine.compare(0, 3, "max") != 0 && dQuota > 0 && dPeriod > 0)
+			_topology.d_QuotaCpus = dQuota / dPeriod;
+	}
+	else if (ReadFirst(lstCpuDirs, "cpu.cfs_quota_us", sLine))
+	{
+		double dQuota = std::strtod(sLine.c_str(), NullPtr);
+		std::string sPeriod;
+		if (dQuota > 0 && ReadFirst(lstCpuDirs, "cpu.cfs_period_us", sPeriod) && std::strtod(sPeriod.c_str(), NullPtr) > 0)
+			_topology.d_QuotaCpus = dQuota / std::strtod(sPeriod.c_str(), NullPtr);
+	}
+
+	if ((ReadFirst(lstCpusetDirs, "cpuset.cpus.effective", sLine) || ReadFirst(lstCpusetDirs, "cpuset.cpus", sLine))
+			&& !ParseCpuList(sLine).empty())
+		_topology.lst_AllowedCpus = Intersect(_topology.lst_AllowedCpus, ParseCpuList(sLine));
+}
+
+}
+
+void EnvironmentImpl::ReadTopologyImpl(CpuTopology & _topology, const std::string & _sRoot)
+{
+	std::string sRoot = _sRoot;
+	if (sRoot.empty() || sRoot[sRoot.size() - 1] != '/')
+		sRoot += '/';
+	bool bHost = (sRoot == "/");
+
+	_topology = CpuTopology();
+	ReadCpus(_topology, sRoot + "sys/devices/system/cpu/");
+	ReadCaches(_topology, sRoot + "sys/devices/system/cpu/");
+	ReadNodes(_topology, sRoot + "sys/devices/system/node/", bHost);
+
+	_topology.lst_AllowedCpus = _topology.lst_OnlineCpus;
+	ReadCgroup(_topology, sRoot);
+
+#if (CXXABB_OS == CXXABB_OS_LINUX)
+	if (bHost)
+	{
+		cpu_set_t tSet;
+		CPU_ZERO(&tSet);
+		if (::sched_getaffinity(0, sizeof(tSet), &tSet) == 0)
+		{
+			std::vector<int> lstAffinity;
+			for (int i = 0; i < CPU_SETSIZE; ++i)
+			{
+				if (CPU_ISSET(i, &tSet))
+					lstAffinity.push_back(i);
+			}
+			_topology.lst_AllowedCpus = Intersect(_topology.lst_AllowedCpus, lstAffinity);
+		}
+	}
+#endif
+
+	int iEffective = static_cast<int>(_topology.lst_AllowedCpus.size());
+	if (_topology.d_QuotaCpus > 0)
+		iEffective = std::min(iEffective, static_cast<int>(std::ceil(_topology.d_QuotaCpus)));
+	_topology.i_EffectiveCpus = std::max(1, iEffective);
+}
+
 }  /* namespace Sys */
 
 }  /* namespace CxxAbb */
@@ -30,8 +30,13 @@
 
 
 #include <CxxAbb/Core.h>
+#include <CxxAbb/Result.h>
+#include <CxxAbb/Sys/CpuTopology.h>
 #include <CxxAbb/Sys/Mutex.h>
 
+#include <utility>
+#include <vector>
+
 namespace CxxAbb
 {
 
@@ -47,10 +52,15 @@ public:
 
 	static std::string GetImpl(const std::string & _key, const std::string & _default);
 
+	static Result<std::string> TryGetImpl(const std::string & _key);
+
 	static bool HasImpl(const std::string & _key);
 
 	static void SetImpl(const std::string & _key, const std::string & _value);
 
+	/// Copy every NAME=VALUE of the process environment
+	static void VariablesImpl(std::vector<std::pair<std::string, std::string> > & _variables);
+
 	static std::string OsNameImpl();
 
 	static std::string HostNameImpl();
@@ -62,9 +72,11 @@ public:
 	static std::string OsArchitectureImpl();
 
 	static unsigned int ProcessorCountImpl();
-private:
 
-	static CxxAbb::Sys::FastMutex m_Mutex;
+	static void ReadTopologyImpl(CpuTopology & _topology, const std::string & _sRoot);
+private:
+	/// Guards getenv/putenv, created on first use (Dp::Singleton)
+	static CxxAbb::Sys::FastMutex & Mutex();
 };
 
 }  /* namespace Sys */
@@ -81,7 +81,7 @@ bool SigEventImpl::TryWaitImpl(long _lMiliSeconds)
 {
 	struct timespec abstime;
 	struct timeval tv;
-	int rc;
+	int rc = 0;
 
 	gettimeofday(&tv, NULL);
 	abstime.tv_sec = tv.tv_sec + _lMiliSeconds / 1000;
@@ -54,10 +54,10 @@ ThreadImpl::~ThreadImpl()
 	}
 }
 
-void ThreadImpl::SetNameImpl(std::string & _sName)
+void ThreadImpl::SetNameImpl(const char * _zName)
 {
 	char zTname[16];
-	strncpy(zTname, _sName.c_str(), 16);
+	strncpy(zTname, _zName, 16);
 	prctl(PR_SET_NAME, zTname);
 }
 
@@ -88,7 +88,7 @@ protected:
 		return ptr_ThreadData->t_ThreadHandle;
 	}
 
-	void SetNameImpl(std::string & _sName);
+	void SetNameImpl(const char * _zName);
 
 	State CurrentStateImpl();
 
@@ -57,7 +57,7 @@ AtomicCounter::~AtomicCounter()
 {
 }
 
-inline AtomicCounter::operator AtomicType() const
+AtomicCounter::operator AtomicType() const
 {
 #if (_MSC_VER >= 1400)
 	MemoryBarrier();
@@ -65,7 +65,7 @@ inline AtomicCounter::operator AtomicType() const
 	return t_Counter;
 }
 
-inline AtomicType AtomicCounter::Value() const
+AtomicType AtomicCounter::Value() const
 {
 #if (_MSC_VER >= 1400)
 	MemoryBarrier();
@@ -74,41 +74,41 @@ inline AtomicType AtomicCounter::Value() const
 }
 
 /// Operators
-inline AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
+AtomicCounter& AtomicCounter::operator =(const AtomicCounter& _counter)
 {
 	InterlockedExchange(&t_Counter, _counter.Value());
 	return *this;
 }
 
-inline AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
+AtomicCounter& AtomicCounter::operator =(AtomicType _atomictype)
 {
 	InterlockedExchange(&t_Counter, _atomictype);
 	return *this;
 }
 
-inline AtomicType AtomicCounter::operator ++()
+AtomicType AtomicCounter::operator ++()
 {
 	return InterlockedIncrement(&t_Counter);
 }
 
-inline AtomicType AtomicCounter::operator ++(Int32)
+AtomicType AtomicCounter::operator ++(Int32)
 {
 	AtomicType result = InterlockedIncrement(&t_Counter);
 	return --result;
 }
 
-inline AtomicType AtomicCounter::operator --()
+AtomicType AtomicCounter::operator --()
 {
 	return InterlockedDecrement(&t_Counter);
 }
 
-inline AtomicType AtomicCounter::operator --(Int32)
+AtomicType AtomicCounter::operator --(Int32)
 {
 	AtomicType result = InterlockedDecrement(&t_Counter);
 	return ++result;
 }
 
-inline bool AtomicCounter::operator !() const
+bool AtomicCounter::operator !() const
 {
 	return t_Counter == 0;
 }
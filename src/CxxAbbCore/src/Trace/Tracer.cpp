@@ -0,0 +1,481 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * Tracer.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Trace
+ * Comment     : Per-thread event tracer with Chrome trace export
+ *
+ */
+
+#include <CxxAbb/Trace/Tracer.h>
+#include <CxxAbb/Runnable.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/SigEvent.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Exception.h>
+
+#include <cstdio>
+#include <sstream>
+#include <vector>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace CxxAbb
+{
+
+namespace Trace
+{
+
+namespace
+{
+
+enum EventType
+{
+	CompleteEvent,
+	InstantEvent,
+	CounterEvent
+};
+
+struct Event
+{
+	UInt64 ui_Time;
+	UInt64 ui_Value;      /// duration of a span or counter value
+	const char * z_Name;
+	int e_Type;
+};
+
+/** @brief Single producer single consumer ring of one thread */
+class Ring : private NonCopyable
+{
+public:
+	Ring(std::size_t _tCapacity, int _iTid, const SharedString & _sName)
+		: a_Events(new Event[_tCapacity]()), // zeroed, page faults happen here and not while recording
+		  t_Mask(_tCapacity - 1),
+		  ui_Head(0),
+		  ui_Tail(0),
+		  i_Tid(_iTid),
+		  s_Name(_sName),
+		  i_Exited(0),
+		  b_Named(false)
+	{}
+
+	~Ring()
+	{
+		delete [] a_Events;
+	}
+
+	/// producer side
+	bool Push(const Event & _event)
+	{
+		UInt64 uiHead = ui_Head;
+		if (uiHead - Sys::AtomicLoad(&ui_Tail, Sys::MemoryOrderAcquire) > t_Mask)
+			return false;
+
+		a_Events[uiHead & t_Mask] = _event;
+		Sys::AtomicStore(&ui_Head, uiHead + 1, Sys::MemoryOrderRelease);
+		return true;
+	}
+
+	/// consumer side
+	bool Pop(Event & _event)
+	{
+		UInt64 uiTail = ui_Tail;
+		if (uiTail == Sys::AtomicLoad(&ui_Head, Sys::MemoryOrderAcquire))
+			return false;
+
+		_event = a_Events[uiTail & t_Mask];
+		Sys::AtomicStore(&ui_Tail, uiTail + 1, Sys::MemoryOrderRelease);
+		return true;
+	}
+
+	Event * a_Events;
+	std::size_t t_Mask;
+	volatile UInt64 ui_Head;
+	char a_Pad[64];           /// keep producer and consumer indexes on separate lines
+	volatile UInt64 ui_Tail;
+	int i_Tid;
+	SharedString s_Name;
+	volatile int i_Exited;
+	bool b_Named;             /// thread_name metadata written to the current file
+};
+
+class Flusher: public CxxAbb::Runnable
+{
+public:
+	Flusher()
+		: i_Stop(0),
+		  l_Interval(100)
+	{}
+
+	void Run();
+
+	Sys::SigEvent m_Wake;
+	volatile int i_Stop;
+	long l_Interval;
+};
+
+/// Tracer state, never destroyed: threads may record while the process exits
+struct TracerState
+{
+	TracerState()
+		: p_File(NullPtr),
+		  b_First(true),
+		  p_Thread(NullPtr),
+		  t_RingEvents(16384),
+		  ui_Dropped(0),
+		  ui_Written(0),
+		  ui_Tick0(0),
+		  ui_Ns0(0),
+		  d_NsPerTick(1.0),
+		  i_Pid(static_cast<int>(::getpid()))
+	{
+		::pthread_key_create(&t_Key, &TracerState::ThreadExit);
+	}
+
+	static void ThreadExit(void * _pRing)
+	{
+		Sys::AtomicStore(&static_cast<Ring*>(_pRing)->i_Exited, 1, Sys::MemoryOrderRelease);
+	}
+
+	Sys::FastMutex mtx_Control;   /// serializes Start / Stop
+	Sys::FastMutex mtx_Rings;     /// ring list and trace file
+	std::vector<Ring*> lst_Rings;
+
+	std::FILE * p_File;
+	bool b_First;
+	Flusher m_Flusher;
+	Sys::Thread * p_Thread;
+
+	std::size_t t_RingEvents;
+	Sys::Atomic<UInt64> ui_Dropped;
+	Sys::Atomic<UInt64> ui_Written;
+
+	UInt64 ui_Tick0;
+	UInt64 ui_Ns0;
+	double d_NsPerTick;
+	int i_Pid;
+	pthread_key_t t_Key;
+};
+
+TracerState * g_State = 0;
+Sys::OnceFlag g_StateOnce = CXXABB_ONCE_INIT;
+__thread Ring * t_Ring = 0;
+
+void CreateState()
+{
+	g_State = new TracerState;
+}
+
+TracerState & State()
+{
+	Sys::CallOnce(g_StateOnce, &CreateState);
+	return *g_State;
+}
+
+UInt64 MonotonicNs()
+{
+	struct timespec ts;
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<UInt64>(ts.tv_sec) * static_cast<UInt64>(1000000000) + static_cast<UInt64>(ts.tv_nsec);
+}
+
+/// Tick rate from the span since Start(), more accurate as the trace grows
+void Calibrate(TracerState & _state)
+{
+	UInt64 uiTicks = Tracer::Now() - _state.ui_Tick0;
+	UInt64 uiNs = MonotonicNs() - _state.ui_Ns0;
+	if (uiNs > 1000000 && uiTicks > 0)
+		_state.d_NsPerTick = static_cast<double>(uiNs) / static_cast<double>(uiTicks);
+}
+
+double ToMicroseconds(const TracerState & _state, UInt64 _uiTicks)
+{
+	return static_cast<double>(static_cast<Int64>(_uiTicks - _state.ui_Tick0)) * _state.d_NsPerTick / 1000.0;
+}
+
+SharedString ThreadName(int _iTid)
+{
+	Sys::Thread * pThread = Sys::Thread::Current();
+	if (pThread)
+		return pThread->Name();
+	if (_iTid == static_cast<int>(::getpid()))
+		return "main";
+
+	std::ostringstream ss;
+	ss << "Thread " << _iTid;
+	return ss.str();
+}
+
+void WriteEscaped(std::FILE * _pFile, const char * _zText)
+{
+	for (; *_zText; ++_zText)
+	{
+		unsigned char c = static_cast<unsigned char>(*_zText);
+		if (c == '"' || c == '\\')
+		{
+			std::fputc('\\', _pFile);
+			std::fputc(c, _pFile);
+		}
+		else if (c < 0x20)
+			std::fprintf(_pFile, "\\u%04x", c);
+		else
+			std::fputc(c, _pFile);
+	}
+}
+
+void BeginRecord(TracerState & _state)
+{
+	std::fputs(_state.b_First ? "\n" : ",\n", _state.p_File);
+	_state.b_First = false;
+}
+
+void WriteEvent(TracerState & _state, const Ring & _ring, const Event & _event)
+{
+	std::FILE * pFile = _state.p_File;
+	BeginRecord(_state);
+	std::fputs("{\"name\":\"", pFile);
+	WriteEscaped(pFile, _event.z_Name);
+
+	switch (_event.e_Type)
+	{
+		case CompleteEvent:
+			std::fprintf(pFile, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+					ToMicroseconds(_state, _event.ui_Time),
+					static_cast<double>(_event.ui_Value) * _state.d_NsPerTick / 1000.0, _state.i_Pid, _ring.i_Tid);
+			break;
+		case InstantEvent:
+			std::fprintf(pFile, "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d}",
+					ToMicroseconds(_state, _event.ui_Time), _state.i_Pid, _ring.i_Tid);
+			break;
+		case CounterEvent:
+			std::fprintf(pFile, "\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d,\"args\":{\"value\":%ld}}",
+					ToMicroseconds(_state, _event.ui_Time), _state.i_Pid, _ring.i_Tid,
+					static_cast<long>(static_cast<Int64>(_event.ui_Value)));
+			break;
+	}
+}
+
+void WriteThreadName(TracerState & _state, Ring & _ring)
+{
+	BeginRecord(_state);
+	std::fprintf(_state.p_File, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"",
+			_state.i_Pid, _ring.i_Tid);
+	WriteEscaped(_state.p_File, _ring.s_Name.c_str());
+	std::fputs("\"}}", _state.p_File);
+	_ring.b_Named = true;
+}
+
+/** @brief Move ring contents to the trace file (or drop them when _bWrite is false)
+ *  Rings of exited threads are freed once empty. Call with mtx_Rings held.
+ */
+void Drain(TracerState & _state, bool _bWrite)
+{
+	if (_bWrite)
+		Calibrate(_state);
+
+	UInt64 uiWritten = 0;
+	for (std::size_t i = 0; i < _state.lst_Rings.size();)
+	{
+		Ring * pRing = _state.lst_Rings[i];
+		bool bExited = Sys::AtomicLoad(&pRing->i_Exited, Sys::MemoryOrderAcquire) != 0;
+
+		Event event;
+		while (pRing->Pop(event))
+		{
+			if (!_bWrite)
+				continue;
+			if (!pRing->b_Named)
+				WriteThreadName(_state, *pRing);
+			WriteEvent(_state, *pRing, event);
+			++uiWritten;
+		}
+
+		if (bExited)
+		{
+			delete pRing;
+			_state.lst_Rings[i] = _state.lst_Rings.back();
+			_state.lst_Rings.pop_back();
+		}
+		else
+			++i;
+	}
+
+	if (_bWrite)
+	{
+		std::fflush(_state.p_File);
+		_state.ui_Written.FetchAdd(uiWritten, Sys::MemoryOrderRelaxed);
+	}
+}
+
+void Flusher::Run()
+{
+	TracerState & state = State();
+	while (!Sys::AtomicLoad(&i_Stop, Sys::MemoryOrderAcquire))
+	{
+		m_Wake.TryWait(l_Interval);
+
+		Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+		if (state.p_File)
+			Drain(state, true);
+	}
+}
+
+Ring * CreateRing()
+{
+	TracerState & state = State();
+	int iTid = static_cast<int>(::syscall(SYS_gettid));
+	Ring * pRing = new Ring(state.t_RingEvents, iTid, ThreadName(iTid));
+	{
+		Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+		state.lst_Rings.push_back(pRing);
+	}
+	::pthread_setspecific(state.t_Key, pRing);
+	t_Ring = pRing;
+	return pRing;
+}
+
+inline void Record(const char * _zName, int _eType, UInt64 _uiTime, UInt64 _uiValue)
+{
+	Ring * pRing = t_Ring;
+	if (!pRing)
+		pRing = CreateRing();
+
+	Event event;
+	event.ui_Time = _uiTime;
+	event.ui_Value = _uiValue;
+	event.z_Name = _zName;
+	event.e_Type = _eType;
+	if (!pRing->Push(event))
+		g_State->ui_Dropped.FetchAdd(1, Sys::MemoryOrderRelaxed);
+}
+
+}
+
+volatile int Tracer::i_Enabled = 0;
+
+void Tracer::Start(const std::string & _sPath, long _lFlushMilliSeconds, std::size_t _tRingEvents)
+{
+	TracerState & state = State();
+	Sys::FastMutex::ScopedLock control(state.mtx_Control);
+	if (state.p_Thread)
+		throw IllegalStateException("Tracer already started");
+
+	std::FILE * pFile = std::fopen(_sPath.c_str(), "w");
+	if (!pFile)
+		throw OpenFileException(_sPath);
+
+	{
+		Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+		// events recorded after the last Stop() belong to no trace
+		Drain(state, false);
+		for (std::size_t i = 0; i < state.lst_Rings.size(); ++i)
+		{
+			state.lst_Rings[i]->b_Named = false;
+		}
+
+		std::size_t tCapacity = 64;
+		while (tCapacity < _tRingEvents)
+		{
+			tCapacity *= 2;
+		}
+		state.t_RingEvents = tCapacity;
+		state.ui_Dropped.Store(0);
+		state.ui_Written.Store(0);
+
+		state.ui_Tick0 = Now();
+		state.ui_Ns0 = MonotonicNs();
+		state.d_NsPerTick = 1.0;
+
+		state.p_File = pFile;
+		state.b_First = true;
+		std::fputs("[", pFile);
+	}
+
+#if defined(__x86_64__) || defined(__i386__)
+	// initial tick rate, refined on every flush
+	while (MonotonicNs() - state.ui_Ns0 < 2000000)
+	{
+		Sys::CpuRelax();
+	}
+	Calibrate(state);
+#endif
+
+	state.m_Flusher.l_Interval = _lFlushMilliSeconds > 0 ? _lFlushMilliSeconds : 1;
+	Sys::AtomicStore(&state.m_Flusher.i_Stop, 0, Sys::MemoryOrderRelease);
+	state.p_Thread = new Sys::Thread("TraceFlusher");
+	state.p_Thread->Start(state.m_Flusher);
+
+	Sys::AtomicStore(&i_Enabled, 1, Sys::MemoryOrderRelease);
+}
+
+void Tracer::Stop()
+{
+	TracerState & state = State();
+	Sys::FastMutex::ScopedLock control(state.mtx_Control);
+	if (!state.p_Thread)
+		return;
+
+	Sys::AtomicStore(&i_Enabled, 0, Sys::MemoryOrderRelease);
+
+	Sys::AtomicStore(&state.m_Flusher.i_Stop, 1, Sys::MemoryOrderRelease);
+	state.m_Flusher.m_Wake.Set();
+	state.p_Thread->Join();
+	delete state.p_Thread;
+	state.p_Thread = NullPtr;
+
+	Sys::FastMutex::ScopedLock lock(state.mtx_Rings);
+	Drain(state, true);
+	std::fputs("\n]\n", state.p_File);
+	std::fclose(state.p_File);
+	state.p_File = NullPtr;
+}
+
+void Tracer::Complete(const char * _zName, UInt64 _uiStart, UInt64 _uiEnd)
+{
+	Record(_zName, CompleteEvent, _uiStart, _uiEnd - _uiStart);
+}
+
+void Tracer::Instant(const char * _zName)
+{
+	Record(_zName, InstantEvent, Now(), 0);
+}
+
+void Tracer::Counter(const char * _zName, Int64 _iValue)
+{
+	Record(_zName, CounterEvent, Now(), static_cast<UInt64>(_iValue));
+}
+
+UInt64 Tracer::Dropped()
+{
+	return State().ui_Dropped.Load(Sys::MemoryOrderRelaxed);
+}
+
+UInt64 Tracer::Written()
+{
+	return State().ui_Written.Load(Sys::MemoryOrderRelaxed);
+}
+
+}  /* namespace Trace */
+
+}  /* namespace CxxAbb */
@@ -50,6 +50,36 @@ void Timestamp::Now()
 	t_Value = TimeVal(tv.tv_sec) * MuSecPerSecond + tv.tv_usec;
 }
 
+void Timestamp::NowCoarse()
+{
+#if defined(CLOCK_REALTIME_COARSE)
+	struct timespec ts;
+	if (::clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0)
+	{
+		t_Value = TimeVal(ts.tv_sec) * MuSecPerSecond + ts.tv_nsec / 1000;
+		return;
+	}
+#endif
+	Now();
+}
+
+Timestamp::TimeVal Timestamp::MonotonicCoarse()
+{
+	struct timespec ts;
+#if defined(CLOCK_MONOTONIC_COARSE)
+	if (::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0)
+		return TimeVal(ts.tv_sec) * MuSecPerSecond + ts.tv_nsec / 1000;
+#endif
+	if (::clock_gettime(CLOCK_MONOTONIC, &ts))
+	{
+		std::stringstream ss;
+		ss << "clock_gettime() failed : ";
+		ss << strerror(errno);
+		throw CxxAbb::SystemException(ss.str());
+	}
+	return TimeVal(ts.tv_sec) * MuSecPerSecond + ts.tv_nsec / 1000;
+}
+
 } /* namespace CxxAbb */
 
 
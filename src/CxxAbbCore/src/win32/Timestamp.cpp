@@ -49,6 +49,18 @@ void Timestamp::Now()
 
 }
 
+void Timestamp::NowCoarse()
+{
+	// GetSystemTimeAsFileTime() already reads the tick updated system time
+	Now();
+}
+
+Timestamp::TimeVal Timestamp::MonotonicCoarse()
+{
+	// milliseconds since boot, updated every tick
+	return static_cast<TimeVal>(GetTickCount64()) * 1000;
+}
+
 } /* namespace CxxAbb */
 
 
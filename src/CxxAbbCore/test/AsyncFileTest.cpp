@@ -0,0 +1,258 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ConcurrentHashMapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Sys
+ * Comment     : AsyncFile unit tests
+ *
+ */
+
+#include <CxxAbb/Sys/AsyncFile.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+const char * AsyncPath = "/tmp/CxxAbbAsyncFileTest.bin";
+const std::size_t BlockSize = 4096;
+const std::size_t Blocks = 16;
+
+volatile long g_lCallbackBytes = 0;
+volatile long g_lCallbacks = 0;
+
+void CountBytes(long _lResult, void * _pData)
+{
+	CxxAbb::Sys::AtomicFetchAdd(&g_lCallbackBytes, _lResult);
+	CxxAbb::Sys::AtomicFetchAdd(&g_lCallbacks, 1L);
+	*static_cast<long*>(_pData) = _lResult;
+}
+
+void RoundTrip(CxxAbb::Sys::AsyncFile::Backend _eBackend)
+{
+	std::remove(AsyncPath);
+	CxxAbb::Sys::AsyncFile file(AsyncPath, CxxAbb::Sys::AsyncFile::ReadWrite, CxxAbb::Sys::AsyncFile::Create,
+			_eBackend, 8);
+	ASSERT_EQ (_eBackend, file.GetBackend());
+	ASSERT_EQ (8U, file.QueueDepth());
+
+	// more writes than the queue depth, submitted in chunks
+	std::vector<CxxAbb::Buffer<char>*> lstOut;
+	std::vector<CxxAbb::Sys::Future<std::size_t> > lstWritten;
+	CxxAbb::Sys::AsyncFile::Batch batch;
+	for (std::size_t i = 0; i < Blocks; ++i)
+	{
+		lstOut.push_back(new CxxAbb::Buffer<char>(BlockSize));
+		lstOut[i]->size(BlockSize);
+		for (std::size_t j = 0; j < BlockSize; ++j)
+			(*lstOut[i])[j] = static_cast<char>('a' + (i + j) % 26);
+		lstWritten.push_back(batch.Write(i * BlockSize, *lstOut[i]));
+	}
+	ASSERT_EQ (Blocks, batch.Size());
+	file.Submit(batch);
+	ASSERT_TRUE (batch.Empty());
+	for (std::size_t i = 0; i < Blocks; ++i)
+		ASSERT_EQ (BlockSize, lstWritten[i].Get());
+	ASSERT_EQ (0U, file.Fsync(true).Get());
+	ASSERT_EQ (Blocks * BlockSize, file.Size());
+
+	// read back through callbacks
+	g_lCallbackBytes = 0;
+	g_lCallbacks = 0;
+	std::vector<CxxAbb::Buffer<char>*> lstIn;
+	std::vector<long> lstResults(Blocks, -1);
+	for (std::size_t i = 0; i < Blocks; ++i)
+	{
+		lstIn.push_back(new CxxAbb::Buffer<char>(BlockSize));
+		batch.Read((Blocks - 1 - i) * BlockSize, *lstIn[i], &CountBytes, &lstResults[i]);
+	}
+	file.Submit(batch);
+	file.Drain();
+	ASSERT_EQ (0U, file.Pending());
+	ASSERT_EQ (static_cast<long>(Blocks), g_lCallbacks);
+	ASSERT_EQ (static_cast<long>(Blocks * BlockSize), g_lCallbackBytes);
+	for (std::size_t i = 0; i < Blocks; ++i)
+	{
+		ASSERT_EQ (static_cast<long>(BlockSize), lstResults[i]);
+		ASSERT_TRUE (*lstIn[i] == *lstOut[Blocks - 1 - i]);
+	}
+
+	// short read at the end, nothing past it
+	CxxAbb::Buffer<char> tail(BlockSize);
+	ASSERT_EQ (100U, file.Read(Blocks * BlockSize - 100, tail).Get());
+	ASSERT_EQ (100U, tail.size());
+	ASSERT_EQ (0U, file.Read(Blocks * BlockSize, tail).Get());
+	ASSERT_EQ (0U, tail.size());
+
+	for (std::size_t i = 0; i < Blocks; ++i)
+	{
+		delete lstOut[i];
+		delete lstIn[i];
+	}
+	file.Close();
+	ASSERT_FALSE (file.IsOpen());
+	std::remove(AsyncPath);
+}
+
+void Errors(CxxAbb::Sys::AsyncFile::Backend _eBackend)
+{
+	std::remove(AsyncPath);
+	ASSERT_THROW (CxxAbb::Sys::AsyncFile(AsyncPath, CxxAbb::Sys::AsyncFile::ReadOnly, 0, _eBackend),
+			CxxAbb::OpenFileException);
+
+	{
+		CxxAbb::Sys::AsyncFile file(AsyncPath, CxxAbb::Sys::AsyncFile::WriteOnly,
+				CxxAbb::Sys::AsyncFile::Create | CxxAbb::Sys::AsyncFile::Truncate, _eBackend);
+		CxxAbb::Buffer<char> buf(16);
+		CxxAbb::Sys::Future<std::size_t> read = file.Read(0, buf);
+		ASSERT_THROW (read.Get(), CxxAbb::ReadFileException);
+	}
+
+	CxxAbb::Sys::AsyncFile file(AsyncPath, CxxAbb::Sys::AsyncFile::ReadOnly, 0, _eBackend);
+	CxxAbb::Buffer<char> buf("x", 1);
+	long lResult = 0;
+	file.Write(0, buf, &CountBytes, &lResult);
+	file.Drain();
+	ASSERT_GT (0, lResult);
+	ASSERT_THROW (file.Write(0, buf).Get(), CxxAbb::WriteFileException);
+
+	file.Close();
+	ASSERT_THROW (file.Fsync(), CxxAbb::IllegalStateException);
+	std::remove(AsyncPath);
+}
+
+/// Reads again from inside the completion of a read
+struct Resubmit
+{
+	CxxAbb::Sys::AsyncFile * p_File;
+	CxxAbb::Buffer<char> * p_Buf;
+	CxxAbb::Sys::Future<std::size_t> m_Inner;
+	bool b_Refused;
+};
+
+void ReadAgain(long, void * _pData)
+{
+	Resubmit & resubmit = *static_cast<Resubmit*>(_pData);
+	try
+	{
+		resubmit.m_Inner = resubmit.p_File->Read(0, *resubmit.p_Buf);
+	}
+	catch(CxxAbb::IllegalStateException &)
+	{
+		resubmit.b_Refused = true;
+	}
+}
+
+void SubmitFromCompletion(CxxAbb::Sys::AsyncFile::Backend _eBackend)
+{
+	{
+		std::FILE * pFile = std::fopen(AsyncPath, "wb");
+		std::fputs("0123456789", pFile);
+		std::fclose(pFile);
+	}
+
+	for (unsigned int uiDepth = 1; uiDepth <= 2; ++uiDepth)
+	{
+		CxxAbb::Sys::AsyncFile file(AsyncPath, CxxAbb::Sys::AsyncFile::ReadOnly, 0, _eBackend, uiDepth);
+		CxxAbb::Buffer<char> outer(4);
+		CxxAbb::Buffer<char> inner(4);
+		Resubmit resubmit;
+		resubmit.p_File = &file;
+		resubmit.p_Buf = &inner;
+		resubmit.b_Refused = false;
+
+		// full queue: the completion's own slot is still taken, waiting for it would never end
+		file.Read(6, outer, &ReadAgain, &resubmit);
+		file.Drain();
+		ASSERT_EQ (0U, file.Pending());
+		if (uiDepth == 1)
+		{
+			ASSERT_TRUE (resubmit.b_Refused);
+			ASSERT_FALSE (resubmit.m_Inner.IsValid());
+		}
+		else
+		{
+			ASSERT_FALSE (resubmit.b_Refused);
+			ASSERT_EQ (4U, resubmit.m_Inner.Get());
+			ASSERT_EQ ("0123", std::string(inner.begin(), inner.size()));
+		}
+		ASSERT_EQ ("6789", std::string(outer.begin(), outer.size()));
+	}
+	std::remove(AsyncPath);
+}
+
+}
+
+TEST(AsyncFileTest, ThreadPool)
+{
+	RoundTrip(CxxAbb::Sys::AsyncFile::BackendThreadPool);
+	Errors(CxxAbb::Sys::AsyncFile::BackendThreadPool);
+	SubmitFromCompletion(CxxAbb::Sys::AsyncFile::BackendThreadPool);
+}
+
+TEST(AsyncFileTest, Uring)
+{
+	if (!CxxAbb::Sys::AsyncFile::UringSupported())
+	{
+		ASSERT_THROW (CxxAbb::Sys::AsyncFile(AsyncPath, CxxAbb::Sys::AsyncFile::ReadWrite,
+				CxxAbb::Sys::AsyncFile::Create, CxxAbb::Sys::AsyncFile::BackendUring), CxxAbb::Exception);
+		std::remove(AsyncPath);
+		return;
+	}
+
+	RoundTrip(CxxAbb::Sys::AsyncFile::BackendUring);
+	Errors(CxxAbb::Sys::AsyncFile::BackendUring);
+	SubmitFromCompletion(CxxAbb::Sys::AsyncFile::BackendUring);
+}
+
+TEST(AsyncFileTest, Auto)
+{
+	CxxAbb::Sys::AsyncFile file;
+	ASSERT_FALSE (file.IsOpen());
+	file.Open(AsyncPath, CxxAbb::Sys::AsyncFile::ReadWrite, CxxAbb::Sys::AsyncFile::Create,
+			CxxAbb::Sys::AsyncFile::BackendAuto, 5);
+	ASSERT_EQ (8U, file.QueueDepth());
+	ASSERT_EQ (CxxAbb::Sys::AsyncFile::UringSupported() ? CxxAbb::Sys::AsyncFile::BackendUring
+			: CxxAbb::Sys::AsyncFile::BackendThreadPool, file.GetBackend());
+
+	CxxAbb::Sys::AsyncFile::Batch batch;
+	CxxAbb::Buffer<char> buf("abc", 3);
+	batch.Write(0, buf);
+	batch.Fsync();
+	file.Submit(batch);
+	file.Close();
+	ASSERT_EQ (CxxAbb::Sys::AsyncFile::BackendAuto, file.GetBackend());
+
+	// dropped before submit, the future is broken rather than left waiting
+	CxxAbb::Sys::Future<std::size_t> dropped;
+	{
+		CxxAbb::Sys::AsyncFile::Batch unsent;
+		dropped = unsent.Fsync();
+	}
+	ASSERT_THROW (dropped.Get(), CxxAbb::IllegalStateException);
+	std::remove(AsyncPath);
+}
@@ -0,0 +1,244 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BinaryWriterTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : BinaryWriter / BinaryReader unit tests
+ *
+ */
+
+
+
+#include <CxxAbb/BinaryWriter.h>
+#include <CxxAbb/BinaryReader.h>
+#include <CxxAbb/Exception.h>
+
+#include <limits>
+#include <string>
+#include <gtest/gtest.h>
+
+
+TEST(BinaryWriterTest, FixedWidth)
+{
+	CxxAbb::Buffer<char> buffer(4);
+	CxxAbb::BinaryWriter writer(buffer);
+	writer.WriteUInt32(0x01020304);
+	writer.WriteInt16(-2);
+	writer.WriteUInt8(0xAB);
+	writer.WriteBool(true);
+	writer.WriteInt64(-5);
+	writer.WriteUInt64(0x0102030405060708ULL);
+	writer.WriteFloat(1.5f);
+	writer.WriteDouble(-2.25);
+	ASSERT_EQ (4U + 2 + 1 + 1 + 8 + 8 + 4 + 8, writer.Position());
+	ASSERT_EQ (std::string("\x01\x02\x03\x04\xFF\xFE", 6), std::string(buffer.begin(), 6));
+
+	CxxAbb::BinaryReader reader(buffer);
+	ASSERT_EQ (CxxAbb::UInt32(0x01020304), reader.ReadUInt32());
+	ASSERT_EQ (-2, reader.ReadInt16());
+	ASSERT_EQ (0xAB, reader.ReadUInt8());
+	ASSERT_TRUE (reader.ReadBool());
+	ASSERT_EQ (-5, reader.ReadInt64());
+	ASSERT_EQ (0x0102030405060708ULL, reader.ReadUInt64());
+	ASSERT_EQ (1.5f, reader.ReadFloat());
+	ASSERT_EQ (-2.25, reader.ReadDouble());
+	ASSERT_TRUE (reader.AtEnd());
+
+	// little endian on the wire
+	CxxAbb::Buffer<char> little(16);
+	CxxAbb::BinaryWriter littleWriter(little, CxxAbb::ByteOrder::OrderLittleEndian);
+	littleWriter.WriteUInt32(0x01020304);
+	ASSERT_EQ (std::string("\x04\x03\x02\x01", 4), std::string(little.begin(), little.size()));
+	CxxAbb::BinaryReader littleReader(little, CxxAbb::ByteOrder::OrderLittleEndian);
+	ASSERT_EQ (CxxAbb::UInt32(0x01020304), littleReader.ReadUInt32());
+}
+
+TEST(BinaryWriterTest, VarInt)
+{
+	CxxAbb::Buffer<char> buffer(1);
+	CxxAbb::BinaryWriter writer(buffer);
+	writer.WriteVarUInt32(0);
+	writer.WriteVarUInt32(300);
+	writer.WriteVarInt32(-1);
+	writer.WriteVarInt32(1);
+	ASSERT_EQ (std::string("\x00\xAC\x02\x01\x02", 5), std::string(buffer.begin(), buffer.size()));
+
+	writer.WriteVarUInt64(std::numeric_limits<CxxAbb::UInt64>::max());
+	writer.WriteVarInt64(std::numeric_limits<CxxAbb::Int64>::min());
+	writer.WriteVarInt64(std::numeric_limits<CxxAbb::Int64>::max());
+	writer.WriteVarInt32(std::numeric_limits<CxxAbb::Int32>::min());
+	ASSERT_EQ (5U + 10 + 10 + 10 + 5, writer.Position());
+
+	ASSERT_EQ (1U, CxxAbb::BinaryWriter::SizeOfVarUInt(127));
+	ASSERT_EQ (2U, CxxAbb::BinaryWriter::SizeOfVarUInt(128));
+	ASSERT_EQ (10U, CxxAbb::BinaryWriter::SizeOfVarUInt(std::numeric_limits<CxxAbb::UInt64>::max()));
+	ASSERT_EQ (1U, CxxAbb::BinaryWriter::SizeOfVarInt(-64));
+	ASSERT_EQ (2U, CxxAbb::BinaryWriter::SizeOfVarInt(64));
+
+	CxxAbb::BinaryReader reader(buffer);
+	ASSERT_EQ (0U, reader.ReadVarUInt32());
+	ASSERT_EQ (300U, reader.ReadVarUInt32());
+	ASSERT_EQ (-1, reader.ReadVarInt32());
+	ASSERT_EQ (1, reader.ReadVarInt32());
+	ASSERT_EQ (std::numeric_limits<CxxAbb::UInt64>::max(), reader.ReadVarUInt64());
+	ASSERT_EQ (std::numeric_limits<CxxAbb::Int64>::min(), reader.ReadVarInt64());
+	ASSERT_EQ (std::numeric_limits<CxxAbb::Int64>::max(), reader.ReadVarInt64());
+	ASSERT_EQ (std::numeric_limits<CxxAbb::Int32>::min(), reader.ReadVarInt32());
+	ASSERT_TRUE (reader.AtEnd());
+}
+
+TEST(BinaryWriterTest, Blobs)
+{
+	CxxAbb::Buffer<char> buffer(8);
+	CxxAbb::BinaryWriter writer(buffer);
+	writer.WriteString("hello");
+	writer.WriteString("");
+	writer.WriteBlob("\x00\x01", 2);
+	writer.WriteBytes("raw", 3);
+
+	CxxAbb::BinaryReader reader(buffer.begin(), buffer.size());
+	CxxAbb::ByteView hello = reader.ReadStringView();
+	ASSERT_TRUE (hello == "hello");
+	ASSERT_EQ (buffer.begin() + 1, hello.p_Data); // zero copy
+	ASSERT_TRUE (reader.ReadBlobView().Empty());
+	ASSERT_EQ (std::string("\x00\x01", 2), reader.ReadString());
+	char aRaw[3];
+	reader.ReadBytes(aRaw, 3);
+	ASSERT_EQ ("raw", std::string(aRaw, 3));
+	ASSERT_EQ (0U, reader.Remaining());
+}
+
+TEST(BinaryWriterTest, Reserve)
+{
+	const std::string sName = "a name long enough to need growing";
+
+	CxxAbb::Buffer<char> buffer(4);
+	CxxAbb::BinaryWriter writer(buffer);
+	writer.Reserve(4 + 8 + CxxAbb::BinaryWriter::SizeOfString(sName) + CxxAbb::BinaryWriter::SizeOfVarInt(-300));
+	const char * pData = buffer.begin();
+
+	writer.WriteUInt32(7);
+	writer.WriteDouble(0.5);
+	writer.WriteString(sName);
+	writer.WriteVarInt32(-300);
+	ASSERT_EQ (pData, buffer.begin()); // no reallocation after Reserve()
+	ASSERT_EQ (buffer.capacity(), buffer.size());
+
+	// unreserved writes grow geometrically
+	CxxAbb::Buffer<char> grown(1);
+	CxxAbb::BinaryWriter grownWriter(grown);
+	for (int i = 0; i < 1000; ++i)
+		grownWriter.WriteUInt8(static_cast<CxxAbb::UInt8>(i));
+	ASSERT_EQ (1024U, grown.capacity());
+
+	// so do varints, raw bytes, strings and blobs
+	CxxAbb::Buffer<char> bytes(1);
+	CxxAbb::BinaryWriter bytesWriter(bytes);
+	int iReallocs = 0;
+	for (int i = 0; i < 10000; ++i)
+	{
+		const char * pBefore = bytes.begin();
+		switch (i % 4)
+		{
+		case 0:
+			bytesWriter.WriteVarUInt32(static_cast<CxxAbb::UInt32>(i));
+			break;
+		case 1:
+			bytesWriter.WriteBytes("xyz", 3);
+			break;
+		case 2:
+			bytesWriter.WriteString("abc");
+			break;
+		default:
+			bytesWriter.WriteBlob("b", 1);
+			break;
+		}
+		if (bytes.begin() != pBefore)
+			++iReallocs;
+	}
+	ASSERT_GE (20, iReallocs);
+	ASSERT_GE (2 * bytes.size(), bytes.capacity());
+}
+
+TEST(BinaryWriterTest, Limits)
+{
+	CxxAbb::SpanningBuffer<char> spanning(4, 8);
+	CxxAbb::BinaryWriter writer(spanning);
+	writer.WriteUInt32(1);
+	writer.WriteUInt32(2);
+	ASSERT_EQ (8U, spanning.capacity());
+	ASSERT_THROW (writer.WriteUInt8(3), CxxAbb::OutOfMemoryException);
+	ASSERT_EQ (8U, writer.Position());
+
+	CxxAbb::FixedLenBuffer<char> fixed(6);
+	CxxAbb::BinaryWriter fixedWriter(fixed);
+	fixedWriter.WriteUInt32(1);
+	ASSERT_THROW (fixedWriter.WriteString("abc"), CxxAbb::OutOfMemoryException);
+	ASSERT_EQ (4U, fixedWriter.Position());
+	fixedWriter.WriteString("a");
+	ASSERT_EQ (6U, fixedWriter.Position());
+
+	char aExternal[2];
+	CxxAbb::Buffer<char> external(aExternal, sizeof(aExternal));
+	external.size(0);
+	CxxAbb::BinaryWriter externalWriter(external);
+	externalWriter.WriteUInt16(0x0102);
+	ASSERT_EQ (2U, external.max());
+	ASSERT_THROW (externalWriter.WriteUInt8(3), CxxAbb::OutOfMemoryException);
+	ASSERT_EQ ('\x01', aExternal[0]);
+}
+
+TEST(BinaryWriterTest, Malformed)
+{
+	const char aTruncated[] = { 0x00, 0x01, 0x02 };
+	CxxAbb::BinaryReader reader(aTruncated, sizeof(aTruncated));
+	reader.ReadUInt8();
+	ASSERT_THROW (reader.ReadUInt32(), CxxAbb::RangeException);
+	ASSERT_EQ (1U, reader.Position());
+	ASSERT_THROW (reader.Skip(3), CxxAbb::RangeException);
+	ASSERT_EQ (0x0102, reader.ReadUInt16());
+
+	// continuation bit on the last byte
+	const char aUnterminated[] = { char(0x80), char(0x80) };
+	CxxAbb::BinaryReader unterminated(aUnterminated, sizeof(aUnterminated));
+	ASSERT_THROW (unterminated.ReadVarUInt64(), CxxAbb::RangeException);
+	ASSERT_EQ (0U, unterminated.Position());
+
+	// 11 bytes, more than 64 bits
+	const char aLong[] = { char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF),
+		char(0xFF), char(0xFF), char(0xFF), char(0xFF), char(0xFF), 0x01 };
+	CxxAbb::BinaryReader tooLong(aLong, sizeof(aLong));
+	ASSERT_THROW (tooLong.ReadVarUInt64(), CxxAbb::DataFormatException);
+	ASSERT_EQ (0U, tooLong.Position());
+
+	// 2^32 does not fit 32 bits
+	const char aWide[] = { char(0x80), char(0x80), char(0x80), char(0x80), 0x10 };
+	CxxAbb::BinaryReader wide(aWide, sizeof(aWide));
+	ASSERT_THROW (wide.ReadVarUInt32(), CxxAbb::DataFormatException);
+	ASSERT_EQ (0U, wide.Position());
+	ASSERT_EQ (0x100000000ULL, wide.ReadVarUInt64());
+
+	// length prefix beyond the data
+	const char aBlob[] = { 0x05, 'a', 'b' };
+	CxxAbb::BinaryReader blob(aBlob, sizeof(aBlob));
+	ASSERT_THROW (blob.ReadBlobView(), CxxAbb::RangeException);
+	ASSERT_EQ (0U, blob.Position());
+}
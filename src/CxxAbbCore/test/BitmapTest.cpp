@@ -0,0 +1,213 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * BitmapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Bitmap unit tests
+ *
+ */
+
+
+
+#include <CxxAbb/Bitmap.h>
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+struct Collect
+{
+	explicit Collect(std::vector<std::size_t> & _lstBits)
+		: p_Bits(&_lstBits)
+	{}
+
+	void operator()(std::size_t _tBit) const
+	{
+		p_Bits->push_back(_tBit);
+	}
+
+	std::vector<std::size_t> * p_Bits;
+};
+
+/// Reference for the bulk kernels: a plain vector<bool>
+CxxAbb::Bitmap Random(std::size_t _tBits, std::vector<bool> & _lstReference, unsigned int & _uiSeed)
+{
+	CxxAbb::Bitmap bitmap(_tBits);
+	_lstReference.assign(_tBits, false);
+	for (std::size_t i = 0; i < _tBits; ++i)
+	{
+		_uiSeed = _uiSeed * 1103515245 + 12345;
+		if ((_uiSeed >> 16) % 3 == 0)
+		{
+			bitmap.Set(i);
+			_lstReference[i] = true;
+		}
+	}
+	return bitmap;
+}
+
+}
+
+TEST(BitmapTest, Bits)
+{
+	CxxAbb::Bitmap bitmap(130);
+	ASSERT_EQ (130U, bitmap.Size());
+	ASSERT_EQ (3U, bitmap.WordCount());
+	ASSERT_TRUE (bitmap.None());
+	ASSERT_EQ (0U, reinterpret_cast<CxxAbb::UPtrT>(bitmap.Words()) % 64);
+
+	bitmap.Set(0);
+	bitmap.Set(64);
+	bitmap.Set(129);
+	ASSERT_TRUE (bitmap.Test(64));
+	ASSERT_TRUE (bitmap[129]);
+	ASSERT_FALSE (bitmap[128]);
+	ASSERT_EQ (3U, bitmap.Count());
+
+	bitmap.Flip(64);
+	bitmap.Reset(0);
+	bitmap.Assign(5, true);
+	ASSERT_EQ (2U, bitmap.Count());
+	ASSERT_EQ (5U, bitmap.FindFirst());
+	ASSERT_EQ (129U, bitmap.FindNext(6));
+	ASSERT_EQ (CxxAbb::Bitmap::npos, bitmap.FindNext(130));
+
+	bitmap.SetAll();
+	ASSERT_EQ (130U, bitmap.Count());
+	ASSERT_EQ (CxxAbb::Bitmap::npos, bitmap.FindFirstZero());
+	ASSERT_EQ (0U, bitmap.Words()[2] >> 2); // nothing past Size()
+	bitmap.Reset(70);
+	ASSERT_EQ (70U, bitmap.FindFirstZero());
+	ASSERT_EQ (CxxAbb::Bitmap::npos, bitmap.FindNextZero(71));
+
+	bitmap.ResetAll();
+	bitmap.SetRange(3, 3);
+	ASSERT_TRUE (bitmap.None());
+	bitmap.SetRange(3, 7);
+	bitmap.SetRange(60, 129);
+	ASSERT_EQ (4U + 69, bitmap.Count());
+	ASSERT_FALSE (bitmap[129]);
+	ASSERT_TRUE (bitmap[128]);
+	ASSERT_EQ (7U, bitmap.FindNextZero(3));
+
+	std::vector<std::size_t> lstBits;
+	CxxAbb::Bitmap sparse(1000);
+	sparse.Set(1);
+	sparse.Set(63);
+	sparse.Set(640);
+	sparse.Set(999);
+	sparse.ForEach(Collect(lstBits));
+	ASSERT_EQ (4U, lstBits.size());
+	ASSERT_EQ (63U, lstBits[1]);
+	ASSERT_EQ (999U, lstBits[3]);
+
+	CxxAbb::Bitmap empty;
+	ASSERT_EQ (0U, empty.Count());
+	ASSERT_EQ (CxxAbb::Bitmap::npos, empty.FindFirst());
+	ASSERT_EQ (CxxAbb::Bitmap::npos, empty.FindFirstZero());
+}
+
+TEST(BitmapTest, Resize)
+{
+	CxxAbb::Bitmap bitmap(10, true);
+	ASSERT_EQ (10U, bitmap.Count());
+
+	bitmap.Resize(200, true);
+	ASSERT_EQ (200U, bitmap.Count());
+	bitmap.Resize(70);
+	ASSERT_EQ (70U, bitmap.Count());
+	bitmap.Resize(66);
+	ASSERT_EQ (66U, bitmap.Count());
+	bitmap.Resize(100);
+	ASSERT_EQ (66U, bitmap.Count());
+	ASSERT_EQ (66U, bitmap.FindFirstZero());
+
+	CxxAbb::Bitmap copy(bitmap);
+	ASSERT_TRUE (copy == bitmap);
+	copy.Reset(0);
+	ASSERT_TRUE (copy != bitmap);
+	copy = bitmap;
+	ASSERT_TRUE (copy == bitmap);
+
+	CxxAbb::Bitmap other(3);
+	swap(copy, other);
+	ASSERT_EQ (3U, copy.Size());
+	ASSERT_EQ (66U, other.Count());
+}
+
+TEST(BitmapTest, Bulk)
+{
+	for (int k = CxxAbb::Bitmap::KernelScalar; k <= CxxAbb::Bitmap::KernelAvx2; ++k)
+	{
+		CxxAbb::Bitmap::Kernel eKernel = static_cast<CxxAbb::Bitmap::Kernel>(k);
+		if (!CxxAbb::Bitmap::SetKernel(eKernel))
+			continue;
+		ASSERT_EQ (eKernel, CxxAbb::Bitmap::ActiveKernel());
+
+		unsigned int uiSeed = 7;
+		const std::size_t aSizes[] = { 0, 1, 63, 64, 65, 255, 256, 257, 1000, 4099 };
+		for (std::size_t s = 0; s < sizeof(aSizes) / sizeof(aSizes[0]); ++s)
+		{
+			std::size_t tBits = aSizes[s];
+			std::vector<bool> lstA, lstB;
+			CxxAbb::Bitmap a = Random(tBits, lstA, uiSeed);
+			CxxAbb::Bitmap b = Random(tBits + s * 7, lstB, uiSeed); // larger right hand side
+
+			std::size_t tCountA = 0, tCountAnd = 0;
+			for (std::size_t i = 0; i < tBits; ++i)
+			{
+				tCountA += lstA[i];
+				tCountAnd += lstA[i] && lstB[i];
+			}
+			ASSERT_EQ (tCountA, a.Count()) << CxxAbb::Bitmap::KernelName(eKernel) << " " << tBits;
+			ASSERT_EQ (tCountAnd, a.CountAnd(b)) << CxxAbb::Bitmap::KernelName(eKernel) << " " << tBits;
+			ASSERT_EQ (tCountAnd, b.CountAnd(a)) << CxxAbb::Bitmap::KernelName(eKernel) << " " << tBits;
+
+			CxxAbb::Bitmap andResult(a), orResult(a), andNotResult(a), xorResult(a);
+			andResult &= b;
+			orResult |= b;
+			andNotResult.AndNot(b);
+			xorResult ^= b;
+			ASSERT_EQ (tBits, orResult.Size());
+			for (std::size_t i = 0; i < tBits; ++i)
+			{
+				ASSERT_EQ (lstA[i] && lstB[i], andResult[i]);
+				ASSERT_EQ (lstA[i] || lstB[i], orResult[i]);
+				ASSERT_EQ (lstA[i] && !lstB[i], andNotResult[i]);
+				ASSERT_EQ (lstA[i] != lstB[i], xorResult[i]);
+			}
+			// the tail past Size() stays clear
+			ASSERT_EQ (CxxAbb::Bitmap::npos, orResult.FindNext(tBits));
+			ASSERT_EQ (orResult.Count(), andResult.Count() + xorResult.Count());
+		}
+
+		// smaller right hand side: missing bits are 0
+		CxxAbb::Bitmap big(300, true);
+		CxxAbb::Bitmap small(100, true);
+		ASSERT_EQ (100U, CxxAbb::Bitmap(big).And(small).Count());
+		ASSERT_EQ (200U, CxxAbb::Bitmap(big).AndNot(small).Count());
+	}
+	ASSERT_TRUE (CxxAbb::Bitmap::SetKernel(CxxAbb::Bitmap::KernelAuto));
+}
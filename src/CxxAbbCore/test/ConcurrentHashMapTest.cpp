@@ -0,0 +1,277 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ConcurrentHashMapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : ConcurrentHashMap and RWSpinLock unit tests
+ *
+ */
+
+
+#include <CxxAbb/Sys/ConcurrentHashMap.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <gtest/gtest.h>
+#include <string>
+
+
+namespace
+{
+
+typedef CxxAbb::Sys::ConcurrentHashMap<int, int> IntMap;
+
+CxxAbb::Sys::Atomic<int> g_FactoryCalls(0);
+
+struct CountingFactory
+{
+	int i_Value;
+
+	explicit CountingFactory(int _iValue) : i_Value(_iValue)
+	{}
+
+	int * operator ()() const
+	{
+		g_FactoryCalls.FetchAdd(1);
+		return new int(i_Value);
+	}
+};
+
+/// Factory that looks up and fills another key of the same map, which needs the shard lock free
+struct NestedFactory
+{
+	IntMap * p_Map;
+
+	explicit NestedFactory(IntMap * _pMap) : p_Map(_pMap)
+	{}
+
+	int * operator ()() const
+	{
+		return new int(*p_Map->ComputeIfAbsent(-1, CountingFactory(5)) + 1);
+	}
+};
+
+struct ComputeArgs
+{
+	IntMap * p_Map;
+	IntMap::ValuePtr a_Seen[1000];
+};
+
+void ComputeAll(void * _pArgs)
+{
+	ComputeArgs & args = *static_cast<ComputeArgs*>(_pArgs);
+	for (int i = 0; i < 1000; ++i)
+		args.a_Seen[i] = args.p_Map->ComputeIfAbsent(i, CountingFactory(i * 2));
+}
+
+void ReadWrite(void * _pMap)
+{
+	IntMap & map = *static_cast<IntMap*>(_pMap);
+	IntMap::ValuePtr value;
+	for (int i = 0; i < 20000; ++i)
+	{
+		int iKey = (i * 7919) % 512;
+		if (i % 10 == 0)
+			map.InsertOrAssign(iKey, new int(iKey));
+		else if (i % 10 == 1)
+			map.Erase(iKey);
+		else if (map.Find(iKey, value))
+		{
+			ASSERT_EQ (iKey, *value);
+		}
+	}
+}
+
+struct LockArgs
+{
+	CxxAbb::Sys::RWSpinLock m_Lock;
+	int i_First;
+	int i_Second;
+	bool b_Torn;
+};
+
+void LockReadWrite(void * _pArgs)
+{
+	LockArgs & args = *static_cast<LockArgs*>(_pArgs);
+	for (int i = 0; i < 20000; ++i)
+	{
+		if (i % 4 == 0)
+		{
+			CxxAbb::Sys::RWSpinLock::ScopedLock lock(args.m_Lock);
+			++args.i_First;
+			++args.i_Second;
+		}
+		else
+		{
+			CxxAbb::Sys::RWSpinLock::ScopedReadLock lock(args.m_Lock);
+			if (args.i_First != args.i_Second)
+				args.b_Torn = true;
+		}
+	}
+}
+
+struct SumValues
+{
+	int * p_Sum;
+
+	explicit SumValues(int * _pSum) : p_Sum(_pSum)
+	{}
+
+	void operator ()(const int & _iKey, const IntMap::ValuePtr & _value) const
+	{
+		*p_Sum += _iKey + *_value;
+	}
+};
+
+}
+
+TEST(ConcurrentHashMapTest, Basic)
+{
+	IntMap map(3);
+	ASSERT_EQ (4U, map.ShardCount());
+	ASSERT_EQ (0U, map.Size());
+
+	for (int i = 0; i < 100; ++i)
+		ASSERT_TRUE (map.InsertOrAssign(i, new int(i * 10)));
+	ASSERT_EQ (100U, map.Size());
+	ASSERT_FALSE (map.InsertOrAssign(5, IntMap::ValuePtr(new int(-5))));
+	ASSERT_EQ (100U, map.Size());
+
+	IntMap::ValuePtr value;
+	ASSERT_TRUE (map.Find(5, value));
+	ASSERT_EQ (-5, *value);
+	ASSERT_TRUE (map.Find(42, value));
+	ASSERT_EQ (420, *value);
+	ASSERT_FALSE (map.Find(100, value));
+	ASSERT_EQ (420, *value);
+
+	ASSERT_TRUE (map.Contains(99));
+	ASSERT_TRUE (map.Erase(99));
+	ASSERT_FALSE (map.Erase(99));
+	ASSERT_FALSE (map.Contains(99));
+	ASSERT_EQ (99U, map.Size());
+
+	int iSum = 0;
+	map.ForEach(SumValues(&iSum));
+	ASSERT_EQ (99 * 98 / 2 + 98 * 99 / 2 * 10 - 50 - 5, iSum);
+
+	map.Clear();
+	ASSERT_EQ (0U, map.Size());
+	ASSERT_FALSE (map.Contains(1));
+
+	CxxAbb::Sys::ConcurrentHashMap<std::string, std::string> names;
+	ASSERT_LE (1U, names.ShardCount());
+	names.InsertOrAssign("key", new std::string("value"));
+	CxxAbb::Sys::ConcurrentHashMap<std::string, std::string>::ValuePtr name;
+	ASSERT_TRUE (names.Find("key", name));
+	ASSERT_EQ ("value", *name);
+}
+
+TEST(ConcurrentHashMapTest, ValueOutlivesErase)
+{
+	IntMap map;
+	map.InsertOrAssign(1, new int(11));
+
+	IntMap::ValuePtr value;
+	ASSERT_TRUE (map.Find(1, value));
+	ASSERT_EQ (2U, value.refCount());
+	map.InsertOrAssign(1, new int(12));
+	ASSERT_EQ (1U, value.refCount());
+	ASSERT_EQ (11, *value);
+
+	ASSERT_TRUE (map.Find(1, value));
+	map.Erase(1);
+	ASSERT_EQ (12, *value);
+}
+
+TEST(ConcurrentHashMapTest, ComputeIfAbsent)
+{
+	IntMap map;
+	g_FactoryCalls.Store(0);
+	ASSERT_EQ (6, *map.ComputeIfAbsent(3, CountingFactory(6)));
+	ASSERT_EQ (6, *map.ComputeIfAbsent(3, CountingFactory(7)));
+	ASSERT_EQ (1, g_FactoryCalls.Load());
+
+	IntMap single(1);
+	ASSERT_EQ (6, *single.ComputeIfAbsent(4, NestedFactory(&single)));
+	ASSERT_EQ (2U, single.Size());
+	map.Clear();
+	g_FactoryCalls.Store(0);
+
+	ComputeArgs * pArgs = new ComputeArgs[4];
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		pArgs[i].p_Map = &map;
+		threads[i].Start(ComputeAll, &pArgs[i]);
+	}
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+
+	// Racing misses may each build a value, only one of them is kept
+	ASSERT_LE (1000, g_FactoryCalls.Load());
+	ASSERT_GE (4000, g_FactoryCalls.Load());
+	ASSERT_EQ (1000U, map.Size());
+	for (int i = 0; i < 1000; ++i)
+	{
+		ASSERT_EQ (i * 2, *pArgs[0].a_Seen[i]);
+		for (int j = 1; j < 4; ++j)
+			ASSERT_EQ (pArgs[0].a_Seen[i].get(), pArgs[j].a_Seen[i].get());
+	}
+	delete [] pArgs;
+}
+
+TEST(ConcurrentHashMapTest, Threads)
+{
+	IntMap map(8);
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+		threads[i].Start(ReadWrite, &map);
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+
+	ASSERT_GE (512U, map.Size());
+	IntMap::ValuePtr value;
+	for (int i = 0; i < 512; ++i)
+	{
+		if (map.Find(i, value))
+		{
+			ASSERT_EQ (i, *value);
+		}
+	}
+}
+
+TEST(ConcurrentHashMapTest, RWSpinLock)
+{
+	LockArgs args;
+	args.i_First = 0;
+	args.i_Second = 0;
+	args.b_Torn = false;
+
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+		threads[i].Start(LockReadWrite, &args);
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+
+	ASSERT_EQ (4 * 5000, args.i_First);
+	ASSERT_EQ (args.i_First, args.i_Second);
+	ASSERT_FALSE (args.b_Torn);
+}
@@ -35,6 +35,7 @@
 #include <CxxAbb/NullType.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <typeinfo>
 #include <gtest/gtest.h>
 
@@ -547,6 +548,80 @@ TEST(CoreTest, SwapByteOrder)
 
 }
 
+namespace
+{
+
+/// Every kernel this CPU has, on every length up to a few vectors and on unaligned arrays
+template <typename T>
+void CheckSwabArray()
+{
+	const std::size_t tMax = 200;
+	T aSource[tMax + 1];
+	T aExpected[tMax + 1];
+	T aOutput[tMax + 2];
+	for (std::size_t i = 0; i <= tMax; ++i)
+	{
+		aSource[i] = static_cast<T>(0x0102030405060708ULL * (i + 1) + i);
+		aExpected[i] = CxxAbb::Swab(aSource[i]);
+	}
+
+	for (int k = CxxAbb::ByteOrder::KernelScalar; k <= CxxAbb::ByteOrder::KernelAvx2; ++k)
+	{
+		CxxAbb::ByteOrder::Kernel eKernel = static_cast<CxxAbb::ByteOrder::Kernel>(k);
+		if (!CxxAbb::ByteOrder::SetKernel(eKernel))
+			continue;
+		ASSERT_EQ (eKernel, CxxAbb::ByteOrder::ActiveKernel());
+
+		for (std::size_t tCount = 0; tCount <= tMax; ++tCount)
+		{
+			// misaligned source and destination, guard element after the end
+			std::memset(aOutput, 0, sizeof(aOutput));
+			const T * pSource = aSource + (tCount % 2);
+			CxxAbb::SwabArray(pSource, aOutput + 1, tCount);
+			for (std::size_t i = 0; i < tCount; ++i)
+				ASSERT_EQ (aExpected[i + tCount % 2], aOutput[i + 1]) << CxxAbb::ByteOrder::KernelName(eKernel) << " " << tCount;
+			ASSERT_EQ (T(0), aOutput[tCount + 1]);
+
+			CxxAbb::SwabArray(aOutput + 1, tCount);
+			ASSERT_EQ (0, std::memcmp(pSource, aOutput + 1, tCount * sizeof(T))) << CxxAbb::ByteOrder::KernelName(eKernel) << " " << tCount;
+		}
+	}
+	ASSERT_TRUE (CxxAbb::ByteOrder::SetKernel(CxxAbb::ByteOrder::KernelAuto));
+}
+
+}
+
+TEST(CoreTest, SwapByteOrderArray)
+{
+	COUT_LOG() << "ByteOrder kernel : " << CxxAbb::ByteOrder::KernelName(CxxAbb::ByteOrder::ActiveKernel());
+	ASSERT_TRUE (CxxAbb::ByteOrder::KernelSupported(CxxAbb::ByteOrder::KernelScalar));
+	ASSERT_NE (CxxAbb::ByteOrder::KernelAuto, CxxAbb::ByteOrder::ActiveKernel());
+
+	CheckSwabArray<CxxAbb::UInt16>();
+	CheckSwabArray<CxxAbb::Int16>();
+	CheckSwabArray<CxxAbb::UInt32>();
+	CheckSwabArray<CxxAbb::Int32>();
+	CheckSwabArray<CxxAbb::UInt64>();
+	CheckSwabArray<CxxAbb::Int64>();
+
+	CxxAbb::UInt8 aBytes[3] = { 1, 2, 3 };
+	CxxAbb::SwabArray(aBytes, 3);
+	ASSERT_EQ (2, aBytes[1]);
+
+	CxxAbb::UInt32 aWire[5] = { 1, 2, 3, 4, 5 };
+	CxxAbb::ByteOrder::HostToNetwork(aWire, 5);
+	ASSERT_EQ (CxxAbb::ByteOrder::HostToNetwork(CxxAbb::UInt32(5)), aWire[4]);
+
+	CxxAbb::Buffer<CxxAbb::UInt32> buffer(8);
+	buffer.assign(aWire, 5);
+	CxxAbb::ByteOrder::NetworkToHost(buffer);
+	ASSERT_EQ (CxxAbb::UInt32(1), buffer.begin()[0]);
+	ASSERT_EQ (CxxAbb::UInt32(5), buffer.begin()[4]);
+
+	CxxAbb::SwabArray(buffer);
+	ASSERT_EQ (CxxAbb::Swab(CxxAbb::UInt32(3)), buffer.begin()[2]);
+}
+
 TEST(CoreTest, TypeInfo)
 {
 	CxxAbb::Int32 i1 = 10;
@@ -703,6 +778,54 @@ void func (int)
 }
 
 using CxxAbb::NullPtr;
+TEST(CoreTest, BitIntrinsics)
+{
+	ASSERT_EQ (0U, CxxAbb::Popcount(CxxAbb::UInt32(0)));
+	ASSERT_EQ (8U, CxxAbb::Popcount(CxxAbb::UInt8(0xFF)));
+	ASSERT_EQ (16U, CxxAbb::Popcount(CxxAbb::UInt16(0xFFFF)));
+	ASSERT_EQ (3U, CxxAbb::Popcount(CxxAbb::UInt32(0x80000101)));
+	ASSERT_EQ (64U, CxxAbb::Popcount(~CxxAbb::UInt64(0)));
+
+	ASSERT_EQ (8U, CxxAbb::CountLeadingZeros(CxxAbb::UInt8(0)));
+	ASSERT_EQ (7U, CxxAbb::CountLeadingZeros(CxxAbb::UInt8(1)));
+	ASSERT_EQ (15U, CxxAbb::CountLeadingZeros(CxxAbb::UInt16(1)));
+	ASSERT_EQ (0U, CxxAbb::CountLeadingZeros(CxxAbb::UInt32(0x80000000)));
+	ASSERT_EQ (32U, CxxAbb::CountLeadingZeros(CxxAbb::UInt32(0)));
+	ASSERT_EQ (63U, CxxAbb::CountLeadingZeros(CxxAbb::UInt64(1)));
+	ASSERT_EQ (64U, CxxAbb::CountLeadingZeros(CxxAbb::UInt64(0)));
+
+	ASSERT_EQ (8U, CxxAbb::CountTrailingZeros(CxxAbb::UInt8(0)));
+	ASSERT_EQ (7U, CxxAbb::CountTrailingZeros(CxxAbb::UInt8(0x80)));
+	ASSERT_EQ (4U, CxxAbb::CountTrailingZeros(CxxAbb::UInt32(0x30)));
+	ASSERT_EQ (63U, CxxAbb::CountTrailingZeros(CxxAbb::UInt64(1) << 63));
+	ASSERT_EQ (64U, CxxAbb::CountTrailingZeros(CxxAbb::UInt64(0)));
+
+	ASSERT_EQ (CxxAbb::UInt8(0x03), CxxAbb::RotateLeft(CxxAbb::UInt8(0x81), 1));
+	ASSERT_EQ (CxxAbb::UInt16(0x2001), CxxAbb::RotateRight(CxxAbb::UInt16(0x0012), 4));
+	ASSERT_EQ (CxxAbb::UInt32(0x23456781), CxxAbb::RotateLeft(CxxAbb::UInt32(0x12345678), 4));
+	ASSERT_EQ (CxxAbb::UInt32(0x12345678), CxxAbb::RotateLeft(CxxAbb::UInt32(0x12345678), 32));
+	ASSERT_EQ (CxxAbb::UInt64(1), CxxAbb::RotateLeft(CxxAbb::UInt64(1) << 63, 1));
+	ASSERT_EQ (CxxAbb::UInt64(1) << 63, CxxAbb::RotateRight(CxxAbb::UInt64(1), 1));
+
+	ASSERT_EQ (1U, CxxAbb::NextPow2(0U));
+	ASSERT_EQ (1U, CxxAbb::NextPow2(1U));
+	ASSERT_EQ (2U, CxxAbb::NextPow2(2U));
+	ASSERT_EQ (4U, CxxAbb::NextPow2(3U));
+	ASSERT_EQ (1024U, CxxAbb::NextPow2(1000U));
+	ASSERT_EQ (0x80000000U, CxxAbb::NextPow2(0x7FFFFFFFU));
+	ASSERT_EQ (0U, CxxAbb::NextPow2(0x80000001U));
+	ASSERT_EQ (CxxAbb::UInt8(128), CxxAbb::NextPow2(CxxAbb::UInt8(100)));
+	ASSERT_EQ (CxxAbb::UInt8(0), CxxAbb::NextPow2(CxxAbb::UInt8(200)));
+	ASSERT_EQ (CxxAbb::UInt64(1) << 40, CxxAbb::NextPow2((CxxAbb::UInt64(1) << 40) - 5));
+
+	ASSERT_TRUE (CxxAbb::IsPow2(64U));
+	ASSERT_FALSE (CxxAbb::IsPow2(0U));
+	ASSERT_FALSE (CxxAbb::IsPow2(96U));
+	ASSERT_EQ (0U, CxxAbb::Log2Floor(1U));
+	ASSERT_EQ (9U, CxxAbb::Log2Floor(1023U));
+	ASSERT_EQ (63U, CxxAbb::Log2Floor(~CxxAbb::UInt64(0)));
+}
+
 TEST(CoreTest, NullPtrTest)
 {
 	char * ch = NullPtr;        // ok
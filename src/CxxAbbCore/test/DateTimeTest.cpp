@@ -90,6 +90,20 @@ TEST(DateTimeTest, Timestamp)
 	ASSERT_TRUE (now.IsElapsed(200000));
 	ASSERT_TRUE (!now.IsElapsed(2000000));
 
+	Timestamp coarse(0);
+	coarse.NowCoarse();
+	now.Now();
+	// the coarse clock is read from a different source and lags by up to a tick,
+	// so only a window around Now() is checked, not the order
+	ASSERT_TRUE (coarse - now < 10000);
+	ASSERT_TRUE (now - coarse < 50000);
+
+	Timestamp::TimeVal tMono = Timestamp::MonotonicCoarse();
+	usleep(51000);
+	Timestamp::TimeDiff tMonoDiff = Timestamp::MonotonicCoarse() - tMono;
+	ASSERT_TRUE (tMonoDiff >= 40000);
+	ASSERT_TRUE (tMonoDiff < 2000000);
+
 	/// timestamp performance test
 //	for(int i=0; i<10; ++i)
 //	{
@@ -27,9 +27,38 @@
 
 
 #include <CxxAbb/Sys/Environment.h>
+#include <CxxAbb/Sys/Thread.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
 #include <gtest/gtest.h>
 
 
+namespace
+{
+
+/// Create _sRoot/_sPath with its directories
+void WriteFile(const std::string & _sRoot, const std::string & _sPath, const std::string & _sContent)
+{
+	std::string sFull = _sRoot + "/" + _sPath;
+	for (std::string::size_type tPos = sFull.find('/', 1); tPos != std::string::npos; tPos = sFull.find('/', tPos + 1))
+		::mkdir(sFull.substr(0, tPos).c_str(), 0755);
+	std::ofstream file(sFull.c_str());
+	file << _sContent << "\n";
+}
+
+/// Reads the snapshot on a thread of its own, whose reference is dropped when it exits
+void ReadSnapshot(void * _pGeneration)
+{
+	*static_cast<CxxAbb::UInt64*>(_pGeneration) = CxxAbb::Sys::Environment::Snapshot()->Generation();
+}
+
+}
+
+
 TEST(EnvironmentTest, Details)
 {
 	COUT_LOG() << "CxxAbb Version:  " << CxxAbb::Sys::Environment::LibraryVersionString();
@@ -39,6 +68,7 @@ TEST(EnvironmentTest, Details)
 	COUT_LOG() << "Node Name:       " << CxxAbb::Sys::Environment::HostName();
 	COUT_LOG() << "Node ID:         " << CxxAbb::Sys::Environment::EthernetAddress();
 	COUT_LOG() << "Number of CPUs:  " << CxxAbb::Sys::Environment::ProcessorCount();
+	COUT_LOG() << "Effective CPUs:  " << CxxAbb::Sys::Environment::EffectiveProcessorCount();
 }
 
 TEST(EnvironmentTest, Variables)
@@ -63,4 +93,174 @@ TEST(EnvironmentTest, Variables)
 	COUT_LOG() << "Path Env : " << sPath;
 }
 
+TEST(EnvironmentTest, TryGet)
+{
+	::setenv("MY_TESTING_TRY_ENV", "MY_TESTING_VAL", 1);
+	CxxAbb::Result<std::string> value = CxxAbb::Sys::Environment::TryGet("MY_TESTING_TRY_ENV");
+	ASSERT_TRUE (value.IsOk());
+	ASSERT_EQ ("MY_TESTING_VAL", value.Value());
+
+	CxxAbb::Result<std::string> missing = CxxAbb::Sys::Environment::TryGet("NON_EXISTING_TRY_ENV_VAR");
+	ASSERT_TRUE (missing.IsError());
+	ASSERT_EQ (ENOENT, missing.Error());
+	ASSERT_EQ ("fallback", missing.Value("fallback"));
+}
+
  
+TEST(EnvironmentTest, Snapshot)
+{
+	typedef CxxAbb::Sys::EnvironmentSnapshot::Ptr SnapshotPtr;
+
+	SnapshotPtr ptrFirst = CxxAbb::Sys::Environment::Snapshot();
+	ASSERT_TRUE (ptrFirst == CxxAbb::Sys::Environment::Snapshot());
+	ASSERT_EQ (CxxAbb::Sys::Environment::HostName(), ptrFirst->HostName());
+	ASSERT_EQ (CxxAbb::Sys::Environment::OsName(), ptrFirst->OsName());
+	ASSERT_EQ (17U, ptrFirst->EthernetAddress().size());
+	ASSERT_EQ (CxxAbb::Sys::Environment::EthernetAddress(), ptrFirst->EthernetAddress());
+	ASSERT_EQ (CxxAbb::Sys::Environment::ProcessorCount(), ptrFirst->ProcessorCount());
+
+	const CxxAbb::Sys::EnvironmentSnapshot::VariableList & lstVariables = ptrFirst->Variables();
+	for (std::size_t i = 1; i < lstVariables.size(); ++i)
+		ASSERT_LT (lstVariables[i - 1].first, lstVariables[i].first);
+
+	// Set() publishes a new snapshot, the old one is left as it was
+	CxxAbb::Sys::Environment::Set("MY_TESTING_SNAPSHOT_ENV", "one");
+	ASSERT_EQ ("one", CxxAbb::Sys::Environment::Get("MY_TESTING_SNAPSHOT_ENV"));
+	SnapshotPtr ptrSecond = CxxAbb::Sys::Environment::Snapshot();
+	ASSERT_TRUE (ptrFirst != ptrSecond);
+	ASSERT_LT (ptrFirst->Generation(), ptrSecond->Generation());
+	ASSERT_EQ ("one", ptrSecond->Get("MY_TESTING_SNAPSHOT_ENV"));
+	ASSERT_FALSE (ptrFirst->Has("MY_TESTING_SNAPSHOT_ENV"));
+	ASSERT_EQ (ptrFirst->HostName(), ptrSecond->HostName());
+
+	// replaced and dropped by every reader, only this Ptr is left
+	ASSERT_EQ (1U, ptrFirst->refCount());
+
+	const std::string & sOne = ptrSecond->Get("MY_TESTING_SNAPSHOT_ENV");
+	CxxAbb::Sys::Environment::Set("MY_TESTING_SNAPSHOT_ENV", "two");
+	ASSERT_EQ ("one", sOne);
+	ASSERT_EQ ("two", *CxxAbb::Sys::Environment::Snapshot()->Find("MY_TESTING_SNAPSHOT_ENV"));
+
+	// ::setenv bypasses Set(), seen after Refresh()
+	::setenv("MY_TESTING_SNAPSHOT_RAW", "raw", 1);
+	ASSERT_TRUE (CxxAbb::Sys::Environment::Snapshot()->Find("MY_TESTING_SNAPSHOT_RAW") == CxxAbb::NullPtr);
+	ASSERT_EQ ("fallback", CxxAbb::Sys::Environment::Snapshot()->Get("MY_TESTING_SNAPSHOT_RAW", "fallback"));
+	ASSERT_THROW (CxxAbb::Sys::Environment::Snapshot()->Get("MY_TESTING_SNAPSHOT_RAW"), CxxAbb::NotFoundException);
+	CxxAbb::Sys::Environment::Refresh();
+	ASSERT_EQ ("raw", CxxAbb::Sys::Environment::Snapshot()->Get("MY_TESTING_SNAPSHOT_RAW"));
+	ASSERT_EQ ("two", CxxAbb::Sys::Environment::Snapshot()->Get("MY_TESTING_SNAPSHOT_ENV"));
+
+	// a thread's reference is dropped when it exits
+	SnapshotPtr ptrCurrent = CxxAbb::Sys::Environment::Snapshot();
+	CxxAbb::UInt64 uiGeneration = 0;
+	CxxAbb::Sys::Thread thread;
+	thread.Start(ReadSnapshot, &uiGeneration);
+	thread.Join();
+	ASSERT_EQ (ptrCurrent->Generation(), uiGeneration);
+	CxxAbb::Sys::Environment::Refresh();
+	CxxAbb::Sys::Environment::Snapshot();
+	ASSERT_EQ (1U, ptrCurrent->refCount());
+}
+
+TEST(EnvironmentTest, HostTopology)
+{
+	const CxxAbb::Sys::CpuTopology & topology = CxxAbb::Sys::Environment::Topology();
+	ASSERT_EQ (&topology, &CxxAbb::Sys::Environment::Topology());
+
+	ASSERT_FALSE (topology.lst_OnlineCpus.empty());
+	ASSERT_LE (1, topology.i_PhysicalCores);
+	ASSERT_LE (1, topology.i_Packages);
+	ASSERT_LE (1, topology.i_ThreadsPerCore);
+	ASSERT_LT (0U, topology.t_CacheLineSize);
+	ASSERT_FALSE (topology.lst_Nodes.empty());
+	ASSERT_FALSE (topology.lst_AllowedCpus.empty());
+	ASSERT_LE (1U, CxxAbb::Sys::Environment::EffectiveProcessorCount());
+	ASSERT_LE (CxxAbb::Sys::Environment::EffectiveProcessorCount(), topology.lst_OnlineCpus.size());
+	ASSERT_TRUE (topology.NodeOf(topology.lst_OnlineCpus.front()) != CxxAbb::NullPtr);
+}
+
+TEST(EnvironmentTest, ReadTopology)
+{
+	// 4 logical CPUs on 2 SMT cores, 2 NUMA nodes, in a cgroup v2 container
+	std::string sRoot = "/tmp/CxxAbbTopologyTest";
+	std::string sCpu = "sys/devices/system/cpu/";
+	WriteFile(sRoot, sCpu + "online", "0-3");
+	for (int i = 0; i < 4; ++i)
+	{
+		std::string sDir = sCpu + "cpu" + static_cast<char>('0' + i) + "/topology/";
+		WriteFile(sRoot, sDir + "physical_package_id", "0");
+		WriteFile(sRoot, sDir + "core_id", i % 2 ? "1" : "0");
+		WriteFile(sRoot, sDir + "thread_siblings_list", i % 2 ? "1,3" : "0,2");
+	}
+	WriteFile(sRoot, sCpu + "cpu0/cache/index0/level", "1");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index0/type", "Data");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index0/size", "48K");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index0/coherency_line_size", "64");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index0/ways_of_associativity", "12");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index0/shared_cpu_list", "0,2");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index1/level", "1");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index1/type", "Instruction");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index1/size", "32K");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index2/level", "3");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index2/type", "Unified");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index2/size", "8M");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index2/coherency_line_size", "128");
+	WriteFile(sRoot, sCpu + "cpu0/cache/index2/shared_cpu_list", "0-3");
+	WriteFile(sRoot, "sys/devices/system/node/online", "0-1");
+	WriteFile(sRoot, "sys/devices/system/node/node0/cpulist", "0-1");
+	WriteFile(sRoot, "sys/devices/system/node/node0/meminfo", "Node 0 MemTotal:       1024 kB\nNode 0 MemFree:        512 kB");
+	WriteFile(sRoot, "sys/devices/system/node/node1/cpulist", "2-3");
+	WriteFile(sRoot, "sys/devices/system/node/node1/meminfo", "Node 1 MemTotal:       2048 kB");
+	WriteFile(sRoot, "proc/self/cgroup", "0::/app");
+	WriteFile(sRoot, "sys/fs/cgroup/app/cpu.max", "150000 100000");
+	WriteFile(sRoot, "sys/fs/cgroup/app/cpuset.cpus.effective", "1-3");
+
+	CxxAbb::Sys::CpuTopology topology;
+	CxxAbb::Sys::Environment::ReadTopology(topology, sRoot);
+
+	ASSERT_EQ (4U, topology.lst_OnlineCpus.size());
+	ASSERT_EQ (2, topology.i_PhysicalCores);
+	ASSERT_EQ (1, topology.i_Packages);
+	ASSERT_EQ (2, topology.i_ThreadsPerCore);
+	ASSERT_EQ (topology.lst_CoreOf[0], topology.lst_CoreOf[2]);
+	ASSERT_NE (topology.lst_CoreOf[0], topology.lst_CoreOf[1]);
+	ASSERT_EQ (2U, topology.lst_Siblings[3].size());
+	ASSERT_EQ (1, topology.lst_Siblings[3][0]);
+
+	ASSERT_EQ (3U, topology.lst_Caches.size());
+	ASSERT_EQ (48U * 1024, topology.Cache(1)->t_Size);
+	ASSERT_EQ ("Data", topology.Cache(1)->s_Type);
+	ASSERT_EQ (12, topology.Cache(1)->i_Ways);
+	ASSERT_EQ (8U * 1024 * 1024, topology.Cache(3)->t_Size);
+	ASSERT_EQ (4U, topology.Cache(3)->lst_SharedCpus.size());
+	ASSERT_TRUE (topology.Cache(2) == CxxAbb::NullPtr);
+	ASSERT_EQ (64U, topology.t_CacheLineSize);
+
+	ASSERT_EQ (2U, topology.lst_Nodes.size());
+	ASSERT_EQ (1024U * 1024, topology.lst_Nodes[0].ui_MemoryBytes);
+	ASSERT_EQ (1, topology.NodeOf(3)->i_Id);
+
+	ASSERT_EQ (3U, topology.lst_AllowedCpus.size());
+	ASSERT_EQ (1, topology.lst_AllowedCpus[0]);
+	ASSERT_DOUBLE_EQ (1.5, topology.d_QuotaCpus);
+	ASSERT_EQ (2, topology.i_EffectiveCpus);
+
+	// cgroup v1, no quota, no NUMA
+	std::string sRootV1 = "/tmp/CxxAbbTopologyTestV1";
+	WriteFile(sRootV1, sCpu + "online", "0-7");
+	WriteFile(sRootV1, "proc/self/cgroup", "4:cpuset:/\n3:cpu,cpuacct:/");
+	WriteFile(sRootV1, "sys/fs/cgroup/cpu,cpuacct/cpu.cfs_quota_us", "-1");
+	WriteFile(sRootV1, "sys/fs/cgroup/cpu,cpuacct/cpu.cfs_period_us", "100000");
+	WriteFile(sRootV1, "sys/fs/cgroup/cpuset/cpuset.cpus", "0-5");
+
+	CxxAbb::Sys::Environment::ReadTopology(topology, sRootV1);
+	ASSERT_EQ (8U, topology.lst_OnlineCpus.size());
+	ASSERT_EQ (8, topology.i_PhysicalCores);
+	ASSERT_EQ (1, topology.i_ThreadsPerCore);
+	ASSERT_EQ (1U, topology.lst_Nodes.size());
+	ASSERT_EQ (8U, topology.lst_Nodes[0].lst_Cpus.size());
+	ASSERT_EQ (0.0, topology.d_QuotaCpus);
+	ASSERT_EQ (6, topology.i_EffectiveCpus);
+
+	std::system(("rm -rf " + sRoot + " " + sRootV1).c_str());
+}
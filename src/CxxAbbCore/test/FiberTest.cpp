@@ -0,0 +1,426 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * FiberTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Fiber
+ * Comment     : Fiber scheduler unit tests
+ *
+ */
+
+
+#include <CxxAbb/Fiber/Scheduler.h>
+#include <CxxAbb/Fiber/StackPool.h>
+#include <CxxAbb/Fiber/Mutex.h>
+#include <CxxAbb/Fiber/SigEvent.h>
+#include <CxxAbb/Fiber/WaitCondition.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/Future.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Timestamp.h>
+
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+CxxAbb::Sys::Atomic<int> g_Counter(0);
+
+class CountTask: public CxxAbb::Runnable
+{
+public:
+	void Run()
+	{
+		g_Counter.FetchAdd(1);
+	}
+};
+
+class YieldTask: public CxxAbb::Runnable
+{
+public:
+	YieldTask(std::vector<int> & _trace, int _iId)
+		: m_Trace(_trace), i_Id(_iId)
+	{
+	}
+
+	void Run()
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			m_Trace.push_back(i_Id);
+			CxxAbb::Fiber::Scheduler::Yield();
+		}
+	}
+
+private:
+	std::vector<int> & m_Trace;
+	int i_Id;
+};
+
+class LockTask: public CxxAbb::Runnable
+{
+public:
+	LockTask(CxxAbb::Fiber::FastMutex & _mutex, int & _iShared)
+		: m_Mutex(_mutex), i_Shared(_iShared)
+	{
+	}
+
+	void Run()
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			CxxAbb::Fiber::FastMutex::ScopedLock lock(m_Mutex);
+			int iValue = i_Shared;
+			CxxAbb::Fiber::Scheduler::Yield();
+			i_Shared = iValue + 1;
+		}
+	}
+
+private:
+	CxxAbb::Fiber::FastMutex & m_Mutex;
+	int & i_Shared;
+};
+
+class EventTask: public CxxAbb::Runnable
+{
+public:
+	EventTask(CxxAbb::Fiber::SigEvent & _wait, CxxAbb::Fiber::SigEvent * _pDone)
+		: m_Wait(_wait), p_Done(_pDone)
+	{
+	}
+
+	void Run()
+	{
+		m_Wait.Wait();
+		g_Counter.FetchAdd(1);
+		if (p_Done)
+			p_Done->Set();
+	}
+
+private:
+	CxxAbb::Fiber::SigEvent & m_Wait;
+	CxxAbb::Fiber::SigEvent * p_Done;
+};
+
+class TimeoutTask: public CxxAbb::Runnable
+{
+public:
+	TimeoutTask(bool & _bResult, CxxAbb::Timestamp::TimeDiff & _tElapsed)
+		: b_Result(_bResult), t_Elapsed(_tElapsed)
+	{
+	}
+
+	void Run()
+	{
+		CxxAbb::Fiber::SigEvent event;
+		CxxAbb::Timestamp start;
+		b_Result = event.TryWait(50);
+		t_Elapsed = start.Elapsed();
+	}
+
+private:
+	bool & b_Result;
+	CxxAbb::Timestamp::TimeDiff & t_Elapsed;
+};
+
+/// Bounded queue with fiber mutex and conditions
+class Channel
+{
+public:
+	void Put(int _iValue)
+	{
+		CxxAbb::Fiber::FastMutex::ScopedLock lock(m_Mutex);
+		while (lst_Items.size() >= 4)
+			m_NotFull.Wait(m_Mutex);
+		lst_Items.push_back(_iValue);
+		m_NotEmpty.Signal();
+	}
+
+	int Take()
+	{
+		CxxAbb::Fiber::FastMutex::ScopedLock lock(m_Mutex);
+		while (lst_Items.empty())
+			m_NotEmpty.Wait(m_Mutex);
+		int iValue = lst_Items.front();
+		lst_Items.pop_front();
+		m_NotFull.Signal();
+		return iValue;
+	}
+
+private:
+	CxxAbb::Fiber::FastMutex m_Mutex;
+	CxxAbb::Fiber::WaitCondition m_NotEmpty;
+	CxxAbb::Fiber::WaitCondition m_NotFull;
+	std::deque<int> lst_Items;
+};
+
+class ProducerTask: public CxxAbb::Runnable
+{
+public:
+	explicit ProducerTask(Channel & _channel): m_Channel(_channel) {}
+
+	void Run()
+	{
+		for (int i = 1; i <= 100; ++i)
+			m_Channel.Put(i);
+	}
+
+private:
+	Channel & m_Channel;
+};
+
+class ConsumerTask: public CxxAbb::Runnable
+{
+public:
+	ConsumerTask(Channel & _channel, int & _iSum): m_Channel(_channel), i_Sum(_iSum) {}
+
+	void Run()
+	{
+		for (int i = 1; i <= 100; ++i)
+			i_Sum += m_Channel.Take();
+	}
+
+private:
+	Channel & m_Channel;
+	int & i_Sum;
+};
+
+class SleepTask: public CxxAbb::Runnable
+{
+public:
+	explicit SleepTask(long _lMilliSeconds = 20): l_MilliSeconds(_lMilliSeconds) {}
+
+	void Run()
+	{
+		CxxAbb::Fiber::Scheduler::Sleep(l_MilliSeconds);
+		g_Counter.FetchAdd(1);
+	}
+
+private:
+	long l_MilliSeconds;
+};
+
+class ThrowTask: public CxxAbb::Runnable
+{
+public:
+	void Run()
+	{
+		throw CxxAbb::DataException("from fiber");
+	}
+};
+
+class InFiber: public std::unary_function<int, bool>
+{
+public:
+	bool operator()(const int &) const
+	{
+		return CxxAbb::Fiber::Scheduler::InFiber();
+	}
+};
+
+}
+
+TEST(FiberTest, StackPool)
+{
+	CxxAbb::Fiber::StackPool pool(10000, 2);
+	ASSERT_EQ (0U, pool.StackSize() % 4096);
+	ASSERT_TRUE (pool.StackSize() >= 10000);
+
+	CxxAbb::Fiber::StackPool::Stack s1 = pool.Allocate();
+	CxxAbb::Fiber::StackPool::Stack s2 = pool.Allocate();
+	std::memset(s1.p_Base, 0xAB, s1.t_Size);
+	ASSERT_NE (s1.p_Base, s2.p_Base);
+
+	pool.Release(s1);
+	ASSERT_EQ (1U, pool.CachedCount());
+	CxxAbb::Fiber::StackPool::Stack s3 = pool.Allocate();
+	ASSERT_EQ (s1.p_Base, s3.p_Base);
+	pool.Release(s2);
+	pool.Release(s3);
+	ASSERT_EQ (2U, pool.CachedCount());
+}
+
+TEST(FiberTest, RunMany)
+{
+	g_Counter.Store(0);
+	CxxAbb::Fiber::Scheduler scheduler(2);
+	scheduler.Start();
+	for (int i = 0; i < 10000; ++i)
+	{
+		scheduler.Execute(new CountTask);
+	}
+	scheduler.WaitIdle();
+	ASSERT_EQ (10000, g_Counter.Load());
+	ASSERT_EQ (0U, scheduler.FiberCount());
+	ASSERT_FALSE (CxxAbb::Fiber::Scheduler::InFiber());
+}
+
+TEST(FiberTest, Yield)
+{
+	std::vector<int> vTrace;
+	CxxAbb::Fiber::Scheduler scheduler(1);
+	scheduler.Execute(new YieldTask(vTrace, 1));
+	scheduler.Execute(new YieldTask(vTrace, 2));
+	scheduler.Start();
+	scheduler.WaitIdle();
+
+	int aExpected[] = { 1, 2, 1, 2, 1, 2 };
+	ASSERT_EQ (6U, vTrace.size());
+	for (int i = 0; i < 6; ++i)
+	{
+		ASSERT_EQ (aExpected[i], vTrace[i]);
+	}
+}
+
+TEST(FiberTest, Mutex)
+{
+	int iShared = 0;
+	CxxAbb::Fiber::FastMutex mutex;
+	CxxAbb::Fiber::Scheduler scheduler(4);
+	scheduler.Start();
+	for (int i = 0; i < 50; ++i)
+	{
+		scheduler.Execute(new LockTask(mutex, iShared));
+	}
+	scheduler.WaitIdle();
+	ASSERT_EQ (5000, iShared);
+
+	ASSERT_TRUE (mutex.TryLock());
+	ASSERT_FALSE (mutex.TryLock(20));
+	mutex.Unlock();
+}
+
+TEST(FiberTest, SigEvent)
+{
+	g_Counter.Store(0);
+	CxxAbb::Fiber::SigEvent go(false);
+	CxxAbb::Fiber::SigEvent done;
+	CxxAbb::Fiber::Scheduler scheduler(2);
+	scheduler.Start();
+
+	// fibers wait for a thread, thread waits for a fiber
+	scheduler.Execute(new EventTask(go, CxxAbb::NullPtr));
+	scheduler.Execute(new EventTask(go, &done));
+	CxxAbb::Fiber::Scheduler::Sleep(20);
+	ASSERT_EQ (0, g_Counter.Load());
+	go.Set();
+	done.Wait();
+	scheduler.WaitIdle();
+	ASSERT_EQ (2, g_Counter.Load());
+	ASSERT_FALSE (done.TryWait(10));
+}
+
+TEST(FiberTest, TryWaitTimeout)
+{
+	bool bResult = true;
+	CxxAbb::Timestamp::TimeDiff tElapsed = 0;
+	CxxAbb::Fiber::Scheduler scheduler(1);
+	scheduler.Start();
+	scheduler.Execute(new TimeoutTask(bResult, tElapsed));
+	scheduler.WaitIdle();
+	ASSERT_FALSE (bResult);
+	ASSERT_TRUE (tElapsed >= 45000);
+	COUT_LOG() << "TryWait(50) on fiber took " << tElapsed << " us";
+}
+
+TEST(FiberTest, WaitCondition)
+{
+	int iSum = 0;
+	Channel channel;
+	CxxAbb::Fiber::Scheduler scheduler(2);
+	scheduler.Execute(new ConsumerTask(channel, iSum));
+	scheduler.Execute(new ProducerTask(channel));
+	scheduler.Start();
+	scheduler.WaitIdle();
+	ASSERT_EQ (5050, iSum);
+}
+
+TEST(FiberTest, Sleep)
+{
+	g_Counter.Store(0);
+	CxxAbb::Fiber::Scheduler scheduler(1);
+	scheduler.Start();
+	CxxAbb::Timestamp start;
+	for (int i = 0; i < 100; ++i)
+	{
+		scheduler.Execute(new SleepTask);
+	}
+	scheduler.WaitIdle();
+	ASSERT_EQ (100, g_Counter.Load());
+	// sleeping fibers do not hold the carrier
+	ASSERT_TRUE (start.Elapsed() < 1000000);
+}
+
+TEST(FiberTest, ManyIdleFibers)
+{
+	g_Counter.Store(0);
+	CxxAbb::Fiber::SigEvent go(false);
+	CxxAbb::Fiber::Scheduler scheduler(2, 16 * 1024);
+	scheduler.Start();
+	for (int i = 0; i < 5000; ++i)
+	{
+		scheduler.Execute(new EventTask(go, CxxAbb::NullPtr));
+	}
+	while (scheduler.FiberCount() != 5000)
+	{
+		CxxAbb::Sys::Thread::Sleep(1);
+	}
+	ASSERT_FALSE (scheduler.TryWaitIdle(10));
+	go.Set();
+	scheduler.WaitIdle();
+	ASSERT_EQ (5000, g_Counter.Load());
+}
+
+TEST(FiberTest, TaskException)
+{
+	g_Counter.Store(0);
+	CxxAbb::Fiber::Scheduler scheduler(1);
+	scheduler.Start();
+	scheduler.Execute(new ThrowTask);
+	scheduler.Execute(new CountTask);
+	scheduler.WaitIdle();
+	ASSERT_EQ (1, g_Counter.Load());
+}
+
+TEST(FiberTest, FutureContinuation)
+{
+	CxxAbb::Fiber::Scheduler scheduler(1);
+	scheduler.Start();
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<bool> onFiber = promise.GetFuture().Then(InFiber(), scheduler);
+	promise.SetValue(1);
+	ASSERT_TRUE (onFiber.Get());
+	scheduler.WaitIdle();
+}
+
+TEST(FiberTest, StopDiscards)
+{
+	CxxAbb::Fiber::Scheduler scheduler(1);
+	scheduler.Start();
+	scheduler.Execute(new SleepTask(60000));
+	scheduler.Execute(new CountTask);
+	ASSERT_FALSE (scheduler.TryWaitIdle(20));
+	scheduler.Stop();
+	ASSERT_EQ (0U, scheduler.FiberCount());
+}
@@ -0,0 +1,239 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * FlatHashMapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : FlatHashMap unit tests
+ *
+ */
+
+
+
+
+#include <CxxAbb/FlatHashMap.h>
+
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+typedef CxxAbb::FlatHashMap<int, int> IntMap;
+typedef CxxAbb::FlatHashMap<std::string, int> StringMap;
+
+/// Throws on the copy that brings the counter to zero
+struct Fragile
+{
+	explicit Fragile(int _iValue = 0)
+		: i_Value(_iValue)
+	{}
+
+	Fragile(const Fragile & _rhs)
+		: i_Value(_rhs.i_Value)
+	{
+		if (s_iCopiesLeft > 0 && --s_iCopiesLeft == 0)
+			throw std::runtime_error("copy");
+	}
+
+	int i_Value;
+	static int s_iCopiesLeft;
+};
+
+int Fragile::s_iCopiesLeft = 0;
+
+/// Every key in the same probe sequence
+struct CollidingHash
+{
+	CxxAbb::UInt64 operator ()(int _iValue) const
+	{
+		return static_cast<CxxAbb::UInt64>(_iValue & 3);
+	}
+};
+
+}
+
+
+TEST(FlatHashMapTest, Basic)
+{
+	IntMap map;
+	ASSERT_TRUE (map.Empty());
+	ASSERT_EQ (0U, map.Capacity());
+	ASSERT_TRUE (map.Find(1) == map.end());
+	ASSERT_TRUE (map.begin() == map.end());
+	ASSERT_EQ (0U, map.Erase(1));
+
+	ASSERT_TRUE (map.Insert(1, 10).second);
+	ASSERT_FALSE (map.Insert(1, 11).second);
+	ASSERT_EQ (10, map.Find(1)->second);
+	ASSERT_FALSE (map.InsertOrAssign(1, 12).second);
+	ASSERT_EQ (12, map.Find(1)->second);
+	map[2] = 20;
+	ASSERT_EQ (20, map[2]);
+	ASSERT_EQ (0, map[3]);
+	ASSERT_EQ (3U, map.Size());
+	ASSERT_EQ (16U, map.Capacity());
+
+	ASSERT_EQ (1U, map.Erase(2));
+	ASSERT_FALSE (map.Contains(2));
+	map.Erase(map.Find(3));
+	ASSERT_EQ (1U, map.Size());
+
+	map.Clear();
+	ASSERT_TRUE (map.Empty());
+	ASSERT_EQ (16U, map.Capacity());
+	map.Rehash(0);
+	ASSERT_EQ (0U, map.Capacity());
+}
+
+TEST(FlatHashMapTest, AgainstStdMap)
+{
+	IntMap map;
+	std::map<int, int> reference;
+	unsigned int uiSeed = 45;
+	for (int i = 0; i < 200000; ++i)
+	{
+		int iKey = rand_r(&uiSeed) % 5000;
+		switch (rand_r(&uiSeed) % 3)
+		{
+			case 0:
+				ASSERT_EQ (reference.insert(std::make_pair(iKey, i)).second, map.Insert(iKey, i).second);
+				break;
+			case 1:
+				ASSERT_EQ (reference.erase(iKey), map.Erase(iKey));
+				break;
+			default:
+				ASSERT_EQ (reference.count(iKey) != 0, map.Contains(iKey));
+				if (reference.count(iKey))
+				{
+					ASSERT_EQ (reference[iKey], map.Find(iKey)->second);
+				}
+		}
+		ASSERT_EQ (reference.size(), map.Size());
+	}
+	// erased slots do not pile up into rehashes to ever bigger tables
+	ASSERT_LE (map.Capacity(), IntMap::CapacityFor(5000));
+
+	std::size_t tSeen = 0;
+	for (IntMap::ConstIterator it = map.begin(); it != map.end(); ++it, ++tSeen)
+		ASSERT_EQ (reference[it->first], it->second);
+	ASSERT_EQ (reference.size(), tSeen);
+}
+
+TEST(FlatHashMapTest, Collisions)
+{
+	CxxAbb::FlatHashMap<int, int, CollidingHash> map;
+	for (int i = 0; i < 1000; ++i)
+		ASSERT_TRUE (map.Insert(i, -i).second);
+	for (int i = 0; i < 1000; i += 2)
+		ASSERT_EQ (1U, map.Erase(i));
+	for (int i = 0; i < 1000; ++i)
+		ASSERT_EQ (i % 2 != 0, map.Contains(i));
+	for (int i = 0; i < 1000; i += 2)
+		ASSERT_TRUE (map.Insert(i, i).second);
+	ASSERT_EQ (1000U, map.Size());
+	ASSERT_EQ (-999, map.Find(999)->second);
+}
+
+TEST(FlatHashMapTest, HeterogeneousLookup)
+{
+	StringMap map;
+	map["alpha"] = 1;
+	map[std::string(100, 'x')] = 2;
+
+	const char * zKey = "alpha";
+	ASSERT_EQ (1, map.Find(zKey)->second);
+	ASSERT_TRUE (map.Contains("alpha"));
+	ASSERT_FALSE (map.Contains("beta"));
+	ASSERT_EQ (2, map.Find(std::string(100, 'x'))->second);
+	ASSERT_EQ (1U, map.Erase("alpha"));
+	ASSERT_EQ (1U, map.Size());
+}
+
+TEST(FlatHashMapTest, ReserveRehashCopy)
+{
+	IntMap map;
+	map.Reserve(1000);
+	std::size_t tCapacity = map.Capacity();
+	ASSERT_EQ (IntMap::CapacityFor(1000), tCapacity);
+	for (int i = 0; i < 1000; ++i)
+		map.Insert(i, i * i);
+	ASSERT_EQ (tCapacity, map.Capacity());
+
+	for (int i = 100; i < 1000; ++i)
+		map.Erase(i);
+	map.Rehash(0);
+	ASSERT_EQ (IntMap::CapacityFor(100), map.Capacity());
+	ASSERT_EQ (81, map.Find(9)->second);
+
+	IntMap copy(map);
+	ASSERT_EQ (100U, copy.Size());
+	copy[5] = -1;
+	ASSERT_EQ (25, map[5]);
+
+	IntMap other;
+	other[1] = 1;
+	other = copy;
+	ASSERT_EQ (-1, other[5]);
+	other.Swap(map);
+	ASSERT_EQ (25, other[5]);
+	ASSERT_EQ (-1, map[5]);
+}
+
+TEST(FlatHashMapTest, ThrowingCopy)
+{
+	CxxAbb::FlatHashMap<int, Fragile> map;
+	for (int i = 0; i < 14; ++i)
+		map.Insert(i, Fragile(i));
+	ASSERT_EQ (16U, map.Capacity());
+
+	// the 15th insert rehashes to 32 slots, copying the first 14
+	Fragile::s_iCopiesLeft = 8;
+	ASSERT_THROW (map.Insert(14, Fragile(14)), std::runtime_error);
+	Fragile::s_iCopiesLeft = 0;
+	ASSERT_EQ (14U, map.Size());
+	ASSERT_EQ (16U, map.Capacity());
+	for (int i = 0; i < 14; ++i)
+		ASSERT_EQ (i, map.Find(i)->second.i_Value);
+}
+
+TEST(FlatHashMapTest, Pool)
+{
+	const std::size_t tBlock = IntMap::StorageSize(IntMap::CapacityFor(50));
+	CxxAbb::MemoryPool pool(tBlock);
+	{
+		IntMap map(&pool);
+		for (int i = 0; i < 50; ++i)
+			map[i] = i;
+		// 16 to 64 slot tables fit a block, the map holds one of them
+		ASSERT_EQ (pool.Allocated() - 1, pool.Available());
+		map[50] = 50;
+		map[99] = 99;
+		for (int i = 51; i < 60; ++i)
+			map[i] = i;
+		ASSERT_GT (map.Capacity(), IntMap::CapacityFor(50));
+	}
+	ASSERT_EQ (pool.Allocated(), pool.Available());
+	ASSERT_EQ (2, pool.Allocated());
+}
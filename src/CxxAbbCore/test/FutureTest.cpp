@@ -0,0 +1,312 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * FutureTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Promise/Future unit tests
+ *
+ */
+
+
+#include <CxxAbb/Sys/Future.h>
+#include <CxxAbb/Sys/Thread.h>
+
+#include <functional>
+#include <sstream>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+class Producer: public CxxAbb::Runnable
+{
+public:
+	Producer(CxxAbb::Sys::Promise<int> & _promise, int _iValue, long _lDelay)
+		: m_Promise(_promise), i_Value(_iValue), l_Delay(_lDelay)
+	{
+	}
+
+	void Run()
+	{
+		CxxAbb::Sys::Thread::Sleep(l_Delay);
+		m_Promise.SetValue(i_Value);
+	}
+
+private:
+	CxxAbb::Sys::Promise<int> & m_Promise;
+	int i_Value;
+	long l_Delay;
+};
+
+class Doubler: public std::unary_function<int, int>
+{
+public:
+	int operator()(const int & _iValue) const
+	{
+		return _iValue * 2;
+	}
+};
+
+class Thrower: public std::unary_function<int, int>
+{
+public:
+	int operator()(const int &) const
+	{
+		throw CxxAbb::DataException("bad value");
+	}
+};
+
+std::string ToString(const int & _iValue)
+{
+	std::ostringstream oss;
+	oss << _iValue;
+	return oss.str();
+}
+
+/// Executor which keeps tasks until Drain(), to check deferred execution
+class QueueExecutor: public CxxAbb::Sys::Executor
+{
+public:
+	void Execute(CxxAbb::Runnable * _pTask)
+	{
+		lst_Tasks.push_back(_pTask);
+	}
+
+	std::size_t Drain()
+	{
+		std::size_t n = lst_Tasks.size();
+		for (std::size_t i = 0; i < lst_Tasks.size(); ++i)
+		{
+			RunTask(lst_Tasks[i]);
+		}
+		lst_Tasks.clear();
+		return n;
+	}
+
+private:
+	std::vector<CxxAbb::Runnable*> lst_Tasks;
+};
+
+}
+
+TEST(FutureTest, SetValue)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> future = promise.GetFuture();
+	ASSERT_TRUE (future.IsValid());
+	ASSERT_FALSE (future.IsReady());
+
+	promise.SetValue(5);
+	ASSERT_TRUE (future.IsReady());
+	ASSERT_FALSE (future.HasException());
+	ASSERT_EQ (5, future.Get());
+	ASSERT_TRUE (promise.IsSatisfied());
+	ASSERT_THROW (promise.SetValue(6), CxxAbb::IllegalStateException);
+	ASSERT_FALSE (promise.TrySetValue(6));
+	ASSERT_EQ (5, future.Get());
+}
+
+TEST(FutureTest, SetException)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> future = promise.GetFuture();
+
+	promise.SetException(CxxAbb::NotFoundException("key"));
+	ASSERT_TRUE (future.IsReady());
+	ASSERT_TRUE (future.HasException());
+	ASSERT_THROW (future.Get(), CxxAbb::NotFoundException);
+	ASSERT_THROW (promise.SetException(CxxAbb::DataException("x")), CxxAbb::IllegalStateException);
+}
+
+TEST(FutureTest, InvalidFuture)
+{
+	CxxAbb::Sys::Future<int> future;
+	ASSERT_FALSE (future.IsValid());
+	ASSERT_THROW (future.IsReady(), CxxAbb::IllegalStateException);
+}
+
+TEST(FutureTest, BrokenPromise)
+{
+	CxxAbb::Sys::Future<int> future;
+	{
+		CxxAbb::Sys::Promise<int> promise;
+		future = promise.GetFuture();
+	}
+	ASSERT_TRUE (future.IsReady());
+	ASSERT_THROW (future.Get(), CxxAbb::IllegalStateException);
+}
+
+TEST(FutureTest, CrossThread)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> future = promise.GetFuture();
+	Producer producer(promise, 42, 100);
+
+	CxxAbb::Sys::Thread thread;
+	thread.Start(producer);
+	ASSERT_EQ (42, future.Get());
+	thread.Join();
+}
+
+TEST(FutureTest, TryGet)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> future = promise.GetFuture();
+	int iValue = 0;
+
+	ASSERT_FALSE (future.TryWait(10));
+	ASSERT_FALSE (future.TryGet(iValue, 10));
+
+	Producer producer(promise, 7, 50);
+	CxxAbb::Sys::Thread thread;
+	thread.Start(producer);
+	ASSERT_TRUE (future.TryGet(iValue, 5000));
+	ASSERT_EQ (7, iValue);
+	thread.Join();
+}
+
+TEST(FutureTest, Then)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> future = promise.GetFuture();
+	CxxAbb::Sys::Future<int> doubled = future.Then(Doubler());
+	CxxAbb::Sys::Future<std::string> str = doubled.Then(ToString);
+	ASSERT_FALSE (str.IsReady());
+
+	promise.SetValue(21);
+	ASSERT_TRUE (str.IsReady());
+	ASSERT_EQ (42, doubled.Get());
+	ASSERT_EQ ("42", str.Get());
+
+	// attached after completion runs immediately
+	ASSERT_EQ (84, doubled.Then(Doubler()).Get());
+}
+
+TEST(FutureTest, ThenPropagatesException)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> failed = promise.GetFuture().Then(Thrower());
+	CxxAbb::Sys::Future<int> chained = failed.Then(Doubler());
+
+	promise.SetValue(1);
+	ASSERT_THROW (failed.Get(), CxxAbb::DataException);
+	ASSERT_THROW (chained.Get(), CxxAbb::DataException);
+
+	CxxAbb::Sys::Future<int> upstream = CxxAbb::Sys::MakeExceptionalFuture<int>(CxxAbb::TimeoutException("late"));
+	ASSERT_THROW (upstream.Then(Doubler()).Get(), CxxAbb::TimeoutException);
+}
+
+TEST(FutureTest, ThenOnExecutor)
+{
+	QueueExecutor executor;
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> first = promise.GetFuture().Then(Doubler(), executor);
+	CxxAbb::Sys::Future<int> second = promise.GetFuture().Then(Doubler(), executor);
+
+	promise.SetValue(3);
+	ASSERT_FALSE (first.IsReady());
+	ASSERT_EQ (2U, executor.Drain());
+	ASSERT_EQ (6, first.Get());
+	ASSERT_EQ (6, second.Get());
+}
+
+TEST(FutureTest, WhenAll)
+{
+	std::vector< CxxAbb::Sys::Promise<int>* > vPromises;
+	std::vector< CxxAbb::Sys::Future<int> > vFutures;
+	for (int i = 0; i < 4; ++i)
+	{
+		vPromises.push_back(new CxxAbb::Sys::Promise<int>);
+		vFutures.push_back(vPromises.back()->GetFuture());
+	}
+
+	CxxAbb::Sys::Future< std::vector<int> > all = CxxAbb::Sys::WhenAll(vFutures);
+	for (int i = 3; i >= 0; --i)
+	{
+		ASSERT_FALSE (all.IsReady());
+		vPromises[i]->SetValue(i * 10);
+	}
+
+	ASSERT_TRUE (all.IsReady());
+	ASSERT_EQ (4U, all.Get().size());
+	for (int i = 0; i < 4; ++i)
+	{
+		ASSERT_EQ (i * 10, all.Get()[i]);
+		delete vPromises[i];
+	}
+
+	ASSERT_TRUE (CxxAbb::Sys::WhenAll(std::vector< CxxAbb::Sys::Future<int> >()).Get().empty());
+}
+
+TEST(FutureTest, WhenAllFailFast)
+{
+	CxxAbb::Sys::Promise<int> p1;
+	CxxAbb::Sys::Promise<int> p2;
+	std::vector< CxxAbb::Sys::Future<int> > vFutures;
+	vFutures.push_back(p1.GetFuture());
+	vFutures.push_back(p2.GetFuture());
+
+	CxxAbb::Sys::Future< std::vector<int> > all = CxxAbb::Sys::WhenAll(vFutures);
+	p2.SetException(CxxAbb::DataException("p2"));
+	ASSERT_TRUE (all.IsReady());
+	ASSERT_THROW (all.Get(), CxxAbb::DataException);
+	p1.SetValue(1);
+}
+
+TEST(FutureTest, WhenAny)
+{
+	CxxAbb::Sys::Promise<int> p1;
+	CxxAbb::Sys::Promise<int> p2;
+	std::vector< CxxAbb::Sys::Future<int> > vFutures;
+	vFutures.push_back(p1.GetFuture());
+	vFutures.push_back(p2.GetFuture());
+
+	CxxAbb::Sys::Future<std::size_t> any = CxxAbb::Sys::WhenAny(vFutures);
+	ASSERT_FALSE (any.IsReady());
+	p2.SetValue(2);
+	ASSERT_EQ (1U, any.Get());
+	p1.SetValue(1);
+	ASSERT_EQ (1U, any.Get());
+
+	ASSERT_THROW (CxxAbb::Sys::WhenAny(std::vector< CxxAbb::Sys::Future<int> >()),
+			CxxAbb::InvalidArgumentException);
+}
+
+TEST(FutureTest, ManyWaiters)
+{
+	CxxAbb::Sys::Promise<int> promise;
+	CxxAbb::Sys::Future<int> future = promise.GetFuture();
+	Producer producer(promise, 9, 50);
+
+	CxxAbb::Sys::Thread thread;
+	thread.Start(producer);
+	for (int i = 0; i < 1000; ++i)
+	{
+		CxxAbb::Sys::Future<int> copy = future;
+		if (copy.TryWait(1))
+		{
+			ASSERT_EQ (9, copy.Get());
+		}
+	}
+	ASSERT_EQ (9, future.Get());
+	thread.Join();
+}
@@ -0,0 +1,148 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LockProfilerTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : Lock contention profiler unit tests
+ *
+ */
+
+
+#include <CxxAbb/Sys/LockProfiler.h>
+#include <CxxAbb/Sys/Mutex.h>
+#include <CxxAbb/Sys/ScopedLock.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/SourceLineInfo.h>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+bool FindStats(const std::string & _sName, CxxAbb::Sys::LockStats & _stats)
+{
+	std::vector<CxxAbb::Sys::LockStats> vStats;
+	CxxAbb::Sys::LockProfiler::Snapshot(vStats);
+	for (std::size_t i = 0; i < vStats.size(); ++i)
+	{
+		if (vStats[i].s_Name == _sName)
+		{
+			_stats = vStats[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+CxxAbb::UInt64 Total(const CxxAbb::UInt64 (&_histogram)[CxxAbb::Sys::LockStats::Buckets])
+{
+	CxxAbb::UInt64 uiTotal = 0;
+	for (int i = 0; i < CxxAbb::Sys::LockStats::Buckets; ++i)
+		uiTotal += _histogram[i];
+	return uiTotal;
+}
+
+CxxAbb::Sys::FastMutex g_Hot("LockProfilerTest.Hot");
+
+void HoldHot(void *)
+{
+	for (int i = 0; i < 20; ++i)
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(g_Hot, CXXABB_SOURCEINFO);
+		CxxAbb::Sys::Thread::Sleep(1);
+	}
+}
+
+}
+
+TEST(LockProfilerTest, Disabled)
+{
+	CxxAbb::Sys::LockProfiler::Enable(false);
+	CxxAbb::Sys::Mutex mutex("LockProfilerTest.Disabled");
+	for (int i = 0; i < 10; ++i)
+	{
+		CxxAbb::Sys::Mutex::ScopedLock lock(mutex);
+	}
+
+	CxxAbb::Sys::LockStats stats;
+	ASSERT_TRUE (FindStats("LockProfilerTest.Disabled", stats));
+	ASSERT_EQ (1U, stats.ui_Locks);
+	ASSERT_EQ (0U, stats.ui_Acquisitions);
+	ASSERT_EQ (0U, Total(stats.ui_HoldHistogram));
+}
+
+TEST(LockProfilerTest, Contention)
+{
+	CxxAbb::Sys::LockProfiler::Enable(true);
+	CxxAbb::Sys::LockProfiler::Reset();
+
+	CxxAbb::Sys::Thread threads[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		threads[i].Start(HoldHot, CxxAbb::NullPtr);
+	}
+	for (int i = 0; i < 3; ++i)
+	{
+		threads[i].Join();
+	}
+	CxxAbb::Sys::LockProfiler::Enable(false);
+
+	CxxAbb::Sys::LockStats stats;
+	ASSERT_TRUE (FindStats("LockProfilerTest.Hot", stats));
+	ASSERT_EQ (60U, stats.ui_Acquisitions);
+	ASSERT_EQ (60U, Total(stats.ui_WaitHistogram));
+	ASSERT_EQ (60U, Total(stats.ui_HoldHistogram));
+	ASSERT_TRUE (stats.ui_Contended > 0);
+	ASSERT_TRUE (stats.ui_WaitNs > 0);
+	// each hold sleeps at least a millisecond
+	ASSERT_TRUE (stats.ui_HoldNs >= 60U * 1000000U);
+	ASSERT_TRUE (CxxAbb::Sys::LockStats::Percentile(stats.ui_HoldHistogram, 50) >= 1000000U);
+
+	ASSERT_EQ (1U, stats.lst_Sites.size());
+	ASSERT_EQ (60U, stats.lst_Sites[0].ui_Acquisitions);
+	ASSERT_EQ (stats.ui_Contended, stats.lst_Sites[0].ui_Contended);
+	ASSERT_NE (std::string::npos, stats.lst_Sites[0].s_File.find("LockProfilerTest.cpp"));
+
+	std::ostringstream os;
+	CxxAbb::Sys::LockProfiler::Dump(os);
+	ASSERT_NE (std::string::npos, os.str().find("LockProfilerTest.Hot"));
+	ASSERT_NE (std::string::npos, os.str().find("LockProfilerTest.cpp"));
+}
+
+TEST(LockProfilerTest, Recursive)
+{
+	CxxAbb::Sys::LockProfiler::Enable(true);
+	CxxAbb::Sys::FastMutex mutex("LockProfilerTest.Recursive");
+	mutex.Lock();
+	ASSERT_TRUE (mutex.TryLock());
+	mutex.Unlock();
+	mutex.Unlock();
+	CxxAbb::Sys::LockProfiler::Enable(false);
+
+	CxxAbb::Sys::LockStats stats;
+	ASSERT_TRUE (FindStats("LockProfilerTest.Recursive", stats));
+	ASSERT_EQ (2U, stats.ui_Acquisitions);
+	ASSERT_EQ (0U, stats.ui_Contended);
+	// hold time is taken once, at the outermost unlock
+	ASSERT_EQ (1U, Total(stats.ui_HoldHistogram));
+}
@@ -0,0 +1,248 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * LoggerTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Logging
+ * Comment     : Asynchronous logger unit tests
+ *
+ */
+
+
+
+#include <CxxAbb/Log/Logger.h>
+#include <CxxAbb/Log/Sink.h>
+#include <CxxAbb/Sys/SignalToException.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <CxxAbb/Exception.h>
+
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <pthread.h>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+const char * LogFile = "/tmp/CxxAbbLoggerTest.log";
+
+std::string ReadFile(const std::string & _sPath)
+{
+	std::ifstream file(_sPath.c_str());
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+std::size_t Occurrences(const std::string & _sText, const std::string & _sWhat)
+{
+	std::size_t tCount = 0;
+	for (std::size_t tPos = _sText.find(_sWhat); tPos != std::string::npos; tPos = _sText.find(_sWhat, tPos + 1))
+		++tCount;
+	return tCount;
+}
+
+void LogThousand(void *)
+{
+	for (int i = 0; i < 1000; ++i)
+		CxxAbb::Log::Info("record {}", i);
+}
+
+/// created after the logger's key, so glibc runs it after the logger retired the thread's ring
+void LogFromKeyDestructor(void *)
+{
+	CxxAbb::Sys::Thread::Sleep(20); // the writer frees the retired ring meanwhile
+	CxxAbb::Log::Info("after exit {}", 2);
+}
+
+void LogAndExit(void * _pKey)
+{
+	::pthread_setspecific(*static_cast<pthread_key_t*>(_pKey), _pKey);
+	CxxAbb::Log::Info("before exit {}", 1);
+}
+
+}
+
+TEST(LoggerTest, Format)
+{
+	CxxAbb::Log::LoggerOptions options;
+	options.e_Level = CxxAbb::Log::LevelDebug;
+	CxxAbb::Log::Logger::Start(new CxxAbb::Log::FileSink(LogFile, true), options);
+	ASSERT_THROW (CxxAbb::Log::Logger::Start(new CxxAbb::Log::FileSink(LogFile)), CxxAbb::IllegalStateException);
+
+	ASSERT_TRUE (CxxAbb::Log::Logger::IsEnabled(CxxAbb::Log::LevelDebug));
+	ASSERT_FALSE (CxxAbb::Log::Logger::IsEnabled(CxxAbb::Log::LevelTrace));
+
+	CxxAbb::Log::Trace("not written");
+	CxxAbb::Log::Debug("int {} uint {} negative {}", 42, 7U, -9223372036854775807L - 1);
+	CxxAbb::Log::Info("double {} bool {} char {}", 2.5, true, 'x');
+	CxxAbb::Log::Warning("string {} and {}", "text", std::string("std"));
+	CxxAbb::Log::Warning("long long {} {}", -1234567890123LL, 18446744073709551615ULL);
+	CxxAbb::Log::Error("missing {} {}", 1);
+	CxxAbb::Log::Fatal("extra", 1);
+	CxxAbb::Log::Logger::Flush();
+
+	std::string sLog = ReadFile(LogFile);
+	ASSERT_EQ (0U, Occurrences(sLog, "not written"));
+	ASSERT_EQ (6U, Occurrences(sLog, "\n"));
+	// YYYY-MM-DD hh:mm:ss.uuuuuu LEVEL [tid] message
+	ASSERT_EQ ('-', sLog[4]);
+	ASSERT_EQ (':', sLog[16]);
+	ASSERT_EQ ('.', sLog[19]);
+	ASSERT_EQ (" DEBUG [", sLog.substr(26, 8));
+	ASSERT_EQ (1U, Occurrences(sLog, "] int 42 uint 7 negative -9223372036854775808\n"));
+	ASSERT_EQ (1U, Occurrences(sLog, " INFO  ["));
+	ASSERT_EQ (1U, Occurrences(sLog, "] double 2.5 bool true char x\n"));
+	ASSERT_EQ (2U, Occurrences(sLog, " WARN  ["));
+	ASSERT_EQ (1U, Occurrences(sLog, "] string text and std\n"));
+	ASSERT_EQ (1U, Occurrences(sLog, "] long long -1234567890123 18446744073709551615\n"));
+	ASSERT_EQ (1U, Occurrences(sLog, "] missing 1 {}\n"));
+	ASSERT_EQ (1U, Occurrences(sLog, " FATAL ["));
+
+	CxxAbb::Log::Logger::SetLevel(CxxAbb::Log::LevelError);
+	ASSERT_FALSE (CxxAbb::Log::Logger::IsEnabled(CxxAbb::Log::LevelWarning));
+
+	CxxAbb::Log::Logger::Stop();
+	ASSERT_FALSE (CxxAbb::Log::Logger::IsEnabled(CxxAbb::Log::LevelFatal));
+	ASSERT_EQ (6U, CxxAbb::Log::Logger::Written());
+	std::remove(LogFile);
+}
+
+TEST(LoggerTest, OverflowDrop)
+{
+	CxxAbb::Log::LoggerOptions options;
+	options.t_RingRecords = 64;
+	options.l_FlushMilliSeconds = 60000; // nothing is drained before Stop()
+	CxxAbb::Log::Logger::Start(new CxxAbb::Log::FileSink(LogFile, true), options);
+
+	CxxAbb::Sys::Thread worker;
+	worker.Start(LogThousand, CxxAbb::NullPtr);
+	worker.Join();
+	CxxAbb::Log::Logger::Stop();
+
+	ASSERT_EQ (64U, CxxAbb::Log::Logger::Written());
+	ASSERT_EQ (1000U - 64U, CxxAbb::Log::Logger::Dropped());
+	ASSERT_EQ (64U, Occurrences(ReadFile(LogFile), "\n"));
+	std::remove(LogFile);
+}
+
+TEST(LoggerTest, OverflowBlock)
+{
+	CxxAbb::Log::LoggerOptions options;
+	options.e_Overflow = CxxAbb::Log::OverflowBlock;
+	options.t_RingRecords = 16;
+	options.l_FlushMilliSeconds = 60000;
+	CxxAbb::Log::Logger::Start(new CxxAbb::Log::FileSink(LogFile, true), options);
+
+	CxxAbb::Sys::Thread workers[4];
+	for (int i = 0; i < 4; ++i)
+		workers[i].Start(LogThousand, CxxAbb::NullPtr);
+	for (int i = 0; i < 4; ++i)
+		workers[i].Join();
+	CxxAbb::Log::Logger::Stop();
+
+	ASSERT_EQ (0U, CxxAbb::Log::Logger::Dropped());
+	ASSERT_EQ (4000U, CxxAbb::Log::Logger::Written());
+	std::string sLog = ReadFile(LogFile);
+	ASSERT_EQ (4000U, Occurrences(sLog, "\n"));
+	ASSERT_EQ (4U, Occurrences(sLog, " record 999\n"));
+	std::remove(LogFile);
+}
+
+TEST(LoggerTest, LogAfterThreadExit)
+{
+	CxxAbb::Log::LoggerOptions options;
+	options.l_FlushMilliSeconds = 1;
+	CxxAbb::Log::Logger::Start(new CxxAbb::Log::FileSink(LogFile, true), options);
+	pthread_key_t key;
+	ASSERT_EQ (0, ::pthread_key_create(&key, &LogFromKeyDestructor));
+
+	CxxAbb::Sys::Thread worker;
+	worker.Start(LogAndExit, &key);
+	worker.Join();
+	CxxAbb::Log::Logger::Stop();
+	::pthread_key_delete(key);
+
+	std::string sLog = ReadFile(LogFile);
+	ASSERT_EQ (1U, Occurrences(sLog, "] before exit 1\n"));
+	ASSERT_EQ (1U, Occurrences(sLog, "] after exit 2\n"));
+	std::remove(LogFile);
+}
+
+TEST(LoggerTest, RotatingFileSink)
+{
+	std::string sPath(LogFile);
+	std::remove((sPath + ".1").c_str());
+	std::remove((sPath + ".2").c_str());
+	std::remove((sPath + ".3").c_str());
+
+	CxxAbb::Log::RotatingFileSink * pSink = new CxxAbb::Log::RotatingFileSink(sPath, 4096, 2);
+	CxxAbb::Log::Logger::Start(pSink);
+	for (int i = 0; i < 1000; ++i)
+		CxxAbb::Log::Info("rotating record {} of {}", i, 1000);
+	CxxAbb::Log::Logger::Flush();
+	ASSERT_LT (0U, pSink->Rotations());
+	CxxAbb::Log::Logger::Stop();
+
+	std::string sCurrent = ReadFile(sPath);
+	std::string sPrevious = ReadFile(sPath + ".1");
+	ASSERT_GE (4096U, sCurrent.size());
+	ASSERT_GE (4096U, sPrevious.size());
+	ASSERT_LT (0U, sPrevious.size());
+	// whole lines only, the newest record is last
+	ASSERT_EQ ('\n', sPrevious[sPrevious.size() - 1]);
+	ASSERT_EQ (" rotating record 999 of 1000\n", sCurrent.substr(sCurrent.size() - 29));
+	ASSERT_EQ (std::string(), ReadFile(sPath + ".3"));
+
+	std::remove(LogFile);
+	std::remove((sPath + ".1").c_str());
+	std::remove((sPath + ".2").c_str());
+}
+
+TEST(LoggerTest, CrashFlush)
+{
+	CxxAbb::Log::LoggerOptions options;
+	options.l_FlushMilliSeconds = 60000;
+	CxxAbb::Log::Logger::Start(new CxxAbb::Log::FileSink(LogFile, true), options);
+	CxxAbb::Sys::SignalToException::SetupHandler(SIGFPE);
+
+	CxxAbb::Log::Error("last words {}", 1);
+	bool bThrown = false;
+	try
+	{
+		ThrowOnSignal();
+		std::raise(SIGFPE);
+	}
+	catch (CxxAbb::SignalException &)
+	{
+		bThrown = true;
+	}
+	ASSERT_TRUE (bThrown);
+	// written by the crash handler, the writer is still asleep
+	ASSERT_EQ (1U, Occurrences(ReadFile(LogFile), "] last words 1\n"));
+
+	CxxAbb::Log::Logger::Stop();
+	std::signal(SIGFPE, SIG_DFL);
+	std::remove(LogFile);
+}
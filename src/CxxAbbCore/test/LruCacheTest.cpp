@@ -0,0 +1,184 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ConcurrentHashMapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : LruCache unit tests
+ *
+ */
+
+
+#include <CxxAbb/Sys/LruCache.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <gtest/gtest.h>
+#include <string>
+
+
+namespace
+{
+
+typedef CxxAbb::Sys::LruCache<int, int> IntCache;
+
+IntCache::ValuePtr Value(int _iValue)
+{
+	return IntCache::ValuePtr(new int(_iValue));
+}
+
+void FindInsert(void * _pCache)
+{
+	IntCache & cache = *static_cast<IntCache*>(_pCache);
+	IntCache::ValuePtr value(new int(0));
+	for (int i = 0; i < 20000; ++i)
+	{
+		int iKey = (i * 7919) % 1024;
+		if (cache.Find(iKey, value))
+		{
+			ASSERT_EQ (iKey, *value);
+		}
+		else
+		{
+			cache.Insert(iKey, Value(iKey));
+		}
+	}
+}
+
+}
+
+TEST(LruCacheTest, LeastRecentlyUsed)
+{
+	IntCache cache(3, 0, 1);
+	ASSERT_EQ (1U, cache.ShardCount());
+
+	ASSERT_TRUE (cache.Insert(1, Value(10)));
+	ASSERT_TRUE (cache.Insert(2, Value(20)));
+	ASSERT_TRUE (cache.Insert(3, Value(30)));
+
+	IntCache::ValuePtr value;
+	ASSERT_TRUE (cache.Find(1, value));
+	ASSERT_EQ (10, *value);
+
+	// 2 is the least recently used now
+	cache.Insert(4, Value(40));
+	ASSERT_EQ (3U, cache.Size());
+	ASSERT_FALSE (cache.Find(2, value));
+	ASSERT_TRUE (cache.Find(1, value));
+	ASSERT_TRUE (cache.Find(3, value));
+	ASSERT_TRUE (cache.Find(4, value));
+
+	// replacing keeps the size and refreshes recency
+	cache.Insert(1, Value(11));
+	cache.Insert(5, Value(50));
+	ASSERT_TRUE (cache.Find(1, value));
+	ASSERT_EQ (11, *value);
+	ASSERT_FALSE (cache.Find(3, value));
+
+	ASSERT_TRUE (cache.Erase(1));
+	ASSERT_FALSE (cache.Erase(1));
+	ASSERT_EQ (2U, cache.Size());
+
+	CxxAbb::Sys::LruCacheStats stats = cache.Stats();
+	ASSERT_EQ (5U, stats.ui_Hits);
+	ASSERT_EQ (2U, stats.ui_Misses);
+	ASSERT_EQ (2U, stats.ui_Evictions);
+	ASSERT_EQ (0U, stats.ui_Expirations);
+	ASSERT_EQ (2U, stats.t_Size);
+	ASSERT_EQ (2U, stats.t_Cost);
+
+	cache.Clear();
+	ASSERT_EQ (0U, cache.Size());
+	ASSERT_FALSE (cache.Find(4, value));
+}
+
+TEST(LruCacheTest, Cost)
+{
+	IntCache cache(100, 0, 1);
+	ASSERT_TRUE (cache.Insert(1, Value(1), 40, 0));
+	ASSERT_TRUE (cache.Insert(2, Value(2), 40, 0));
+	ASSERT_FALSE (cache.Insert(3, Value(3), 101, 0));
+	ASSERT_EQ (80U, cache.Stats().t_Cost);
+
+	// one 30 does not fit next to 80, the oldest goes
+	ASSERT_TRUE (cache.Insert(3, Value(3), 30, 0));
+	IntCache::ValuePtr value;
+	ASSERT_FALSE (cache.Find(1, value));
+	ASSERT_TRUE (cache.Find(2, value));
+	ASSERT_EQ (70U, cache.Stats().t_Cost);
+
+	ASSERT_TRUE (cache.Insert(4, Value(4), 100, 0));
+	ASSERT_EQ (1U, cache.Size());
+	ASSERT_EQ (3U, cache.Stats().ui_Evictions);
+}
+
+TEST(LruCacheTest, TimeToLive)
+{
+	IntCache cache(100, 20 * 1000, 1);
+	cache.Insert(1, Value(1));
+	cache.Insert(2, Value(2), 1, 0);
+	cache.Insert(3, Value(3));
+	cache.Insert(4, Value(4), 1, 60 * 1000 * 1000);
+
+	IntCache::ValuePtr value;
+	ASSERT_TRUE (cache.Find(1, value));
+	CxxAbb::Sys::Thread::Sleep(60);
+
+	ASSERT_FALSE (cache.Find(1, value));
+	ASSERT_EQ (1, *value);
+	ASSERT_TRUE (cache.Find(2, value));
+	ASSERT_TRUE (cache.Find(4, value));
+	ASSERT_EQ (3U, cache.Size());
+
+	ASSERT_EQ (1U, cache.PurgeExpired());
+	ASSERT_EQ (2U, cache.Size());
+	ASSERT_EQ (2U, cache.Stats().ui_Expirations);
+}
+
+TEST(LruCacheTest, ValueOutlivesEviction)
+{
+	typedef CxxAbb::Sys::LruCache<std::string, std::string> StringCache;
+	StringCache cache(1, 0, 1);
+	cache.Insert("a", StringCache::ValuePtr(new std::string("first")));
+
+	StringCache::ValuePtr value;
+	ASSERT_TRUE (cache.Find("a", value));
+	cache.Insert("b", StringCache::ValuePtr(new std::string("second")));
+	ASSERT_FALSE (cache.Find("a", value));
+	ASSERT_EQ ("first", *value);
+	ASSERT_EQ (1U, value.refCount());
+}
+
+TEST(LruCacheTest, Threads)
+{
+	IntCache cache(256, 0, 4);
+	ASSERT_EQ (4U, cache.ShardCount());
+
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+		threads[i].Start(FindInsert, &cache);
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+
+	CxxAbb::Sys::LruCacheStats stats = cache.Stats();
+	ASSERT_EQ (4U * 20000, stats.ui_Hits + stats.ui_Misses);
+	ASSERT_GE (256U, stats.t_Cost);
+	ASSERT_EQ (stats.t_Size, stats.t_Cost);
+	// a key missed by two threads at once is inserted twice
+	ASSERT_LE (stats.t_Size + stats.ui_Evictions, stats.ui_Misses);
+}
@@ -0,0 +1,167 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ConcurrentHashMapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : MappedFile unit tests
+ *
+ */
+
+
+#include <CxxAbb/MappedFile.h>
+#include <CxxAbb/BinaryReader.h>
+#include <CxxAbb/BinaryWriter.h>
+#include <CxxAbb/Exception.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+const char * MapFile = "/tmp/CxxAbbMappedFileTest.bin";
+
+void WriteFile(const std::string & _sContent)
+{
+	std::ofstream ofs(MapFile, std::ios::binary | std::ios::trunc);
+	ofs.write(_sContent.data(), static_cast<std::streamsize>(_sContent.size()));
+}
+
+std::string ReadFile()
+{
+	std::ifstream ifs(MapFile, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+}
+
+TEST(MappedFileTest, ReadOnly)
+{
+	std::string sContent;
+	for (int i = 0; i < 10000; ++i)
+		sContent += static_cast<char>('a' + i % 26);
+	WriteFile(sContent);
+
+	CxxAbb::MappedFile file(MapFile);
+	ASSERT_TRUE (file.IsOpen());
+	ASSERT_EQ (std::string(MapFile), file.Path());
+	ASSERT_EQ (sContent.size(), file.Size());
+	ASSERT_EQ (sContent, std::string(file.Data(), file.Size()));
+
+	file.Advise(CxxAbb::MappedFile::AdviceSequential);
+	file.Advise(CxxAbb::MappedFile::AdviceRandom, 5000, 100);
+	file.Advise(CxxAbb::MappedFile::AdviceWillNeed, 20000);
+
+	CxxAbb::BufferView<char> view = file.View(26, 5);
+	ASSERT_EQ (file.Data() + 26, view.begin());
+	ASSERT_EQ (5U, view.size());
+	ASSERT_EQ ("abcde", std::string(view.begin(), view.size()));
+
+	ASSERT_EQ (0U, file.View(file.Size(), 0).size());
+	ASSERT_THROW (file.View(file.Size() - 4, 5), CxxAbb::RangeException);
+	ASSERT_THROW (file.View(file.Size() + 1, 0), CxxAbb::RangeException);
+
+	file.Close();
+	ASSERT_FALSE (file.IsOpen());
+	ASSERT_EQ (0U, file.Size());
+	std::remove(MapFile);
+}
+
+TEST(MappedFileTest, ReadWrite)
+{
+	std::remove(MapFile);
+	{
+		CxxAbb::MappedFile file(MapFile, CxxAbb::MappedFile::ReadWrite, CxxAbb::MappedFile::Shared, 0, 64);
+		ASSERT_EQ (64U, file.Size());
+
+		CxxAbb::BufferView<char> view = file.View(0, file.Size());
+		CxxAbb::Buffer<char> target(view.begin(), view.size());
+		target.size(0);
+		CxxAbb::BinaryWriter writer(target);
+		writer.WriteUInt32(0x01020304);
+		writer.WriteUInt64(42);
+		ASSERT_EQ (file.Data(), target.begin());
+		file.Sync();
+
+		// copies of a view still write to the file
+		std::vector<CxxAbb::BufferView<CxxAbb::UInt32> > lstViews;
+		lstViews.push_back(file.FixedView<CxxAbb::UInt32>(16, 4));
+		CxxAbb::BufferView<CxxAbb::UInt32> words;
+		words = lstViews[0];
+		ASSERT_EQ (reinterpret_cast<CxxAbb::UInt32*>(file.Data() + 16), words.begin());
+		ASSERT_EQ (4U, words.size());
+		words[0] = 7;
+		CxxAbb::BufferView<char> copy(view);
+		copy[63] = 'e';
+		ASSERT_THROW (file.FixedView<CxxAbb::UInt32>(2, 1), CxxAbb::InvalidArgumentException);
+		ASSERT_THROW (file.FixedView<CxxAbb::UInt32>(0, 17), CxxAbb::RangeException);
+	}
+
+	std::string sContent = ReadFile();
+	ASSERT_EQ (64U, sContent.size());
+	CxxAbb::BinaryReader reader(sContent.data(), sContent.size());
+	ASSERT_EQ (0x01020304U, reader.ReadUInt32());
+	ASSERT_EQ (42U, reader.ReadUInt64());
+	ASSERT_EQ (7, sContent[16] + sContent[19]);
+	ASSERT_EQ ('e', sContent[63]);
+
+	// private changes stay in the mapping
+	{
+		CxxAbb::MappedFile file(MapFile, CxxAbb::MappedFile::ReadWrite, CxxAbb::MappedFile::Private);
+		file.Data()[0] = 'x';
+		ASSERT_EQ ('x', file.Data()[0]);
+		file.Sync();
+	}
+	ASSERT_EQ (sContent, ReadFile());
+	std::remove(MapFile);
+}
+
+TEST(MappedFileTest, Flags)
+{
+	std::string sContent(CxxAbb::MappedFile::HugePageSize + 12345, 'h');
+	sContent[sContent.size() - 1] = 'z';
+	WriteFile(sContent);
+
+	CxxAbb::MappedFile file;
+	ASSERT_FALSE (file.IsOpen());
+	file.Open(MapFile, CxxAbb::MappedFile::ReadOnly, CxxAbb::MappedFile::Private,
+			CxxAbb::MappedFile::Populate | CxxAbb::MappedFile::HugePages);
+	ASSERT_EQ (0U, reinterpret_cast<CxxAbb::UPtrT>(file.Data()) % CxxAbb::MappedFile::HugePageSize);
+	ASSERT_EQ (sContent.size(), file.Size());
+	ASSERT_EQ ('z', file.Data()[file.Size() - 1]);
+	ASSERT_EQ (sContent, std::string(file.Data(), file.Size()));
+
+	WriteFile("");
+	file.Open(MapFile);
+	ASSERT_TRUE (file.IsOpen());
+	ASSERT_EQ (0U, file.Size());
+	ASSERT_EQ (0U, file.View(0, 0).size());
+	std::remove(MapFile);
+
+	ASSERT_THROW (file.Open(MapFile), CxxAbb::OpenFileException);
+	ASSERT_FALSE (file.IsOpen());
+	ASSERT_THROW (file.Open(MapFile, CxxAbb::MappedFile::ReadOnly, CxxAbb::MappedFile::Shared, 0, 10),
+			CxxAbb::InvalidArgumentException);
+}
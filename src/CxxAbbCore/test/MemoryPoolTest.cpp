@@ -27,6 +27,8 @@
 
 #include <CxxAbb/Exception.h>
 #include <CxxAbb/MemoryPool.h>
+
+#include <cerrno>
 #include <gtest/gtest.h>
 
 namespace
@@ -88,3 +90,26 @@ TEST(MemoryPoolTest, Allocation)
 	ASSERT_TRUE (pool2.Allocated() == 5);
 }
  
+
+TEST(MemoryPoolTest, TryGet)
+{
+	CxxAbb::MemoryPool pool(sizeof(Stock), 2);
+
+	CxxAbb::Result<void*> first = pool.TryGet();
+	CxxAbb::Result<void*> second = pool.TryGet();
+	ASSERT_TRUE (first.IsOk());
+	ASSERT_TRUE (second.IsOk());
+	ASSERT_NE (first.Value(), second.Value());
+
+	CxxAbb::Result<void*> third = pool.TryGet();
+	ASSERT_TRUE (third.IsError());
+	ASSERT_EQ (ENOMEM, third.Error());
+	ASSERT_THROW (third.Value(), CxxAbb::NullValueException);
+
+	pool.Release(second.Value());
+	third = pool.TryGet();
+	ASSERT_EQ (second.Value(), third.Value());
+
+	pool.Release(first.Value());
+	pool.Release(third.Value());
+}
@@ -0,0 +1,164 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * MetricsTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Metrics
+ * Comment     : Metrics unit tests
+ *
+ */
+
+
+#include <CxxAbb/Metrics/Counter.h>
+#include <CxxAbb/Metrics/Histogram.h>
+#include <CxxAbb/Metrics/Registry.h>
+#include <CxxAbb/Sys/Thread.h>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+void CountMillion(void * _pCounter)
+{
+	CxxAbb::Metrics::Counter * pCounter = static_cast<CxxAbb::Metrics::Counter*>(_pCounter);
+	for (int i = 0; i < 1000000; ++i)
+		pCounter->Increment();
+}
+
+}
+
+TEST(MetricsTest, Counter)
+{
+	CxxAbb::Metrics::Counter counter;
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		threads[i].Start(CountMillion, &counter);
+	}
+	for (int i = 0; i < 4; ++i)
+	{
+		threads[i].Join();
+	}
+	ASSERT_EQ (4000000U, counter.Value());
+
+	counter.Add(5);
+	ASSERT_EQ (4000005U, counter.Value());
+	counter.Reset();
+	ASSERT_EQ (0U, counter.Value());
+}
+
+TEST(MetricsTest, Gauge)
+{
+	CxxAbb::Metrics::Gauge gauge;
+	gauge.Set(10);
+	gauge.Add(5);
+	gauge.Sub(20);
+	ASSERT_EQ (-5, gauge.Value());
+}
+
+TEST(MetricsTest, Buckets)
+{
+	typedef CxxAbb::Metrics::HistogramSnapshot Snapshot;
+
+	for (CxxAbb::UInt64 v = 0; v < 32; ++v)
+	{
+		ASSERT_EQ (v, Snapshot::BucketLow(Snapshot::BucketOf(v)));
+		ASSERT_EQ (v, Snapshot::BucketHigh(Snapshot::BucketOf(v)));
+	}
+
+	CxxAbb::UInt64 uiValues[] = { 32, 33, 1000, 123456789, 0xFFFFFFFFULL, ~static_cast<CxxAbb::UInt64>(0) };
+	for (std::size_t i = 0; i < sizeof(uiValues) / sizeof(uiValues[0]); ++i)
+	{
+		unsigned int uiBucket = Snapshot::BucketOf(uiValues[i]);
+		ASSERT_TRUE (uiBucket < static_cast<unsigned int>(Snapshot::Buckets));
+		ASSERT_TRUE (Snapshot::BucketLow(uiBucket) <= uiValues[i]);
+		ASSERT_TRUE (uiValues[i] <= Snapshot::BucketHigh(uiBucket));
+		// relative bucket width below 1/16
+		ASSERT_TRUE ((Snapshot::BucketHigh(uiBucket) - Snapshot::BucketLow(uiBucket)) <= uiValues[i] / 16);
+	}
+	ASSERT_EQ (static_cast<unsigned int>(Snapshot::Buckets - 1), Snapshot::BucketOf(~static_cast<CxxAbb::UInt64>(0)));
+}
+
+TEST(MetricsTest, Histogram)
+{
+	CxxAbb::Metrics::Histogram histogram;
+	for (CxxAbb::UInt64 v = 1; v <= 10000; ++v)
+	{
+		histogram.Record(v);
+	}
+
+	CxxAbb::Metrics::HistogramSnapshot snapshot;
+	histogram.Snapshot(snapshot);
+	ASSERT_EQ (10000U, snapshot.Count());
+	ASSERT_EQ (50005000U, snapshot.Sum());
+	ASSERT_EQ (10000U, snapshot.Max());
+	ASSERT_NEAR (5000.5, snapshot.Mean(), 0.001);
+	ASSERT_NEAR (5000.0, static_cast<double>(snapshot.Percentile(50)), 5000.0 / 16);
+	ASSERT_NEAR (9900.0, static_cast<double>(snapshot.Percentile(99)), 9900.0 / 16);
+	ASSERT_EQ (10000U, snapshot.Percentile(100));
+
+	CxxAbb::Metrics::HistogramSnapshot merged;
+	merged.Merge(snapshot);
+	merged.Merge(snapshot);
+	ASSERT_EQ (20000U, merged.Count());
+	ASSERT_EQ (snapshot.Percentile(50), merged.Percentile(50));
+
+	histogram.Reset();
+	histogram.Snapshot(snapshot);
+	ASSERT_EQ (0U, snapshot.Count());
+	ASSERT_EQ (0U, snapshot.Percentile(50));
+}
+
+TEST(MetricsTest, Registry)
+{
+	CxxAbb::Metrics::Registry registry;
+	CxxAbb::Metrics::Counter & requests = registry.GetCounter("requests_total", "Served requests");
+	ASSERT_EQ (&requests, &registry.GetCounter("requests_total"));
+	ASSERT_THROW (registry.GetGauge("requests_total"), CxxAbb::InvalidArgumentException);
+
+	requests.Add(3);
+	registry.GetGauge("queue_depth").Set(7);
+	CxxAbb::Metrics::Histogram & latency = registry.GetHistogram("latency", "Request latency");
+	latency.Record(100);
+	{
+		CxxAbb::Metrics::ScopedTimer timer(latency);
+	}
+
+	CxxAbb::Metrics::MetricsSnapshot snapshot;
+	registry.Snapshot(snapshot);
+	snapshot.Merge(snapshot);
+	ASSERT_EQ (6U, snapshot.Metrics()["requests_total"].ui_Counter);
+	ASSERT_EQ (14, snapshot.Metrics()["queue_depth"].i_Gauge);
+	ASSERT_EQ (4U, snapshot.Metrics()["latency"].m_Histogram.Count());
+
+	std::ostringstream os;
+	registry.Expose(os);
+	const std::string sText = os.str();
+	ASSERT_NE (std::string::npos, sText.find("# HELP requests_total Served requests\n"));
+	ASSERT_NE (std::string::npos, sText.find("# TYPE requests_total counter\nrequests_total 3\n"));
+	ASSERT_NE (std::string::npos, sText.find("queue_depth 7\n"));
+	ASSERT_NE (std::string::npos, sText.find("latency_count 2\n"));
+	ASSERT_NE (std::string::npos, sText.find("latency{quantile=\"0.99\"} 100\n"));
+
+	ASSERT_EQ (&CxxAbb::Metrics::Registry::Default(), &CxxAbb::Metrics::Registry::Default());
+}
@@ -0,0 +1,255 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ParallelTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Threading
+ * Comment     : ThreadPool and parallel algorithm unit tests
+ *
+ */
+
+
+#include <CxxAbb/Sys/Parallel.h>
+#include <CxxAbb/Sys/ThreadPool.h>
+#include <CxxAbb/Buffer.h>
+
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+CxxAbb::Sys::Atomic<int> g_Runs(0);
+
+class CountTask: public CxxAbb::Runnable
+{
+public:
+	void Run()
+	{
+		g_Runs.FetchAdd(1);
+	}
+};
+
+class Square
+{
+public:
+	void operator()(CxxAbb::UInt32 * _pBegin, CxxAbb::UInt32 * _pEnd) const
+	{
+		for (; _pBegin != _pEnd; ++_pBegin)
+			*_pBegin = *_pBegin * *_pBegin;
+	}
+};
+
+class MarkVisits
+{
+public:
+	explicit MarkVisits(std::vector<int> & _visits): p_Visits(&_visits) {}
+
+	void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		for (std::size_t i = _tBegin; i < _tEnd; ++i)
+			++(*p_Visits)[i];
+	}
+
+private:
+	std::vector<int> * p_Visits;
+};
+
+class Checksum: public std::binary_function<const CxxAbb::UInt32 *, const CxxAbb::UInt32 *, CxxAbb::UInt64>
+{
+public:
+	CxxAbb::UInt64 operator()(const CxxAbb::UInt32 * _pBegin, const CxxAbb::UInt32 * _pEnd) const
+	{
+		CxxAbb::UInt64 uiSum = 0;
+		for (; _pBegin != _pEnd; ++_pBegin)
+			uiSum += *_pBegin;
+		return uiSum;
+	}
+};
+
+/// Range to string, to check combine order
+class Digits
+{
+public:
+	std::string operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		std::string s;
+		for (std::size_t i = _tBegin; i < _tEnd; ++i)
+			s += static_cast<char>('0' + i % 10);
+		return s;
+	}
+};
+
+class Concat
+{
+public:
+	std::string operator()(const std::string & _a, const std::string & _b) const
+	{
+		return _a + _b;
+	}
+};
+
+class Fails
+{
+public:
+	void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		if (_tBegin <= 500 && 500 < _tEnd)
+			throw CxxAbb::DataException("bad element");
+	}
+};
+
+/// Parallel loop inside a parallel loop
+class Nested
+{
+public:
+	explicit Nested(CxxAbb::Sys::ThreadPool & _pool): p_Pool(&_pool) {}
+
+	void operator()(std::size_t _tBegin, std::size_t _tEnd) const
+	{
+		for (std::size_t i = _tBegin; i < _tEnd; ++i)
+		{
+			std::vector<int> vVisits(100);
+			CxxAbb::Sys::ParallelFor(0, vVisits.size(), MarkVisits(vVisits), 1, *p_Pool);
+			g_Runs.FetchAdd(static_cast<int>(std::count(vVisits.begin(), vVisits.end(), 1)));
+		}
+	}
+
+private:
+	CxxAbb::Sys::ThreadPool * p_Pool;
+};
+
+}
+
+TEST(ParallelTest, ThreadPool)
+{
+	g_Runs.Store(0);
+	{
+		CxxAbb::Sys::ThreadPool pool(3);
+		ASSERT_EQ (3U, pool.ThreadCount());
+		for (int i = 0; i < 1000; ++i)
+		{
+			pool.Execute(new CountTask);
+		}
+		while (pool.RunPending())
+		{
+		}
+	}
+	// destructor finishes queued tasks
+	ASSERT_EQ (1000, g_Runs.Load());
+	ASSERT_TRUE (CxxAbb::Sys::ThreadPool::Default().ThreadCount() >= 1);
+}
+
+TEST(ParallelTest, ForVisitsOnce)
+{
+	CxxAbb::Sys::ThreadPool pool(4);
+	std::vector<int> vVisits(100000);
+	CxxAbb::Sys::ParallelFor(0, vVisits.size(), MarkVisits(vVisits), 0, pool);
+	ASSERT_EQ (vVisits.size(), static_cast<std::size_t>(std::count(vVisits.begin(), vVisits.end(), 1)));
+
+	std::vector<int> vSmall(10);
+	CxxAbb::Sys::ParallelFor(3, 7, MarkVisits(vSmall), 1, pool);
+	CxxAbb::Sys::ParallelFor(7, 7, MarkVisits(vSmall), 1, pool);
+	ASSERT_EQ (4, std::count(vSmall.begin(), vSmall.end(), 1));
+}
+
+TEST(ParallelTest, ForBuffer)
+{
+	CxxAbb::Buffer<CxxAbb::UInt32> buffer(50000);
+	buffer.size(50000);
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+		buffer[i] = static_cast<CxxAbb::UInt32>(i);
+
+	CxxAbb::Sys::ParallelFor(buffer, Square(), 100);
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+	{
+		ASSERT_EQ (static_cast<CxxAbb::UInt32>(i * i), buffer[i]);
+	}
+}
+
+TEST(ParallelTest, Reduce)
+{
+	CxxAbb::Buffer<CxxAbb::UInt32> buffer(100000);
+	buffer.size(100000);
+	CxxAbb::UInt64 uiExpected = 0;
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+	{
+		buffer[i] = static_cast<CxxAbb::UInt32>(i * 7);
+		uiExpected += buffer[i];
+	}
+
+	CxxAbb::UInt64 uiSum = CxxAbb::Sys::ParallelReduce(buffer, CxxAbb::UInt64(0), Checksum(), std::plus<CxxAbb::UInt64>());
+	ASSERT_EQ (uiExpected, uiSum);
+
+	// not commutative, order must be kept
+	CxxAbb::Sys::ThreadPool pool(4);
+	std::string s = CxxAbb::Sys::ParallelReduce(0, 1000, std::string(), Digits(), Concat(), 7, pool);
+	ASSERT_EQ (Digits()(0, 1000), s);
+}
+
+TEST(ParallelTest, Sort)
+{
+	CxxAbb::Sys::ThreadPool pool(4);
+	std::vector<int> v(200000);
+	for (std::size_t i = 0; i < v.size(); ++i)
+		v[i] = static_cast<int>((i * 2654435761U) % 100003);
+	std::vector<int> vExpected(v);
+	std::sort(vExpected.begin(), vExpected.end());
+
+	CxxAbb::Sys::ParallelSort(&v[0], &v[0] + v.size(), std::less<int>(), 1000, pool);
+	ASSERT_TRUE (v == vExpected);
+
+	CxxAbb::Buffer<int> buffer(&v[0], v.size());
+	std::reverse(buffer.begin(), buffer.end());
+	CxxAbb::Sys::ParallelSort(buffer, std::greater<int>(), 0, pool);
+	ASSERT_TRUE (std::equal(buffer.begin(), buffer.end(), vExpected.rbegin()));
+}
+
+TEST(ParallelTest, Exception)
+{
+	CxxAbb::Sys::ThreadPool pool(2);
+	ASSERT_THROW (CxxAbb::Sys::ParallelFor(0, 1000, Fails(), 10, pool), CxxAbb::DataException);
+
+	// pool still usable
+	std::vector<int> vVisits(1000);
+	CxxAbb::Sys::ParallelFor(0, vVisits.size(), MarkVisits(vVisits), 10, pool);
+	ASSERT_EQ (1000, std::count(vVisits.begin(), vVisits.end(), 1));
+}
+
+TEST(ParallelTest, Nested)
+{
+	g_Runs.Store(0);
+	CxxAbb::Sys::ThreadPool pool(2);
+	CxxAbb::Sys::ParallelFor(0, 50, Nested(pool), 1, pool);
+	ASSERT_EQ (5000, g_Runs.Load());
+}
+
+TEST(ParallelTest, ManySmallJobs)
+{
+	// each job lives on the stack of ParallelFor, tasks finishing just before
+	// Join() returns must not touch it after it is gone
+	CxxAbb::Sys::ThreadPool pool(4);
+	std::vector<int> vVisits(8);
+	for (int i = 0; i < 20000; ++i)
+		CxxAbb::Sys::ParallelFor(0, vVisits.size(), MarkVisits(vVisits), 1, pool);
+	ASSERT_EQ (8, std::count(vVisits.begin(), vVisits.end(), 20000));
+}
@@ -75,6 +75,37 @@ public:
 private:
 };
 
+template <class CountPolicy>
+class IntrusiveTestClass : public CxxAbb::IntrusiveRefCounted<IntrusiveTestClass<CountPolicy>, CountPolicy>
+{
+public:
+	IntrusiveTestClass()
+	{
+		i_GlbCount++;
+	}
+
+	virtual ~IntrusiveTestClass()
+	{
+		i_GlbCount--;
+	}
+
+	static int i_GlbCount;
+};
+
+template <class CountPolicy>
+int IntrusiveTestClass<CountPolicy>::i_GlbCount = 0;
+
+class IntrusiveDerivedClass : public IntrusiveTestClass<CxxAbb::AtomicRefCount>
+{
+};
+
+/// No virtual function at all, the base adds only the counter
+class PlainValue : public CxxAbb::IntrusiveRefCounted<PlainValue, CxxAbb::PlainRefCount>
+{
+public:
+	int i_Value;
+};
+
 }
 
 TEST(RefCountedObjTest, Constructor)
@@ -294,3 +325,67 @@ TEST(RefCountedObjTest, Casting)
 }
 
 
+
+template <class CountPolicy>
+void IntrusiveLifetime()
+{
+	typedef IntrusiveTestClass<CountPolicy> Object;
+	{
+		CxxAbb::IntrusivePtr<Object> varIT1(new Object);
+		EXPECT_EQ(1, Object::i_GlbCount);
+		EXPECT_EQ(1u, varIT1->refCount());
+
+		CxxAbb::IntrusivePtr<Object> varIT2(varIT1);
+		EXPECT_EQ(2u, varIT1->refCount());
+
+		CxxAbb::IntrusivePtr<Object> varIT3;
+		EXPECT_TRUE(varIT3.isNull());
+		varIT3 = varIT2;
+		EXPECT_EQ(3u, varIT1->refCount());
+
+		varIT2.reset();
+		EXPECT_TRUE(!varIT2);
+		EXPECT_EQ(2u, varIT1->refCount());
+
+		varIT3.assign(new Object);
+		EXPECT_EQ(2, Object::i_GlbCount);
+		EXPECT_EQ(1u, varIT1->refCount());
+
+		Object * pRaw = varIT1.duplicate();
+		EXPECT_EQ(2u, pRaw->refCount());
+		CxxAbb::IntrusivePtr<Object> varIT4(pRaw);
+		EXPECT_TRUE(varIT4 == varIT1);
+
+		swap(varIT3, varIT4);
+		EXPECT_TRUE(varIT3 == varIT1);
+	}
+	EXPECT_EQ(0, Object::i_GlbCount);
+}
+
+TEST(RefCountedObjTest, Intrusive)
+{
+	IntrusiveLifetime<CxxAbb::PlainRefCount>();
+	IntrusiveLifetime<CxxAbb::AtomicRefCount>();
+
+	// deleted as the most derived type through the virtual destructor
+	{
+		CxxAbb::IntrusivePtr<IntrusiveDerivedClass> varID1(new IntrusiveDerivedClass);
+		CxxAbb::IntrusivePtr<IntrusiveTestClass<CxxAbb::AtomicRefCount> > varIT1 = varID1;
+		EXPECT_EQ(2u, varIT1->refCount());
+
+		CxxAbb::IntrusivePtr<IntrusiveDerivedClass> varID2 =
+				varIT1.cast<IntrusiveDerivedClass>();
+		EXPECT_FALSE(varID2.isNull());
+		EXPECT_EQ(3u, varID2->refCount());
+	}
+	EXPECT_EQ(0, IntrusiveTestClass<CxxAbb::AtomicRefCount>::i_GlbCount);
+
+	// usable with AutoPtr as well
+	{
+		CxxAbb::AutoPtr<PlainValue> varPV1(new PlainValue);
+		CxxAbb::AutoPtr<PlainValue> varPV2(varPV1);
+		EXPECT_EQ(2u, varPV1->refCount());
+	}
+
+	EXPECT_EQ(sizeof(unsigned int), sizeof(CxxAbb::IntrusiveRefCounted<PlainValue, CxxAbb::PlainRefCount>));
+}
@@ -0,0 +1,133 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ResultTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : Result unit tests
+ *
+ */
+
+
+
+#include <CxxAbb/Result.h>
+#include <CxxAbb/Exception.h>
+
+#include <cerrno>
+#include <string>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+/// No default constructor, counts live instances
+class Tracked
+{
+public:
+	explicit Tracked(int _iValue) : i_Value(_iValue)
+	{
+		++i_Live;
+	}
+
+	Tracked(const Tracked & _rhs) : i_Value(_rhs.i_Value)
+	{
+		++i_Live;
+	}
+
+	~Tracked()
+	{
+		--i_Live;
+	}
+
+	int i_Value;
+	static int i_Live;
+};
+
+int Tracked::i_Live = 0;
+
+CxxAbb::Result<int> Parse(const char * _zText)
+{
+	if (!_zText || !*_zText)
+		return CxxAbb::Fail(EINVAL);
+
+	int iValue = 0;
+	for (; *_zText; ++_zText)
+	{
+		if (*_zText < '0' || *_zText > '9')
+			return CxxAbb::Fail(EINVAL);
+		iValue = iValue * 10 + (*_zText - '0');
+	}
+	return iValue;
+}
+
+CxxAbb::Result<void, std::string> Check(bool _bOk)
+{
+	if (_bOk)
+		return CxxAbb::Result<void, std::string>();
+	return CxxAbb::Fail(std::string("not ok"));
+}
+
+}
+
+TEST(ResultTest, ValueOrError)
+{
+	CxxAbb::Result<int> ok = Parse("1234");
+	ASSERT_TRUE (ok.IsOk());
+	ASSERT_FALSE (ok.IsError());
+	ASSERT_EQ (1234, ok.Value());
+	ASSERT_EQ (0, ok.Error());
+
+	CxxAbb::Result<int> bad = Parse("12a4");
+	ASSERT_TRUE (bad.IsError());
+	ASSERT_EQ (EINVAL, bad.Error());
+	ASSERT_EQ (-1, bad.Value(-1));
+	ASSERT_THROW (bad.Value(), CxxAbb::NullValueException);
+
+	bad = ok;
+	ASSERT_EQ (1234, bad.Value());
+
+	ASSERT_TRUE (Check(true).IsOk());
+	ASSERT_EQ ("not ok", Check(false).Error());
+}
+
+TEST(ResultTest, Lifetime)
+{
+	{
+		CxxAbb::Result<Tracked> failed = CxxAbb::Fail(ENOENT);
+		ASSERT_EQ (0, Tracked::i_Live);
+
+		CxxAbb::Result<Tracked> value = Tracked(7);
+		ASSERT_EQ (1, Tracked::i_Live);
+		ASSERT_EQ (7, value.Value().i_Value);
+
+		CxxAbb::Result<Tracked> copy(value);
+		ASSERT_EQ (2, Tracked::i_Live);
+
+		copy = failed;
+		ASSERT_EQ (1, Tracked::i_Live);
+		ASSERT_EQ (ENOENT, copy.Error());
+
+		failed = value;
+		ASSERT_EQ (2, Tracked::i_Live);
+		ASSERT_EQ (7, failed.Value().i_Value);
+	}
+	ASSERT_EQ (0, Tracked::i_Live);
+}
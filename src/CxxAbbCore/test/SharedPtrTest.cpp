@@ -27,6 +27,7 @@
 
 #include <CxxAbb/Exception.h>
 #include <CxxAbb/SmartPtr.h>
+#include <CxxAbb/Sys/Thread.h>
 #include <gtest/gtest.h>
 
 namespace {
@@ -64,6 +65,19 @@ private:
 
 int TestClass::i_GlbCount = 0;
 
+typedef CxxAbb::SmartPtr<int, CxxAbb::DeleteDestroyPolicy<int>,
+		CxxAbb::AtomicExternalRefCounter<int, CxxAbb::DeleteDestroyPolicy<int> > > AtomicIntPtr;
+
+void CopyAndDrop(void * _pShared)
+{
+	const AtomicIntPtr & shared = *static_cast<AtomicIntPtr*>(_pShared);
+	for (int i = 0; i < 100000; ++i)
+	{
+		AtomicIntPtr copy(shared);
+		ASSERT_EQ (7, *copy);
+	}
+}
+
 class DerivedTestClass : public TestClass
 {
 public:
@@ -212,4 +226,14 @@ TEST(SharedPtrTest, Operators2)
 //	ASSERT_TRUE (TestClass::count() == 1);
 //	ASSERT_TRUE (ptr2.get() == 0);
 }
- 
+
+TEST(SharedPtrTest, AtomicCounter)
+{
+	AtomicIntPtr shared(new int(7));
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+		threads[i].Start(CopyAndDrop, &shared);
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+	ASSERT_EQ (1U, shared.refCount());
+}
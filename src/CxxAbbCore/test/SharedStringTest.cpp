@@ -0,0 +1,243 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * ConcurrentHashMapTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Core
+ * Comment     : SharedString and InternedString unit tests
+ *
+ */
+
+
+#include <CxxAbb/SharedString.h>
+#include <CxxAbb/InternedString.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+
+namespace
+{
+
+const char * const Names[] = { "alpha", "beta", "gamma", "a name well past the inline limit", "delta" };
+
+struct InternArgs
+{
+	CxxAbb::InternedString a_Handles[5];
+};
+
+void InternAll(void * _pArgs)
+{
+	InternArgs & args = *static_cast<InternArgs*>(_pArgs);
+	for (int iRound = 0; iRound < 1000; ++iRound)
+	{
+		for (int i = 0; i < 5; ++i)
+			args.a_Handles[i] = CxxAbb::InternedString(Names[i]);
+	}
+}
+
+struct WhatArgs
+{
+	const CxxAbb::Exception * p_Shared;
+	const char * z_What;
+};
+
+void ReadWhat(void * _pArgs)
+{
+	WhatArgs & args = *static_cast<WhatArgs*>(_pArgs);
+	for (int iRound = 0; iRound < 1000; ++iRound)
+		args.z_What = args.p_Shared->what();
+}
+
+/// Written without the macros, builds its what() text like they do
+class QuotaException: public CxxAbb::RuntimeException
+{
+public:
+	explicit QuotaException(const std::string & _sMsg)
+		: CxxAbb::RuntimeException(_sMsg, 0, DeferWhat())
+	{
+		BuildWhat();
+	}
+
+	const char * Name() const throw()
+	{
+		return "Quota exceeded";
+	}
+};
+
+}
+
+TEST(SharedStringTest, Inline)
+{
+	CxxAbb::SharedString empty;
+	ASSERT_TRUE (empty.empty());
+	ASSERT_EQ (0U, empty.size());
+	ASSERT_STREQ ("", empty.c_str());
+	ASSERT_TRUE (empty.IsInline());
+	ASSERT_EQ (16U, sizeof(CxxAbb::SharedString));
+
+	CxxAbb::SharedString full("123456789012345");
+	ASSERT_TRUE (full.IsInline());
+	ASSERT_EQ (15U, full.size());
+	ASSERT_STREQ ("123456789012345", full.c_str());
+
+	CxxAbb::SharedString copy(full);
+	ASSERT_TRUE (copy == full);
+	ASSERT_NE (copy.data(), full.data());
+
+	CxxAbb::SharedString embedded("a\0b", 3);
+	ASSERT_EQ (3U, embedded.size());
+	ASSERT_EQ (std::string("a\0b", 3), embedded.str());
+}
+
+TEST(SharedStringTest, Shared)
+{
+	std::string sLong(100, 'x');
+	CxxAbb::SharedString value(sLong);
+	ASSERT_FALSE (value.IsInline());
+	ASSERT_EQ (100U, value.size());
+	ASSERT_EQ (sLong, value.str());
+	ASSERT_EQ ('\0', value.c_str()[100]);
+
+	CxxAbb::SharedString copy(value);
+	ASSERT_EQ (value.data(), copy.data());
+
+	CxxAbb::SharedString assigned("short");
+	assigned = copy;
+	ASSERT_EQ (value.data(), assigned.data());
+	value = CxxAbb::SharedString("other");
+	ASSERT_EQ (sLong, copy.str());
+	ASSERT_EQ (sLong, assigned.str());
+
+	copy.swap(value);
+	ASSERT_TRUE (copy == "other");
+	ASSERT_TRUE (value == sLong);
+}
+
+TEST(SharedStringTest, Compare)
+{
+	CxxAbb::SharedString abc("abc");
+	ASSERT_TRUE (abc == "abc");
+	ASSERT_TRUE ("abc" == abc);
+	ASSERT_TRUE (abc == std::string("abc"));
+	ASSERT_TRUE (abc != "abd");
+	ASSERT_TRUE (abc != "ab");
+	ASSERT_TRUE (abc < CxxAbb::SharedString("abd"));
+	ASSERT_TRUE (CxxAbb::SharedString("ab") < abc);
+	ASSERT_EQ (0, abc.compare("abc", 3));
+	ASSERT_GT (abc.compare("ab", 2), 0);
+
+	CxxAbb::Hash<CxxAbb::SharedString> hash;
+	ASSERT_EQ (hash(abc), hash("abc"));
+	ASSERT_EQ (hash(abc), hash(std::string("abc")));
+
+	std::ostringstream oss;
+	oss << abc << CxxAbb::SharedString(std::string(20, 'y'));
+	ASSERT_EQ ("abc" + std::string(20, 'y'), oss.str());
+}
+
+TEST(SharedStringTest, ExceptionMessage)
+{
+	CxxAbb::RuntimeException ex(std::string(40, 'm'));
+	CxxAbb::RuntimeException copy(ex);
+	ASSERT_EQ (ex.Message().data(), copy.Message().data());
+	ASSERT_EQ ("Runtime exception: " + std::string(40, 'm'), std::string(copy.what()));
+	ASSERT_EQ (copy.what(), copy.what());
+
+	// built by the most derived constructor, kept by copies and assignment
+	CxxAbb::OpenFileException open("/no/such/file");
+	ASSERT_STREQ ("Cannot open file: /no/such/file", open.what());
+	CxxAbb::OpenFileException assigned("other");
+	assigned = open;
+	ASSERT_STREQ (open.what(), assigned.what());
+	CxxAbb::Exception * pClone = open.Clone();
+	ASSERT_STREQ (open.what(), pClone->what());
+	delete pClone;
+
+	// intermediate classes leave the text to the most derived one
+	CxxAbb::PathSyntaxException path("a//b");
+	ASSERT_STREQ ("Bad path syntax: a//b", path.what());
+	QuotaException quota("disk");
+	ASSERT_STREQ ("Quota exceeded: disk", quota.what());
+
+	// what() only reads, threads sharing one exception see the same text
+	WhatArgs args[4];
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		args[i].p_Shared = &ex;
+		threads[i].Start(ReadWhat, &args[i]);
+	}
+	for (int i = 0; i < 4; ++i)
+	{
+		threads[i].Join();
+		ASSERT_EQ (ex.what(), args[i].z_What);
+	}
+}
+
+TEST(InternedStringTest, Basic)
+{
+	CxxAbb::InternedString empty;
+	ASSERT_TRUE (empty.empty());
+	ASSERT_TRUE (empty == CxxAbb::InternedString(""));
+	ASSERT_TRUE (empty == CxxAbb::InternedString(std::string()));
+
+	CxxAbb::InternedString a("interned.a");
+	CxxAbb::InternedString b(std::string("interned.") + "a");
+	CxxAbb::InternedString c(CxxAbb::SharedString("interned.c"));
+	ASSERT_TRUE (a == b);
+	ASSERT_TRUE (a != c);
+	ASSERT_EQ (a.c_str(), b.c_str());
+	ASSERT_EQ ("interned.a", a.str());
+	ASSERT_EQ (10U, a.size());
+	ASSERT_EQ (a.HashValue(), CxxAbb::Hash<CxxAbb::InternedString>()(b));
+	ASSERT_EQ (CxxAbb::HashBytes("interned.a", 10), a.HashValue());
+	ASSERT_TRUE (a < c || c < a);
+
+	std::size_t tSize = CxxAbb::InternedString::TableSize();
+	CxxAbb::InternedString again("interned.c");
+	ASSERT_EQ (tSize, CxxAbb::InternedString::TableSize());
+	CxxAbb::InternedString fresh("interned.fresh");
+	ASSERT_EQ (tSize + 1, CxxAbb::InternedString::TableSize());
+
+	std::ostringstream oss;
+	oss << fresh;
+	ASSERT_EQ ("interned.fresh", oss.str());
+}
+
+TEST(InternedStringTest, Threads)
+{
+	InternArgs * pArgs = new InternArgs[4];
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+		threads[i].Start(InternAll, &pArgs[i]);
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+
+	for (int i = 0; i < 5; ++i)
+	{
+		ASSERT_EQ (std::string(Names[i]), pArgs[0].a_Handles[i].str());
+		for (int j = 1; j < 4; ++j)
+			ASSERT_TRUE (pArgs[0].a_Handles[i] == pArgs[j].a_Handles[i]);
+	}
+	delete [] pArgs;
+}
@@ -0,0 +1,159 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * SingletonTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Pattern
+ * Comment     : Singleton and CallOnce unit tests
+ *
+ */
+
+
+#include <CxxAbb/Singleton.h>
+#include <CxxAbb/Exception.h>
+#include <CxxAbb/ExceptionHandler.h>
+#include <CxxAbb/Sys/CallOnce.h>
+#include <CxxAbb/Sys/Thread.h>
+
+#include <string>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+CxxAbb::Sys::Atomic<int> g_Constructed(0);
+std::string g_Order;
+
+class Counted: public CxxAbb::Dp::Singleton<Counted>
+{
+	friend class CxxAbb::Dp::Singleton<Counted>;
+
+private:
+	Counted()
+	{
+		g_Constructed.FetchAdd(1);
+		// widen the window for racing first callers
+		CxxAbb::Sys::Thread::Sleep(20);
+	}
+};
+
+class Inner: public CxxAbb::Dp::Singleton<Inner>
+{
+	friend class CxxAbb::Dp::Singleton<Inner>;
+
+private:
+	Inner() {}
+	~Inner() { g_Order += "Inner;"; }
+};
+
+/// Uses Inner in constructor, so must be destroyed before Inner
+class Outer: public CxxAbb::Dp::Singleton<Outer>
+{
+	friend class CxxAbb::Dp::Singleton<Outer>;
+
+private:
+	Outer() { Inner::Instance(); }
+	~Outer() { g_Order += "Outer;"; }
+};
+
+int g_Attempts = 0;
+
+class Flaky: public CxxAbb::Dp::Singleton<Flaky>
+{
+	friend class CxxAbb::Dp::Singleton<Flaky>;
+
+private:
+	Flaky()
+	{
+		if (++g_Attempts == 1)
+			throw CxxAbb::SystemException("first construction fails");
+	}
+};
+
+void GetCounted(void * _pResult)
+{
+	*static_cast<Counted**>(_pResult) = Counted::Instance();
+}
+
+int g_Calls = 0;
+
+void Increment()
+{
+	++g_Calls;
+}
+
+}
+
+TEST(SingletonTest, ConcurrentInstance)
+{
+	const int iThreads = 8;
+	CxxAbb::Sys::Thread threads[iThreads];
+	Counted * pInstances[iThreads];
+	for (int i = 0; i < iThreads; ++i)
+	{
+		threads[i].Start(GetCounted, &pInstances[i]);
+	}
+	for (int i = 0; i < iThreads; ++i)
+	{
+		threads[i].Join();
+	}
+
+	ASSERT_EQ (1, g_Constructed.Load());
+	for (int i = 0; i < iThreads; ++i)
+	{
+		ASSERT_EQ (Counted::Instance(), pInstances[i]);
+	}
+}
+
+TEST(SingletonTest, ReverseDependencyOrder)
+{
+	g_Order.clear();
+	Outer * pOuter = Outer::Instance();
+	ASSERT_TRUE (pOuter != CxxAbb::NullPtr);
+	ASSERT_TRUE (CxxAbb::Dp::SingletonRegistry::Count() >= 2);
+
+	CxxAbb::Dp::SingletonRegistry::DestroyAll();
+	ASSERT_EQ ("Outer;Inner;", g_Order);
+	ASSERT_EQ (0U, CxxAbb::Dp::SingletonRegistry::Count());
+
+	// library singletons come back on next use
+	ASSERT_TRUE (CxxAbb::ThreadErrorHandler::Get() != CxxAbb::NullPtr);
+	ASSERT_EQ (1U, CxxAbb::Dp::SingletonRegistry::Count());
+	ASSERT_TRUE (Inner::Instance() != CxxAbb::NullPtr);
+	ASSERT_EQ (2U, CxxAbb::Dp::SingletonRegistry::Count());
+}
+
+TEST(SingletonTest, ConstructorThrows)
+{
+	ASSERT_THROW (Flaky::Instance(), CxxAbb::SystemException);
+	ASSERT_TRUE (Flaky::Instance() != CxxAbb::NullPtr);
+	ASSERT_EQ (2, g_Attempts);
+}
+
+TEST(SingletonTest, CallOnce)
+{
+	static CxxAbb::Sys::OnceFlag s_Once = CXXABB_ONCE_INIT;
+	ASSERT_FALSE (s_Once.IsDone());
+	CxxAbb::Sys::CallOnce(s_Once, &Increment);
+	CxxAbb::Sys::CallOnce(s_Once, &Increment);
+	ASSERT_TRUE (s_Once.IsDone());
+	ASSERT_EQ (1, g_Calls);
+}
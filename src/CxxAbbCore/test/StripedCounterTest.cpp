@@ -0,0 +1,107 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * StripedCounterTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : System
+ * Comment     : StripedCounter and CacheAligned unit tests
+ *
+ */
+
+
+
+#include <CxxAbb/Sys/StripedCounter.h>
+#include <CxxAbb/Sys/CacheAligned.h>
+#include <CxxAbb/Sys/AtomicOps.h>
+#include <CxxAbb/Sys/Thread.h>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+void CountUpDown(void * _pCounter)
+{
+	CxxAbb::Sys::StripedCounter & counter = *static_cast<CxxAbb::Sys::StripedCounter*>(_pCounter);
+	for (int i = 0; i < 100000; ++i)
+	{
+		++counter;
+		counter += 3;
+		counter.Sub(2);
+	}
+	--counter;
+}
+
+bool LineAligned(const void * _p)
+{
+	return reinterpret_cast<CxxAbb::UPtrT>(_p) % CxxAbb::Sys::CacheLineSize == 0;
+}
+
+}
+
+TEST(StripedCounterTest, Threads)
+{
+	CxxAbb::Sys::StripedCounter counter;
+	ASSERT_EQ (0, counter.Value());
+
+	CxxAbb::Sys::Thread threads[4];
+	for (int i = 0; i < 4; ++i)
+		threads[i].Start(CountUpDown, &counter);
+	for (int i = 0; i < 4; ++i)
+		threads[i].Join();
+
+	ASSERT_EQ (4 * (2 * 100000 - 1), counter.Value());
+
+	counter.Reset();
+	ASSERT_EQ (0, counter.Value());
+	counter.Add(-5);
+	ASSERT_EQ (-5, counter.Value());
+}
+
+TEST(StripedCounterTest, CacheAligned)
+{
+	ASSERT_EQ (CxxAbb::Sys::CacheLineSize, sizeof(CxxAbb::Sys::CacheAligned<char>));
+	ASSERT_EQ (2 * CxxAbb::Sys::CacheLineSize, sizeof(CxxAbb::Sys::CacheAligned<char[65]>));
+
+	CxxAbb::Sys::CacheAligned<CxxAbb::Sys::Atomic<long> > aCounters[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		ASSERT_TRUE (LineAligned(&aCounters[i]));
+		aCounters[i]->Store(i);
+	}
+	ASSERT_EQ (2, (*aCounters[2]).Load());
+
+	CxxAbb::Sys::CacheAligned<int> * pValue = new CxxAbb::Sys::CacheAligned<int>(7);
+	ASSERT_TRUE (LineAligned(pValue));
+	ASSERT_EQ (7, pValue->Value());
+	delete pValue;
+
+	CxxAbb::Sys::CacheAligned<int> * pValues = new CxxAbb::Sys::CacheAligned<int>[5];
+	for (int i = 0; i < 5; ++i)
+	{
+		ASSERT_TRUE (LineAligned(&pValues[i]));
+		ASSERT_EQ (0, pValues[i].Value());
+	}
+	delete [] pValues;
+
+	CxxAbb::Sys::CachePadded<int> padded(3);
+	ASSERT_EQ (3, *padded);
+	ASSERT_LE (sizeof(int) + 2 * CxxAbb::Sys::CacheLineSize, sizeof(padded));
+}
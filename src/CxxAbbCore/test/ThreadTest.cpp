@@ -28,6 +28,7 @@
 
 #include <CxxAbb/Sys/Thread.h>
 #include <CxxAbb/Sys/SignalToException.h>
+#include <CxxAbb/Sys/WaitCondition.h>
 #include <CxxAbb/Timespan.h>
 
 #include <cstdlib>
@@ -110,6 +111,74 @@ private:
 
 int MyRunnable::_staticVar = 0;
 
+class WaitRunnable: public CxxAbb::Runnable
+{
+public:
+	WaitRunnable(CxxAbb::Sys::FastMutex & mutex, CxxAbb::Sys::WaitCondition & condition)
+	: _mutex(mutex), _condition(condition)
+	{
+	}
+
+	void Run()
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(_mutex);
+		_condition.Wait(_mutex);
+	}
+
+private:
+	CxxAbb::Sys::FastMutex & _mutex;
+	CxxAbb::Sys::WaitCondition & _condition;
+};
+
+/// Records the order in which waiters wake, i_Queued counts the ones inside Wait()
+struct WakeOrder
+{
+	WakeOrder() : i_Queued(0), i_Woken(0)
+	{}
+
+	CxxAbb::Sys::FastMutex m_Mutex;
+	CxxAbb::Sys::WaitCondition m_Condition;
+	int i_Queued;
+	int i_Woken;
+	int a_Woken[3];
+};
+
+class OrderedWaitRunnable: public CxxAbb::Runnable
+{
+public:
+	OrderedWaitRunnable(WakeOrder & order, int id)
+	: _order(order), _id(id)
+	{
+	}
+
+	void Run()
+	{
+		CxxAbb::Sys::FastMutex::ScopedLock lock(_order.m_Mutex);
+		++_order.i_Queued;
+		_order.m_Condition.Wait(_order.m_Mutex);
+		_order.a_Woken[_order.i_Woken++] = _id;
+	}
+
+private:
+	WakeOrder & _order;
+	int _id;
+};
+
+/// Wait() queues the caller before it gives up the mutex, so holding the mutex
+/// with the count reached means the waiter is in the queue
+void WaitForCount(CxxAbb::Sys::FastMutex & _mutex, const int & _iCount, int _iExpected)
+{
+	for (;;)
+	{
+		{
+			CxxAbb::Sys::FastMutex::ScopedLock lock(_mutex);
+			if (_iCount == _iExpected)
+				return;
+		}
+		CxxAbb::Sys::Thread::Sleep(1);
+	}
+}
+
 void freeFunc()
 {
 	++MyRunnable::_staticVar;
@@ -223,6 +292,70 @@ TEST(ThreadTest, Join)
 	ASSERT_TRUE (!thread.IsRunning());
 }
 
+TEST(ThreadTest, SigEventTryWaitAlreadySet)
+{
+	// the event is set before the wait, pthread_cond_timedwait() is never called
+	CxxAbb::Sys::SigEvent autoReset;
+	autoReset.Set();
+	ASSERT_TRUE (autoReset.TryWait(0));
+	ASSERT_FALSE (autoReset.TryWait(0));
+
+	CxxAbb::Sys::SigEvent manualReset(false);
+	manualReset.Set();
+	ASSERT_TRUE (manualReset.TryWait(0));
+	ASSERT_TRUE (manualReset.TryWait(0));
+	manualReset.Reset();
+	ASSERT_FALSE (manualReset.TryWait(10));
+}
+
+TEST(ThreadTest, WaitConditionSignal)
+{
+	CxxAbb::Sys::FastMutex mutex;
+	CxxAbb::Sys::WaitCondition condition;
+	WaitRunnable r1(mutex, condition);
+	WaitRunnable r2(mutex, condition);
+	CxxAbb::Sys::Thread thread1;
+	CxxAbb::Sys::Thread thread2;
+
+	thread1.Start(r1);
+	thread2.Start(r2);
+	CxxAbb::Sys::Thread::Sleep(200);
+	ASSERT_TRUE (thread1.IsRunning());
+	ASSERT_TRUE (thread2.IsRunning());
+
+	// every Signal() must wake a distinct waiter
+	condition.Signal();
+	condition.Signal();
+	ASSERT_TRUE (thread1.TryJoin(500));
+	ASSERT_TRUE (thread2.TryJoin(500));
+}
+
+TEST(ThreadTest, WaitConditionFifo)
+{
+	WakeOrder order;
+	OrderedWaitRunnable r0(order, 0);
+	OrderedWaitRunnable r1(order, 1);
+	OrderedWaitRunnable r2(order, 2);
+	CxxAbb::Runnable * runnables[3] = { &r0, &r1, &r2 };
+	CxxAbb::Sys::Thread threads[3];
+
+	for (int i = 0; i < 3; ++i)
+	{
+		threads[i].Start(*runnables[i]);
+		WaitForCount(order.m_Mutex, order.i_Queued, i + 1);
+	}
+
+	// Signal() wakes the longest waiting thread first
+	for (int i = 0; i < 3; ++i)
+	{
+		order.m_Condition.Signal();
+		WaitForCount(order.m_Mutex, order.i_Woken, i + 1);
+		EXPECT_EQ (i, order.a_Woken[i]);
+	}
+	for (int i = 0; i < 3; ++i)
+		threads[i].Join();
+}
+
 TEST(ThreadTest, ThreadFunc)
 {
 
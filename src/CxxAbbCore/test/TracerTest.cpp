@@ -0,0 +1,124 @@
+/**
+ *                                                             _|        _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *                     _|          _|_|      _|_|    _|    _|  _|    _|  _|    _|
+ *                     _|        _|    _|  _|    _|  _|    _|  _|    _|  _|    _|
+ *                       _|_|_|  _|    _|  _|    _|    _|_|_|  _|_|_|    _|_|_|
+ *
+ *                              CxxABB - C++ Application Building Blocks
+ *
+ *                     Copyright (C) 2017 Prabodha Srimal <prabodha007@gmail.com>
+ *
+ *
+ * TracerTest.cpp
+ *
+ * FileId      : $Id$
+ *
+ * Created by  : Prabodha Srimal <prabodha007@gmail.com> - Oct 19, 2026
+ * Edited by   : $Author$
+ * Edited date : $Date$
+ * Version     : $Revision$
+ *
+ * Library     : CxxAbbCore
+ * Module      : Trace
+ * Comment     : Event tracer unit tests
+ *
+ */
+
+
+#include <CxxAbb/Trace/Tracer.h>
+#include <CxxAbb/Sys/Thread.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+
+
+namespace
+{
+
+const char * TraceFile = "/tmp/CxxAbbTracerTest.json";
+
+std::string ReadFile(const char * _zPath)
+{
+	std::ifstream file(_zPath);
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+std::size_t Occurrences(const std::string & _sText, const std::string & _sWhat)
+{
+	std::size_t tCount = 0;
+	for (std::size_t tPos = _sText.find(_sWhat); tPos != std::string::npos; tPos = _sText.find(_sWhat, tPos + 1))
+		++tCount;
+	return tCount;
+}
+
+void Work(void *)
+{
+	for (int i = 0; i < 10; ++i)
+	{
+		CXXABB_TRACE_SCOPE("Work");
+		CXXABB_TRACE_INSTANT("Tick");
+		CXXABB_TRACE_COUNTER("Progress", i);
+	}
+}
+
+}
+
+TEST(TracerTest, ChromeTrace)
+{
+	CxxAbb::Trace::Tracer::Start(TraceFile, 10);
+	ASSERT_TRUE (CxxAbb::Trace::Tracer::IsEnabled());
+	ASSERT_THROW (CxxAbb::Trace::Tracer::Start(TraceFile), CxxAbb::IllegalStateException);
+
+	{
+		CXXABB_TRACE_SCOPE("Main \"quoted\"");
+		CxxAbb::Sys::Thread worker("TraceWorker");
+		worker.Start(Work, CxxAbb::NullPtr);
+		worker.Join();
+	}
+	CxxAbb::Sys::Thread::Sleep(30);
+	CxxAbb::Trace::Tracer::Stop();
+	ASSERT_FALSE (CxxAbb::Trace::Tracer::IsEnabled());
+
+	ASSERT_EQ (0U, CxxAbb::Trace::Tracer::Dropped());
+	ASSERT_EQ (31U, CxxAbb::Trace::Tracer::Written());
+
+	std::string sTrace = ReadFile(TraceFile);
+	ASSERT_EQ ('[', sTrace[0]);
+	ASSERT_EQ ("]\n", sTrace.substr(sTrace.size() - 2));
+	ASSERT_EQ (11U, Occurrences(sTrace, "\"ph\":\"X\""));
+	ASSERT_EQ (10U, Occurrences(sTrace, "{\"name\":\"Tick\",\"ph\":\"i\""));
+	ASSERT_EQ (10U, Occurrences(sTrace, "{\"name\":\"Progress\",\"ph\":\"C\""));
+	ASSERT_EQ (1U, Occurrences(sTrace, "\"args\":{\"name\":\"TraceWorker\"}"));
+	ASSERT_EQ (1U, Occurrences(sTrace, "Main \\\"quoted\\\""));
+
+	// disabled: nothing recorded
+	Work(CxxAbb::NullPtr);
+	CxxAbb::Trace::Tracer::Stop();
+	std::remove(TraceFile);
+}
+
+void WorkTenTimes(void *)
+{
+	for (int i = 0; i < 10; ++i)
+		Work(CxxAbb::NullPtr);
+}
+
+TEST(TracerTest, FullRingDrops)
+{
+	// long flush period: nothing is drained before Stop()
+	CxxAbb::Trace::Tracer::Start(TraceFile, 60000, 64);
+	CxxAbb::Sys::Thread worker;
+	worker.Start(WorkTenTimes, CxxAbb::NullPtr);
+	worker.Join();
+	CxxAbb::Trace::Tracer::Stop();
+
+	ASSERT_EQ (64U, CxxAbb::Trace::Tracer::Written());
+	ASSERT_EQ (300U - 64U, CxxAbb::Trace::Tracer::Dropped());
+	std::remove(TraceFile);
+}